@@ -65,3 +65,24 @@ if(EL_HAVE_OPENMP)
 else()
   set(EL_HAVE_OMP_SIMD FALSE)
 endif()
+
+# See if we have 'taskloop' support, which was introduced in OpenMP 4.5
+if(EL_HAVE_OPENMP)
+  set(CMAKE_REQUIRED_FLAGS ${OpenMP_CXX_FLAGS})
+  set(OMP_TASKLOOP_CODE
+      "#include <omp.h>
+       int main( int argc, char* argv[] ) 
+       {
+           int k[10];
+       #pragma omp parallel
+       #pragma omp single
+       #pragma omp taskloop default(shared) if(argc > 0)
+           for( int i=0; i<10; ++i )
+               k[i] = i;
+           return 0; 
+       }")
+  check_cxx_source_compiles("${OMP_TASKLOOP_CODE}" EL_HAVE_OMP_TASKLOOP)
+  set(CMAKE_REQUIRED_FLAGS)
+else()
+  set(EL_HAVE_OMP_TASKLOOP FALSE)
+endif()
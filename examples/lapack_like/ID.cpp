@@ -24,6 +24,10 @@ int main( int argc, char* argv[] )
           El::Input("--maxSteps","max # of steps of QR",10);
         const Real tol = El::Input("--tol","tolerance for ID",Real(-1));
         const bool print = El::Input("--print","print matrices?",false);
+        const bool randomized =
+          El::Input("--randomized","sketch A before pivoting?",false);
+        const El::Int numPowerIts =
+          El::Input("--numPowerIts","number of subspace iterations",1);
         const bool smallestFirst =
           El::Input("--smallestFirst","smallest norm first?",false);
         El::ProcessInput();
@@ -54,7 +58,16 @@ int main( int argc, char* argv[] )
         El::Timer timer;
         if( El::mpi::Rank(comm) == 0 )
             timer.Start();
-        El::ID( A, Omega, Z, ctrl );
+        if( randomized )
+        {
+            El::RandomizedCtrl<Real> randCtrl;
+            randCtrl.rank = maxSteps;
+            randCtrl.numPowerIts = numPowerIts;
+            randCtrl.qrCtrl = ctrl;
+            El::RandomizedID( A, Omega, Z, randCtrl );
+        }
+        else
+            El::ID( A, Omega, Z, ctrl );
         if( El::mpi::Rank(comm) == 0 )
             timer.Stop();
         const El::Int rank = Z.Height();
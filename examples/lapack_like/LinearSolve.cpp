@@ -25,6 +25,10 @@ int main( int argc, char* argv[] )
         const El::Int blocksize =
           El::Input("--blocksize","algorithmic blocksize",64);
         const El::Int numTests = El::Input("--numTests","number of tests",3);
+        const bool mixed =
+          El::Input("--mixed","factor in single precision and refine?",false);
+        const bool gmres =
+          El::Input("--gmres","use GMRES-based refinement?",false);
         const bool error = El::Input("--error","test Elemental error?",true);
         El::Int gridHeight = El::Input("--gridHeight","grid height",0);
         const bool details = El::Input("--details","print norm details?",false);
@@ -63,10 +67,32 @@ int main( int argc, char* argv[] )
             El::mpi::Barrier( comm );
             if( commRank == 0 )
                 timer.Start();
-            El::LinearSolve( A, X );
-            El::mpi::Barrier( comm );
-            if( commRank == 0 )
-                El::Output(timer.Stop()," seconds");
+            if( mixed )
+            {
+                El::MixedPrecisionCtrl<Real> ctrl;
+                if( gmres )
+                    ctrl.refine = El::MIXED_REFINE_GMRES;
+                auto info = El::LinearSolve( A, X, ctrl );
+                El::mpi::Barrier( comm );
+                if( commRank == 0 )
+                {
+                    El::Output(timer.Stop()," seconds");
+                    El::Output
+                    ("Refinement ",(info.converged ? "converged" : "failed"),
+                     " after ",info.numRefineIts," iterations (",
+                     info.numGMRESIts," GMRES iterations) with backward "
+                     "error ",info.backwardError);
+                    if( info.fellBack )
+                        El::Output("Fell back to a full-precision solve");
+                }
+            }
+            else
+            {
+                El::LinearSolve( A, X );
+                El::mpi::Barrier( comm );
+                if( commRank == 0 )
+                    El::Output(timer.Stop()," seconds");
+            }
 
             if( error )
             {
@@ -85,6 +85,10 @@ main( int argc, char* argv[] )
         const bool arnoldi = El::Input("--arnoldi","use Arnoldi?",true);
         const El::Int basisSize =
           El::Input("--basisSize","num Arnoldi vectors",10);
+        const El::Int numSubgrids =
+          El::Input("--numSubgrids","num subgrids for shift batches",1);
+        const El::Int shiftBatchSize =
+          El::Input("--shiftBatchSize","shifts per batch (0: auto)",0);
         const El::Int maxIts =
           El::Input("--maxIts","maximum pseudospec iter's",200);
         const Real psTol =
@@ -276,6 +280,8 @@ main( int argc, char* argv[] )
         psCtrl.deflate = deflate;
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
+        psCtrl.numSubgrids = numSubgrids;
+        psCtrl.shiftBatchSize = shiftBatchSize;
         psCtrl.progress = progress;
         psCtrl.schurCtrl.hessSchurCtrl.scalapack = false;
         psCtrl.schurCtrl.hessSchurCtrl.fullTriangle = true;
@@ -25,6 +25,10 @@ main( int argc, char* argv[] )
         El::Int maxSteps = El::Input("--maxSteps","max # of steps of QR",10);
         const Real tol = El::Input("--tol","tolerance for ID",Real(-1));
         const bool print = El::Input("--print","print matrices?",false);
+        const bool randomized =
+          El::Input("--randomized","sketch A before pivoting?",false);
+        const El::Int numPowerIts =
+          El::Input("--numPowerIts","number of subspace iterations",1);
         El::ProcessInput();
         El::PrintInputReport();
 
@@ -56,7 +60,16 @@ main( int argc, char* argv[] )
         El::Timer timer;
         if( El::mpi::Rank(comm) == 0 )
             timer.Start();
-        El::Skeleton( A, PR, PC, Z, ctrl );
+        if( randomized )
+        {
+            El::RandomizedCtrl<Real> randCtrl;
+            randCtrl.rank = maxSteps;
+            randCtrl.numPowerIts = numPowerIts;
+            randCtrl.qrCtrl = ctrl;
+            El::RandomizedSkeleton( A, PR, PC, Z, randCtrl );
+        }
+        else
+            El::Skeleton( A, PR, PC, Z, ctrl );
         if( El::mpi::Rank(comm) == 0 )
             timer.Stop();
         const El::Int rank = Z.Height();
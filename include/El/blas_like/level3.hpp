@@ -182,6 +182,88 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// C := A B, where all three matrices are sparse. The sparsity pattern of C is
+// formed (using a hash table for each row) before its values are accumulated,
+// and both phases are threaded over the rows of C. In the distributed case,
+// each process first gathers the rows of B required by its rows of A.
+template<typename T>
+void Multiply
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C );
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C );
+
+// Repeatedly form C := A diag(d) A^T (or A diag(d) A^H) for a fixed sparse
+// matrix A and varying d, as is required by the normal equations of interior
+// point methods. The sparsity pattern of C (which always includes the
+// diagonal) and, in the distributed case, the rows of A^T needed by each
+// process are computed once by 'Initialize', so that each call to 'Form'
+// only exchanges the required entries of d and recomputes the values of C.
+template<typename T>
+class NormalMatrixPlan
+{
+public:
+    void Initialize
+    ( const SparseMatrix<T>& A, bool onlyLower=false, bool conjugate=false );
+
+    // If C already has the sparsity pattern of the product, only its values
+    // are overwritten
+    void Form( const Matrix<T>& d, SparseMatrix<T>& C ) const;
+
+    bool Initialized() const EL_NO_EXCEPT;
+    bool OnlyLower() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int NumEntries() const EL_NO_EXCEPT;
+
+private:
+    bool initialized_=false;
+    bool onlyLower_=false;
+    SparseMatrix<T> A_, AAdj_;
+    vector<Int> offsets_, targets_;
+};
+
+template<typename T>
+class DistNormalMatrixPlan
+{
+public:
+    void Initialize
+    ( const DistSparseMatrix<T>& A,
+      bool onlyLower=false, bool conjugate=false );
+
+    // If C already has the sparsity pattern of the product, only its values
+    // are overwritten
+    void Form( const DistMultiVec<T>& d, DistSparseMatrix<T>& C ) const;
+
+    bool Initialized() const EL_NO_EXCEPT;
+    bool OnlyLower() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int NumLocalEntries() const EL_NO_EXCEPT;
+
+private:
+    bool initialized_=false;
+    bool onlyLower_=false;
+    const El::Grid* grid_=nullptr;
+    Int height_=0, width_=0;
+
+    // Our rows of A (with the targets replaced by the indices of the gathered
+    // rows of A^T) and the communication pattern for gathering d
+    vector<Int> AOffsets_, ATargets_;
+    vector<T> AValues_;
+    DistGraphMultMeta meta_;
+
+    // The rows of A^T (or A^H) indexed by the targets of our rows of A
+    vector<Int> AAdjOffsets_, AAdjTargets_;
+    vector<T> AAdjValues_;
+
+    vector<Int> offsets_, targets_;
+};
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
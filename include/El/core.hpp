@@ -276,6 +276,7 @@ class DistMatrix;
 #include <El/core/Graph/decl.hpp>
 #include <El/core/DistMap/decl.hpp>
 #include <El/core/DistGraph/decl.hpp>
+#include <El/core/SparseMatrix/AssemblyPlan.hpp>
 #include <El/core/SparseMatrix/decl.hpp>
 #include <El/core/DistSparseMatrix/decl.hpp>
 #include <El/core/DistMultiVec/decl.hpp>
@@ -301,6 +302,7 @@ class DistMatrix;
 
 // TODO: Sequential map
 //#include <El/core/Map.hpp>
+#include <El/core/Graph/Assemble.hpp>
 #include <El/core/SparseMatrix/impl.hpp>
 
 #include <El/core/DistMap.hpp>
@@ -88,6 +88,25 @@ public:
     void ProcessQueues();
     void ProcessLocalQueues();
 
+    // Repeated assembly into a fixed sparsity pattern
+    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+    // Each (rows[k],cols[k]) must be a member of the (locally consistent)
+    // sparsity pattern, and 'values' must hold one value per update of the
+    // plan. As with QueueUpdate, updates of rows owned by other processes
+    // are ignored if 'passive' is true. Unless the plan is passive, forming
+    // and executing it are collective. If 'accumulate' is false, the local
+    // values are zeroed first.
+    DistSparseAssemblyPlan FormAssemblyPlan
+    ( const vector<Int>& rows, const vector<Int>& cols,
+      bool passive=false ) const;
+    DistSparseAssemblyPlan FormElementAssemblyPlan
+    ( const vector<Int>& elementOffsets,
+      const vector<Int>& elementIndices,
+      bool passive=false ) const;
+    void Assemble
+    ( const DistSparseAssemblyPlan& plan, const vector<Ring>& values,
+      bool accumulate=true );
+
     // Operator overloading
     // ====================
 
@@ -333,64 +333,157 @@ void DistSparseMatrix<Ring>::ProcessLocalQueues()
     if( distGraph_.locallyConsistent_ )
         return;
 
-    Int numRemoved = 0;
-    const Int numLocalEntries = vals_.size();
-    vector<Entry<Ring>> entries( numLocalEntries );
-    if( distGraph_.markedForRemoval_.size() != 0 )
+    sparse_assembly::SortAndCombine
+    ( distGraph_.FirstLocalSource(), distGraph_.numLocalSources_,
+      distGraph_.sources_, distGraph_.targets_, &vals_,
+      distGraph_.markedForRemoval_, distGraph_.localSourceOffsets_ );
+    SwapClear( distGraph_.markedForRemoval_ );
+    distGraph_.locallyConsistent_ = true;
+}
+
+template<typename Ring>
+DistSparseAssemblyPlan DistSparseMatrix<Ring>::FormAssemblyPlan
+( const vector<Int>& rows, const vector<Int>& cols, bool passive ) const
+{
+    EL_DEBUG_CSE
+    if( rows.size() != cols.size() )
+        LogicError("Inconsistent numbers of rows and columns");
+    AssertLocallyConsistent();
+    const Int height = Height();
+    const Int width = Width();
+    const Int firstLocalRow = FirstLocalRow();
+    const Int localHeight = LocalHeight();
+    const Int numLocalEntries = NumLocalEntries();
+    mpi::Comm comm = Grid().Comm();
+    const int commSize = Grid().Size();
+
+    auto localOffset = [&]( Int row, Int col )
     {
-        for( Int s=0; s<numLocalEntries; ++s )
+        // The offset of an absent entry may lie at the end of the row, which
+        // is the beginning of the next row
+        const Int localRow = row - firstLocalRow;
+        const Int index = Offset( localRow, col );
+        if( index == RowOffset(localRow+1) ||
+            distGraph_.targets_[index] != col )
+            LogicError("(",row,",",col,") is not in the sparsity pattern");
+        return index;
+    };
+
+    DistSparseAssemblyPlan plan;
+    plan.numUpdates = rows.size();
+    plan.numLocalEntries = numLocalEntries;
+    plan.passive = passive;
+    plan.sendSizes.resize( commSize, 0 );
+    for( Int k=0; k<plan.numUpdates; ++k )
+    {
+        const Int row = rows[k];
+        const Int col = cols[k];
+        if( row < 0 || row >= height || col < 0 || col >= width )
+            LogicError
+            ("(",row,",",col,") is out of bounds of ",height," x ",width,
+             " matrix");
+        if( row >= firstLocalRow && row < firstLocalRow+localHeight )
         {
-            pair<Int,Int> candidate(distGraph_.sources_[s],
-                                    distGraph_.targets_[s]);
-            if( distGraph_.markedForRemoval_.find(candidate) ==
-                distGraph_.markedForRemoval_.end() )
-            {
-                entries[s-numRemoved].i = distGraph_.sources_[s];
-                entries[s-numRemoved].j = distGraph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
-            }
+            plan.localUpdates.push_back( k );
+            plan.localOffsets.push_back( localOffset(row,col) );
         }
-        SwapClear( distGraph_.markedForRemoval_ );
-        entries.resize( numLocalEntries-numRemoved );
+        else if( !passive )
+            ++plan.sendSizes[RowOwner(row)];
     }
-    else
+    if( passive )
     {
-        for( Int s=0; s<numLocalEntries; ++s )
-            entries[s] = Entry<Ring>{distGraph_.sources_[s],
-                                  distGraph_.targets_[s],vals_[s]};
+        SwapClear( plan.sendSizes );
+        return plan;
     }
-    std::sort( entries.begin(), entries.end(), CompareEntries );
-    const Int numSorted = entries.size();
 
-    // Combine duplicates
-    // ------------------
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
+    // Pack the remote updates by owner
+    // ================================
+    const int totalSend = Scan( plan.sendSizes, plan.sendOffs );
+    auto offs = plan.sendOffs;
+    plan.sendInds.resize( totalSend );
+    vector<Int> sendRows(totalSend), sendCols(totalSend);
+    for( Int k=0; k<plan.numUpdates; ++k )
     {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
+        const Int row = rows[k];
+        if( row >= firstLocalRow && row < firstLocalRow+localHeight )
+            continue;
+        const int owner = RowOwner(row);
+        plan.sendInds[offs[owner]] = k;
+        sendRows[offs[owner]] = row;
+        sendCols[offs[owner]] = cols[k];
+        ++offs[owner];
+    }
+
+    // Exchange the remote updates and locate the ones we received
+    // ===========================================================
+    plan.recvSizes.resize( commSize );
+    mpi::AllToAll
+    ( plan.sendSizes.data(), 1, plan.recvSizes.data(), 1, comm );
+    const int totalRecv = Scan( plan.recvSizes, plan.recvOffs );
+    auto recvRows =
+      mpi::AllToAll( sendRows, plan.sendSizes, plan.sendOffs, comm );
+    auto recvCols =
+      mpi::AllToAll( sendCols, plan.sendSizes, plan.sendOffs, comm );
+    plan.recvOffsets.resize( totalRecv );
+    for( Int i=0; i<totalRecv; ++i )
+        plan.recvOffsets[i] = localOffset( recvRows[i], recvCols[i] );
+
+    return plan;
+}
+
+template<typename Ring>
+DistSparseAssemblyPlan DistSparseMatrix<Ring>::FormElementAssemblyPlan
+( const vector<Int>& elementOffsets,
+  const vector<Int>& elementIndices,
+  bool passive ) const
+{
+    EL_DEBUG_CSE
+    vector<Int> rows, cols;
+    ElementUpdates( elementOffsets, elementIndices, rows, cols );
+    return FormAssemblyPlan( rows, cols, passive );
+}
+
+template<typename Ring>
+void DistSparseMatrix<Ring>::Assemble
+( const DistSparseAssemblyPlan& plan,
+  const vector<Ring>& values,
+  bool accumulate )
+{
+    EL_DEBUG_CSE
+    if( Int(values.size()) != plan.numUpdates )
+        LogicError
+        ("Expected ",plan.numUpdates," values but received ",values.size());
+    if( !LocallyConsistent() || NumLocalEntries() != plan.numLocalEntries )
+        LogicError("The sparsity pattern changed after forming the plan");
+    if( !accumulate )
+        std::fill( vals_.begin(), vals_.end(), Ring(0) );
+
+    // Pack the remote updates
+    vector<Ring> sendVals, recvVals;
+    if( !plan.passive )
+    {
+        const Int totalSend = plan.sendInds.size();
+        sendVals.resize( totalSend );
+        for( Int i=0; i<totalSend; ++i )
+            sendVals[i] = values[plan.sendInds[i]];
+        recvVals.resize( plan.recvOffsets.size() );
     }
-    const Int numUnique = lastUnique+1;
 
-    entries.resize( numUnique );
-    distGraph_.sources_.resize( numUnique );
-    distGraph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
-    for( Int s=0; s<numUnique; ++s )
+    Ring* valBuf = vals_.data();
+    const Int numLocalUpdates = plan.localUpdates.size();
+    for( Int i=0; i<numLocalUpdates; ++i )
+        valBuf[plan.localOffsets[i]] += values[plan.localUpdates[i]];
+
+    if( !plan.passive )
     {
-        distGraph_.sources_[s] = entries[s].i;
-        distGraph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
+        mpi::AllToAll
+        ( sendVals.data(), plan.sendSizes.data(), plan.sendOffs.data(),
+          recvVals.data(), plan.recvSizes.data(), plan.recvOffs.data(),
+          Grid().Comm() );
+        const Int totalRecv = recvVals.size();
+        for( Int i=0; i<totalRecv; ++i )
+            valBuf[plan.recvOffsets[i]] += recvVals[i];
     }
-    distGraph_.ComputeSourceOffsets();
-    distGraph_.locallyConsistent_ = true;
 }
 
 // Operator overloading
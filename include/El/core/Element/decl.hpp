@@ -152,6 +152,25 @@ template<typename Real> struct PromoteHelper<Complex<Real>>
 
 template<typename Field> using Promote = typename PromoteHelper<Field>::type;
 
+// Decrease the precision (if possible)
+// ------------------------------------
+template<typename Field> struct DemoteHelper { typedef Field type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+
+#ifdef EL_HAVE_QD
+template<> struct DemoteHelper<DoubleDouble> { typedef double type; };
+template<> struct DemoteHelper<QuadDouble> { typedef DoubleDouble type; };
+#endif
+
+#ifdef EL_HAVE_QUAD
+template<> struct DemoteHelper<Quad> { typedef double type; };
+#endif
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+
+template<typename Field> using Demote = typename DemoteHelper<Field>::type;
+
 template<typename S,typename T>
 struct CanCast
 {
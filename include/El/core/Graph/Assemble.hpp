@@ -0,0 +1,231 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_GRAPH_ASSEMBLE_HPP
+#define EL_GRAPH_ASSEMBLE_HPP
+
+namespace El {
+namespace sparse_assembly {
+
+// Convert the queued (source,target) pairs -- and, if 'values' is non-null,
+// their corresponding values -- into compressed sparse row form: the pairs
+// marked for removal are dropped, the remainder are sorted by source and
+// then target, and duplicates are combined by summing their values (in the
+// order in which they were queued). The sources are assumed to lie within
+// [firstSource,firstSource+numSources), and 'offsets' is overwritten with
+// the numSources+1 offsets of the sources.
+//
+// Rather than sorting an array of triplets with a comparison sort, the
+// pairs are bucketed by their source using a (stable) parallel counting sort
+// and each row is then independently sorted by target (if it is not
+// already) and compressed.
+template<typename Ring>
+void SortAndCombine
+(       Int firstSource,
+        Int numSources,
+        vector<Int>& sources,
+        vector<Int>& targets,
+        vector<Ring>* values,
+  const set<pair<Int,Int>>& markedForRemoval,
+        vector<Int>& offsets )
+{
+    EL_DEBUG_CSE
+    const Int numQueued = sources.size();
+    const bool haveValues = ( values != nullptr );
+    EL_DEBUG_ONLY(
+      if( Int(targets.size()) != numQueued ||
+          (haveValues && Int(values->size()) != numQueued) )
+          LogicError("Inconsistent queue sizes");
+      for( Int e=0; e<numQueued; ++e )
+          if( sources[e] < firstSource ||
+              sources[e] >= firstSource+numSources )
+              LogicError
+              ("Source ",sources[e]," was not in [",firstSource,",",
+               firstSource+numSources,")");
+    )
+
+    // Flag the pairs which were marked for removal
+    vector<char> keep;
+    const bool removals = !markedForRemoval.empty();
+    if( removals )
+    {
+        keep.resize( numQueued );
+        EL_PARALLEL_FOR
+        for( Int e=0; e<numQueued; ++e )
+        {
+            const pair<Int,Int> candidate(sources[e],targets[e]);
+            keep[e] = ( markedForRemoval.find(candidate) ==
+                        markedForRemoval.end() );
+        }
+    }
+
+    // Each chunk of the queue requires its own histogram of the sources, so
+    // the number of chunks is limited such that the histograms are no larger
+    // than the queue
+#ifdef EL_HYBRID
+    const Int maxThreads = omp_get_max_threads();
+#else
+    const Int maxThreads = 1;
+#endif
+    const Int numChunks =
+      Max( Min( maxThreads, numQueued/Max(numSources,Int(1)) ), Int(1) );
+    const Int chunkSize = ( numQueued+numChunks-1 ) / numChunks;
+
+    // Count the number of (kept) pairs from each chunk with each source
+    vector<Int> positions( numChunks*numSources, 0 );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numChunks; ++c )
+    {
+        const Int first = c*chunkSize;
+        const Int last = Min( first+chunkSize, numQueued );
+        Int* chunkCounts = &positions[c*numSources];
+        for( Int e=first; e<last; ++e )
+            if( !removals || keep[e] )
+                ++chunkCounts[sources[e]-firstSource];
+    }
+
+    // Convert the counts into the positions where each chunk begins writing
+    // the pairs for each source
+    offsets.resize( numSources+1 );
+    Int numKept = 0;
+    for( Int s=0; s<numSources; ++s )
+    {
+        offsets[s] = numKept;
+        for( Int c=0; c<numChunks; ++c )
+        {
+            const Int count = positions[c*numSources+s];
+            positions[c*numSources+s] = numKept;
+            numKept += count;
+        }
+    }
+    offsets[numSources] = numKept;
+
+    // Stably scatter the targets and values into their rows
+    vector<Int> rowTargets( numKept );
+    vector<Ring> rowValues( haveValues ? numKept : 0 );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numChunks; ++c )
+    {
+        const Int first = c*chunkSize;
+        const Int last = Min( first+chunkSize, numQueued );
+        Int* chunkPositions = &positions[c*numSources];
+        for( Int e=first; e<last; ++e )
+        {
+            if( removals && !keep[e] )
+                continue;
+            const Int pos = chunkPositions[sources[e]-firstSource]++;
+            rowTargets[pos] = targets[e];
+            if( haveValues )
+                rowValues[pos] = (*values)[e];
+        }
+    }
+    SwapClear( positions );
+    SwapClear( keep );
+
+    // Sort each row by target and combine its duplicates in place
+    vector<Int> numUnique( numSources );
+    const Int numRowChunks = Min( 4*maxThreads, Max(numSources,Int(1)) );
+    const Int rowChunkSize = ( numSources+numRowChunks-1 ) / numRowChunks;
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int c=0; c<numRowChunks; ++c )
+    {
+        vector<Int> perm, targetsCopy;
+        vector<Ring> valuesCopy;
+        const Int firstRow = c*rowChunkSize;
+        const Int lastRow = Min( firstRow+rowChunkSize, numSources );
+        for( Int s=firstRow; s<lastRow; ++s )
+        {
+            const Int rowOffset = offsets[s];
+            const Int rowSize = offsets[s+1] - rowOffset;
+            Int* rowTargetBuf = &rowTargets[rowOffset];
+            Ring* rowValueBuf =
+              ( haveValues ? &rowValues[rowOffset] : nullptr );
+
+            bool sorted = true;
+            for( Int k=1; k<rowSize; ++k )
+            {
+                if( rowTargetBuf[k-1] > rowTargetBuf[k] )
+                {
+                    sorted = false;
+                    break;
+                }
+            }
+            if( !sorted )
+            {
+                perm.resize( rowSize );
+                for( Int k=0; k<rowSize; ++k )
+                    perm[k] = k;
+                std::stable_sort
+                ( perm.begin(), perm.end(),
+                  [&]( Int k0, Int k1 )
+                  { return rowTargetBuf[k0] < rowTargetBuf[k1]; } );
+                targetsCopy.assign( rowTargetBuf, rowTargetBuf+rowSize );
+                for( Int k=0; k<rowSize; ++k )
+                    rowTargetBuf[k] = targetsCopy[perm[k]];
+                if( haveValues )
+                {
+                    valuesCopy.assign( rowValueBuf, rowValueBuf+rowSize );
+                    for( Int k=0; k<rowSize; ++k )
+                        rowValueBuf[k] = valuesCopy[perm[k]];
+                }
+            }
+
+            Int rowUnique = 0;
+            for( Int k=0; k<rowSize; ++k )
+            {
+                const Int target = rowTargetBuf[k];
+                if( rowUnique > 0 && rowTargetBuf[rowUnique-1] == target )
+                {
+                    if( haveValues )
+                        rowValueBuf[rowUnique-1] += rowValueBuf[k];
+                }
+                else
+                {
+                    rowTargetBuf[rowUnique] = target;
+                    if( haveValues )
+                        rowValueBuf[rowUnique] = rowValueBuf[k];
+                    ++rowUnique;
+                }
+            }
+            numUnique[s] = rowUnique;
+        }
+    }
+
+    // Form the final offsets and compress the rows directly into the
+    // original buffers
+    vector<Int> rowOffsets( offsets );
+    Int numEntries = 0;
+    for( Int s=0; s<numSources; ++s )
+    {
+        offsets[s] = numEntries;
+        numEntries += numUnique[s];
+    }
+    offsets[numSources] = numEntries;
+    sources.resize( numEntries );
+    targets.resize( numEntries );
+    if( haveValues )
+        values->resize( numEntries );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int oldOffset = rowOffsets[s];
+        const Int newOffset = offsets[s];
+        for( Int k=0; k<numUnique[s]; ++k )
+        {
+            sources[newOffset+k] = firstSource + s;
+            targets[newOffset+k] = rowTargets[oldOffset+k];
+            if( haveValues )
+                (*values)[newOffset+k] = rowValues[oldOffset+k];
+        }
+    }
+}
+
+} // namespace sparse_assembly
+} // namespace El
+
+#endif // ifndef EL_GRAPH_ASSEMBLE_HPP
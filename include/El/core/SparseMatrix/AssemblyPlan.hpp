@@ -0,0 +1,89 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SPARSEMATRIX_ASSEMBLYPLAN_HPP
+#define EL_CORE_SPARSEMATRIX_ASSEMBLYPLAN_HPP
+
+namespace El {
+
+// Assembly plans cache the location of each of a fixed sequence of updates
+// within the (unchanging) sparsity pattern of a matrix so that the matrix
+// can be repeatedly reassembled with a flat scatter-add of the update values
+// rather than by searching within rows (or queueing, sorting, and
+// exchanging the updates).
+
+struct SparseAssemblyPlan
+{
+    Int numUpdates=0;
+    // The number of entries in the sparsity pattern the plan was formed for
+    Int numEntries=0;
+    // The offset into the value buffer of each update
+    vector<Int> offsets;
+};
+
+struct DistSparseAssemblyPlan
+{
+    Int numUpdates=0;
+    // The number of local entries the plan was formed for
+    Int numLocalEntries=0;
+    // Whether updates of rows owned by other processes were ignored
+    bool passive=false;
+
+    // The updates of locally-owned rows and their local value offsets
+    vector<Int> localUpdates, localOffsets;
+
+    // The persistent exchange pattern for updates of rows owned by other
+    // processes: the update indices in packing order, and the local value
+    // offsets of the updates received from other processes
+    vector<int> sendSizes, sendOffs,
+                recvSizes, recvOffs;
+    vector<Int> sendInds, recvOffsets;
+};
+
+// Expand a list of finite elements, where element e couples the indices
+// elementIndices[elementOffsets[e]:elementOffsets[e+1]], into the (row,col)
+// pairs of their dense element matrices. Each element matrix is traversed in
+// column-major order so that the update values may simply be the
+// concatenation of the (column-major) element matrices.
+inline void ElementUpdates
+( const vector<Int>& elementOffsets,
+  const vector<Int>& elementIndices,
+        vector<Int>& rows,
+        vector<Int>& cols )
+{
+    EL_DEBUG_CSE
+    const Int numElements = Max( Int(elementOffsets.size())-1, Int(0) );
+    Int numUpdates = 0;
+    for( Int e=0; e<numElements; ++e )
+    {
+        const Int elementSize = elementOffsets[e+1] - elementOffsets[e];
+        numUpdates += elementSize*elementSize;
+    }
+    rows.resize( numUpdates );
+    cols.resize( numUpdates );
+
+    Int update = 0;
+    for( Int e=0; e<numElements; ++e )
+    {
+        const Int first = elementOffsets[e];
+        const Int last = elementOffsets[e+1];
+        for( Int k=first; k<last; ++k )
+        {
+            for( Int l=first; l<last; ++l )
+            {
+                rows[update] = elementIndices[l];
+                cols[update] = elementIndices[k];
+                ++update;
+            }
+        }
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_SPARSEMATRIX_ASSEMBLYPLAN_HPP
@@ -68,6 +68,20 @@ public:
     void QueueZero( Int row, Int col ) EL_NO_RELEASE_EXCEPT;
     void ProcessQueues();
 
+    // Repeated assembly into a fixed sparsity pattern
+    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+    // Each (rows[k],cols[k]) must be a member of the (consistent) sparsity
+    // pattern, and 'values' must hold one value per update of the plan.
+    // If 'accumulate' is false, the matrix values are zeroed first.
+    SparseAssemblyPlan FormAssemblyPlan
+    ( const vector<Int>& rows, const vector<Int>& cols ) const;
+    SparseAssemblyPlan FormElementAssemblyPlan
+    ( const vector<Int>& elementOffsets,
+      const vector<Int>& elementIndices ) const;
+    void Assemble
+    ( const SparseAssemblyPlan& plan, const vector<Ring>& values,
+      bool accumulate=true );
+
     // Operator overloading
     // ====================
 
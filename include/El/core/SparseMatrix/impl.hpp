@@ -425,64 +425,74 @@ void SparseMatrix<Ring>::ProcessQueues()
     if( graph_.consistent_ )
         return;
 
-    Int numRemoved = 0;
-    const Int numEntries = vals_.size();
-    vector<Entry<Ring>> entries( numEntries );
-    if( graph_.markedForRemoval_.size() != 0 )
-    {
-        for( Int s=0; s<numEntries; ++s )
-        {
-            pair<Int,Int> candidate(graph_.sources_[s],graph_.targets_[s]);
-            if( graph_.markedForRemoval_.find(candidate) ==
-                graph_.markedForRemoval_.end() )
-            {
-                entries[s-numRemoved].i = graph_.sources_[s];
-                entries[s-numRemoved].j = graph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
-            }
-        }
-        graph_.markedForRemoval_.clear();
-        entries.resize( numEntries-numRemoved );
-    }
-    else
-    {
-        for( Int s=0; s<numEntries; ++s )
-            entries[s] =
-              Entry<Ring>{graph_.sources_[s],graph_.targets_[s],vals_[s]};
-    }
-    CompareEntriesFunctor comparer;
-    std::sort( entries.begin(), entries.end(), comparer );
-    const Int numSorted = entries.size();
+    sparse_assembly::SortAndCombine
+    ( 0, graph_.numSources_, graph_.sources_, graph_.targets_, &vals_,
+      graph_.markedForRemoval_, graph_.sourceOffsets_ );
+    graph_.markedForRemoval_.clear();
+    graph_.consistent_ = true;
+}
 
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
+template<typename Ring>
+SparseAssemblyPlan SparseMatrix<Ring>::FormAssemblyPlan
+( const vector<Int>& rows, const vector<Int>& cols ) const
+{
+    EL_DEBUG_CSE
+    if( rows.size() != cols.size() )
+        LogicError("Inconsistent numbers of rows and columns");
+    AssertConsistent();
+    const Int height = Height();
+    const Int width = Width();
+    const Int numEntries = NumEntries();
+
+    SparseAssemblyPlan plan;
+    plan.numUpdates = rows.size();
+    plan.numEntries = numEntries;
+    plan.offsets.resize( plan.numUpdates );
+    for( Int k=0; k<plan.numUpdates; ++k )
     {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
+        const Int row = rows[k];
+        const Int col = cols[k];
+        if( row < 0 || row >= height || col < 0 || col >= width )
+            LogicError
+            ("(",row,",",col,") is out of bounds of ",height," x ",width,
+             " matrix");
+        // The offset of an absent entry may lie at the end of the row, which
+        // is the beginning of the next row
+        const Int index = Offset( row, col );
+        if( index == RowOffset(row+1) || graph_.targets_[index] != col )
+            LogicError("(",row,",",col,") is not in the sparsity pattern");
+        plan.offsets[k] = index;
     }
-    const Int numUnique = lastUnique+1;
-    entries.resize( numUnique );
+    return plan;
+}
 
-    graph_.sources_.resize( numUnique );
-    graph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
-    for( Int s=0; s<numUnique; ++s )
-    {
-        graph_.sources_[s] = entries[s].i;
-        graph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
-    }
+template<typename Ring>
+SparseAssemblyPlan SparseMatrix<Ring>::FormElementAssemblyPlan
+( const vector<Int>& elementOffsets, const vector<Int>& elementIndices ) const
+{
+    EL_DEBUG_CSE
+    vector<Int> rows, cols;
+    ElementUpdates( elementOffsets, elementIndices, rows, cols );
+    return FormAssemblyPlan( rows, cols );
+}
 
-    graph_.ComputeSourceOffsets();
-    graph_.consistent_ = true;
+template<typename Ring>
+void SparseMatrix<Ring>::Assemble
+( const SparseAssemblyPlan& plan, const vector<Ring>& values, bool accumulate )
+{
+    EL_DEBUG_CSE
+    if( Int(values.size()) != plan.numUpdates )
+        LogicError
+        ("Expected ",plan.numUpdates," values but received ",values.size());
+    if( !Consistent() || NumEntries() != plan.numEntries )
+        LogicError("The sparsity pattern changed after forming the plan");
+    if( !accumulate )
+        std::fill( vals_.begin(), vals_.end(), Ring(0) );
+
+    Ring* valBuf = vals_.data();
+    const Int* offsetBuf = plan.offsets.data();
+    for( Int k=0; k<plan.numUpdates; ++k )
+        valBuf[offsetBuf[k]] += values[k];
 }
 
 template<typename Ring>
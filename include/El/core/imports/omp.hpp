@@ -9,9 +9,13 @@
 #ifndef EL_IMPORTS_OMP_HPP
 #define EL_IMPORTS_OMP_HPP
 
+#define EL_PRAGMA(...) _Pragma(#__VA_ARGS__)
+
 #ifdef EL_HYBRID
 # include <omp.h>
 # define EL_PARALLEL_FOR _Pragma("omp parallel for")
+// For loops whose iterations have widely varying costs
+# define EL_PARALLEL_FOR_DYNAMIC _Pragma("omp parallel for schedule(dynamic)")
 # ifdef EL_HAVE_OMP_COLLAPSE
 #  define EL_PARALLEL_FOR_COLLAPSE2 _Pragma("omp parallel for collapse(2)")
 # else
@@ -19,13 +23,39 @@
 # endif
 # ifdef EL_HAVE_OMP_SIMD
 #  define EL_SIMD _Pragma("omp simd")
+#  define EL_SIMD_REDUCTION(...) EL_PRAGMA(omp simd reduction(__VA_ARGS__))
 # else
 #  define EL_SIMD
+#  define EL_SIMD_REDUCTION(...)
+# endif
+// Task parallelism for recursive algorithms. Since the tasks are typically
+// spawned from (orphaned) routines, the variables of the spawning routine are
+// shared so that the results are visible after the taskwait.
+# define EL_PARALLEL_REGION _Pragma("omp parallel")
+# define EL_SINGLE _Pragma("omp single")
+# define EL_TASK_IF(cond) EL_PRAGMA(omp task default(shared) if(cond))
+// Loop indices must be copied into the tasks they spawn (rather than shared)
+# define EL_TASK_IF_FIRSTPRIVATE(cond,...) \
+  EL_PRAGMA(omp task default(shared) firstprivate(__VA_ARGS__) if(cond))
+# define EL_TASKWAIT _Pragma("omp taskwait")
+# ifdef EL_HAVE_OMP_TASKLOOP
+#  define EL_TASKLOOP_IF(cond) \
+   EL_PRAGMA(omp taskloop default(shared) if(cond))
+# else
+#  define EL_TASKLOOP_IF(cond) EL_PRAGMA(omp parallel for if(cond))
 # endif
 #else
 # define EL_PARALLEL_FOR 
+# define EL_PARALLEL_FOR_DYNAMIC
 # define EL_PARALLEL_FOR_COLLAPSE2
 # define EL_SIMD
+# define EL_SIMD_REDUCTION(...)
+# define EL_PARALLEL_REGION
+# define EL_SINGLE
+# define EL_TASK_IF(cond)
+# define EL_TASK_IF_FIRSTPRIVATE(cond,...)
+# define EL_TASKWAIT
+# define EL_TASKLOOP_IF(cond)
 #endif
 
 #ifdef EL_AVOID_OMP_FMA
@@ -165,7 +165,8 @@ typedef enum
   EL_BUNCH_KAUFMAN_D,
   EL_BUNCH_KAUFMAN_BOUNDED,
   EL_BUNCH_PARLETT,
-  LDL_WITHOUT_PIVOTING
+  LDL_WITHOUT_PIVOTING,
+  EL_AASEN
   /* TODO(poulson): Diagonal pivoting? */
 } ElLDLPivotType;
 
@@ -748,6 +749,14 @@ EL_EXPORT ElError ElSolveAfterLQDist_z
 /* QR factorization
    ================ */
 
+typedef enum
+{
+  EL_CHOLESKY_QR,
+  EL_CHOLESKY_QR2,
+  EL_SHIFTED_CHOLESKY_QR3,
+  EL_CHOLESKY_QR_ADAPTIVE
+} ElCholeskyQRVariant;
+
 typedef struct
 {
     bool colPiv;
@@ -763,6 +772,9 @@ typedef struct
     /* TODO(poulson): Add Chan ratio */
 
     bool smallestFirst;
+
+    bool cholesky;
+    ElCholeskyQRVariant cholVariant;
 } ElQRCtrl_s;
 EL_EXPORT ElError ElQRCtrlDefault_s( ElQRCtrl_s* ctrl );
 
@@ -780,6 +792,9 @@ typedef struct
 
     /* TODO(poulson): Add Chan ratio */
     bool smallestFirst;
+
+    bool cholesky;
+    ElCholeskyQRVariant cholVariant;
 } ElQRCtrl_d;
 EL_EXPORT ElError ElQRCtrlDefault_d( ElQRCtrl_d* ctrl );
 
@@ -99,7 +99,8 @@ enum LDLPivotType
     BUNCH_KAUFMAN_D,
     BUNCH_KAUFMAN_BOUNDED,
     BUNCH_PARLETT,
-    LDL_WITHOUT_PIVOTING
+    LDL_WITHOUT_PIVOTING,
+    AASEN
     /* TODO(poulson): Diagonal pivoting? */
 };
 }
@@ -114,6 +115,8 @@ Real LDLPivotConstant( LDLPivotType pivType )
     case BUNCH_KAUFMAN_A:
     case BUNCH_PARLETT:   return (1+Sqrt(Real(17)))/8;
     case BUNCH_KAUFMAN_D: return Real(0.525);
+    // Bunch's tridiagonal pivoting threshold, (sqrt(5)-1)/2
+    case AASEN:           return (Sqrt(Real(5))-1)/2;
     default:
         LogicError("No default constant exists for this pivot type");
         return 0;
@@ -344,6 +347,29 @@ Int SolveAfter
 
 } // namespace reg_ldl
 
+// Solve a linear system with an incomplete factorization as a preconditioner
+// ==========================================================================
+namespace ldl {
+
+// Run FGMRES or LGMRES (as determined by 'ctrl.alg') preconditioned with the
+// incomplete factorization. Since the preconditioner is only approximate,
+// 'ctrl.maxIts' and 'ctrl.restart' should typically be increased from their
+// defaults (which are meant for regularized factorizations).
+template<typename Field>
+Int SolveAfter
+( const SparseMatrix<Field>& A,
+  const IncompleteLDLFactorization<Field>& incompleteFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+template<typename Field>
+Int SolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistIncompleteLDLFactorization<Field>& incompleteFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+
+} // namespace ldl
+
 // LU
 // ==
 
@@ -542,6 +568,19 @@ void Explicit( AbstractDistMatrix<Field>& L, AbstractDistMatrix<Field>& A );
 // QR factorization
 // ================
 
+namespace CholeskyQRVariantNS {
+enum CholeskyQRVariant
+{
+    CHOLESKY_QR,
+    CHOLESKY_QR2,
+    SHIFTED_CHOLESKY_QR3,
+    // Choose between CHOLESKY_QR2 and SHIFTED_CHOLESKY_QR3 based upon an
+    // estimate of the loss of orthogonality of a single CholeskyQR pass
+    CHOLESKY_QR_ADAPTIVE
+};
+}
+using namespace CholeskyQRVariantNS;
+
 template<typename Real>
 struct QRCtrl
 {
@@ -562,6 +601,13 @@ struct QRCtrl
     // instead, as it is often the case that one may desire a custom pivoting
     // rule.
     bool smallestFirst=false;
+
+    // Unpivoted, thin QR factorizations of tall-skinny matrices may instead
+    // be computed via CholeskyQR, which only requires a Herk, a small Cholesky
+    // factorization, a Trsm, and a single allreduce per pass (distributed
+    // matrices are redistributed into a [VC,STAR] distribution)
+    bool cholesky=false;
+    CholeskyQRVariant cholVariant=CHOLESKY_QR_ADAPTIVE;
 };
 
 // Return an implicit representation of Q and R such that A = Q R
@@ -594,6 +640,32 @@ void QR
   DistPermutation& Omega,
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>() );
 
+// Update the thin factorization A = Q R after appending the columns of C to A
+// ---------------------------------------------------------------------------
+template<typename Field>
+void QRAppendColumns
+(       Matrix<Field>& Q,
+        Matrix<Field>& R,
+  const Matrix<Field>& C );
+template<typename Field>
+void QRAppendColumns
+(       AbstractDistMatrix<Field>& Q,
+        AbstractDistMatrix<Field>& R,
+  const AbstractDistMatrix<Field>& C );
+
+// Update the thin factorization A = Q R after deleting a set of columns of A
+// --------------------------------------------------------------------------
+template<typename Field>
+void QRDeleteColumns
+(       Matrix<Field>& Q,
+        Matrix<Field>& R,
+  const vector<Int>& deletions );
+template<typename Field>
+void QRDeleteColumns
+(       AbstractDistMatrix<Field>& Q,
+        AbstractDistMatrix<Field>& R,
+  const vector<Int>& deletions );
+
 namespace qr {
 
 // Apply Q using its implicit representation
@@ -637,10 +709,25 @@ void SolveAfter
 
 // Cholesky-based QR
 // -----------------
+// A single pass loses orthogonality proportional to kappa_2(A)^2 eps. A second
+// pass (CholeskyQR2) restores orthogonality to O(eps) when kappa_2(A) is less
+// than roughly eps^{-1/2}, and a preliminary pass over a diagonally-shifted
+// Gram matrix (shifted CholeskyQR3) extends this to kappa_2(A) < O(eps^{-1}).
+//
+// The variants which accept a CholeskyQRVariant return the variant which was
+// actually run (which is only interesting for CHOLESKY_QR_ADAPTIVE).
 template<typename Field>
 void Cholesky( Matrix<Field>& A, Matrix<Field>& R );
 template<typename Field>
 void Cholesky( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+template<typename Field>
+CholeskyQRVariant Cholesky
+( Matrix<Field>& A, Matrix<Field>& R, CholeskyQRVariant variant );
+template<typename Field>
+CholeskyQRVariant Cholesky
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& R,
+  CholeskyQRVariant variant );
 
 // Return R (with non-negative diagonal) such that A = Q R or A Omega^T = Q R
 // --------------------------------------------------------------------------
@@ -900,6 +987,70 @@ void ExplicitTriang
 
 } // namespace grq
 
+// Randomized range finder
+// =======================
+// See N. Halko, P.G. Martinsson, and J.A. Tropp,
+// "Finding structure with randomness: Probabilistic algorithms for
+// constructing approximate matrix decompositions", SIAM Review, 53(2), 2011.
+
+namespace SketchTypeNS {
+enum SketchType
+{
+    // Multiply by an i.i.d. Gaussian matrix
+    GAUSSIAN_SKETCH,
+    // Multiply by a Subsampled Randomized Hadamard Transform, D H S, where D is
+    // a random diagonal sign matrix, H is a (zero-padded) Walsh-Hadamard
+    // transform, and S randomly samples columns. Sparse matrices always use
+    // Gaussian sketches.
+    SRHT_SKETCH
+};
+}
+using namespace SketchTypeNS;
+
+template<typename Real>
+struct RandomizedCtrl
+{
+    // The target rank, k
+    Int rank=10;
+    // The number of extra samples, p, so that k+p columns are sketched
+    Int oversample=10;
+    // The number of (orthogonalized) subspace iterations with A A^H
+    Int numPowerIts=1;
+    SketchType sketch=GAUSSIAN_SKETCH;
+
+    // Used for the orthonormalizations within RangeFinder (without column
+    // pivoting), e.g., to select CholeskyQR, and for the deterministic
+    // factorizations of the (small) sketches
+    QRCtrl<Real> qrCtrl;
+};
+
+// Return Q, with orthonormal columns, such that op(A) ~= Q Q^H op(A)
+// ------------------------------------------------------------------
+template<typename Field>
+void RangeFinder
+( Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& Q,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+template<typename Field>
+void RangeFinder
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& Q,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+template<typename Field>
+void RangeFinder
+( Orientation orientation,
+  const SparseMatrix<Field>& A,
+        Matrix<Field>& Q,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+template<typename Field>
+void RangeFinder
+( Orientation orientation,
+  const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& Q,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+
 // Interpolative Decomposition
 // ===========================
 template<typename Field>
@@ -930,6 +1081,21 @@ void ID
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>(),
   bool canOverwrite=false );
 
+// Compute the ID of a sketch of the row space of A, Q^H A, where Q is returned
+// from RangeFinder, rather than of A itself. The rank is bounded by ctrl.rank.
+template<typename Field>
+void RandomizedID
+( const Matrix<Field>& A,
+        Permutation& P,
+        Matrix<Field>& Z,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+template<typename Field>
+void RandomizedID
+( const AbstractDistMatrix<Field>& A,
+        DistPermutation& P,
+        AbstractDistMatrix<Field>& Z,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+
 // Skeleton
 // ========
 template<typename Field>
@@ -947,6 +1113,23 @@ void Skeleton
         AbstractDistMatrix<Field>& Z,
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>() );
 
+// Choose the rows and columns from pivoted QR factorizations of sketches of
+// the column and row spaces of A
+template<typename Field>
+void RandomizedSkeleton
+( const Matrix<Field>& A,
+        Permutation& PR,
+        Permutation& PC,
+        Matrix<Field>& Z,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+template<typename Field>
+void RandomizedSkeleton
+( const AbstractDistMatrix<Field>& A,
+        DistPermutation& PR,
+        DistPermutation& PC,
+        AbstractDistMatrix<Field>& Z,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+
 } // namespace El
 
 #include <El/lapack_like/factor/qr/ProxyHouseholder.hpp>
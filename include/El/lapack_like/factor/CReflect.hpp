@@ -83,6 +83,11 @@ inline InertiaType CReflect( const ElInertiaType& inertiaC )
     return inertia;
 }
 
+inline ElCholeskyQRVariant CReflect( CholeskyQRVariant variant )
+{ return static_cast<ElCholeskyQRVariant>( variant ); }
+inline CholeskyQRVariant CReflect( ElCholeskyQRVariant variant )
+{ return static_cast<CholeskyQRVariant>( variant ); }
+
 inline ElQRCtrl_s CReflect( const QRCtrl<float>& ctrl )
 { 
     ElQRCtrl_s ctrlC;
@@ -93,6 +98,8 @@ inline ElQRCtrl_s CReflect( const QRCtrl<float>& ctrl )
     ctrlC.tol = ctrl.tol;
     ctrlC.alwaysRecomputeNorms = ctrl.alwaysRecomputeNorms;
     ctrlC.smallestFirst = ctrl.smallestFirst;
+    ctrlC.cholesky = ctrl.cholesky;
+    ctrlC.cholVariant = CReflect(ctrl.cholVariant);
     return ctrlC;
 }
 inline ElQRCtrl_d CReflect( const QRCtrl<double>& ctrl )
@@ -105,6 +112,8 @@ inline ElQRCtrl_d CReflect( const QRCtrl<double>& ctrl )
     ctrlC.tol = ctrl.tol;
     ctrlC.alwaysRecomputeNorms = ctrl.alwaysRecomputeNorms;
     ctrlC.smallestFirst = ctrl.smallestFirst;
+    ctrlC.cholesky = ctrl.cholesky;
+    ctrlC.cholVariant = CReflect(ctrl.cholVariant);
     return ctrlC;
 }
 
@@ -118,6 +127,8 @@ inline QRCtrl<float> CReflect( const ElQRCtrl_s& ctrlC )
     ctrl.tol = ctrlC.tol;
     ctrl.alwaysRecomputeNorms = ctrlC.alwaysRecomputeNorms;
     ctrl.smallestFirst = ctrlC.smallestFirst;
+    ctrl.cholesky = ctrlC.cholesky;
+    ctrl.cholVariant = CReflect(ctrlC.cholVariant);
     return ctrl;
 }
 inline QRCtrl<double> CReflect( const ElQRCtrl_d& ctrlC )
@@ -130,6 +141,8 @@ inline QRCtrl<double> CReflect( const ElQRCtrl_d& ctrlC )
     ctrl.tol = ctrlC.tol;
     ctrl.alwaysRecomputeNorms = ctrlC.alwaysRecomputeNorms;
     ctrl.smallestFirst = ctrlC.smallestFirst;
+    ctrl.cholesky = ctrlC.cholesky;
+    ctrl.cholVariant = CReflect(ctrlC.cholVariant);
     return ctrl;
 }
 
@@ -34,7 +34,10 @@ enum LDLFrontType
   LDL_INTRAPIV_1D,        LDL_INTRAPIV_2D,
   LDL_INTRAPIV_SELINV_1D, LDL_INTRAPIV_SELINV_2D,
   BLOCK_LDL_1D,           BLOCK_LDL_2D,
-  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D
+  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D,
+  // An approximate factorization in which the bottom-left blocks of the
+  // large fronts are stored in a block low-rank (BLR) format
+  LDL_BLR_2D
 };
 
 bool Unfactored( LDLFrontType type );
@@ -48,6 +51,59 @@ LDLFrontType AppendSelInv( LDLFrontType type );
 LDLFrontType RemoveSelInv( LDLFrontType type );
 LDLFrontType InitialFactorType( LDLFrontType type );
 
+template<typename Real>
+struct BLRCtrl
+{
+    // Only the fronts with at least this many pivots are compressed
+    Int minSize=1024;
+
+    // The bottom-left block of each compressed front is partitioned into
+    // tiles which are (at most) tileSize x tileSize
+    Int tileSize=256;
+
+    // Each tile is truncated once the pivoted QR factorization underlying its
+    // Interpolative Decomposition encounters a column norm of at most 'tol'
+    // times the largest column norm of the tile
+    Real tol;
+
+    // Compute the ID of a Gaussian sketch of each tile rather than of the
+    // tile itself. The rank of the sketch is bounded by half of the tile
+    // size, and tiles which reach this bound are stored densely.
+    bool randomized=false;
+
+    BLRCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        tol = Pow(eps,Real(0.5));
+    }
+};
+
+// Parameters for threshold-dropping incomplete LDL^T and LDL^H factorizations
+// in the spirit of Saad's ILUT(tau,p)
+template<typename Real>
+struct IncompleteLDLCtrl
+{
+    // An entry L(i,k) is dropped if |L(i,k) d(k)| is less than 'dropTol' times
+    // the two-norm of the i'th row of the (lower triangle of the) matrix
+    Real dropTol;
+
+    // Each row of L keeps at most 'fill' more entries than the strictly lower
+    // triangle of the corresponding row of the matrix (the largest entries
+    // are kept). A negative value imposes no limit.
+    Int fill=10;
+
+    // Pivots of magnitude at most 'pivotTol' times the row norm are replaced
+    // with a pivot of that magnitude (preserving the sign of the real part)
+    Real pivotTol;
+
+    IncompleteLDLCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        dropTol = Real(1)/Real(1000);
+        pivotTol = Pow(eps,Real(0.5));
+    }
+};
+
 namespace ldl {
 
 template<typename T>
@@ -250,6 +306,40 @@ struct DistMatrixNode
 template<typename Field>
 struct DistFront;
 
+// A tile of a block low-rank matrix, which is either stored densely in 'U' or
+// approximated as the product 'U V', where 'U' is a subset of the columns of
+// the tile and 'V' contains the interpolation coefficients.
+template<typename MatType>
+struct BLRTile
+{
+    bool lowRank=false;
+    MatType U, V;
+};
+
+// A block low-rank (BLR) matrix whose tiles are stored in column-major order
+template<typename MatType>
+struct BLRMatrix
+{
+    Int height=0, width=0, tileSize=0;
+    vector<BLRTile<MatType>> tiles;
+
+    Int NumRowTiles() const
+    { return tileSize == 0 ? 0 : (height+tileSize-1)/tileSize; }
+    Int NumColTiles() const
+    { return tileSize == 0 ? 0 : (width+tileSize-1)/tileSize; }
+
+    BLRTile<MatType>& Tile( Int i, Int j )
+    { return tiles[i+j*NumRowTiles()]; }
+    const BLRTile<MatType>& Tile( Int i, Int j ) const
+    { return tiles[i+j*NumRowTiles()]; }
+
+    void Empty()
+    {
+        height = width = tileSize = 0;
+        SwapClear( tiles );
+    }
+};
+
 template<typename Field>
 struct Front
 {
@@ -260,6 +350,10 @@ struct Front
     Matrix<Field> LDense;
     SparseMatrix<Field> LSparse;
 
+    // For LDL_BLR_2D fronts which were large enough to be compressed, LDense
+    // only holds the top-left block and the bottom-left block is stored here
+    BLRMatrix<Matrix<Field>> LBLR;
+
     Matrix<Field> diag;
     Matrix<Field> subdiag;
     Permutation p;
@@ -314,6 +408,11 @@ struct Front
     Int NumBottomLeftEntries() const;
     double FactorGFlops() const;
     double SolveGFlops( Int numRHS=1 ) const;
+
+    // The inertia of the (Hermitian) factored matrix, which is read off of
+    // the (quasi-)diagonal of each front and is thus unavailable for block
+    // factorizations.
+    InertiaType Inertia() const;
 };
 
 struct FactorCommMeta
@@ -349,6 +448,10 @@ struct DistFront
     DistMatrix<Field,VC,STAR> L1D;
     DistMatrix<Field> L2D;
 
+    // For LDL_BLR_2D fronts which were large enough to be compressed, L2D
+    // only holds the top-left block and the bottom-left block is stored here
+    BLRMatrix<DistMatrix<Field>> LBLR;
+
     DistMatrix<Field,VC,STAR> diag;
     DistMatrix<Field,VC,STAR> subdiag;
     DistPermutation p;
@@ -426,6 +529,11 @@ struct DistFront
     double LocalFactorGFlops( bool selInv=false ) const;
     double LocalSolveGFlops( Int numRHS=1 ) const;
 
+    // The contribution of this process to the inertia of the factored matrix
+    // (summing over the process grid yields the full inertia).
+    // NOTE: This routine is collective over the grid of each distributed front.
+    InertiaType LocalInertia() const;
+
     void ComputeRecvInds( const DistNodeInfo& info ) const;
     void ComputeCommMeta
     ( const DistNodeInfo& info, bool computeRecvInds ) const;
@@ -440,6 +548,11 @@ public:
     SparseLDLFactorization();
 
     // Find a reordering and initialize the frontal tree.
+    //
+    // NOTE: If the factorization was previously initialized with a matrix
+    // with the same sparsity pattern and the same bisection parameters, then
+    // the existing reordering and symbolic analysis are reused and only the
+    // nonzero values are updated (as in 'ChangeNonzeroValues').
     void Initialize
     ( const SparseMatrix<Field>& A,
             bool hermitian=true,
@@ -477,9 +590,38 @@ public:
     void ChangeFrontType( LDLFrontType frontType );
 
     // Overwrite 'B' with the solution to 'A X = B'.
+    //
+    // NOTE: Right-hand sides wider than the solve block width are solved in
+    // consecutive blocks of columns so that the nodal workspace is bounded by
+    // the block width rather than the total number of right-hand sides.
     void Solve( Matrix<Field>& B ) const;
     void Solve( ldl::MatrixNode<Field>& B ) const;
 
+    // Set the maximum number of right-hand sides solved against at once. If
+    // the width is zero (the default), it is chosen so that the nodal
+    // workspace is roughly bounded by a fixed memory budget (but is never
+    // less than the algorithmic blocksize).
+    void SetSolveBlockWidth( Int blockWidth );
+
+    // Set the compression parameters used by 'Factor( LDL_BLR_2D )'.
+    void SetBLRCtrl( const BLRCtrl<Base<Field>>& ctrl );
+
+    // Form the solution 'X' to 'A X = B' for a sparse right-hand side 'B'.
+    // The forward solve only visits the fronts on the paths from the nonzero
+    // rows of 'B' to the root.
+    void Solve( const SparseMatrix<Field>& B, Matrix<Field>& X ) const;
+    // As above, but only form the rows of the solution listed in
+    // 'outputRows' (the remaining rows of 'X' are zero) so that the backward
+    // solve is also restricted to the paths from the requested rows to the
+    // root.
+    void Solve
+    ( const SparseMatrix<Field>& B,
+      const vector<Int>& outputRows,
+            Matrix<Field>& X ) const;
+    // Overwrite the rows of 'B' listed in 'outputRows' with the corresponding
+    // rows of the solution to 'A X = B' (and zero the remaining rows).
+    void Solve( Matrix<Field>& B, const vector<Int>& outputRows ) const;
+
     // Overwrite 'B' with the solution to 'A X = B' using Iterative Refinement.
     void SolveWithIterativeRefinement
     ( const SparseMatrix<Field>& A,
@@ -521,6 +663,10 @@ public:
     double FactorGFlops() const;
     double SolveGFlops( Int numRHS=1 ) const;
 
+    // Return the number of positive, negative, and zero eigenvalues of the
+    // factored (Hermitian) matrix via Sylvester's law of inertia.
+    InertiaType Inertia() const;
+
     ldl::Front<Field>& Front();
     const ldl::Front<Field>& Front() const;
 
@@ -539,11 +685,25 @@ public:
 private:
     bool initialized_=false;
     bool factored_=false;
+    Int solveBlockWidth_=0;
+    BLRCtrl<Base<Field>> blrCtrl_;
     unique_ptr<ldl::Front<Field>> front_;
     unique_ptr<ldl::NodeInfo> info_;
     unique_ptr<ldl::Separator> separator_;
 
     vector<Int> map_, inverseMap_;
+
+    // The sparsity pattern which was last analyzed and the fingerprint of
+    // the parameters of its ordering
+    Graph pattern_;
+    unsigned long long orderingHash_=0;
+
+    // Attempt to reuse the existing analysis for a matrix with the given
+    // ordering fingerprint
+    bool ReuseAnalysis
+    ( const SparseMatrix<Field>& A,
+            bool hermitian,
+            unsigned long long orderingHash );
 };
 
 template<typename Field>
@@ -553,6 +713,12 @@ public:
     DistSparseLDLFactorization();
 
     // Find a reordering and initialize the frontal tree.
+    //
+    // NOTE: If the factorization was previously initialized with a matrix
+    // with the same sparsity pattern, distribution, and grid, and with the
+    // same bisection parameters, then the existing reordering and symbolic
+    // analysis are reused and only the nonzero values are updated (as in
+    // 'ChangeNonzeroValues').
     void Initialize
     ( const DistSparseMatrix<Field>& A,
             bool hermitian=true,
@@ -590,10 +756,40 @@ public:
     void ChangeFrontType( LDLFrontType frontType );
 
     // Overwrite 'B' with the solution to 'A X = B'.
+    //
+    // NOTE: Right-hand sides wider than the solve block width are solved in
+    // consecutive blocks of columns so that the nodal workspace is bounded by
+    // the block width rather than the total number of right-hand sides.
     void Solve( DistMultiVec<Field>& B ) const;
     void Solve( ldl::DistMultiVecNode<Field>& B ) const;
     void Solve( ldl::DistMatrixNode<Field>& B ) const;
 
+    // Set the maximum number of right-hand sides solved against at once. If
+    // the width is zero (the default), it is chosen so that the nodal
+    // workspace of each process is roughly bounded by a fixed memory budget
+    // (but is never less than the algorithmic blocksize).
+    void SetSolveBlockWidth( Int blockWidth );
+
+    // Set the compression parameters used by 'Factor( LDL_BLR_2D )'.
+    void SetBLRCtrl( const BLRCtrl<Base<Field>>& ctrl );
+
+    // Form the solution 'X' to 'A X = B' for a sparse right-hand side 'B'.
+    // The forward solve only visits the sequential fronts on the paths from
+    // the nonzero rows of 'B' to the roots of the sequential subtrees.
+    void Solve
+    ( const DistSparseMatrix<Field>& B, DistMultiVec<Field>& X ) const;
+    // As above, but only form the rows of the solution listed in the union of
+    // 'outputRows' over the team (the remaining rows of 'X' are zero) so that
+    // the sequential portion of the backward solve is similarly restricted.
+    void Solve
+    ( const DistSparseMatrix<Field>& B,
+      const vector<Int>& outputRows,
+            DistMultiVec<Field>& X ) const;
+    // Overwrite the rows of 'B' listed in the union of 'outputRows' over the
+    // team with the corresponding rows of the solution to 'A X = B' (and zero
+    // the remaining rows).
+    void Solve( DistMultiVec<Field>& B, const vector<Int>& outputRows ) const;
+
     // Overwrite 'B' with the solution to 'A X = B' using Iterative Refinement.
     void SolveWithIterativeRefinement
     ( const DistSparseMatrix<Field>& A,
@@ -643,6 +839,10 @@ public:
     double LocalFactorGFlops( bool selInv=false ) const;
     double LocalSolveGFlops( Int numRHS=1 ) const;
 
+    // Return the number of positive, negative, and zero eigenvalues of the
+    // factored (Hermitian) matrix via Sylvester's law of inertia.
+    InertiaType Inertia() const;
+
     ldl::DistFront<Field>& Front();
     const ldl::DistFront<Field>& Front() const;
 
@@ -663,6 +863,8 @@ public:
 private:
     bool initialized_=false;
     bool factored_=false;
+    Int solveBlockWidth_=0;
+    BLRCtrl<Base<Field>> blrCtrl_;
     unique_ptr<ldl::DistFront<Field>> front_;
     unique_ptr<ldl::DistNodeInfo> info_;
     unique_ptr<ldl::DistSeparator> separator_;
@@ -675,6 +877,143 @@ private:
 
     // Metadata for future use.
     mutable ldl::DistMultiVecNodeMeta dmvMeta_;
+
+    // The (local portion of the) sparsity pattern which was last analyzed and
+    // the fingerprint of the parameters of its ordering
+    DistGraph pattern_;
+    unsigned long long orderingHash_=0;
+
+    // Attempt to reuse the existing analysis for a matrix with the given
+    // ordering fingerprint
+    bool ReuseAnalysis
+    ( const DistSparseMatrix<Field>& A,
+            bool hermitian,
+            unsigned long long orderingHash );
+};
+
+// Form the entries of the inverse of a factored sparse matrix which lie
+// within the (symmetrized) sparsity pattern of its factor, L + L^T, or only
+// the diagonal of the inverse if 'diagonalOnly' is true. The result is
+// returned in the original ordering of the matrix.
+//
+// NOTE: Fronts with non-block intra-pivoted factorizations are not supported.
+template<typename Field>
+void SelectedInverse
+( const SparseLDLFactorization<Field>& factorization,
+        SparseMatrix<Field>& selInv,
+        bool diagonalOnly=false );
+// NOTE: This routine is collective over the grid of the factorization.
+template<typename Field>
+void SelectedInverse
+( const DistSparseLDLFactorization<Field>& factorization,
+        DistSparseMatrix<Field>& selInv,
+        bool diagonalOnly=false );
+
+// An incomplete LDL^T or LDL^H factorization, with threshold dropping, of a
+// symmetric or Hermitian sparse matrix which is meant to be used as a
+// preconditioner for (flexible) Krylov methods when an exact factorization
+// is too expensive.
+//
+// The matrix is first reordered with the same nested dissection used by the
+// multifrontal factorizations. The rows of each separator (supernode) are
+// factored only after the subtrees of its children, which are factored
+// concurrently (when threading is enabled) since their rows never interact.
+// The triangular solves traverse the same tree.
+//
+// NOTE: The supernodes only determine the ordering and the task parallelism;
+// the factorization itself is a scalar, row-by-row ILUT(tau,p) rather than a
+// supernodal one with dense blocks, since threshold dropping destroys the
+// dense structure of the separator blocks that a supernodal kernel relies on.
+template<typename Field>
+class IncompleteLDLFactorization
+{
+public:
+    IncompleteLDLFactorization();
+
+    // Find a reordering of the matrix and form its permuted lower triangle.
+    void Initialize
+    ( const SparseMatrix<Field>& A,
+            bool hermitian=true,
+      const BisectCtrl& bisectCtrl=BisectCtrl() );
+
+    // Replace the matrix with one with the same nonzero pattern.
+    void ChangeNonzeroValues( const SparseMatrix<Field>& ANew );
+
+    // Form the incomplete factors of the initialized matrix.
+    void Factor
+    ( const IncompleteLDLCtrl<Base<Field>>& ctrl=
+      IncompleteLDLCtrl<Base<Field>>() );
+
+    // Overwrite 'B' with 'inv(L D L^T) B' or 'inv(L D L^H) B', which is an
+    // approximation of 'inv(A) B'.
+    void Solve( Matrix<Field>& B ) const;
+
+    bool Factored() const;
+    Int Height() const;
+
+    // The number of entries in the strictly lower triangle of L plus the
+    // number of diagonal entries
+    Int NumEntries() const;
+
+    const ldl::NodeInfo& NodeInfo() const;
+    const vector<Int>& Map() const;
+    const vector<Int>& InverseMap() const;
+
+private:
+    bool initialized_=false;
+    bool factored_=false;
+    bool hermitian_=true;
+    unique_ptr<ldl::NodeInfo> info_;
+    unique_ptr<ldl::Separator> separator_;
+    vector<Int> map_, inverseMap_;
+
+    // The lower triangle (including the diagonal) of the reordered matrix
+    SparseMatrix<Field> ALower_;
+
+    // The strictly lower triangle of the unit lower-triangular factor and
+    // the diagonal factor (both in the reordered indices)
+    SparseMatrix<Field> L_;
+    Matrix<Field> d_;
+
+    void FormLowerTriangle( const SparseMatrix<Field>& A );
+};
+
+// A block Jacobi preconditioner in which each process computes an incomplete
+// factorization of the diagonal block of the matrix corresponding to the rows
+// that it owns. The coupling between the blocks of different processes is
+// ignored.
+template<typename Field>
+class DistIncompleteLDLFactorization
+{
+public:
+    DistIncompleteLDLFactorization();
+
+    void Initialize
+    ( const DistSparseMatrix<Field>& A,
+            bool hermitian=true,
+      const BisectCtrl& bisectCtrl=BisectCtrl() );
+
+    void ChangeNonzeroValues( const DistSparseMatrix<Field>& ANew );
+
+    void Factor
+    ( const IncompleteLDLCtrl<Base<Field>>& ctrl=
+      IncompleteLDLCtrl<Base<Field>>() );
+
+    // Overwrite 'B' with the (block-diagonal) approximation of 'inv(A) B'.
+    void Solve( DistMultiVec<Field>& B ) const;
+
+    bool Factored() const;
+    Int NumLocalEntries() const;
+
+    const IncompleteLDLFactorization<Field>& LocalFactorization() const;
+
+private:
+    bool initialized_=false;
+    Int firstLocalRow_=0;
+    IncompleteLDLFactorization<Field> localFact_;
+
+    void FormLocalBlock
+    ( const DistSparseMatrix<Field>& A, SparseMatrix<Field>& ALoc ) const;
 };
 
 } // namespace El
@@ -50,6 +50,13 @@ void NestedDissection
         DistNodeInfo& rootInfo,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// Fingerprints of the parameters which determine a nested dissection of a
+// given sparsity pattern (either via bisection or via the natural ordering of
+// a grid graph), which must also match for an analysis to be reused
+unsigned long long OrderingHash( const BisectCtrl& ctrl );
+unsigned long long NaturalOrderingHash
+( Int gridDim0, Int gridDim1, Int gridDim2, Int cutoff );
+
 void NaturalNestedDissection
 ( Int nx, Int ny, Int nz,
   const Graph& graph,
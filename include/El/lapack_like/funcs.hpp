@@ -195,6 +195,125 @@ void HPSDSquareRoot
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
   const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
 
+// Krylov-based Hermitian functions
+// =================================
+// Approximate X := f(A) B for a sparse Hermitian matrix (or operator, see
+// El/lapack_like/funcs/Krylov.hpp) using the Lanczos process without forming
+// f(A).
+
+template<typename Real>
+struct KrylovFunctionCtrl
+{
+    // The number of Lanczos vectors stored for each column (for the
+    // exponential, this is the dimension of the Krylov subspace built after
+    // each restart)
+    Int basisSize=30;
+    // The maximum number of applications of A per column
+    Int maxIts=1000;
+    // The iteration stops once the estimated relative error is at most 'tol'.
+    // If 'tol' is zero, eps^(2/3) is used.
+    Real tol=Real(0);
+    bool progress=false;
+};
+
+template<typename Real>
+struct KrylovFunctionInfo
+{
+    // The maximum number of Lanczos iterations (or, for the exponential, time
+    // steps) over all columns
+    Int numIts=0;
+    Int numRestarts=0;
+    Int numApplications=0;
+    // The maximum estimate of || f(A) b - x ||_2 / || b ||_2 over all columns
+    Real errorEst=Real(0);
+    bool converged=true;
+};
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovHermitianFunction
+( const SparseMatrix<Field>& A,
+        function<Base<Field>(const Base<Field>&)> func,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovHermitianFunction
+( const DistSparseMatrix<Field>& A,
+        function<Base<Field>(const Base<Field>&)> func,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+
+// X := exp(t A) B
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovExp
+( const SparseMatrix<Field>& A,
+        Base<Field> t,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovExp
+( const DistSparseMatrix<Field>& A,
+        Base<Field> t,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+
+// X := sqrt(A) B for Hermitian positive semi-definite A
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovSquareRoot
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovSquareRoot
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+
+// X := inv(sqrt(A)) B for Hermitian positive-definite A
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovInverseSquareRoot
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovInverseSquareRoot
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+
+// X := sign(A) B for nonsingular Hermitian A
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovSign
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovSign
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl=
+        KrylovFunctionCtrl<Base<Field>>() );
+
 } // namespace El
 
+#include <El/lapack_like/funcs/Krylov.hpp>
+
 #endif // ifndef EL_FUNCS_HPP
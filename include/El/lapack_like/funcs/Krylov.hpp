@@ -0,0 +1,617 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FUNCS_KRYLOV_HPP
+#define EL_FUNCS_KRYLOV_HPP
+
+namespace El {
+
+// Approximate X := f(A) B, where A is a Hermitian operator, using the Lanczos
+// approximation || b ||_2 V_k f(T_k) e_1 for each column b of B, where
+// A V_k = V_k T_k + beta_k v_{k+1} e_k^T.
+//
+// As in El/lapack_like/spectral/KrylovEig.hpp, 'applyA' should be a function
+// of the form
+//
+//   void applyA( const MatType& X, MatType& Y )
+//
+// and overwrite Y := A X, where MatType is either Matrix<Field> or
+// DistMultiVec<Field>.
+//
+// Only the first 'ctrl.basisSize' Lanczos vectors are stored (and fully
+// reorthogonalized against). If the approximation has not converged by then,
+// the iteration is continued using only the most recent two vectors and the
+// remaining contributions are accumulated by regenerating those vectors in a
+// second pass [Frommer/Simoncini, "Matrix functions", Sec. 3.2], so that the
+// memory usage is bounded independently of the number of iterations.
+//
+// For the exponential, the Lanczos process is instead restarted from the
+// current iterate after each of a sequence of adaptively-chosen time steps,
+// exp(t A) b = exp(tau_s A) ... exp(tau_1 A) b, using the a posteriori error
+// estimate || w ||_2 beta_k | e_k^T exp(tau T_k) e_1 | of Saad to choose the
+// steps [Sidje, "Expokit: A software package for computing matrix
+// exponentials"].
+//
+
+namespace krylov_func {
+
+// Overwrite y := f(T) e_1, where T is the symmetric tridiagonal matrix with
+// diagonal alpha(0:k) and subdiagonal beta(0:k-1)
+template<typename Real>
+void TridiagFunction
+( const Matrix<Real>& alpha,
+  const Matrix<Real>& beta,
+        Int k,
+  const function<Real(const Real&)>& func,
+        Matrix<Real>& y )
+{
+    EL_DEBUG_CSE
+    auto d = alpha( IR(0,k), ALL );
+    auto e = beta( IR(0,k-1), ALL );
+    Matrix<Real> w, Q;
+    HermitianTridiagEig( d, e, w, Q );
+    Zeros( y, k, 1 );
+    for( Int j=0; j<k; ++j )
+    {
+        const Real gamma = func(w(j))*Q(0,j);
+        for( Int i=0; i<k; ++i )
+            y(i) += Q(i,j)*gamma;
+    }
+}
+
+// Expand an orthonormal Lanczos basis Q by one vector: w := A q, where q is
+// the last column of Q, is orthogonalized against Q and then normalized.
+template<typename Field,class ApplyAType>
+void Expand
+( const ApplyAType& applyA,
+  const Matrix<Field>& Q,
+        Matrix<Field>& w,
+        Base<Field>& alpha,
+        Base<Field>& beta,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int k = Q.Width();
+    auto q = Q( ALL, IR(k-1) );
+    applyA( q, w );
+
+    Matrix<Field> H;
+    Matrix<Real> norms;
+    krylov_eig::Orthogonalize( Q, w, H, comm );
+    krylov_eig::ColumnNorms( w, norms, comm );
+    alpha = RealPart(H(k-1));
+    beta = norms(0);
+    if( beta > Real(0) )
+        w *= Real(1)/beta;
+}
+
+// x += gamma V y
+template<typename Field>
+void Accumulate
+( Base<Field> gamma,
+  const Matrix<Field>& V,
+  const Matrix<Base<Field>>& y,
+        Matrix<Field>& x )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> yField;
+    Copy( y, yField );
+    if( V.Height() > 0 )
+        Gemv( NORMAL, Field(gamma), V, yField, Field(1), x );
+}
+
+template<typename Field,class ApplyAType>
+void FunctionColumn
+(       Int localHeight,
+        mpi::Comm comm,
+  const ApplyAType& applyA,
+  const function<Base<Field>(const Base<Field>&)>& func,
+  const Matrix<Field>& b,
+        Matrix<Field>& x,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl,
+        KrylovFunctionInfo<Base<Field>>& info )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol =
+      ( ctrl.tol == Real(0) ? Pow(eps,Real(2)/Real(3)) : ctrl.tol );
+    const Int m = Max( ctrl.basisSize, Int(2) );
+    const Int maxIts = Max( ctrl.maxIts, Int(1) );
+
+    Zeros( x, localHeight, 1 );
+    Matrix<Real> norms;
+    krylov_eig::ColumnNorms( b, norms, comm );
+    const Real bNorm = norms(0);
+    if( bNorm == Real(0) )
+        return;
+
+    Matrix<Field> V, W, w;
+    Zeros( V, localHeight, m+1 );
+    auto v0 = V( ALL, IR(0) );
+    v0 = b;
+    v0 *= Real(1)/bNorm;
+
+    Matrix<Real> alpha, beta, y, yOld;
+    Zeros( alpha, maxIts, 1 );
+    Zeros( beta, maxIts, 1 );
+    Real normEst = 0;
+    bool converged = false;
+    Int k = 0;
+    while( true )
+    {
+        // Expand the basis from the stored vectors or, once those have been
+        // exhausted, from the most recent two vectors
+        if( k < m )
+        {
+            auto Q = V( ALL, IR(0,k+1) );
+            Expand( applyA, Q, w, alpha(k), beta(k), comm );
+        }
+        else
+        {
+            if( k == m )
+                W = V( ALL, IR(m-1,m+1) );
+            Expand( applyA, W, w, alpha(k), beta(k), comm );
+        }
+        ++info.numApplications;
+        ++k;
+        normEst = Max( normEst, Abs(alpha(k-1))+Real(2)*beta(k-1) );
+        const bool breakdown = ( beta(k-1) <= eps*normEst );
+
+        // The tridiagonal eigenvalue problem is only re-solved every few
+        // iterations once the stored basis has been exhausted
+        const Int checkInterval = ( k <= m ? 1 : Max(m/4,Int(1)) );
+        if( breakdown || k == maxIts || k % checkInterval == 0 )
+        {
+            TridiagFunction( alpha, beta, k, func, y );
+            auto yOldPad( y );
+            for( Int i=0; i<k; ++i )
+                yOldPad(i) -= ( i < yOld.Height() ? yOld(i) : Real(0) );
+            const Real yNorm = FrobeniusNorm( y );
+            const Real errorEst = FrobeniusNorm( yOldPad );
+            converged = breakdown || errorEst <= tol*yNorm;
+            if( converged || k == maxIts )
+            {
+                info.errorEst = Max( info.errorEst, errorEst );
+                break;
+            }
+            yOld = y;
+            if( ctrl.progress )
+                Output("  ",k," iterations: relative change of ",errorEst);
+        }
+
+        if( k <= m )
+        {
+            auto vNext = V( ALL, IR(k) );
+            vNext = w;
+        }
+        else
+        {
+            auto w0 = W( ALL, IR(0) );
+            auto w1 = W( ALL, IR(1) );
+            w0 = w1;
+            w1 = w;
+        }
+    }
+    info.numIts = Max( info.numIts, k );
+    if( !converged )
+        info.converged = false;
+
+    // Accumulate the contributions of the stored vectors
+    const Int kStored = Min( k, m );
+    Accumulate( bNorm, V(ALL,IR(0,kStored)), y(IR(0,kStored),ALL), x );
+
+    // Regenerate (exactly) the remaining vectors and accumulate their
+    // contributions
+    if( k > m )
+    {
+        W = V( ALL, IR(m-1,m+1) );
+        Real alphaCopy, betaCopy;
+        for( Int j=m; j<k; ++j )
+        {
+            Accumulate( bNorm, W(ALL,IR(1)), y(IR(j),ALL), x );
+            if( j == k-1 )
+                break;
+            Expand( applyA, W, w, alphaCopy, betaCopy, comm );
+            ++info.numApplications;
+            auto w0 = W( ALL, IR(0) );
+            auto w1 = W( ALL, IR(1) );
+            w0 = w1;
+            w1 = w;
+        }
+    }
+}
+
+template<typename Field,class ApplyAType>
+void ExpColumn
+(       Int localHeight,
+        mpi::Comm comm,
+  const ApplyAType& applyA,
+        Base<Field> t,
+  const Matrix<Field>& b,
+        Matrix<Field>& x,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl,
+        KrylovFunctionInfo<Base<Field>>& info )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol =
+      ( ctrl.tol == Real(0) ? Pow(eps,Real(2)/Real(3)) : ctrl.tol );
+    const Int m = Max( ctrl.basisSize, Int(1) );
+    const Real gamma = Real(9)/Real(10);
+
+    x = b;
+    Matrix<Real> norms;
+    krylov_eig::ColumnNorms( b, norms, comm );
+    const Real bNorm = norms(0);
+    const Real tAbs = Abs(t);
+    if( bNorm == Real(0) || tAbs == Real(0) )
+        return;
+    const Real tSign = Sgn(t);
+
+    Matrix<Field> V, w;
+    Matrix<Real> alpha, beta, lambda, Q, y;
+    Real tDone = 0;
+    Real tau = tAbs;
+    Real errorEst = 0;
+    Int numSteps = 0;
+    bool converged = true;
+    while( tDone < tAbs )
+    {
+        if( info.numApplications >= ctrl.maxIts )
+        {
+            converged = false;
+            break;
+        }
+        krylov_eig::ColumnNorms( x, norms, comm );
+        const Real xNorm = norms(0);
+        if( xNorm == Real(0) )
+            break;
+
+        // Build a Lanczos basis for the current iterate
+        Zeros( V, localHeight, m+1 );
+        Zeros( alpha, m, 1 );
+        Zeros( beta, m, 1 );
+        auto v0 = V( ALL, IR(0) );
+        v0 = x;
+        v0 *= Real(1)/xNorm;
+        Real normEst = 0;
+        bool breakdown = false;
+        Int k = 0;
+        while( k < m )
+        {
+            auto Vk = V( ALL, IR(0,k+1) );
+            Expand( applyA, Vk, w, alpha(k), beta(k), comm );
+            ++info.numApplications;
+            ++k;
+            normEst = Max( normEst, Abs(alpha(k-1))+Real(2)*beta(k-1) );
+            if( beta(k-1) <= eps*normEst )
+            {
+                breakdown = true;
+                break;
+            }
+            auto vNext = V( ALL, IR(k) );
+            vNext = w;
+        }
+        auto d = alpha( IR(0,k), ALL );
+        auto e = beta( IR(0,k-1), ALL );
+        HermitianTridiagEig( d, e, lambda, Q );
+
+        // Choose the largest step whose error estimate is acceptable. Since
+        // the basis is independent of the step size, rejected steps are
+        // cheap.
+        tau = Min( tau, tAbs-tDone );
+        Real stepError;
+        while( true )
+        {
+            Zeros( y, k, 1 );
+            for( Int j=0; j<k; ++j )
+            {
+                const Real phi = Exp(tSign*tau*lambda(j))*Q(0,j);
+                for( Int i=0; i<k; ++i )
+                    y(i) += Q(i,j)*phi;
+            }
+            stepError = ( breakdown ? Real(0) : xNorm*beta(k-1)*Abs(y(k-1)) );
+            // Estimates at the level of the rounding errors in forming y are
+            // not meaningful
+            if( stepError <= eps*normEst*xNorm )
+                stepError = 0;
+            const Real stepTol = tol*xNorm*(tau/tAbs);
+            if( stepError <= stepTol || tau <= eps*tAbs )
+                break;
+            tau *= Max( Min( gamma*Pow(stepTol/stepError,Real(1)/Real(k)),
+                             Real(1)/Real(2) ), Real(1)/Real(10) );
+        }
+
+        Zeros( x, localHeight, 1 );
+        Accumulate( xNorm, V(ALL,IR(0,k)), y, x );
+        tDone += tau;
+        errorEst += stepError;
+        ++numSteps;
+        if( ctrl.progress )
+            Output
+            ("  step ",numSteps," of size ",tau," reached t=",tSign*tDone,
+             " with error estimate ",stepError);
+
+        if( breakdown )
+        {
+            // The Krylov subspace is invariant, so the remaining time can be
+            // integrated exactly
+            tau = tAbs - tDone;
+        }
+        else
+        {
+            const Real stepTol = tol*xNorm*(tau/tAbs);
+            const Real growth =
+              ( stepError == Real(0) ? Real(2) :
+                Min( gamma*Pow(stepTol/stepError,Real(1)/Real(k)),
+                     Real(2) ) );
+            tau *= Max( growth, Real(1)/Real(2) );
+        }
+    }
+    info.numIts = Max( info.numIts, numSteps );
+    info.numRestarts += Max( numSteps-1, Int(0) );
+    info.errorEst = Max( info.errorEst, errorEst/bNorm );
+    if( !converged )
+        info.converged = false;
+}
+
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> Function
+(       Int localHeight,
+        mpi::Comm comm,
+  const ApplyAType& applyA,
+  const function<Base<Field>(const Base<Field>&)>& func,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    KrylovFunctionInfo<Base<Field>> info;
+    const Int numRHS = B.Width();
+    Zeros( X, localHeight, numRHS );
+    Matrix<Field> x;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        if( ctrl.progress )
+            Output("Column ",j,":");
+        FunctionColumn
+        ( localHeight, comm, applyA, func, B(ALL,IR(j)), x, ctrl, info );
+        auto xj = X( ALL, IR(j) );
+        xj = x;
+    }
+    return info;
+}
+
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> Exp
+(       Int localHeight,
+        mpi::Comm comm,
+  const ApplyAType& applyA,
+        Base<Field> t,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    KrylovFunctionInfo<Base<Field>> info;
+    const Int numRHS = B.Width();
+    Zeros( X, localHeight, numRHS );
+    Matrix<Field> x;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        if( ctrl.progress )
+            Output("Column ",j,":");
+        ExpColumn
+        ( localHeight, comm, applyA, t, B(ALL,IR(j)), x, ctrl, info );
+        auto xj = X( ALL, IR(j) );
+        xj = x;
+    }
+    return info;
+}
+
+template<typename Real>
+function<Real(const Real&)> SquareRoot()
+{ return []( const Real& alpha ) { return Sqrt(Max(alpha,Real(0))); }; }
+
+template<typename Real>
+function<Real(const Real&)> InverseSquareRoot()
+{ return []( const Real& alpha ) { return Real(1)/Sqrt(alpha); }; }
+
+template<typename Real>
+function<Real(const Real&)> Sign()
+{ return []( const Real& alpha ) { return Sgn(alpha); }; }
+
+// Wrap a DistMultiVec operator so that it acts on the local rows
+template<typename Field,class ApplyAType>
+function<void(const Matrix<Field>&,Matrix<Field>&)>
+LocalOperator
+( Int n,
+  const ApplyAType& applyA,
+  DistMultiVec<Field>& XDist,
+  DistMultiVec<Field>& YDist )
+{
+    return
+      [&applyA,&XDist,&YDist,n]
+      ( const Matrix<Field>& XLoc, Matrix<Field>& YLoc )
+      {
+          Zeros( XDist, n, XLoc.Width() );
+          XDist.Matrix() = XLoc;
+          applyA( XDist, YDist );
+          YLoc = YDist.LockedMatrix();
+      };
+}
+
+} // namespace krylov_func
+
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovHermitianFunction
+(       Int n,
+  const ApplyAType& applyA,
+  const function<Base<Field>(const Base<Field>&)>& func,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( B.Height() != n )
+        LogicError("B was not of height n");
+    return krylov_func::Function
+      ( n, mpi::COMM_SELF, applyA, func, B, X, ctrl );
+}
+
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovHermitianFunction
+(       Int n,
+  const ApplyAType& applyA,
+  const function<Base<Field>(const Base<Field>&)>& func,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( B.Height() != n )
+        LogicError("B was not of height n");
+    const Grid& grid = B.Grid();
+    DistMultiVec<Field> XDist(grid), YDist(grid);
+    auto applyALocal =
+      krylov_func::LocalOperator<Field>( n, applyA, XDist, YDist );
+    X.SetGrid( grid );
+    Zeros( X, n, B.Width() );
+    return krylov_func::Function
+      ( B.LocalHeight(), grid.Comm(), applyALocal, func, B.LockedMatrix(),
+        X.Matrix(), ctrl );
+}
+
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovExp
+(       Int n,
+  const ApplyAType& applyA,
+        Base<Field> t,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( B.Height() != n )
+        LogicError("B was not of height n");
+    return krylov_func::Exp( n, mpi::COMM_SELF, applyA, t, B, X, ctrl );
+}
+
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovExp
+(       Int n,
+  const ApplyAType& applyA,
+        Base<Field> t,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( B.Height() != n )
+        LogicError("B was not of height n");
+    const Grid& grid = B.Grid();
+    DistMultiVec<Field> XDist(grid), YDist(grid);
+    auto applyALocal =
+      krylov_func::LocalOperator<Field>( n, applyA, XDist, YDist );
+    X.SetGrid( grid );
+    Zeros( X, n, B.Width() );
+    return krylov_func::Exp
+      ( B.LocalHeight(), grid.Comm(), applyALocal, t, B.LockedMatrix(),
+        X.Matrix(), ctrl );
+}
+
+// The square root of a Hermitian positive semi-definite operator
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovSquareRoot
+(       Int n,
+  const ApplyAType& applyA,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KrylovHermitianFunction
+      ( n, applyA, krylov_func::SquareRoot<Base<Field>>(), B, X, ctrl );
+}
+
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovSquareRoot
+(       Int n,
+  const ApplyAType& applyA,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KrylovHermitianFunction
+      ( n, applyA, krylov_func::SquareRoot<Base<Field>>(), B, X, ctrl );
+}
+
+// The inverse square root of a Hermitian positive-definite operator
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovInverseSquareRoot
+(       Int n,
+  const ApplyAType& applyA,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KrylovHermitianFunction
+      ( n, applyA, krylov_func::InverseSquareRoot<Base<Field>>(), B, X,
+        ctrl );
+}
+
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovInverseSquareRoot
+(       Int n,
+  const ApplyAType& applyA,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KrylovHermitianFunction
+      ( n, applyA, krylov_func::InverseSquareRoot<Base<Field>>(), B, X,
+        ctrl );
+}
+
+// The sign function of a (nonsingular) Hermitian operator. Note that the
+// convergence rate depends upon the distance of the spectrum from the origin.
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovSign
+(       Int n,
+  const ApplyAType& applyA,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KrylovHermitianFunction
+      ( n, applyA, krylov_func::Sign<Base<Field>>(), B, X, ctrl );
+}
+
+template<typename Field,class ApplyAType>
+KrylovFunctionInfo<Base<Field>> KrylovSign
+(       Int n,
+  const ApplyAType& applyA,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KrylovHermitianFunction
+      ( n, applyA, krylov_func::Sign<Base<Field>>(), B, X, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_FUNCS_KRYLOV_HPP
@@ -14,6 +14,65 @@
 
 namespace El {
 
+// Mixed-precision iterative refinement
+// ====================================
+// Factor a copy of A in the next-lowest precision, Demote<Field>, and recover
+// the accuracy of the working precision through either classical iterative
+// refinement or GMRES-based refinement preconditioned by the low-precision
+// factorization (see Carson and Higham, "Accelerating the solution of linear
+// systems by iterative refinement in three precisions", SISC, 40(2), 2018).
+namespace MixedPrecisionRefineNS {
+enum MixedPrecisionRefine
+{
+  MIXED_REFINE_CLASSICAL,
+  MIXED_REFINE_GMRES
+};
+}
+using namespace MixedPrecisionRefineNS;
+
+template<typename Real>
+struct MixedPrecisionCtrl
+{
+    MixedPrecisionRefine refine=MIXED_REFINE_CLASSICAL;
+
+    // Refinement is declared converged once the normwise backward error,
+    //   || B - op(A) X ||_max / (|| A ||_oo || X ||_max + || B ||_max),
+    // is at most 'relTol'. A value of zero selects Sqrt(n) eps, as in LAPACK's
+    // mixed-precision driver, dsgesv.
+    Real relTol=0;
+    Int maxRefineIts=30;
+
+    // Refinement has stalled if a step does not reduce the backward error by
+    // at least this factor
+    Real stallRatio=Real(0.5);
+
+    // Only used by MIXED_REFINE_GMRES
+    Real gmresRelTol=Pow(limits::Epsilon<Real>(),Real(0.25));
+    Int maxGMRESIts=20;
+
+    // If refinement fails, refactor and solve in the working precision
+    bool fallback=true;
+    bool progress=false;
+};
+
+template<typename Real>
+struct MixedPrecisionInfo
+{
+    // Whether the low-precision factorization completed (it can break down
+    // due to overflow, exact singularity, or a loss of definiteness)
+    bool factored=false;
+    bool converged=false;
+    bool fellBack=false;
+
+    Int numRefineIts=0;
+    Int numGMRESIts=0;
+    Real backwardError=0;
+
+    // The machine epsilons of the factorization and working precisions
+    Real factorEpsilon=0;
+    Real workingEpsilon=0;
+};
+
 // Linear
 // ======
 template<typename Field>
@@ -26,6 +85,19 @@ void LinearSolve
         AbstractDistMatrix<Field>& B,
   bool scalapack=false );
 
+template<typename Field>
+MixedPrecisionInfo<Base<Field>>
+LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+template<typename Field>
+MixedPrecisionInfo<Base<Field>>
+LinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
 template<typename Field>
 void LinearSolve
 ( const SparseMatrix<Field>& A,
@@ -199,6 +271,23 @@ void HPDSolve
   const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& B );
 
+template<typename Field>
+MixedPrecisionInfo<Base<Field>>
+HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+template<typename Field>
+MixedPrecisionInfo<Base<Field>>
+HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
 template<typename Field>
 void HPDSolve
 ( const SparseMatrix<Field>& A,
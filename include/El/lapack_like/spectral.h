@@ -38,6 +38,7 @@ typedef struct {
   bool penalizeDerivative;
   bool progress;
   ElCubicSecularCtrl cubicCtrl;
+  ElInt batchCutoff;
 } ElSecularEVDCtrl_s;
 EL_EXPORT ElError ElSecularEVDCtrlDefault_s
 ( ElSecularEVDCtrl_s* ctrl );
@@ -49,6 +50,7 @@ typedef struct {
   bool penalizeDerivative;
   bool progress;
   ElCubicSecularCtrl cubicCtrl;
+  ElInt batchCutoff;
 } ElSecularEVDCtrl_d;
 EL_EXPORT ElError ElSecularEVDCtrlDefault_d
 ( ElSecularEVDCtrl_d* ctrl );
@@ -62,6 +64,7 @@ typedef struct {
   bool penalizeDerivative;
   bool progress;
   ElCubicSecularCtrl cubicCtrl;
+  ElInt batchCutoff;
 } ElSecularSVDCtrl_s;
 EL_EXPORT ElError ElSecularSVDCtrlDefault_s
 ( ElSecularSVDCtrl_s* ctrl );
@@ -73,6 +76,7 @@ typedef struct {
   bool penalizeDerivative;
   bool progress;
   ElCubicSecularCtrl cubicCtrl;
+  ElInt batchCutoff;
 } ElSecularSVDCtrl_d;
 EL_EXPORT ElError ElSecularSVDCtrlDefault_d
 ( ElSecularSVDCtrl_d* ctrl );
@@ -120,6 +124,7 @@ typedef struct {
   float deflationFudge;
   ElInt cutoff;
   bool exploitStructure;
+  ElInt taskCutoff;
 } ElHermitianTridiagEigDCCtrl_s;
 EL_EXPORT ElError ElHermitianTridiagEigDCCtrlDefault_s
 ( ElHermitianTridiagEigDCCtrl_s* ctrl );
@@ -129,10 +134,29 @@ typedef struct {
   double deflationFudge;
   ElInt cutoff;
   bool exploitStructure;
+  ElInt taskCutoff;
 } ElHermitianTridiagEigDCCtrl_d;
 EL_EXPORT ElError ElHermitianTridiagEigDCCtrlDefault_d
 ( ElHermitianTridiagEigDCCtrl_d* ctrl );
 
+typedef struct {
+  bool native;
+  float minRelGap;
+  ElInt maxRQIIts;
+  ElInt maxDepth;
+} ElHermitianTridiagEigMRRRCtrl_s;
+EL_EXPORT ElError ElHermitianTridiagEigMRRRCtrlDefault_s
+( ElHermitianTridiagEigMRRRCtrl_s* ctrl );
+
+typedef struct {
+  bool native;
+  double minRelGap;
+  ElInt maxRQIIts;
+  ElInt maxDepth;
+} ElHermitianTridiagEigMRRRCtrl_d;
+EL_EXPORT ElError ElHermitianTridiagEigMRRRCtrlDefault_d
+( ElHermitianTridiagEigMRRRCtrl_d* ctrl );
+
 typedef struct {
   bool wantEigVecs;
   bool accumulateEigVecs;
@@ -142,6 +166,7 @@ typedef struct {
   ElHermitianTridiagEigAlg alg;
   ElHermitianTridiagEigQRCtrl qrCtrl;
   ElHermitianTridiagEigDCCtrl_s dcCtrl;
+  ElHermitianTridiagEigMRRRCtrl_s mrrrCtrl;
 } ElHermitianTridiagEigCtrl_s;
 EL_EXPORT ElError ElHermitianTridiagEigCtrlDefault_s
 ( ElHermitianTridiagEigCtrl_s* ctrl );
@@ -155,6 +180,7 @@ typedef struct {
   ElHermitianTridiagEigAlg alg;
   ElHermitianTridiagEigQRCtrl qrCtrl;
   ElHermitianTridiagEigDCCtrl_d dcCtrl;
+  ElHermitianTridiagEigMRRRCtrl_d mrrrCtrl;
 } ElHermitianTridiagEigCtrl_d;
 EL_EXPORT ElError ElHermitianTridiagEigCtrlDefault_s
 ( ElHermitianTridiagEigCtrl_s* ctrl );
@@ -216,6 +242,7 @@ typedef struct {
   float tol;
   float spreadFactor;
   bool progress;
+  bool qdwhEig;
 } ElHermitianSDCCtrl_s;
 EL_EXPORT ElError ElHermitianSDCCtrlDefault_s( ElHermitianSDCCtrl_s* ctrl );
 
@@ -225,6 +252,7 @@ typedef struct {
   double tol;
   double spreadFactor;
   bool progress;
+  bool qdwhEig;
 } ElHermitianSDCCtrl_d;
 EL_EXPORT ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl );
 
@@ -620,6 +648,8 @@ typedef struct {
   bool scalapack;
   ElInt blockHeight;
   ElInt (*numBulgesPerBlock)(ElInt);
+  ElInt minDistAEDSize;
+  ElInt (*distAEDGridDim)(ElInt,ElInt);
 } ElHessenbergSchurCtrl;
 EL_EXPORT ElError ElHessenbergSchurCtrlDefault( ElHessenbergSchurCtrl* ctrl );
 
@@ -812,6 +842,10 @@ typedef struct {
   double fullChanRatio;
 
   ElBidiagSVDCtrl_s bidiagSVDCtrl;
+
+  bool useQDWH;
+  ElQDWHCtrl qdwhCtrl;
+  ElHermitianSDCCtrl_s sdcCtrl;
 } ElSVDCtrl_s;
 EL_EXPORT ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl );
 
@@ -826,6 +860,10 @@ typedef struct {
   double fullChanRatio;
 
   ElBidiagSVDCtrl_d bidiagSVDCtrl;
+
+  bool useQDWH;
+  ElQDWHCtrl qdwhCtrl;
+  ElHermitianSDCCtrl_d sdcCtrl;
 } ElSVDCtrl_d;
 EL_EXPORT ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl );
 
@@ -1045,6 +1083,9 @@ typedef struct {
   ElInt basisSize;
   bool reorthog;
 
+  ElInt numSubgrids;
+  ElInt shiftBatchSize;
+
   bool progress;
 
   ElSnapshotCtrl snapCtrl;
@@ -1070,6 +1111,9 @@ typedef struct {
   ElInt basisSize;
   bool reorthog;
 
+  ElInt numSubgrids;
+  ElInt shiftBatchSize;
+
   bool progress;
 
   ElSnapshotCtrl snapCtrl;
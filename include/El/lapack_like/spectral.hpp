@@ -10,6 +10,7 @@
 #define EL_SPECTRAL_HPP
 
 #include <El/lapack_like/condense.hpp>
+#include <El/lapack_like/factor.hpp>
 
 namespace El {
 
@@ -85,6 +86,10 @@ struct SecularEVDCtrl
     bool progress = false;
 
     CubicSecularCtrl cubicCtrl;
+
+    // When Elemental is built with OpenMP support (EL_HYBRID), batches of at
+    // least 'batchCutoff' roots are solved concurrently.
+    Int batchCutoff = 256;
 };
 
 // Compute a single eigenvalue corresponding to the diagonal plus rank-one
@@ -122,6 +127,20 @@ SecularEigenvalue
         Matrix<Real>& dMinusShift,
   const SecularEVDCtrl<Real>& ctrl=SecularEVDCtrl<Real>() );
 
+// Compute all of the eigenvalues of diag(d) + rho z z^T (under the same
+// assumptions as SecularEigenvalue), with the accurately-computed differences
+// d - w(j) returned in the j'th column of 'dMinusShifts'.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+SecularEVDInfo
+SecularEigenvalues
+( const Matrix<Real>& d,
+  const Real& rho,
+  const Matrix<Real>& z,
+        Matrix<Real>& w,
+        Matrix<Real>& dMinusShifts,
+  const SecularEVDCtrl<Real>& ctrl=SecularEVDCtrl<Real>() );
+
 // Note that this routine requires that d(0) <= d(1) <= ... <= d(n-1) and
 // that || z ||_2 = 1.
 template<typename Real,
@@ -169,6 +188,10 @@ struct SecularSVDCtrl
     bool progress = false;
 
     CubicSecularCtrl cubicCtrl;
+
+    // When Elemental is built with OpenMP support (EL_HYBRID), batches of at
+    // least 'batchCutoff' roots are solved concurrently.
+    Int batchCutoff = 256;
 };
 
 // Compute a single singular value corresponding to the square-root of an
@@ -215,6 +238,23 @@ SecularSingularValue
         Matrix<Real>& dPlusShift,
   const SecularSVDCtrl<Real>& ctrl=SecularSVDCtrl<Real>() );
 
+// Compute all of the singular values corresponding to the square-roots of the
+// eigenvalues of diag(d)^2 + rho z z^T (under the same assumptions as
+// SecularSingularValue), with the accurately-computed differences d - s(j) and
+// sums d + s(j) returned in the j'th columns of 'dMinusShifts' and
+// 'dPlusShifts'.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+SecularSVDInfo
+SecularSingularValues
+( const Matrix<Real>& d,
+  const Real& rho,
+  const Matrix<Real>& z,
+        Matrix<Real>& s,
+        Matrix<Real>& dMinusShifts,
+        Matrix<Real>& dPlusShifts,
+  const SecularSVDCtrl<Real>& ctrl=SecularSVDCtrl<Real>() );
+
 // Note that this routine requires that 0 = d(0) <= d(1) <= ... <= d(n-1) and
 // that || z ||_2 = 1.
 template<typename Real,
@@ -301,6 +341,46 @@ struct DCCtrl
     // eigenvectors with the outer singular vectors? This should only be
     // disabled for academic reasons.
     bool exploitStructure = true;
+
+    // When Elemental is built with OpenMP support (EL_HYBRID), subproblems of
+    // height at least 'taskCutoff' are solved as concurrent tasks, as are the
+    // secular equations and eigenvector updates of their merges.
+    Int taskCutoff = 256;
+};
+
+struct MRRRInfo
+{
+    // The number of (non-root) relatively robust representations formed to
+    // resolve clusters of eigenvalues
+    Int numRepresentations=0;
+    Int numRQIIterations=0;
+    // The number of clusters whose eigenvectors were explicitly orthogonalized
+    // since no sufficiently robust representation could be found
+    Int numOrthogonalizedClusters=0;
+};
+
+template<typename Real>
+struct MRRRCtrl
+{
+    // Use Elemental's native implementation of MRRR rather than LAPACK's
+    // (or, for distributed matrices, PMRRR's) for single- and double-precision?
+    // The native implementation is always used for the remaining datatypes.
+    // Its threading is governed by OpenMP (when EL_HYBRID is defined), whereas
+    // PMRRR maintains its own pool of threads.
+    bool native = false;
+
+    // Neighboring eigenvalues whose gap relative to their magnitude is at
+    // least 'minRelGap' are considered to be well-separated; the remainder are
+    // grouped into clusters which are resolved using a shifted representation.
+    // Cf. LAPACK's {s,d}larrv [CITATION] for the choice of 1e-3.
+    Real minRelGap = Real(1)/Real(1000);
+
+    // The maximum number of Rayleigh Quotient Iterations for each singleton
+    Int maxRQIIts = 10;
+
+    // The maximum depth of the representation tree before the eigenvectors of
+    // a cluster are explicitly orthogonalized
+    Int maxDepth = 20;
 };
 
 // Cf. Section 4 of Gu and Eisenstat's "A Divide-and-Conquer Algorithm for the
@@ -331,7 +411,7 @@ struct HermitianTridiagEigInfo
 {
     herm_tridiag_eig::QRInfo qrInfo;
     herm_tridiag_eig::DCInfo dcInfo;
-    // TODO(poulson): MRRR info
+    herm_tridiag_eig::MRRRInfo mrrrInfo;
 };
 
 enum HermitianTridiagEigAlg {
@@ -353,7 +433,7 @@ struct HermitianTridiagEigCtrl
     HermitianTridiagEigAlg alg=HERM_TRIDIAG_EIG_MRRR;
     herm_tridiag_eig::QRCtrl qrCtrl;
     herm_tridiag_eig::DCCtrl<Real> dcCtrl;
-    // TODO(poulson): MRRR ctrl
+    herm_tridiag_eig::MRRRCtrl<Real> mrrrCtrl;
 };
 
 // Compute eigenvalues
@@ -405,6 +485,14 @@ struct HermitianSDCCtrl
     Real tol=Real(0);
     Real spreadFactor=Real(1e-6);
     bool progress=false;
+
+    // Use the QDWH-eig splitting of Nakatsukasa and Higham, which first
+    // attempts to split at the median of the diagonal and reads the rank of
+    // the split off of the trace of the spectral projector, rather than a
+    // randomized URV decomposition of the projector. In this case,
+    // 'maxInnerIts' is the number of steps of subspace iteration used to
+    // compute a basis for the range of the projector.
+    bool qdwhEig=false;
 };
 
 template<typename Field>
@@ -715,6 +803,12 @@ inline Int SufficientDeflation( Int deflationSize )
     return (nibble*deflationSize) / 100;
 }
 
+// The dimension of the square process grid that the distributed AED uses for
+// the Schur decomposition of a deflation window; each process is assigned
+// roughly an 8 x 8 array of distribution blocks of the window.
+inline Int DistGridDim( Int deflationSize, Int blockHeight )
+{ return Max( Int(1), deflationSize/(8*Max(blockHeight,Int(1))) ); }
+
 } // namespace aed
 
 } // namespace hess_schur
@@ -763,6 +857,14 @@ struct HessenbergSchurCtrl
     // the distributed multibulge algorithm.
     function<Int(Int)> numBulgesPerBlock =
       function<Int(Int)>(hess_schur::multibulge::NumBulgesPerBlock);
+    // Deflation windows at least this large have their Schur decompositions
+    // computed on a square subgrid (as in ScaLAPACK's PDLAQR3) rather than
+    // on a single process.
+    Int minDistAEDSize = 500;
+    // A map from the deflation window size and the distribution block height
+    // to the dimension of said subgrid.
+    function<Int(Int,Int)> distAEDGridDim =
+      function<Int(Int,Int)>(hess_schur::aed::DistGridDim);
 };
 
 template<typename Field>
@@ -1238,6 +1340,16 @@ struct SVDCtrl
     double fullChanRatio=1.5;
 
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
+
+    // QDWH-SVD
+    // --------
+    // Compute the polar decomposition A = U_p H via QDWH and then the
+    // eigenvalue decomposition H = V diag(s) V^H via QDWH-eig so that
+    // A = (U_p V) diag(s) V^H. Only thin and compact SVDs are supported;
+    // sdcCtrl.qdwhEig is ignored since QDWH-eig is always used.
+    bool useQDWH=false;
+    QDWHCtrl qdwhCtrl;
+    HermitianSDCCtrl<Real> sdcCtrl;
 };
 
 // Compute the singular values
@@ -1357,6 +1469,42 @@ SVDInfo TSQR
 
 } // namespace svd
 
+// Randomized SVD
+// ==============
+// Compute an approximate truncated SVD, A ~= U diag(s) V^H, with (at most)
+// ctrl.rank singular triplets, from the SVD of the small matrix Q^H A, where
+// Q is returned by RangeFinder. See Algorithm 5.1 of Halko, Martinsson, and
+// Tropp's "Finding structure with randomness".
+template<typename Field>
+void RSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+template<typename Field>
+void RSVD
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+template<typename Field>
+void RSVD
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+// NOTE: The singular values are stored redundantly on every process
+template<typename Field>
+void RSVD
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& U,
+        Matrix<Base<Field>>& s,
+        DistMultiVec<Field>& V,
+  const RandomizedCtrl<Base<Field>>& ctrl=RandomizedCtrl<Base<Field>>() );
+
 // Hermitian SVD
 // =============
 
@@ -1549,6 +1697,147 @@ pair<Base<Field>,Base<Field>>
 HermitianExtremalSingValEst
 ( const DistSparseMatrix<Field>& A, Int basisSize=20 );
 
+// Thick-restart Lanczos and LOBPCG
+// ================================
+// Compute a few extremal eigenpairs of a Hermitian matrix (or operator, see
+// El/lapack_like/spectral/KrylovEig.hpp) with locking of converged Ritz pairs.
+
+namespace EigTargetNS {
+enum EigTarget
+{
+  EIG_SMALLEST,
+  EIG_LARGEST,
+  EIG_LARGEST_MAGNITUDE
+};
+}
+using namespace EigTargetNS;
+
+template<typename Real>
+struct KrylovEigCtrl
+{
+    Int numEigs=1;
+    EigTarget target=EIG_SMALLEST;
+
+    // The maximum number of Lanczos vectors (if zero, max(2 numEigs,
+    // numEigs+20) is used)
+    Int basisSize=0;
+    // The LOBPCG block size (which is increased to numEigs if it is smaller)
+    Int blockSize=0;
+
+    // A Ritz pair (theta,x) is locked once || A x - theta x ||_2 is at most
+    // 'tol' times the running estimate of || A ||_2. If 'tol' is zero,
+    // eps^(2/3) is used.
+    Real tol=0;
+    // The maximum number of restarts (Lanczos) or iterations (LOBPCG)
+    Int maxIts=1000;
+
+    // If 'shiftInvert' is true, the sparse-matrix drivers factor A - shift I
+    // with a sparse LDL factorization. Lanczos is then run on its inverse to
+    // find the eigenvalues nearest 'shift' (in order of increasing distance
+    // and ignoring 'target'), whereas LOBPCG uses the inverse as the
+    // preconditioner (and 'shift' should lie below the desired eigenvalues).
+    bool shiftInvert=false;
+    Real shift=0;
+
+    bool progress=false;
+};
+
+struct KrylovEigInfo
+{
+    Int numIts=0;
+    Int numApplications=0;
+    Int numLocked=0;
+    bool converged=false;
+};
+
+template<typename Field>
+KrylovEigInfo ThickRestartLanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl=KrylovEigCtrl<Base<Field>>() );
+template<typename Field>
+KrylovEigInfo ThickRestartLanczos
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl=KrylovEigCtrl<Base<Field>>() );
+
+template<typename Field>
+KrylovEigInfo LOBPCG
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl=KrylovEigCtrl<Base<Field>>() );
+template<typename Field>
+KrylovEigInfo LOBPCG
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl=KrylovEigCtrl<Base<Field>>() );
+
+// Spectrum slicing
+// ================
+// Compute the eigenpairs of a sparse Hermitian matrix with eigenvalues in the
+// window (lowerBound,upperBound] of 'subset' (or, if no subset is requested,
+// in a Gershgorin interval containing the entire spectrum).
+//
+// The window is recursively bisected, using the inertia of sparse LDL^H
+// factorizations of A - sigma I to count the eigenvalues in each slice, until
+// no slice holds more than 'maxEigsPerSlice' eigenvalues. The processes are
+// then split into 'numTeams' teams, each of which is given a copy of A and
+// runs shift-and-invert thick-restart Lanczos about the midpoints of its share
+// of the slices. Since the inertia provides the exact number of eigenvalues in
+// each slice, missing (e.g., repeated) eigenvalues are recovered by deflating
+// the converged eigenvectors and restarting Lanczos.
+//
+// Index subsets are not yet supported.
+
+template<typename Real>
+struct SpectrumSliceCtrl
+{
+    HermitianEigSubset<Real> subset;
+
+    // If zero, each process forms its own team
+    Int numTeams=0;
+    Int maxEigsPerSlice=50;
+    // The maximum number of deflated Lanczos runs per slice
+    Int maxPasses=3;
+
+    LDLFrontType frontType=LDL_2D;
+    BisectCtrl bisectCtrl;
+    // The 'numEigs', 'target', and 'shiftInvert' members are overwritten
+    KrylovEigCtrl<Real> krylovCtrl;
+
+    bool progress=false;
+};
+
+struct SpectrumSliceInfo
+{
+    Int numSlices=0;
+    Int numFactorizations=0;
+    // The number of eigenvalues in the window according to the inertia
+    Int numEigs=0;
+    // The number of eigenpairs which were computed
+    Int numFound=0;
+    bool converged=false;
+};
+
+template<typename Field>
+SpectrumSliceInfo
+HermitianEig
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl=SpectrumSliceCtrl<Base<Field>>() );
+template<typename Field>
+SpectrumSliceInfo
+HermitianEig
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl=SpectrumSliceCtrl<Base<Field>>() );
+
 // Pseudospectra
 // =============
 enum PseudospecNorm {
@@ -1606,6 +1895,14 @@ struct PseudospecCtrl
     Int basisSize=10;
     bool reorthog=true; // only matters for IRL, which isn't currently used
 
+    // If numSubgrids > 1, the distributed routines split the processes into
+    // (up to) this many subgrids, each of which redundantly stores the
+    // matrix and repeatedly claims batches of shiftBatchSize shifts until
+    // none remain. A shiftBatchSize of zero chooses roughly four batches per
+    // subgrid.
+    Int numSubgrids=1;
+    Int shiftBatchSize=0;
+
     // Whether or not to print progress information at each iteration
     bool progress=false;
 
@@ -2014,5 +2311,6 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 #include <El/lapack_like/spectral/SVD.hpp>
 #include <El/lapack_like/spectral/Lanczos.hpp>
 #include <El/lapack_like/spectral/ProductLanczos.hpp>
+#include <El/lapack_like/spectral/KrylovEig.hpp>
 
 #endif // ifndef EL_SPECTRAL_HPP
@@ -45,6 +45,7 @@ CReflect( const SecularEVDCtrl<float>& ctrl )
     ctrlC.penalizeDerivative = ctrl.penalizeDerivative;
     ctrlC.progress = ctrl.progress;
     ctrlC.cubicCtrl = CReflect( ctrl.cubicCtrl );
+    ctrlC.batchCutoff = ctrl.batchCutoff;
     return ctrlC;
 }
 
@@ -58,6 +59,7 @@ CReflect( const SecularEVDCtrl<double>& ctrl )
     ctrlC.penalizeDerivative = ctrl.penalizeDerivative;
     ctrlC.progress = ctrl.progress;
     ctrlC.cubicCtrl = CReflect( ctrl.cubicCtrl );
+    ctrlC.batchCutoff = ctrl.batchCutoff;
     return ctrlC;
 }
 
@@ -71,6 +73,7 @@ CReflect( const ElSecularEVDCtrl_s& ctrlC )
     ctrl.penalizeDerivative = ctrlC.penalizeDerivative;
     ctrl.progress = ctrlC.progress;
     ctrl.cubicCtrl = CReflect( ctrlC.cubicCtrl );
+    ctrl.batchCutoff = ctrlC.batchCutoff;
     return ctrl;
 }
 
@@ -84,6 +87,7 @@ CReflect( const ElSecularEVDCtrl_d& ctrlC )
     ctrl.penalizeDerivative = ctrlC.penalizeDerivative;
     ctrl.progress = ctrlC.progress;
     ctrl.cubicCtrl = CReflect( ctrlC.cubicCtrl );
+    ctrl.batchCutoff = ctrlC.batchCutoff;
     return ctrl;
 }
 
@@ -98,6 +102,7 @@ CReflect( const SecularSVDCtrl<float>& ctrl )
     ctrlC.penalizeDerivative = ctrl.penalizeDerivative;
     ctrlC.progress = ctrl.progress;
     ctrlC.cubicCtrl = CReflect( ctrl.cubicCtrl );
+    ctrlC.batchCutoff = ctrl.batchCutoff;
     return ctrlC;
 }
 
@@ -111,6 +116,7 @@ CReflect( const SecularSVDCtrl<double>& ctrl )
     ctrlC.penalizeDerivative = ctrl.penalizeDerivative;
     ctrlC.progress = ctrl.progress;
     ctrlC.cubicCtrl = CReflect( ctrl.cubicCtrl );
+    ctrlC.batchCutoff = ctrl.batchCutoff;
     return ctrlC;
 }
 
@@ -124,6 +130,7 @@ CReflect( const ElSecularSVDCtrl_s& ctrlC )
     ctrl.penalizeDerivative = ctrlC.penalizeDerivative;
     ctrl.progress = ctrlC.progress;
     ctrl.cubicCtrl = CReflect( ctrlC.cubicCtrl );
+    ctrl.batchCutoff = ctrlC.batchCutoff;
     return ctrl;
 }
 
@@ -137,6 +144,7 @@ CReflect( const ElSecularSVDCtrl_d& ctrlC )
     ctrl.penalizeDerivative = ctrlC.penalizeDerivative;
     ctrl.progress = ctrlC.progress;
     ctrl.cubicCtrl = CReflect( ctrlC.cubicCtrl );
+    ctrl.batchCutoff = ctrlC.batchCutoff;
     return ctrl;
 }
 
@@ -232,6 +240,7 @@ inline herm_tridiag_eig::DCCtrl<float> CReflect
     ctrl.deflationFudge = ctrlC.deflationFudge;
     ctrl.cutoff = ctrlC.cutoff;
     ctrl.exploitStructure = ctrlC.exploitStructure;
+    ctrl.taskCutoff = ctrlC.taskCutoff;
     return ctrl;
 }
 
@@ -243,6 +252,7 @@ inline herm_tridiag_eig::DCCtrl<double> CReflect
     ctrl.deflationFudge = ctrlC.deflationFudge;
     ctrl.cutoff = ctrlC.cutoff;
     ctrl.exploitStructure = ctrlC.exploitStructure;
+    ctrl.taskCutoff = ctrlC.taskCutoff;
     return ctrl;
 }
 
@@ -254,6 +264,7 @@ inline ElHermitianTridiagEigDCCtrl_s CReflect
     ctrlC.deflationFudge = ctrl.deflationFudge;
     ctrlC.cutoff = ctrl.cutoff;
     ctrlC.exploitStructure = ctrl.exploitStructure;
+    ctrlC.taskCutoff = ctrl.taskCutoff;
     return ctrlC;
 }
 inline ElHermitianTridiagEigDCCtrl_d CReflect
@@ -264,6 +275,7 @@ inline ElHermitianTridiagEigDCCtrl_d CReflect
     ctrlC.deflationFudge = ctrl.deflationFudge;
     ctrlC.cutoff = ctrl.cutoff;
     ctrlC.exploitStructure = ctrl.exploitStructure;
+    ctrlC.taskCutoff = ctrl.taskCutoff;
     return ctrlC;
 }
 
@@ -345,6 +357,7 @@ inline ElHermitianSDCCtrl_s CReflect( const HermitianSDCCtrl<float>& ctrl )
     ctrlC.tol = ctrl.tol;
     ctrlC.spreadFactor = ctrl.spreadFactor;
     ctrlC.progress = ctrl.progress;
+    ctrlC.qdwhEig = ctrl.qdwhEig;
     return ctrlC;
 }
 inline ElHermitianSDCCtrl_d CReflect( const HermitianSDCCtrl<double>& ctrl )
@@ -356,6 +369,7 @@ inline ElHermitianSDCCtrl_d CReflect( const HermitianSDCCtrl<double>& ctrl )
     ctrlC.tol = ctrl.tol;
     ctrlC.spreadFactor = ctrl.spreadFactor;
     ctrlC.progress = ctrl.progress;
+    ctrlC.qdwhEig = ctrl.qdwhEig;
     return ctrlC;
 }
 
@@ -368,6 +382,7 @@ inline HermitianSDCCtrl<float> CReflect( const ElHermitianSDCCtrl_s& ctrlC )
     ctrl.tol = ctrlC.tol;
     ctrl.spreadFactor = ctrlC.spreadFactor;
     ctrl.progress = ctrlC.progress;
+    ctrl.qdwhEig = ctrlC.qdwhEig;
     return ctrl;
 }
 inline HermitianSDCCtrl<double> CReflect( const ElHermitianSDCCtrl_d& ctrlC )
@@ -379,6 +394,7 @@ inline HermitianSDCCtrl<double> CReflect( const ElHermitianSDCCtrl_d& ctrlC )
     ctrl.tol = ctrlC.tol;
     ctrl.spreadFactor = ctrlC.spreadFactor;
     ctrl.progress = ctrlC.progress;
+    ctrl.qdwhEig = ctrlC.qdwhEig;
     return ctrl;
 }
 
@@ -686,6 +702,9 @@ inline SVDCtrl<float> CReflect( const ElSVDCtrl_s& ctrlC )
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
+    ctrl.useQDWH = ctrlC.useQDWH;
+    ctrl.qdwhCtrl = CReflect(ctrlC.qdwhCtrl);
+    ctrl.sdcCtrl = CReflect(ctrlC.sdcCtrl);
     return ctrl;
 }
 
@@ -699,6 +718,9 @@ inline SVDCtrl<double> CReflect( const ElSVDCtrl_d& ctrlC )
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
+    ctrl.useQDWH = ctrlC.useQDWH;
+    ctrl.qdwhCtrl = CReflect(ctrlC.qdwhCtrl);
+    ctrl.sdcCtrl = CReflect(ctrlC.sdcCtrl);
     return ctrl;
 }
 
@@ -712,6 +734,9 @@ inline ElSVDCtrl_s CReflect( const SVDCtrl<float>& ctrl )
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
+    ctrlC.useQDWH = ctrl.useQDWH;
+    ctrlC.qdwhCtrl = CReflect(ctrl.qdwhCtrl);
+    ctrlC.sdcCtrl = CReflect(ctrl.sdcCtrl);
     return ctrlC;
 }
 
@@ -725,6 +750,9 @@ inline ElSVDCtrl_d CReflect( const SVDCtrl<double>& ctrl )
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
+    ctrlC.useQDWH = ctrl.useQDWH;
+    ctrlC.qdwhCtrl = CReflect(ctrl.qdwhCtrl);
+    ctrlC.sdcCtrl = CReflect(ctrl.sdcCtrl);
     return ctrlC;
 }
 
@@ -783,6 +811,14 @@ inline ElHessenbergSchurCtrl CReflect( const HessenbergSchurCtrl& ctrl )
     else
         RuntimeError
         ("Could not convert numBulgesPerBlock to C function pointer");
+    ctrlC.minDistAEDSize = ctrl.minDistAEDSize;
+    auto distAEDGridDimRes =
+      ctrl.distAEDGridDim.target<ElInt(*)(ElInt,ElInt)>();
+    if( distAEDGridDimRes )
+        ctrlC.distAEDGridDim = *distAEDGridDimRes;
+    else
+        RuntimeError
+        ("Could not convert distAEDGridDim to C function pointer");
 
     return ctrlC;
 }
@@ -813,6 +849,8 @@ inline HessenbergSchurCtrl CReflect( const ElHessenbergSchurCtrl& ctrlC )
     ctrl.scalapack = ctrlC.scalapack;
     ctrl.blockHeight = ctrlC.blockHeight;
     ctrl.numBulgesPerBlock = ctrlC.numBulgesPerBlock;
+    ctrl.minDistAEDSize = ctrlC.minDistAEDSize;
+    ctrl.distAEDGridDim = ctrlC.distAEDGridDim;
 
     return ctrl;
 }
@@ -964,6 +1002,8 @@ inline ElPseudospecCtrl_s CReflect( const PseudospecCtrl<float>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.numSubgrids = ctrl.numSubgrids;
+    ctrlC.shiftBatchSize = ctrl.shiftBatchSize;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -983,6 +1023,8 @@ inline ElPseudospecCtrl_d CReflect( const PseudospecCtrl<double>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.numSubgrids = ctrl.numSubgrids;
+    ctrlC.shiftBatchSize = ctrl.shiftBatchSize;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -1003,6 +1045,8 @@ inline PseudospecCtrl<float> CReflect( const ElPseudospecCtrl_s& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.numSubgrids = ctrlC.numSubgrids;
+    ctrl.shiftBatchSize = ctrlC.shiftBatchSize;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -1022,6 +1066,8 @@ inline PseudospecCtrl<double> CReflect( const ElPseudospecCtrl_d& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.numSubgrids = ctrlC.numSubgrids;
+    ctrl.shiftBatchSize = ctrlC.shiftBatchSize;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -0,0 +1,786 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SPECTRAL_KRYLOVEIG_HPP
+#define EL_SPECTRAL_KRYLOVEIG_HPP
+
+namespace El {
+
+// Compute a few extremal eigenpairs of a Hermitian operator using either
+// thick-restart Lanczos [Wu/Simon, "Thick-restart Lanczos method for large
+// symmetric eigenvalue problems"] or the Locally Optimal Block Preconditioned
+// Conjugate Gradient method [Knyazev, "Toward the optimal preconditioned
+// eigensolver: LOBPCG"].
+//
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA( const MatType& X, MatType& Y )
+//
+// and overwrite Y := A X, whereas 'applyPrecond' should have the form
+//
+//   void applyPrecond( MatType& W )
+//
+// and overwrite W with inv(T) W, where T is a Hermitian positive-definite
+// preconditioner (e.g., a factorization of A - shift I for a shift below the
+// desired eigenvalues). MatType may be either Matrix<Field> or
+// DistMultiVec<Field>.
+//
+// Both methods are implemented in terms of the local rows of the (row-
+// distributed) blocks of vectors so that the Matrix and DistMultiVec versions
+// share the same code; the only difference is the communicator over which
+// inner products are summed.
+//
+
+namespace krylov_eig {
+
+// Return the indices of the Ritz values in their order of preference
+template<typename Real>
+vector<Int> PreferredOrder( const Matrix<Real>& theta, EigTarget target )
+{
+    EL_DEBUG_CSE
+    const Int k = theta.Height();
+    vector<Int> order( k );
+    for( Int i=0; i<k; ++i )
+        order[i] = i;
+    if( target == EIG_SMALLEST )
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( Int i, Int j ) { return theta(i) < theta(j); } );
+    else if( target == EIG_LARGEST )
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( Int i, Int j ) { return theta(i) > theta(j); } );
+    else
+        std::stable_sort
+        ( order.begin(), order.end(),
+          [&]( Int i, Int j ) { return Abs(theta(i)) > Abs(theta(j)); } );
+    return order;
+}
+
+// C := A^H B, where the rows of A and B are distributed over 'comm'
+template<typename Field>
+void InnerProducts
+( const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& C,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    // Ensure that C is contiguous so that it can be summed in place
+    C.Empty();
+    Zeros( C, A.Width(), B.Width() );
+    if( A.Height() > 0 )
+        Gemm( ADJOINT, NORMAL, Field(1), A, B, Field(0), C );
+    mpi::AllReduce( C.Buffer(), C.Height()*C.Width(), comm );
+}
+
+// Return the two-norms of the columns of A, whose rows are distributed over
+// 'comm'
+template<typename Field>
+void ColumnNorms
+( const Matrix<Field>& A,
+        Matrix<Base<Field>>& norms,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int height = A.Height();
+    const Int width = A.Width();
+    Zeros( norms, width, 1 );
+    for( Int j=0; j<width; ++j )
+    {
+        Real normSquared = 0;
+        for( Int i=0; i<height; ++i )
+        {
+            const Real alpha = Abs(A(i,j));
+            normSquared += alpha*alpha;
+        }
+        norms(j) = normSquared;
+    }
+    mpi::AllReduce( norms.Buffer(), width, comm );
+    for( Int j=0; j<width; ++j )
+        norms(j) = Sqrt(norms(j));
+}
+
+// W := (I - Q Q^H) W using classical Gram-Schmidt with reorthogonalization.
+// The (summed) projection coefficients are returned in H.
+template<typename Field>
+void Orthogonalize
+( const Matrix<Field>& Q,
+        Matrix<Field>& W,
+        Matrix<Field>& H,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> HCorr;
+    InnerProducts( Q, W, H, comm );
+    Gemm( NORMAL, NORMAL, Field(-1), Q, H, Field(1), W );
+    InnerProducts( Q, W, HCorr, comm );
+    Gemm( NORMAL, NORMAL, Field(-1), Q, HCorr, Field(1), W );
+    H += HCorr;
+}
+
+// Overwrite the column w with a random unit vector orthogonal to Q
+template<typename Field>
+void RandomOrthogonalVector
+( const Matrix<Field>& Q,
+        Matrix<Field>& w,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Field> r, H;
+    Matrix<Real> norms;
+    Gaussian( r, w.Height(), 1 );
+    Orthogonalize( Q, r, H, comm );
+    ColumnNorms( r, norms, comm );
+    r *= Real(1)/norms(0);
+    w = r;
+}
+
+// Overwrite S with an orthonormal basis for its span, dropping numerically
+// dependent directions, and apply the same transformation to AS = A S using
+// the SVQB algorithm of Stathopoulos and Wu.
+template<typename Field>
+void SVQB( Matrix<Field>& S, Matrix<Field>& AS, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    for( Int pass=0; pass<2; ++pass )
+    {
+        const Int k = S.Width();
+        if( k == 0 )
+            return;
+
+        // Form the Gram matrix with a unit diagonal
+        Matrix<Field> G;
+        InnerProducts( S, S, G, comm );
+        Matrix<Real> d;
+        Zeros( d, k, 1 );
+        for( Int j=0; j<k; ++j )
+        {
+            const Real gamma = RealPart(G(j,j));
+            d(j) = ( gamma > Real(0) ? Real(1)/Sqrt(gamma) : Real(0) );
+        }
+        for( Int j=0; j<k; ++j )
+            for( Int i=0; i<k; ++i )
+                G(i,j) *= d(i)*d(j);
+
+        // Drop the directions whose Gram eigenvalues are negligible and scale
+        // the remainder to be orthonormal
+        Matrix<Real> lambda;
+        Matrix<Field> U;
+        HermitianEig( LOWER, G, lambda, U );
+        const Real lambdaMax = lambda(k-1);
+        if( lambdaMax <= Real(0) )
+        {
+            S.Resize( S.Height(), 0 );
+            AS.Resize( AS.Height(), 0 );
+            return;
+        }
+        Int numDrop = 0;
+        while( lambda(numDrop) <= k*eps*lambdaMax )
+            ++numDrop;
+        const Int kNew = k - numDrop;
+        Matrix<Field> C;
+        Zeros( C, k, kNew );
+        for( Int j=0; j<kNew; ++j )
+        {
+            const Real scale = Real(1)/Sqrt(lambda(numDrop+j));
+            for( Int i=0; i<k; ++i )
+                C(i,j) = d(i)*U(i,numDrop+j)*scale;
+        }
+        Matrix<Field> Z;
+        Gemm( NORMAL, NORMAL, Field(1), S, C, Z );
+        S = Z;
+        Gemm( NORMAL, NORMAL, Field(1), AS, C, Z );
+        AS = Z;
+
+        // A second pass is only needed if S was ill-conditioned
+        if( lambda(numDrop) > Sqrt(eps)*lambdaMax )
+            break;
+    }
+}
+
+// Return the coefficients, U, of the 'numSel' preferred Ritz vectors, S U,
+// from the subspace spanned by the orthonormal S
+template<typename Field>
+void RayleighRitz
+( const Matrix<Field>& S,
+  const Matrix<Field>& AS,
+        EigTarget target,
+        Int numSel,
+        Matrix<Field>& USel,
+        Matrix<Base<Field>>& theta,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int k = S.Width();
+    numSel = Min( numSel, k );
+
+    Matrix<Field> H, HAdj, U;
+    Matrix<Real> lambda;
+    InnerProducts( S, AS, H, comm );
+    Adjoint( H, HAdj );
+    H += HAdj;
+    H *= Real(1)/Real(2);
+    HermitianEig( LOWER, H, lambda, U );
+
+    const vector<Int> order = PreferredOrder( lambda, target );
+    Zeros( USel, k, numSel );
+    Zeros( theta, numSel, 1 );
+    for( Int j=0; j<numSel; ++j )
+    {
+        theta(j) = lambda(order[j]);
+        for( Int i=0; i<k; ++i )
+            USel(i,j) = U(i,order[j]);
+    }
+}
+
+// Permute the eigenpairs into their order of preference
+template<typename Field>
+void SortEigenpairs
+( Matrix<Base<Field>>& w,
+  Matrix<Field>& X,
+  EigTarget target )
+{
+    EL_DEBUG_CSE
+    const Int k = w.Height();
+    const vector<Int> order = PreferredOrder( w, target );
+    auto wCopy( w );
+    Matrix<Field> XCopy;
+    GetSubmatrix( X, IR(0,X.Height()), order, XCopy );
+    for( Int j=0; j<k; ++j )
+        w(j) = wCopy(order[j]);
+    X = XCopy;
+}
+
+template<typename Field,class ApplyAType>
+KrylovEigInfo ThickRestartLanczos
+(       Int n,
+        Int localHeight,
+        mpi::Comm comm,
+  const ApplyAType& applyA,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol =
+      ( ctrl.tol > Real(0) ? ctrl.tol : Pow(eps,Real(2)/Real(3)) );
+    const Int numEigs = ctrl.numEigs;
+    if( numEigs < 1 )
+        LogicError("Must request at least one eigenpair");
+    Int m =
+      ( ctrl.basisSize > 0 ? ctrl.basisSize : Max(2*numEigs,numEigs+20) );
+    m = Min( m, n-numEigs-1 );
+    if( m <= numEigs )
+        LogicError
+        ("The basis size must exceed the number of eigenpairs and be less "
+         "than n minus the number of eigenpairs (use HermitianEig for small "
+         "problems)");
+
+    // The first 'numLocked' columns of Q hold the converged Ritz vectors,
+    // which are deflated from the operator by keeping the Lanczos basis
+    // (stored in the following m+1 columns) orthogonal to them.
+    Matrix<Field> Q, wVec, H;
+    Matrix<Real> wLock, T, theta, Y, norms;
+    Zeros( Q, localHeight, numEigs+m+1 );
+    Zeros( wLock, numEigs, 1 );
+    Zeros( T, m, m );
+    Int numLocked = 0;
+    Real normEst = 0;
+    {
+        auto q0 = Q( ALL, IR(0) );
+        RandomOrthogonalVector( Q( ALL, IR(0,0) ), q0, comm );
+    }
+
+    KrylovEigInfo info;
+    vector<Int> keepInds;
+    Int k = 0;
+    for( Int restart=0; true; ++restart )
+    {
+        ++info.numIts;
+
+        // Expand the (thick-restarted) Lanczos decomposition to m vectors
+        // ===============================================================
+        Real betaLast = 0;
+        for( Int j=k; j<m; ++j )
+        {
+            const Int jQ = numLocked + j;
+            auto qj = Q( ALL, IR(jQ) );
+            auto qjp1 = Q( ALL, IR(jQ+1) );
+            auto QPrev = Q( ALL, IR(0,jQ+1) );
+            applyA( qj, wVec );
+            ++info.numApplications;
+
+            // Orthogonalize against the locked vectors and the entire basis
+            // since the three-term recurrence loses orthogonality
+            Orthogonalize( QPrev, wVec, H, comm );
+            const Real alpha = RealPart(H(jQ));
+            ColumnNorms( wVec, norms, comm );
+            const Real beta = norms(0);
+            T(j,j) = alpha;
+            normEst = Max( normEst, Abs(alpha) );
+
+            if( beta <= n*eps*normEst )
+            {
+                // An invariant subspace was found; continue with a random
+                // vector which is decoupled from the current basis
+                RandomOrthogonalVector( QPrev, qjp1, comm );
+                betaLast = 0;
+            }
+            else
+            {
+                wVec *= Real(1)/beta;
+                qjp1 = wVec;
+                betaLast = beta;
+            }
+            if( j < m-1 )
+                T(j+1,j) = T(j,j+1) = betaLast;
+        }
+
+        // Compute the Ritz pairs and their residual norms,
+        //   || A (V y_i) - theta_i (V y_i) ||_2 = |beta y_i(m-1)|
+        // =======================================================
+        auto TCopy( T );
+        HermitianEig( LOWER, TCopy, theta, Y );
+        for( Int i=0; i<m; ++i )
+            normEst = Max( normEst, Abs(theta(i)) );
+        const vector<Int> order = PreferredOrder( theta, ctrl.target );
+
+        // Lock the desired Ritz pairs which have converged
+        // ================================================
+        const Int numWanted = numEigs - numLocked;
+        vector<Int> lockInds, unlockedInds;
+        Real maxResid = 0;
+        for( Int l=0; l<m; ++l )
+        {
+            const Int i = order[l];
+            const Real resid = Abs(betaLast*Y(m-1,i));
+            if( l < numWanted && resid <= tol*normEst )
+            {
+                lockInds.push_back( i );
+            }
+            else
+            {
+                unlockedInds.push_back( i );
+                if( l < numWanted )
+                    maxResid = Max( maxResid, resid );
+            }
+        }
+        const Int numNewLocked = lockInds.size();
+        const Int numStillWanted = numWanted - numNewLocked;
+        if( ctrl.progress )
+            OutputFromRoot
+            (comm,"restart ",restart,": ",numLocked+numNewLocked," of ",
+             numEigs," eigenpairs locked, max relative residual of the rest: ",
+             maxResid/normEst);
+
+        const bool finished =
+          ( numStillWanted == 0 || restart+1 >= ctrl.maxIts );
+        Int kKeep = numStillWanted;
+        if( !finished )
+            kKeep =
+              Min( numStillWanted+(m-numStillWanted)/2,
+                   Min(m-1,m-numNewLocked) );
+        keepInds.assign( unlockedInds.begin(), unlockedInds.begin()+kKeep );
+
+        // Form the newly-locked Ritz vectors followed by the kept Ritz vectors
+        // ====================================================================
+        const Int numSel = numNewLocked + kKeep;
+        Matrix<Field> YSel, Z, r;
+        Zeros( YSel, m, numSel );
+        for( Int l=0; l<numSel; ++l )
+        {
+            const Int i =
+              ( l < numNewLocked ? lockInds[l] : keepInds[l-numNewLocked] );
+            for( Int s=0; s<m; ++s )
+                YSel(s,l) = Y(s,i);
+        }
+        r = Q( ALL, IR(numLocked+m) );
+        auto V = Q( ALL, IR(numLocked,numLocked+m) );
+        Gemm( NORMAL, NORMAL, Field(1), V, YSel, Z );
+        auto QSel = Q( ALL, IR(numLocked,numLocked+numSel) );
+        QSel = Z;
+        for( Int l=0; l<numNewLocked; ++l )
+            wLock(numLocked+l) = theta(lockInds[l]);
+        numLocked += numNewLocked;
+        if( finished )
+        {
+            info.converged = ( numStillWanted == 0 );
+            for( Int l=0; l<kKeep; ++l )
+                wLock(numLocked+l) = theta(keepInds[l]);
+            break;
+        }
+
+        // Restart with the kept Ritz vectors and the residual direction
+        // =============================================================
+        auto qk = Q( ALL, IR(numLocked+kKeep) );
+        qk = r;
+        Zero( T );
+        for( Int l=0; l<kKeep; ++l )
+        {
+            T(l,l) = theta(keepInds[l]);
+            T(l,kKeep) = T(kKeep,l) = betaLast*Y(m-1,keepInds[l]);
+        }
+        k = kKeep;
+    }
+    info.numLocked = numLocked;
+
+    w = wLock;
+    X = Q( ALL, IR(0,numEigs) );
+    SortEigenpairs( w, X, ctrl.target );
+    return info;
+}
+
+template<typename Field,class ApplyAType,class ApplyPrecondType>
+KrylovEigInfo LOBPCG
+(       Int n,
+        Int localHeight,
+        mpi::Comm comm,
+  const ApplyAType& applyA,
+  const ApplyPrecondType& applyPrecond,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol =
+      ( ctrl.tol > Real(0) ? ctrl.tol : Pow(eps,Real(2)/Real(3)) );
+    const Int numEigs = ctrl.numEigs;
+    if( numEigs < 1 )
+        LogicError("Must request at least one eigenpair");
+    const Int blockSize = Max( ctrl.blockSize, numEigs );
+    if( numEigs+3*blockSize > n )
+        LogicError
+        ("The number of eigenpairs plus three times the block size cannot "
+         "exceed n (use HermitianEig for small problems)");
+
+    // The converged eigenvectors are moved into XLock and the active block is
+    // kept orthogonal to them
+    Matrix<Field> XLock, AX, P, AP, R, Z, AZ, S, AS, XNew, U, C;
+    Matrix<Real> wLock, theta, norms;
+    Zeros( XLock, localHeight, numEigs );
+    Zeros( wLock, numEigs, 1 );
+    Zeros( P, localHeight, 0 );
+    Zeros( AP, localHeight, 0 );
+    Int numLocked = 0;
+    Real normEst = 0;
+
+    KrylovEigInfo info;
+    Gaussian( S, localHeight, blockSize );
+    applyA( S, AS );
+    info.numApplications += blockSize;
+    SVQB( S, AS, comm );
+    RayleighRitz( S, AS, ctrl.target, blockSize, U, theta, comm );
+    Gemm( NORMAL, NORMAL, Field(1), S, U, X );
+    Gemm( NORMAL, NORMAL, Field(1), AS, U, AX );
+    for( Int it=0; true; ++it )
+    {
+        ++info.numIts;
+        const Int activeSize = X.Width();
+
+        // R := A X - X diag(theta)
+        // ========================
+        R = AX;
+        for( Int j=0; j<activeSize; ++j )
+        {
+            auto xj = X( ALL, IR(j) );
+            auto rj = R( ALL, IR(j) );
+            Axpy( Field(-theta(j)), xj, rj );
+            normEst = Max( normEst, Abs(theta(j)) );
+        }
+        ColumnNorms( R, norms, comm );
+
+        // Lock the desired Ritz pairs which have converged
+        // ================================================
+        const Int numWanted = numEigs - numLocked;
+        vector<Int> activeInds;
+        Real maxResid = 0;
+        Int numNewLocked = 0;
+        for( Int j=0; j<activeSize; ++j )
+        {
+            if( j < numWanted && norms(j) <= tol*normEst )
+            {
+                auto xj = X( ALL, IR(j) );
+                auto xLock = XLock( ALL, IR(numLocked+numNewLocked) );
+                xLock = xj;
+                wLock(numLocked+numNewLocked) = theta(j);
+                ++numNewLocked;
+            }
+            else
+            {
+                activeInds.push_back( j );
+                if( j < numWanted )
+                    maxResid = Max( maxResid, norms(j) );
+            }
+        }
+        numLocked += numNewLocked;
+        if( ctrl.progress )
+            OutputFromRoot
+            (comm,"iteration ",it,": ",numLocked," of ",numEigs,
+             " eigenpairs locked, max relative residual of the rest: ",
+             maxResid/normEst);
+        if( numLocked == numEigs || it+1 >= ctrl.maxIts )
+        {
+            info.converged = ( numLocked == numEigs );
+            for( Int l=0; numLocked+l<numEigs; ++l )
+            {
+                const Int j = activeInds[l];
+                auto xj = X( ALL, IR(j) );
+                auto xLock = XLock( ALL, IR(numLocked+l) );
+                xLock = xj;
+                wLock(numLocked+l) = theta(j);
+            }
+            break;
+        }
+        if( numNewLocked > 0 )
+        {
+            // Remove the locked columns from the active block and restart
+            // the conjugate directions, which are not orthogonal to them
+            const Range<Int> rows( 0, localHeight );
+            Matrix<Real> thetaAct;
+            Zeros( thetaAct, activeInds.size(), 1 );
+            for( size_t l=0; l<activeInds.size(); ++l )
+                thetaAct(l) = theta(activeInds[l]);
+            theta = thetaAct;
+            GetSubmatrix( X, rows, activeInds, XNew );
+            X = XNew;
+            GetSubmatrix( AX, rows, activeInds, XNew );
+            AX = XNew;
+            GetSubmatrix( R, rows, activeInds, XNew );
+            R = XNew;
+            P.Resize( localHeight, 0 );
+            AP.Resize( localHeight, 0 );
+        }
+        const Int newActiveSize = X.Width();
+
+        // Z := [inv(T) R, P], with inv(T) R projected against the locked
+        // vectors
+        // ===================================================================
+        const Int pSize = P.Width();
+        const Range<Int> indW(0,newActiveSize),
+          indP(newActiveSize,newActiveSize+pSize);
+        Zeros( Z, localHeight, newActiveSize+pSize );
+        Zeros( AZ, localHeight, newActiveSize+pSize );
+        auto ZW = Z( ALL, indW );
+        auto ZP = Z( ALL, indP );
+        auto AZW = AZ( ALL, indW );
+        auto AZP = AZ( ALL, indP );
+        ZW = R;
+        applyPrecond( ZW );
+        if( numLocked > 0 )
+        {
+            auto XL = XLock( ALL, IR(0,numLocked) );
+            Orthogonalize( XL, ZW, C, comm );
+        }
+        applyA( ZW, AZW );
+        info.numApplications += newActiveSize;
+        ZP = P;
+        AZP = AP;
+
+        // Orthonormalize Z against X (and itself) so that the conjugate
+        // directions, P, can be formed without cancellation
+        // ===============================================================
+        for( Int pass=0; pass<2; ++pass )
+        {
+            InnerProducts( X, Z, C, comm );
+            Gemm( NORMAL, NORMAL, Field(-1), X, C, Field(1), Z );
+            Gemm( NORMAL, NORMAL, Field(-1), AX, C, Field(1), AZ );
+            SVQB( Z, AZ, comm );
+        }
+
+        // Rayleigh-Ritz over span{X,Z}
+        // ============================
+        const Int zSize = Z.Width();
+        Zeros( S, localHeight, newActiveSize+zSize );
+        Zeros( AS, localHeight, newActiveSize+zSize );
+        auto SX = S( ALL, IR(0,newActiveSize) );
+        auto SZ = S( ALL, IR(newActiveSize,newActiveSize+zSize) );
+        auto ASX = AS( ALL, IR(0,newActiveSize) );
+        auto ASZ = AS( ALL, IR(newActiveSize,newActiveSize+zSize) );
+        SX = X;
+        SZ = Z;
+        ASX = AX;
+        ASZ = AZ;
+        RayleighRitz( S, AS, ctrl.target, newActiveSize, U, theta, comm );
+
+        // P := Z U_Z and X := X U_X + P
+        // =============================
+        auto UX = U( IR(0,newActiveSize), ALL );
+        auto UZ = U( IR(newActiveSize,newActiveSize+zSize), ALL );
+        Gemm( NORMAL, NORMAL, Field(1), Z, UZ, P );
+        Gemm( NORMAL, NORMAL, Field(1), AZ, UZ, AP );
+        XNew = P;
+        Gemm( NORMAL, NORMAL, Field(1), X, UX, Field(1), XNew );
+        X = XNew;
+        XNew = AP;
+        Gemm( NORMAL, NORMAL, Field(1), AX, UX, Field(1), XNew );
+        AX = XNew;
+    }
+    info.numLocked = numLocked;
+
+    w = wLock;
+    X = XLock;
+    SortEigenpairs( w, X, ctrl.target );
+    return info;
+}
+
+} // namespace krylov_eig
+
+template<typename Field,class ApplyAType>
+KrylovEigInfo ThickRestartLanczos
+(       Int n,
+  const ApplyAType& applyA,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return krylov_eig::ThickRestartLanczos
+      ( n, n, mpi::COMM_SELF, applyA, w, X, ctrl );
+}
+
+template<typename Field,class ApplyAType>
+KrylovEigInfo ThickRestartLanczos
+(       Int n,
+  const ApplyAType& applyA,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        DistMultiVec<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& grid = X.Grid();
+    DistMultiVec<Field> XDist(grid), YDist(grid);
+    Zeros( X, n, 1 );
+    const Int localHeight = X.LocalHeight();
+
+    auto applyALocal =
+      [&]( const Matrix<Field>& XLoc, Matrix<Field>& YLoc )
+      {
+          Zeros( XDist, n, XLoc.Width() );
+          XDist.Matrix() = XLoc;
+          applyA( XDist, YDist );
+          YLoc = YDist.LockedMatrix();
+      };
+    Matrix<Real> w;
+    Matrix<Field> XLoc;
+    auto info =
+      krylov_eig::ThickRestartLanczos
+      ( n, localHeight, grid.Comm(), applyALocal, w, XLoc, ctrl );
+
+    Zeros( X, n, XLoc.Width() );
+    X.Matrix() = XLoc;
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& wStar = wProx.Get();
+    wStar.Resize( w.Height(), 1 );
+    wStar.Matrix() = w;
+    return info;
+}
+
+template<typename Field,class ApplyAType,class ApplyPrecondType>
+KrylovEigInfo LOBPCG
+(       Int n,
+  const ApplyAType& applyA,
+  const ApplyPrecondType& applyPrecond,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return krylov_eig::LOBPCG
+      ( n, n, mpi::COMM_SELF, applyA, applyPrecond, w, X, ctrl );
+}
+
+template<typename Field,class ApplyAType,class ApplyPrecondType>
+KrylovEigInfo LOBPCG
+(       Int n,
+  const ApplyAType& applyA,
+  const ApplyPrecondType& applyPrecond,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        DistMultiVec<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& grid = X.Grid();
+    DistMultiVec<Field> XDist(grid), YDist(grid);
+    Zeros( X, n, 1 );
+    const Int localHeight = X.LocalHeight();
+
+    auto applyALocal =
+      [&]( const Matrix<Field>& XLoc, Matrix<Field>& YLoc )
+      {
+          Zeros( XDist, n, XLoc.Width() );
+          XDist.Matrix() = XLoc;
+          applyA( XDist, YDist );
+          YLoc = YDist.LockedMatrix();
+      };
+    auto applyPrecondLocal =
+      [&]( Matrix<Field>& WLoc )
+      {
+          Zeros( XDist, n, WLoc.Width() );
+          XDist.Matrix() = WLoc;
+          applyPrecond( XDist );
+          WLoc = XDist.LockedMatrix();
+      };
+    Matrix<Real> w;
+    Matrix<Field> XLoc;
+    auto info =
+      krylov_eig::LOBPCG
+      ( n, localHeight, grid.Comm(), applyALocal, applyPrecondLocal,
+        w, XLoc, ctrl );
+
+    Zeros( X, n, XLoc.Width() );
+    X.Matrix() = XLoc;
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& wStar = wProx.Get();
+    wStar.Resize( w.Height(), 1 );
+    wStar.Matrix() = w;
+    return info;
+}
+
+// Unpreconditioned LOBPCG
+// =======================
+template<typename Field,class ApplyAType>
+KrylovEigInfo LOBPCG
+(       Int n,
+  const ApplyAType& applyA,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto identity = []( Matrix<Field>& ) { };
+    return LOBPCG( n, applyA, identity, w, X, ctrl );
+}
+
+template<typename Field,class ApplyAType>
+KrylovEigInfo LOBPCG
+(       Int n,
+  const ApplyAType& applyA,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto identity = []( DistMultiVec<Field>& ) { };
+    return LOBPCG( n, applyA, identity, w, X, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPECTRAL_KRYLOVEIG_HPP
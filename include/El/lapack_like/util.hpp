@@ -20,10 +20,16 @@ struct BisectCtrl
     Int numSeqSeps;
     Int cutoff;
     bool storeFactRecvInds;
+    // Use the native multilevel bisection rather than (Par)METIS. The native
+    // bisection is also used whenever the required library is unavailable.
+    bool native;
+    // The maximum ratio of the weight of the heavier side of a native
+    // bisection to half of the total weight (METIS uses its own default)
+    double maxImbalance;
 
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false), native(false), maxImbalance(1.1)
     { }
 };
 
@@ -43,6 +49,25 @@ Int Bisect
         bool& onLeft,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// A native multilevel vertex bisection (heavy-edge matching coarsening,
+// Fiduccia-Mattheyses refinement, and vertex separator extraction) which
+// does not require METIS or ParMETIS
+Int MultilevelBisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// NOTE: for two or more processes
+Int MultilevelBisect
+( const DistGraph& graph,
+        unique_ptr<Grid>& childGrid,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 Int NaturalBisect
 ( Int nx,
   Int ny,
@@ -195,7 +195,7 @@ def SolveAfterCholeskyPiv(uplo,orient,A,p,B):
 
 # Emulate an enum for LDL pivot types
 (BUNCH_KAUFMAN_A,BUNCH_KAUFMAN_C,BUNCH_KAUFMAN_D,BUNCH_KAUFMAN_BOUNDED,
- BUNCH_PARLETT,LDL_WITHOUT_PIVOTING)=(0,1,2,3,4,5)
+ BUNCH_PARLETT,LDL_WITHOUT_PIVOTING,AASEN)=(0,1,2,3,4,5,6)
 
 class LDLPivot(ctypes.Structure):
   _fields_ = [("nb",iType),("from",(iType*2))]
@@ -894,19 +894,24 @@ def SolveAfterLQ(orient,A,t,d,B):
 
 # QR factorization
 # ================
+# Emulate an enum for the CholeskyQR variants
+(CHOLESKY_QR,CHOLESKY_QR2,SHIFTED_CHOLESKY_QR3,CHOLESKY_QR_ADAPTIVE)=(0,1,2,3)
+
 lib.ElQRCtrlDefault_s.argtypes = \
 lib.ElQRCtrlDefault_d.argtypes = \
   [c_void_p]
 class QRCtrl_s(ctypes.Structure):
   _fields_ = [("colPiv",bType),("boundRank",bType),("maxRank",iType),
               ("adaptive",bType),("tol",sType),("alwaysRecomputeNorms",bType),
-              ("smallestFirst",bType)]
+              ("smallestFirst",bType),("cholesky",bType),
+              ("cholVariant",c_uint)]
   def __init__(self):
     lib.ElQRCtrlDefault_s(pointer(self))
 class QRCtrl_d(ctypes.Structure):
   _fields_ = [("colPiv",bType),("boundRank",bType),("maxRank",iType),
               ("adaptive",bType),("tol",dType),("alwaysRecomputeNorms",bType),
-              ("smallestFirst",bType)]
+              ("smallestFirst",bType),("cholesky",bType),
+              ("cholVariant",c_uint)]
   def __init__(self):
     lib.ElQRCtrlDefault_d(pointer(self))
 
@@ -28,7 +28,8 @@ class SecularEVDCtrl_s(ctypes.Structure):
               ("negativeFix",c_uint),
               ("penalizeDerivative",bType),
               ("progress",bType),
-              ("cubicCtrl",CubicSecularCtrl)]
+              ("cubicCtrl",CubicSecularCtrl),
+              ("batchCutoff",iType)]
   def __init__(self):
     lib.ElSecularEVDCtrlDefault_s(pointer(self))
 
@@ -38,7 +39,8 @@ class SecularEVDCtrl_d(ctypes.Structure):
               ("negativeFix",c_uint),
               ("penalizeDerivative",bType),
               ("progress",bType),
-              ("cubicCtrl",CubicSecularCtrl)]
+              ("cubicCtrl",CubicSecularCtrl),
+              ("batchCutoff",iType)]
   def __init__(self):
     lib.ElSecularEVDCtrlDefault_d(pointer(self))
 
@@ -50,7 +52,8 @@ class SecularSVDCtrl_s(ctypes.Structure):
               ("negativeFix",c_uint),
               ("penalizeDerivative",bType),
               ("progress",bType),
-              ("cubicCtrl",CubicSecularCtrl)]
+              ("cubicCtrl",CubicSecularCtrl),
+              ("batchCutoff",iType)]
   def __init__(self):
     lib.ElSecularSVDCtrlDefault_s(pointer(self))
 
@@ -60,7 +63,8 @@ class SecularSVDCtrl_d(ctypes.Structure):
               ("negativeFix",c_uint),
               ("penalizeDerivative",bType),
               ("progress",bType),
-              ("cubicCtrl",CubicSecularCtrl)]
+              ("cubicCtrl",CubicSecularCtrl),
+              ("batchCutoff",iType)]
   def __init__(self):
     lib.ElSecularSVDCtrlDefault_d(pointer(self))
 
@@ -83,7 +87,8 @@ class HermitianTridiagEigDCCtrl_s(ctypes.Structure):
   _fields_ = [("secularCtrl",SecularEVDCtrl_s),
               ("deflationFudge",sType),
               ("cutoff",iType),
-              ("exploitStructure",bType)]
+              ("exploitStructure",bType),
+              ("taskCutoff",iType)]
   def __init__(self):
     lib.ElHermitianTridiagEigDCCtrlDefault_s(pointer(self))
 
@@ -91,10 +96,27 @@ class HermitianTridiagEigDCCtrl_d(ctypes.Structure):
   _fields_ = [("secularCtrl",SecularEVDCtrl_d),
               ("deflationFudge",dType),
               ("cutoff",iType),
-              ("exploitStructure",bType)]
+              ("exploitStructure",bType),
+              ("taskCutoff",iType)]
   def __init__(self):
     lib.ElHermitianTridiagEigDCCtrlDefault_d(pointer(self))
 
+class HermitianTridiagEigMRRRCtrl_s(ctypes.Structure):
+  _fields_ = [("native",bType),
+              ("minRelGap",sType),
+              ("maxRQIIts",iType),
+              ("maxDepth",iType)]
+  def __init__(self):
+    lib.ElHermitianTridiagEigMRRRCtrlDefault_s(pointer(self))
+
+class HermitianTridiagEigMRRRCtrl_d(ctypes.Structure):
+  _fields_ = [("native",bType),
+              ("minRelGap",dType),
+              ("maxRQIIts",iType),
+              ("maxDepth",iType)]
+  def __init__(self):
+    lib.ElHermitianTridiagEigMRRRCtrlDefault_d(pointer(self))
+
 class HermitianTridiagEigQRCtrl(ctypes.Structure):
   _fields_ = [("maxIterPerEig",iType),
               ("demandConverged",bType),
@@ -584,7 +606,9 @@ class HessenbergSchurCtrl(ctypes.Structure):
               ("sufficientDeflation",CFUNCTYPE(iType,iType)),
               ("scalapack",bType),
               ("blockHeight",iType),
-              ("numBulgesPerBlock",CFUNCTYPE(iType,iType))]
+              ("numBulgesPerBlock",CFUNCTYPE(iType,iType)),
+              ("minDistAEDSize",iType),
+              ("distAEDGridDim",CFUNCTYPE(iType,iType,iType))]
   def __init__(self):
     lib.ElHessenbergSchurCtrlDefault(pointer(self))
 
@@ -829,6 +853,35 @@ class BidiagSVDCtrl_d(ctypes.Structure):
 # Singular value decomposition
 # ============================
 
+lib.ElQDWHCtrlDefault.argtypes = [c_void_p]
+class QDWHCtrl(ctypes.Structure):
+  _fields_ = [("colPiv",bType),
+              ("maxIts",iType)]
+  def __init__(self):
+    lib.ElQDWHCtrlDefault(pointer(self))
+
+lib.ElHermitianSDCCtrlDefault_s.argtypes = [c_void_p]
+class HermitianSDCCtrl_s(ctypes.Structure):
+  _fields_ = [("cutoff",iType),
+              ("maxInnerIts",iType),("maxOuterIts",iType),
+              ("tol",sType),
+              ("spreadFactor",sType),
+              ("progress",bType),
+              ("qdwhEig",bType)]
+  def __init__(self):
+    lib.ElHermitianSDCCtrlDefault_s(pointer(self))
+
+lib.ElHermitianSDCCtrlDefault_d.argtypes = [c_void_p]
+class HermitianSDCCtrl_d(ctypes.Structure):
+  _fields_ = [("cutoff",iType),
+              ("maxInnerIts",iType),("maxOuterIts",iType),
+              ("tol",dType),
+              ("spreadFactor",dType),
+              ("progress",bType),
+              ("qdwhEig",bType)]
+  def __init__(self):
+    lib.ElHermitianSDCCtrlDefault_d(pointer(self))
+
 class SVDCtrl_s(ctypes.Structure):
   _fields_ = [("overwrite",bType),
               ("time",bType),
@@ -836,7 +889,10 @@ class SVDCtrl_s(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
-              ("bidiagSVDCtrl",BidiagSVDCtrl_s)]
+              ("bidiagSVDCtrl",BidiagSVDCtrl_s),
+              ("useQDWH",bType),
+              ("qdwhCtrl",QDWHCtrl),
+              ("sdcCtrl",HermitianSDCCtrl_s)]
   def __init__(self):
     lib.ElSVDCtrlDefault_s(pointer(self))
 
@@ -847,7 +903,10 @@ class SVDCtrl_d(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
-              ("bidiagSVDCtrl",BidiagSVDCtrl_d)]
+              ("bidiagSVDCtrl",BidiagSVDCtrl_d),
+              ("useQDWH",bType),
+              ("qdwhCtrl",QDWHCtrl),
+              ("sdcCtrl",HermitianSDCCtrl_d)]
   def __init__(self):
     lib.ElSVDCtrlDefault_d(pointer(self))
 
@@ -1137,6 +1196,8 @@ class PseudospecCtrl_s(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("numSubgrids",iType),
+              ("shiftBatchSize",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",cType),
@@ -1163,6 +1224,8 @@ class PseudospecCtrl_d(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("numSubgrids",iType),
+              ("shiftBatchSize",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",zType),
@@ -11,6 +11,8 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Multiply/Sparse.hpp"
+
 namespace El {
 
 namespace {
@@ -694,6 +696,104 @@ void Multiply
         Output("Multiply total time: ",totalTimer.Stop());
 }
 
+template<typename T>
+void Multiply
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError("The width of A must match the height of B");
+    const Int m = A.Height();
+    const Int n = B.Width();
+
+    sparse_multiply::CSRView<T> AView
+    { m, A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      A.LockedValueBuffer() };
+    sparse_multiply::CSRView<T> BView
+    { B.Height(), B.LockedOffsetBuffer(), B.LockedTargetBuffer(),
+      B.LockedValueBuffer() };
+
+    // Form the sparsity pattern of the product
+    vector<Int> offsets, targets;
+    const sparse_multiply::PatternCtrl ctrl;
+    sparse_multiply::Symbolic( AView, BView, n, ctrl, offsets, targets );
+
+    // Fill in the values of the product
+    const Int numEntries = targets.size();
+    C.Empty();
+    C.Resize( m, n );
+    C.ForceNumEntries( numEntries );
+    Int* sourceBuf = C.SourceBuffer();
+    Int* targetBuf = C.TargetBuffer();
+    Int* offsetBuf = C.OffsetBuffer();
+    for( Int i=0; i<m; ++i )
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+            sourceBuf[e] = i;
+    MemCopy( targetBuf, targets.data(), numEntries );
+    MemCopy( offsetBuf, offsets.data(), m+1 );
+    sparse_multiply::Numeric
+    ( AView, BView, offsets, targets, C.ValueBuffer() );
+    C.ForceConsistency();
+}
+
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError("The width of A must match the height of B");
+    if( !mpi::Congruent( A.Grid().Comm(), B.Grid().Comm() ) )
+        LogicError("Communicators of A and B must match");
+    const Int m = A.Height();
+    const Int n = B.Width();
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+
+    // Gather the rows of B indexed by the targets of our rows of A (the
+    // communication pattern is the same as for multiplying A with a dense
+    // set of vectors)
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    vector<Int> BOffsets, BTargets;
+    vector<T> BValues;
+    sparse_multiply::GatherRows( B, meta, BOffsets, BTargets, BValues );
+
+    sparse_multiply::CSRView<T> AView
+    { localHeight, A.LockedOffsetBuffer(), meta.colOffs.data(),
+      A.LockedValueBuffer() };
+    sparse_multiply::CSRView<T> BView
+    { meta.numRecvInds, BOffsets.data(), BTargets.data(), BValues.data() };
+
+    // Form the sparsity pattern of our rows of the product
+    vector<Int> offsets, targets;
+    sparse_multiply::PatternCtrl ctrl;
+    ctrl.firstRow = firstLocalRow;
+    sparse_multiply::Symbolic( AView, BView, n, ctrl, offsets, targets );
+
+    // Fill in the values of our rows of the product
+    const Int numLocalEntries = targets.size();
+    C.SetGrid( A.Grid() );
+    C.Empty();
+    C.Resize( m, n );
+    C.ForceNumLocalEntries( numLocalEntries );
+    Int* sourceBuf = C.SourceBuffer();
+    Int* targetBuf = C.TargetBuffer();
+    Int* offsetBuf = C.OffsetBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( Int e=offsets[iLoc]; e<offsets[iLoc+1]; ++e )
+            sourceBuf[e] = firstLocalRow + iLoc;
+    MemCopy( targetBuf, targets.data(), numLocalEntries );
+    MemCopy( offsetBuf, offsets.data(), localHeight+1 );
+    sparse_multiply::Numeric
+    ( AView, BView, offsets, targets, C.ValueBuffer() );
+    C.ForceConsistency();
+}
+
 #define PROTO(T) \
     template void Multiply \
     ( Orientation orientation, \
@@ -715,7 +815,15 @@ void Multiply
       const DistSparseMatrix<T>& A, \
       const DistMultiVec<T>& X, \
             T beta, \
-            DistMultiVec<T>& Y );
+            DistMultiVec<T>& Y ); \
+    template void Multiply \
+    ( const SparseMatrix<T>& A, \
+      const SparseMatrix<T>& B, \
+            SparseMatrix<T>& C ); \
+    template void Multiply \
+    ( const DistSparseMatrix<T>& A, \
+      const DistSparseMatrix<T>& B, \
+            DistSparseMatrix<T>& C );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
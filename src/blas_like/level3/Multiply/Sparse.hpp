@@ -0,0 +1,347 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MULTIPLY_SPARSE_HPP
+#define EL_MULTIPLY_SPARSE_HPP
+
+namespace El {
+namespace sparse_multiply {
+
+// A read-only view of a sparse matrix in compressed sparse row form. When it
+// represents the left factor of a product, its targets index the rows of the
+// right factor (which, in the distributed case, are the gathered rows rather
+// than the global column indices).
+template<typename T>
+struct CSRView
+{
+    Int numRows;
+    const Int* offsets;
+    const Int* targets;
+    const T* values;
+};
+
+struct PatternCtrl
+{
+    // The global index of the first row of the (local portion of the) product
+    Int firstRow=0;
+    // Whether to explicitly store the diagonal of the (square) product
+    bool includeDiagonal=false;
+    // Whether to drop the strictly upper triangle of the (square) product
+    bool onlyLower=false;
+};
+
+// An open-addressing (linear probing) hash table from the targets of a single
+// row of a product to their positions within the row. Only the slots which
+// were used by the previous row are cleared upon a reset, so that the cost of
+// forming a row is proportional to the number of products which contribute
+// to it rather than to the width of the product.
+class RowAccumulator
+{
+public:
+    // Empty the table and ensure that it can hold 'maxEntries' targets
+    void Reset( Int maxEntries )
+    {
+        for( const Int& slot : slots_ )
+            table_[slot] = -1;
+        targets_.clear();
+        slots_.clear();
+
+        Int capacity = 16;
+        while( capacity < 2*maxEntries )
+            capacity *= 2;
+        if( capacity > Int(table_.size()) )
+            table_.resize( capacity, -1 );
+        mask_ = capacity - 1;
+    }
+
+    // Return the position of the target within the row, appending it if it
+    // was not yet present
+    Int Insert( Int target )
+    {
+        Int slot = Hash( target );
+        while( true )
+        {
+            const Int pos = table_[slot];
+            if( pos == -1 )
+            {
+                const Int newPos = targets_.size();
+                table_[slot] = newPos;
+                targets_.push_back( target );
+                slots_.push_back( slot );
+                return newPos;
+            }
+            if( targets_[pos] == target )
+                return pos;
+            slot = (slot+1) & mask_;
+        }
+    }
+
+    // Return the position of the target within the row, or -1 if it is not
+    // present
+    Int Find( Int target ) const
+    {
+        Int slot = Hash( target );
+        while( true )
+        {
+            const Int pos = table_[slot];
+            if( pos == -1 || targets_[pos] == target )
+                return pos;
+            slot = (slot+1) & mask_;
+        }
+    }
+
+    Int Size() const { return targets_.size(); }
+
+    // Write the targets of the row in ascending order
+    void SortedTargets( Int* targets ) const
+    {
+        const Int numTargets = targets_.size();
+        for( Int k=0; k<numTargets; ++k )
+            targets[k] = targets_[k];
+        std::sort( targets, targets+numTargets );
+    }
+
+private:
+    vector<Int> table_, targets_, slots_;
+    Int mask_=0;
+
+    Int Hash( Int target ) const
+    {
+        // Fibonacci hashing spreads consecutive targets across the table
+        const unsigned long long key = target;
+        return Int( (key*11400714819323198485ull) >> 32 ) & mask_;
+    }
+};
+
+inline Int NumRowChunks( Int numRows )
+{
+#ifdef EL_HYBRID
+    const Int maxThreads = omp_get_max_threads();
+#else
+    const Int maxThreads = 1;
+#endif
+    return Min( 4*maxThreads, Max(numRows,Int(1)) );
+}
+
+// Form the sparsity pattern of the product of A and B in compressed sparse row
+// form. The rows are processed in independent chunks (each with its own
+// accumulator) in two passes: the first counts the number of entries in each
+// row so that the second can write the sorted targets in place.
+template<typename T>
+void Symbolic
+( const CSRView<T>& A,
+  const CSRView<T>& B,
+        Int numTargets,
+  const PatternCtrl& ctrl,
+        vector<Int>& offsets,
+        vector<Int>& targets )
+{
+    EL_DEBUG_CSE
+    const Int numRows = A.numRows;
+    const Int numChunks = NumRowChunks( numRows );
+    const Int chunkSize = ( numRows+numChunks-1 ) / numChunks;
+
+    auto formRow =
+      [&]( Int iLoc, RowAccumulator& accumulator )
+      {
+          const Int i = ctrl.firstRow + iLoc;
+          Int bound = ( ctrl.includeDiagonal ? 1 : 0 );
+          for( Int e=A.offsets[iLoc]; e<A.offsets[iLoc+1]; ++e )
+          {
+              const Int k = A.targets[e];
+              bound += B.offsets[k+1] - B.offsets[k];
+          }
+          accumulator.Reset( Min(bound,numTargets) );
+          if( ctrl.includeDiagonal )
+              accumulator.Insert( i );
+          for( Int e=A.offsets[iLoc]; e<A.offsets[iLoc+1]; ++e )
+          {
+              const Int k = A.targets[e];
+              for( Int f=B.offsets[k]; f<B.offsets[k+1]; ++f )
+              {
+                  const Int j = B.targets[f];
+                  if( !ctrl.onlyLower || j <= i )
+                      accumulator.Insert( j );
+              }
+          }
+      };
+
+    offsets.resize( numRows+1 );
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int c=0; c<numChunks; ++c )
+    {
+        RowAccumulator accumulator;
+        const Int first = c*chunkSize;
+        const Int last = Min( first+chunkSize, numRows );
+        for( Int iLoc=first; iLoc<last; ++iLoc )
+        {
+            formRow( iLoc, accumulator );
+            offsets[iLoc] = accumulator.Size();
+        }
+    }
+
+    Int numEntries = 0;
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+    {
+        const Int rowSize = offsets[iLoc];
+        offsets[iLoc] = numEntries;
+        numEntries += rowSize;
+    }
+    offsets[numRows] = numEntries;
+
+    targets.resize( numEntries );
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int c=0; c<numChunks; ++c )
+    {
+        RowAccumulator accumulator;
+        const Int first = c*chunkSize;
+        const Int last = Min( first+chunkSize, numRows );
+        for( Int iLoc=first; iLoc<last; ++iLoc )
+        {
+            formRow( iLoc, accumulator );
+            accumulator.SortedTargets( &targets[offsets[iLoc]] );
+        }
+    }
+}
+
+// Overwrite 'values' with the entries of the product of A, diag(scale) (if
+// 'scale' is non-null, where it is indexed by the targets of A), and B within
+// the sparsity pattern returned by 'Symbolic'. Contributions outside of the
+// pattern (i.e., within the dropped upper triangle) are ignored.
+template<typename T>
+void Numeric
+( const CSRView<T>& A,
+  const CSRView<T>& B,
+  const vector<Int>& offsets,
+  const vector<Int>& targets,
+        T* values,
+  const T* scale=nullptr )
+{
+    EL_DEBUG_CSE
+    const Int numRows = A.numRows;
+    const Int numChunks = NumRowChunks( numRows );
+    const Int chunkSize = ( numRows+numChunks-1 ) / numChunks;
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int c=0; c<numChunks; ++c )
+    {
+        RowAccumulator accumulator;
+        const Int first = c*chunkSize;
+        const Int last = Min( first+chunkSize, numRows );
+        for( Int iLoc=first; iLoc<last; ++iLoc )
+        {
+            const Int rowOffset = offsets[iLoc];
+            const Int rowSize = offsets[iLoc+1] - rowOffset;
+            T* rowValues = &values[rowOffset];
+            accumulator.Reset( rowSize );
+            for( Int t=0; t<rowSize; ++t )
+            {
+                accumulator.Insert( targets[rowOffset+t] );
+                rowValues[t] = 0;
+            }
+            for( Int e=A.offsets[iLoc]; e<A.offsets[iLoc+1]; ++e )
+            {
+                const Int k = A.targets[e];
+                const T alpha =
+                  ( scale == nullptr ? A.values[e] : A.values[e]*scale[k] );
+                for( Int f=B.offsets[k]; f<B.offsets[k+1]; ++f )
+                {
+                    const Int t = accumulator.Find( B.targets[f] );
+                    if( t >= 0 )
+                        rowValues[t] += alpha*B.values[f];
+                }
+            }
+        }
+    }
+}
+
+// Gather the rows of B that are needed by the local rows of a distributed
+// matrix with the given multiplication metadata (i.e., the rows indexed by
+// the unique targets of the local rows, in ascending order)
+template<typename T>
+void GatherRows
+( const DistSparseMatrix<T>& B,
+  const DistGraphMultMeta& meta,
+        vector<Int>& offsets,
+        vector<Int>& targets,
+        vector<T>& values )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = B.Grid().Comm();
+    const int commSize = B.Grid().Size();
+    const Int firstLocalRow = B.FirstLocalRow();
+
+    // Exchange the sizes of the requested rows
+    const Int numSendRows = meta.sendInds.size();
+    vector<Int> sendRowSizes( numSendRows );
+    for( Int s=0; s<numSendRows; ++s )
+        sendRowSizes[s] = B.NumConnections( meta.sendInds[s]-firstLocalRow );
+    vector<Int> recvRowSizes( meta.numRecvInds );
+    mpi::AllToAll
+    ( sendRowSizes.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      recvRowSizes.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      comm );
+
+    // Convert the row sizes into entry counts for each process
+    vector<int> sendSizes( commSize, 0 ), sendOffs( commSize ),
+                recvSizes( commSize, 0 ), recvOffs( commSize );
+    Int numSendEntries=0, numRecvEntries=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        const Int sendEnd = meta.sendOffs[q] + meta.sendSizes[q];
+        for( Int s=meta.sendOffs[q]; s<sendEnd; ++s )
+            sendSizes[q] += sendRowSizes[s];
+        const Int recvEnd = meta.recvOffs[q] + meta.recvSizes[q];
+        for( Int s=meta.recvOffs[q]; s<recvEnd; ++s )
+            recvSizes[q] += recvRowSizes[s];
+        sendOffs[q] = numSendEntries;
+        recvOffs[q] = numRecvEntries;
+        numSendEntries += sendSizes[q];
+        numRecvEntries += recvSizes[q];
+    }
+
+    // Pack and exchange the requested rows
+    vector<Int> sendTargets;
+    vector<T> sendValues;
+    FastResize( sendTargets, numSendEntries );
+    FastResize( sendValues, numSendEntries );
+    const Int* targetBuf = B.LockedTargetBuffer();
+    const T* valueBuf = B.LockedValueBuffer();
+    Int off = 0;
+    for( Int s=0; s<numSendRows; ++s )
+    {
+        const Int rowOffset = B.RowOffset( meta.sendInds[s]-firstLocalRow );
+        for( Int t=0; t<sendRowSizes[s]; ++t )
+        {
+            sendTargets[off] = targetBuf[rowOffset+t];
+            sendValues[off] = valueBuf[rowOffset+t];
+            ++off;
+        }
+    }
+    FastResize( targets, numRecvEntries );
+    FastResize( values, numRecvEntries );
+    mpi::AllToAll
+    ( sendTargets.data(), sendSizes.data(), sendOffs.data(),
+      targets.data(),     recvSizes.data(), recvOffs.data(), comm );
+    mpi::AllToAll
+    ( sendValues.data(), sendSizes.data(), sendOffs.data(),
+      values.data(),     recvSizes.data(), recvOffs.data(), comm );
+
+    offsets.resize( meta.numRecvInds+1 );
+    off = 0;
+    for( Int r=0; r<meta.numRecvInds; ++r )
+    {
+        offsets[r] = off;
+        off += recvRowSizes[r];
+    }
+    offsets[meta.numRecvInds] = off;
+}
+
+} // namespace sparse_multiply
+} // namespace El
+
+#endif // ifndef EL_MULTIPLY_SPARSE_HPP
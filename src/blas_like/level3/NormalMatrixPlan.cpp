@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./Multiply/Sparse.hpp"
+
+namespace El {
+
+template<typename T>
+void NormalMatrixPlan<T>::Initialize
+( const SparseMatrix<T>& A, bool onlyLower, bool conjugate )
+{
+    EL_DEBUG_CSE
+    A_ = A;
+    Transpose( A, AAdj_, conjugate );
+    onlyLower_ = onlyLower;
+
+    sparse_multiply::CSRView<T> AView
+    { A_.Height(), A_.LockedOffsetBuffer(), A_.LockedTargetBuffer(),
+      A_.LockedValueBuffer() };
+    sparse_multiply::CSRView<T> AAdjView
+    { AAdj_.Height(), AAdj_.LockedOffsetBuffer(), AAdj_.LockedTargetBuffer(),
+      AAdj_.LockedValueBuffer() };
+    sparse_multiply::PatternCtrl ctrl;
+    ctrl.includeDiagonal = true;
+    ctrl.onlyLower = onlyLower;
+    sparse_multiply::Symbolic
+    ( AView, AAdjView, A_.Height(), ctrl, offsets_, targets_ );
+    initialized_ = true;
+}
+
+template<typename T>
+void NormalMatrixPlan<T>::Form( const Matrix<T>& d, SparseMatrix<T>& C ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Form()'");
+    const Int m = A_.Height();
+    const Int n = A_.Width();
+    if( d.Height() != n || d.Width() != 1 )
+        LogicError("d should be a column vector of length ",n);
+
+    const Int numEntries = targets_.size();
+    const bool samePattern =
+      C.Height() == m && C.Width() == m && C.Consistent() &&
+      C.NumEntries() == numEntries &&
+      std::equal( offsets_.begin(), offsets_.end(), C.LockedOffsetBuffer() ) &&
+      std::equal( targets_.begin(), targets_.end(), C.LockedTargetBuffer() );
+    if( !samePattern )
+    {
+        C.Empty();
+        C.Resize( m, m );
+        C.ForceNumEntries( numEntries );
+        Int* sourceBuf = C.SourceBuffer();
+        for( Int i=0; i<m; ++i )
+            for( Int e=offsets_[i]; e<offsets_[i+1]; ++e )
+                sourceBuf[e] = i;
+        MemCopy( C.TargetBuffer(), targets_.data(), numEntries );
+        MemCopy( C.OffsetBuffer(), offsets_.data(), m+1 );
+        C.ForceConsistency();
+    }
+
+    // A contiguous copy of d is required for indexing by the targets of A
+    vector<T> scale( n );
+    for( Int k=0; k<n; ++k )
+        scale[k] = d(k);
+
+    sparse_multiply::CSRView<T> AView
+    { m, A_.LockedOffsetBuffer(), A_.LockedTargetBuffer(),
+      A_.LockedValueBuffer() };
+    sparse_multiply::CSRView<T> AAdjView
+    { n, AAdj_.LockedOffsetBuffer(), AAdj_.LockedTargetBuffer(),
+      AAdj_.LockedValueBuffer() };
+    sparse_multiply::Numeric
+    ( AView, AAdjView, offsets_, targets_, C.ValueBuffer(), scale.data() );
+}
+
+template<typename T>
+bool NormalMatrixPlan<T>::Initialized() const EL_NO_EXCEPT
+{ return initialized_; }
+
+template<typename T>
+bool NormalMatrixPlan<T>::OnlyLower() const EL_NO_EXCEPT
+{ return onlyLower_; }
+
+template<typename T>
+Int NormalMatrixPlan<T>::Height() const EL_NO_EXCEPT
+{ return A_.Height(); }
+
+template<typename T>
+Int NormalMatrixPlan<T>::Width() const EL_NO_EXCEPT
+{ return A_.Width(); }
+
+template<typename T>
+Int NormalMatrixPlan<T>::NumEntries() const EL_NO_EXCEPT
+{ return targets_.size(); }
+
+template<typename T>
+void DistNormalMatrixPlan<T>::Initialize
+( const DistSparseMatrix<T>& A, bool onlyLower, bool conjugate )
+{
+    EL_DEBUG_CSE
+    grid_ = &A.Grid();
+    height_ = A.Height();
+    width_ = A.Width();
+    onlyLower_ = onlyLower;
+
+    // Gather the rows of A^T (or A^H) indexed by the targets of our rows of A
+    DistSparseMatrix<T> AAdj(A.Grid());
+    Transpose( A, AAdj, conjugate );
+    A.InitializeMultMeta();
+    meta_ = A.LockedDistGraph().multMeta;
+    sparse_multiply::GatherRows
+    ( AAdj, meta_, AAdjOffsets_, AAdjTargets_, AAdjValues_ );
+
+    // Keep a copy of our rows of A with their targets mapped to the indices of
+    // the gathered rows
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    AOffsets_.assign
+    ( A.LockedOffsetBuffer(), A.LockedOffsetBuffer()+localHeight+1 );
+    ATargets_ = meta_.colOffs;
+    AValues_.assign
+    ( A.LockedValueBuffer(), A.LockedValueBuffer()+numLocalEntries );
+
+    sparse_multiply::CSRView<T> AView
+    { localHeight, AOffsets_.data(), ATargets_.data(), AValues_.data() };
+    sparse_multiply::CSRView<T> AAdjView
+    { meta_.numRecvInds, AAdjOffsets_.data(), AAdjTargets_.data(),
+      AAdjValues_.data() };
+    sparse_multiply::PatternCtrl ctrl;
+    ctrl.firstRow = A.FirstLocalRow();
+    ctrl.includeDiagonal = true;
+    ctrl.onlyLower = onlyLower;
+    sparse_multiply::Symbolic
+    ( AView, AAdjView, height_, ctrl, offsets_, targets_ );
+    initialized_ = true;
+}
+
+template<typename T>
+void DistNormalMatrixPlan<T>::Form
+( const DistMultiVec<T>& d, DistSparseMatrix<T>& C ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Form()'");
+    if( d.Height() != width_ || d.Width() != 1 )
+        LogicError("d should be a column vector of length ",width_);
+    if( !mpi::Congruent( grid_->Comm(), d.Grid().Comm() ) )
+        LogicError("Communicators of A and d must match");
+
+    // Gather the entries of d indexed by the targets of our rows of A
+    const Int numSendInds = meta_.sendInds.size();
+    const Int dFirstLocalRow = d.FirstLocalRow();
+    auto& dLoc = d.LockedMatrix();
+    vector<T> sendVals;
+    FastResize( sendVals, numSendInds );
+    for( Int s=0; s<numSendInds; ++s )
+        sendVals[s] = dLoc(meta_.sendInds[s]-dFirstLocalRow);
+    vector<T> scale;
+    FastResize( scale, meta_.numRecvInds );
+    mpi::AllToAll
+    ( sendVals.data(), meta_.sendSizes.data(), meta_.sendOffs.data(),
+      scale.data(),    meta_.recvSizes.data(), meta_.recvOffs.data(),
+      grid_->Comm() );
+
+    const Int localHeight = AOffsets_.size() - 1;
+    const Int numLocalEntries = targets_.size();
+    bool samePattern =
+      C.Height() == height_ && C.Width() == height_ &&
+      C.LocallyConsistent() && C.NumLocalEntries() == numLocalEntries &&
+      mpi::Congruent( grid_->Comm(), C.Grid().Comm() ) &&
+      std::equal( offsets_.begin(), offsets_.end(), C.LockedOffsetBuffer() ) &&
+      std::equal( targets_.begin(), targets_.end(), C.LockedTargetBuffer() );
+    // Every process must agree on whether or not the pattern is rebuilt
+    samePattern =
+      mpi::AllReduce( Int(samePattern), mpi::MIN, grid_->Comm() ) == 1;
+    if( !samePattern )
+    {
+        C.SetGrid( *grid_ );
+        C.Empty();
+        C.Resize( height_, height_ );
+        C.ForceNumLocalEntries( numLocalEntries );
+        const Int firstLocalRow = C.FirstLocalRow();
+        Int* sourceBuf = C.SourceBuffer();
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            for( Int e=offsets_[iLoc]; e<offsets_[iLoc+1]; ++e )
+                sourceBuf[e] = firstLocalRow + iLoc;
+        MemCopy( C.TargetBuffer(), targets_.data(), numLocalEntries );
+        MemCopy( C.OffsetBuffer(), offsets_.data(), localHeight+1 );
+        C.ForceConsistency();
+    }
+
+    sparse_multiply::CSRView<T> AView
+    { localHeight, AOffsets_.data(), ATargets_.data(), AValues_.data() };
+    sparse_multiply::CSRView<T> AAdjView
+    { meta_.numRecvInds, AAdjOffsets_.data(), AAdjTargets_.data(),
+      AAdjValues_.data() };
+    sparse_multiply::Numeric
+    ( AView, AAdjView, offsets_, targets_, C.ValueBuffer(), scale.data() );
+}
+
+template<typename T>
+bool DistNormalMatrixPlan<T>::Initialized() const EL_NO_EXCEPT
+{ return initialized_; }
+
+template<typename T>
+bool DistNormalMatrixPlan<T>::OnlyLower() const EL_NO_EXCEPT
+{ return onlyLower_; }
+
+template<typename T>
+Int DistNormalMatrixPlan<T>::Height() const EL_NO_EXCEPT
+{ return height_; }
+
+template<typename T>
+Int DistNormalMatrixPlan<T>::Width() const EL_NO_EXCEPT
+{ return width_; }
+
+template<typename T>
+Int DistNormalMatrixPlan<T>::NumLocalEntries() const EL_NO_EXCEPT
+{ return targets_.size(); }
+
+#define PROTO(T) \
+  template class NormalMatrixPlan<T>; \
+  template class DistNormalMatrixPlan<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
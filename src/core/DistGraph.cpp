@@ -439,46 +439,10 @@ void DistGraph::ProcessLocalQueues()
     if( locallyConsistent_ )
         return;
 
-    const Int numLocalEdges = sources_.size();
-    Int numRemoved = 0;
-    vector<pair<Int,Int>> pairs( numLocalEdges );
-    if( markedForRemoval_.size() != 0 )
-    {
-        for( Int e=0; e<numLocalEdges; ++e )
-        {
-            pair<Int,Int> candidate(sources_[e],targets_[e]);
-            if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
-                pairs[e-numRemoved] = candidate;
-            else
-                ++numRemoved;
-        }
-        SwapClear( markedForRemoval_ );
-        pairs.resize( numLocalEdges-numRemoved );
-    }
-    else
-    {
-        for( Int e=0; e<numLocalEdges; ++e )
-            pairs[e] = pair<Int,Int>{sources_[e],targets_[e]};
-    }
-    std::sort( pairs.begin(), pairs.end() );
-    const Int numSorted = pairs.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int e=1; e<numSorted; ++e )
-        if( pairs[e] != pairs[lastUnique] )
-            pairs[++lastUnique] = pairs[e];
-    const Int numUnique = lastUnique+1;
-    pairs.resize( numUnique );
-
-    sources_.resize( numUnique );
-    targets_.resize( numUnique );
-    for( Int e=0; e<numUnique; ++e )
-    {
-        sources_[e] = pairs[e].first;
-        targets_[e] = pairs[e].second;
-    }
-    ComputeSourceOffsets();
+    sparse_assembly::SortAndCombine<Int>
+    ( FirstLocalSource(), numLocalSources_, sources_, targets_, nullptr,
+      markedForRemoval_, localSourceOffsets_ );
+    SwapClear( markedForRemoval_ );
     locallyConsistent_ = true;
 }
 
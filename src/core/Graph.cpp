@@ -231,47 +231,10 @@ void Graph::ProcessQueues()
     if( consistent_ )
         return;
 
-    Int numRemoved=0;
-    const Int numEdges = sources_.size();
-    vector<pair<Int,Int>> pairs( numEdges );
-    if( markedForRemoval_.size() != 0 )
-    {
-        for( Int e=0; e<numEdges; ++e )
-        {
-            pair<Int,Int> candidate(sources_[e],targets_[e]);
-            if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
-                pairs[e-numRemoved] = candidate;
-            else
-                ++numRemoved;
-        }
-        markedForRemoval_.clear();
-        pairs.resize( numEdges-numRemoved );
-    }
-    else
-    {
-        for( Int e=0; e<numEdges; ++e )
-            pairs[e] = pair<Int,Int>{sources_[e],targets_[e]};
-    }
-    std::sort( pairs.begin(), pairs.end() );
-    const Int numSorted = pairs.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int e=1; e<numSorted; ++e )
-        if( pairs[e] != pairs[lastUnique] )
-            pairs[++lastUnique] = pairs[e];
-    const Int numUnique = lastUnique+1;
-    pairs.resize( numUnique );
-
-    sources_.resize( numUnique );
-    targets_.resize( numUnique );
-    for( Int e=0; e<numUnique; ++e )
-    {
-        sources_[e] = pairs[e].first;
-        targets_[e] = pairs[e].second;
-    }
-
-    ComputeSourceOffsets();
+    sparse_assembly::SortAndCombine<Int>
+    ( 0, numSources_, sources_, targets_, nullptr, markedForRemoval_,
+      sourceOffsets_ );
+    markedForRemoval_.clear();
     consistent_ = true;
 }
 
@@ -12,6 +12,50 @@
 namespace El {
 namespace hessenberg {
 
+// The reflectors from this many consecutive panels of the reduction are
+// aggregated into each WY transform applied by the sequential routines so
+// that the updates are performed with wider matrix-matrix products
+const Int numPanelsPerWY = 2;
+
+// Apply the packed reflectors to B in independent blocks of its columns (if
+// side==LEFT) or rows (if side==RIGHT), which are processed in parallel
+// when OpenMP is enabled
+template<typename F>
+void ApplyPackedReflectorsThreaded
+( LeftOrRight side, UpperOrLower uplo,
+  VerticalOrHorizontal dir, ForwardOrBackward order,
+  Conjugation conjugation, Int offset,
+  const Matrix<F>& H,
+  const Matrix<F>& householderScalars,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const bool onLeft = (side==LEFT);
+    const Int numIndep = ( onLeft ? B.Width() : B.Height() );
+#ifdef EL_HYBRID
+    const Int maxThreads = omp_get_max_threads();
+#else
+    const Int maxThreads = 1;
+#endif
+    const Int numBlocks =
+      Max( Min( maxThreads, numIndep/Blocksize() ), Int(1) );
+    const Int blockSize = ( numIndep+numBlocks-1 ) / numBlocks;
+
+    PushBlocksizeStack( numPanelsPerWY*Blocksize() );
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int first = block*blockSize;
+        const Int last = Min( first+blockSize, numIndep );
+        auto BBlock =
+          ( onLeft ? B( ALL, IR(first,last) ) : B( IR(first,last), ALL ) );
+        ApplyPackedReflectors
+        ( side, uplo, dir, order, conjugation, offset,
+          H, householderScalars, BBlock );
+    }
+    PopBlocksizeStack();
+}
+
 template<typename F>
 void ApplyQ
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
@@ -26,14 +70,14 @@ void ApplyQ
     if( uplo == LOWER )
     {
         const Conjugation conjugation = ( normal ? UNCONJUGATED : CONJUGATED );
-        ApplyPackedReflectors
+        ApplyPackedReflectorsThreaded
         ( side, UPPER, HORIZONTAL, direction, conjugation, 1,
           A, householderScalars, B );
     }
     else
     {
         const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
-        ApplyPackedReflectors
+        ApplyPackedReflectorsThreaded
         ( side, LOWER, VERTICAL, direction, conjugation, -1,
           A, householderScalars, B );
     }
@@ -12,6 +12,11 @@
 namespace El {
 namespace hessenberg {
 
+// Since Q = H_0 H_1 ... H_{n-2}, where H_j only acts upon indices j+1:n,
+// accumulating the reflectors from the last to the first only ever modifies
+// the trailing submatrix Q(j+1:n,j+1:n), which is all that each block of
+// reflectors is applied to.
+
 template<typename F>
 void FormQ
 ( UpperOrLower uplo,
@@ -20,24 +25,74 @@ void FormQ
         Matrix<F>& Q )
 {
     EL_DEBUG_CSE
-    // TODO: Make this smarter
     const Int n = A.Height();
     Identity( Q, n, n );
-    ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    const Int numReflectors = Max(n-1,0);
+    const Int bsize = numPanelsPerWY*Blocksize();
+    const Int kLast = LastOffset( numReflectors, bsize );
+    for( Int k=kLast; k>=0; k-=bsize )
+    {
+        const Int nb = Min(bsize,numReflectors-k);
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+        auto QBR = Q( IR(k+1,n), IR(k+1,n) );
+        if( uplo == LOWER )
+        {
+            auto A1R = A( IR(k,k+nb), IR(k+1,n) );
+            ApplyPackedReflectorsThreaded
+            ( LEFT, UPPER, HORIZONTAL, BACKWARD, UNCONJUGATED, 0,
+              A1R, householderScalars1, QBR );
+        }
+        else
+        {
+            auto AB1 = A( IR(k+1,n), IR(k,k+nb) );
+            ApplyPackedReflectorsThreaded
+            ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, 0,
+              AB1, householderScalars1, QBR );
+        }
+    }
 }
 
 template<typename F>
 void FormQ
 ( UpperOrLower uplo,
-  const AbstractDistMatrix<F>& A,
-  const AbstractDistMatrix<F>& householderScalars,
-        AbstractDistMatrix<F>& Q )
+  const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& householderScalarsPre,
+        AbstractDistMatrix<F>& QPre )
 {
     EL_DEBUG_CSE
-    // TODO: Make this smarter
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& A = AProx.GetLocked();
+    auto& householderScalars = householderScalarsProx.GetLocked();
+    auto& Q = QProx.Get();
+
     const Int n = A.Height();
     Identity( Q, n, n );
-    ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, Q );
+    const Int numReflectors = Max(n-1,0);
+    const Int bsize = Blocksize();
+    const Int kLast = LastOffset( numReflectors, bsize );
+    for( Int k=kLast; k>=0; k-=bsize )
+    {
+        const Int nb = Min(bsize,numReflectors-k);
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+        auto QBR = Q( IR(k+1,n), IR(k+1,n) );
+        if( uplo == LOWER )
+        {
+            auto A1R = A( IR(k,k+nb), IR(k+1,n) );
+            ApplyPackedReflectors
+            ( LEFT, UPPER, HORIZONTAL, BACKWARD, UNCONJUGATED, 0,
+              A1R, householderScalars1, QBR );
+        }
+        else
+        {
+            auto AB1 = A( IR(k+1,n), IR(k,k+nb) );
+            ApplyPackedReflectors
+            ( LEFT, LOWER, VERTICAL, BACKWARD, CONJUGATED, 0,
+              AB1, householderScalars1, QBR );
+        }
+    }
 }
 
 } // namespace hessenberg
@@ -14,6 +14,21 @@
 namespace El {
 namespace hessenberg {
 
+// AB0 := AB0 - (UB1 inv(G11)^H UB1^H AB0)
+//      = AB0 - (UB1 ((AB0^H UB1) inv(G11))^H)
+template<typename F>
+void LowerUpdateLeft
+(       Matrix<F>& AB0,
+  const Matrix<F>& UB1,
+  const Matrix<F>& G11 )
+{
+    EL_DEBUG_CSE
+    Matrix<F> V01;
+    Gemm( ADJOINT, NORMAL, F(1), AB0, UB1, V01 );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), G11, V01 );
+    Gemm( NORMAL, ADJOINT, F(-1), UB1, V01, F(1), AB0 );
+}
+
 template<typename F>
 void LowerBlocked( Matrix<F>& A, Matrix<F>& householderScalars )
 {
@@ -21,39 +36,56 @@ void LowerBlocked( Matrix<F>& A, Matrix<F>& householderScalars )
     const Int n = A.Height();
     householderScalars.Resize( Max(n-1,0), 1 );
 
-    Matrix<F> UB1, V01, VB1, G11;
+    // The update of the columns left of each panel only involves the columns
+    // left of the next panel, so it is deferred until the next iteration and
+    // overlapped with the (memory-bound) factorization of the next panel. The
+    // Householder vectors of consecutive panels are therefore stored in
+    // alternating buffers.
+    Matrix<F> UBuf[2], GBuf[2], VB1;
+    Int kPrev=-1, stepPrev=0;
 
     const Int bsize = Blocksize();
-    for( Int k=0; k<n-1; k+=bsize )
+    for( Int k=0, step=0; k<n-1; k+=bsize, ++step )
     {
         const Int nb = Min(bsize,n-1-k);
 
-        const Range<Int> ind0( 0,    k    ),
-                         ind1( k,    k+nb ),
+        const Range<Int> ind1( k,    k+nb ),
                          indB( k,    n    ), indR( k, n ),
                          ind2( k+nb, n    );
 
         auto ABR = A( indB, indR );
-        auto A22 = A( ind2, ind2 );
 
         auto householderScalars1 = householderScalars( ind1, ALL );
+        auto& UB1 = UBuf[step%2];
+        auto& G11 = GBuf[step%2];
+        const auto& UB1Prev = UBuf[stepPrev%2];
+        const auto& G11Prev = GBuf[stepPrev%2];
         UB1.Resize( n-k, nb );
         VB1.Resize( n-k, nb );
         G11.Resize( nb,  nb );
-        hessenberg::LowerPanel( ABR, householderScalars1, UB1, VB1, G11 );
 
-        auto AB0 = A( indB, ind0 );
+        EL_PARALLEL_FOR
+        for( Int section=0; section<2; ++section )
+        {
+            if( section == 0 )
+            {
+                if( kPrev >= 0 )
+                {
+                    auto AB0Prev = A( IR(kPrev,n), IR(0,kPrev) );
+                    LowerUpdateLeft( AB0Prev, UB1Prev, G11Prev );
+                }
+            }
+            else
+                hessenberg::LowerPanel
+                ( ABR, householderScalars1, UB1, VB1, G11 );
+        }
+        kPrev = k;
+        stepPrev = step;
+
         auto A2R = A( ind2, indR );
         auto U21 = UB1( IR(nb,END), ALL );
         auto V21 = VB1( IR(nb,END), ALL );
 
-        // AB0 := AB0 - (UB1 inv(G11)^H UB1^H AB0)
-        //      = AB0 - (UB1 ((AB0^H UB1) inv(G11))^H)
-        // -------------------------------------------
-        Gemm( ADJOINT, NORMAL, F(1), AB0, UB1, V01 );
-        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), G11, V01 );
-        Gemm( NORMAL, ADJOINT, F(-1), UB1, V01, F(1), AB0 );
-
         // A2R := (A2R - U21 inv(G11)^H VB1^H)(I - UB1 inv(G11) UB1^H)
         // -----------------------------------------------------------
         // A2R := A2R - U21 inv(G11)^H VB1^H
@@ -65,6 +97,12 @@ void LowerBlocked( Matrix<F>& A, Matrix<F>& householderScalars )
         Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), G11, V21 );
         Gemm( NORMAL, ADJOINT, F(-1), V21, UB1, F(1), A2R );
     }
+    if( kPrev >= 0 )
+    {
+        // Finish the deferred update of the columns left of the last panel
+        auto AB0 = A( IR(kPrev,n), IR(0,kPrev) );
+        LowerUpdateLeft( AB0, UBuf[stepPrev%2], GBuf[stepPrev%2] );
+    }
 }
 
 template<typename F>
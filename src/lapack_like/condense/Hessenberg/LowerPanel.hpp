@@ -156,6 +156,7 @@ void LowerPanel
 
     DistMatrix<F,STAR,MR  > a1Conj_MR(g);
     DistMatrix<F,STAR,STAR> y10_STAR(g);
+    vector<F> reduceBuf;
 
     for( Int k=0; k<nU; ++k )
     {
@@ -224,12 +225,26 @@ void LowerPanel
 
         // v1 := A2^H u21
         LocalGemv( ADJOINT, F(1), A2, u21_MC, F(0), v1_MR );
-        El::AllReduce( v1_MR, A2.ColComm() );
 
         // g01 := U20^H u21
         LocalGemv
         ( ADJOINT, F(1), U20_MC_STAR, u21_MC, F(0), g01_STAR );
-        El::AllReduce( g01_STAR, U20_MC_STAR.ColComm() );
+
+        // Both of the above products are summed over the process column, so
+        // the two reductions are fused to halve the latency cost
+        auto& v1Loc = v1_MR.Matrix();
+        auto& g01Loc = g01_STAR.Matrix();
+        const Int v1LocHeight = v1Loc.Height();
+        reduceBuf.resize( v1LocHeight+k );
+        for( Int iLoc=0; iLoc<v1LocHeight; ++iLoc )
+            reduceBuf[iLoc] = v1Loc(iLoc,0);
+        for( Int j=0; j<k; ++j )
+            reduceBuf[v1LocHeight+j] = g01Loc(j,0);
+        mpi::AllReduce( reduceBuf.data(), v1LocHeight+k, A2.ColComm() );
+        for( Int iLoc=0; iLoc<v1LocHeight; ++iLoc )
+            v1Loc(iLoc,0) = reduceBuf[iLoc];
+        for( Int j=0; j<k; ++j )
+            g01Loc(j,0) = reduceBuf[v1LocHeight+j];
 
         // gamma11 := 1/tau
         gamma11.Set(0,0,F(1)/tau);
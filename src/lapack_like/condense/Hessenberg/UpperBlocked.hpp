@@ -14,6 +14,20 @@
 namespace El {
 namespace hessenberg {
 
+// A0R := A0R - ((A0R UB1) inv(G11)^H) UB1^H
+template<typename F>
+void UpperUpdateAbove
+(       Matrix<F>& A0R,
+  const Matrix<F>& UB1,
+  const Matrix<F>& G11 )
+{
+    EL_DEBUG_CSE
+    Matrix<F> V01;
+    Gemm( NORMAL, NORMAL, F(1), A0R, UB1, V01 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), G11, V01 );
+    Gemm( NORMAL, ADJOINT, F(-1), V01, UB1, F(1), A0R );
+}
+
 template<typename F>
 void UpperBlocked( Matrix<F>& A, Matrix<F>& householderScalars )
 {
@@ -21,38 +35,56 @@ void UpperBlocked( Matrix<F>& A, Matrix<F>& householderScalars )
     const Int n = A.Height();
     householderScalars.Resize( Max(n-1,0), 1 );
 
-    Matrix<F> UB1, V01, VB1, G11;
+    // The update of the rows above each panel only involves the rows above
+    // the next panel, so it is deferred until the next iteration and
+    // overlapped with the (memory-bound) factorization of the next panel. The
+    // Householder vectors of consecutive panels are therefore stored in
+    // alternating buffers.
+    Matrix<F> UBuf[2], GBuf[2], VB1;
+    Int kPrev=-1, stepPrev=0;
 
     const Int bsize = Blocksize();
-    for( Int k=0; k<n-1; k+=bsize )
+    for( Int k=0, step=0; k<n-1; k+=bsize, ++step )
     {
         const Int nb = Min(bsize,n-1-k);
 
-        const Range<Int> ind0( 0,    k    ),
-                         ind1( k,    k+nb ),
+        const Range<Int> ind1( k,    k+nb ),
                          indB( k,    n    ), indR( k, n ),
                          ind2( k+nb, n    );
 
         auto ABR = A( indB, indR );
-        auto A22 = A( ind2, ind2 );
 
         auto householderScalars1 = householderScalars( ind1, ALL );
+        auto& UB1 = UBuf[step%2];
+        auto& G11 = GBuf[step%2];
+        const auto& UB1Prev = UBuf[stepPrev%2];
+        const auto& G11Prev = GBuf[stepPrev%2];
         UB1.Resize( n-k, nb );
         VB1.Resize( n-k, nb );
         G11.Resize( nb,  nb );
-        hessenberg::UpperPanel( ABR, householderScalars1, UB1, VB1, G11 );
 
-        auto A0R = A( ind0, indR );
+        EL_PARALLEL_FOR
+        for( Int section=0; section<2; ++section )
+        {
+            if( section == 0 )
+            {
+                if( kPrev >= 0 )
+                {
+                    auto A0RPrev = A( IR(0,kPrev), IR(kPrev,n) );
+                    UpperUpdateAbove( A0RPrev, UB1Prev, G11Prev );
+                }
+            }
+            else
+                hessenberg::UpperPanel
+                ( ABR, householderScalars1, UB1, VB1, G11 );
+        }
+        kPrev = k;
+        stepPrev = step;
+
         auto AB2 = A( indB, ind2 );
         auto U21 = UB1( IR(nb,END), ALL );
         auto V21 = VB1( IR(nb,END), ALL );
 
-        // A0R := A0R - ((A0R UB1) inv(G11)^H) UB1^H
-        // -----------------------------------------
-        Gemm( NORMAL, NORMAL, F(1), A0R, UB1, V01 );
-        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), G11, V01 );
-        Gemm( NORMAL, ADJOINT, F(-1), V01, UB1, F(1), A0R );
-
         // AB2 := (I - UB1 inv(G11) UB1^H)(AB2 - VB1 inv(G11)^H U21^H)
         // -----------------------------------------------------------
         // AB2 := AB2 - VB1 inv(G11)^H U21^H
@@ -66,6 +98,12 @@ void UpperBlocked( Matrix<F>& A, Matrix<F>& householderScalars )
         Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), G11, V21 );
         Gemm( NORMAL, ADJOINT, F(-1), UB1, V21, F(1), AB2 );
     }
+    if( kPrev >= 0 )
+    {
+        // Finish the deferred update of the rows above the last panel
+        auto A0R = A( IR(0,kPrev), IR(kPrev,n) );
+        UpperUpdateAbove( A0R, UBuf[stepPrev%2], GBuf[stepPrev%2] );
+    }
 }
 
 template<typename F>
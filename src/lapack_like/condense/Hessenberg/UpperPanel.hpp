@@ -153,6 +153,7 @@ void UpperPanel
 
     DistMatrix<F,MC,  STAR> a1_MC(g);
     DistMatrix<F,STAR,STAR> y10_STAR(g);
+    vector<F> reduceBuf;
 
     for( Int k=0; k<nU; ++k )
     {
@@ -214,13 +215,26 @@ void UpperPanel
 
         // v1 := A2 u21
         LocalGemv( NORMAL, F(1), A2, u21_MR, F(0), v1_MC );
-        El::AllReduce( v1_MC, A2.RowComm() );
 
         // g10 := u21^H U20 = (U20^H u21)^H
         LocalGemv
         ( ADJOINT, F(1), U20_MR_STAR, u21_MR, F(0), g10_STAR );
-        El::AllReduce( g10_STAR, U20_MR_STAR.ColComm() );
-        Conjugate( g10_STAR );
+
+        // Both of the above products are summed over the process row, so
+        // the two reductions are fused to halve the latency cost
+        auto& v1Loc = v1_MC.Matrix();
+        auto& g10Loc = g10_STAR.Matrix();
+        const Int v1LocHeight = v1Loc.Height();
+        reduceBuf.resize( v1LocHeight+k );
+        for( Int iLoc=0; iLoc<v1LocHeight; ++iLoc )
+            reduceBuf[iLoc] = v1Loc(iLoc,0);
+        for( Int j=0; j<k; ++j )
+            reduceBuf[v1LocHeight+j] = g10Loc(0,j);
+        mpi::AllReduce( reduceBuf.data(), v1LocHeight+k, A2.RowComm() );
+        for( Int iLoc=0; iLoc<v1LocHeight; ++iLoc )
+            v1Loc(iLoc,0) = reduceBuf[iLoc];
+        for( Int j=0; j<k; ++j )
+            g10Loc(0,j) = Conj(reduceBuf[v1LocHeight+j]);
 
         // gamma11 := 1/tau
         gamma11.Set(0,0,F(1)/tau);
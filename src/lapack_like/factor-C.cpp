@@ -51,6 +51,8 @@ ElError ElQRCtrlDefault_s( ElQRCtrl_s* ctrl )
     ctrl->tol = 0;
     ctrl->alwaysRecomputeNorms = false;
     ctrl->smallestFirst = false;
+    ctrl->cholesky = false;
+    ctrl->cholVariant = EL_CHOLESKY_QR_ADAPTIVE;
     return EL_SUCCESS;
 }
 
@@ -63,6 +65,8 @@ ElError ElQRCtrlDefault_d( ElQRCtrl_d* ctrl )
     ctrl->tol = 0;
     ctrl->alwaysRecomputeNorms = false;
     ctrl->smallestFirst = false;
+    ctrl->cholesky = false;
+    ctrl->cholVariant = EL_CHOLESKY_QR_ADAPTIVE;
     return EL_SUCCESS;
 }
 
@@ -9,14 +9,26 @@
 #ifndef EL_CHOLESKY_LOWER_MOD_HPP
 #define EL_CHOLESKY_LOWER_MOD_HPP
 
-// TODO: Blocked algorithms
 namespace El {
 namespace cholesky {
 
 namespace mod {
 
+// Each step of the following unblocked updates and downdates overwrites the
+// remainder of the rows of [L(:,k), V] with
+//
+//   [L(:,k), V] (I - beta_k J w_k w_k^H),   w_k = | 1          |,
+//                                                 | V(k,:)^T   |
+//
+// where J = I for updates and J = diag(1,-I) for downdates, and then negates
+// L(:,k) so that the diagonal of L is positive. Since the later w_k vanish
+// in the earlier columns of L, the negations commute with the later
+// transformations and can be applied after all of them. The beta_k are
+// returned so that the same transformations can be applied in a blocked manner
+// to the rows below a panel.
+
 template<typename F>
-void LowerUpdate( Matrix<F>& L, Matrix<F>& V )
+void LowerUpdate( Matrix<F>& L, Matrix<F>& V, Matrix<F>& betas )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -26,6 +38,7 @@ void LowerUpdate( Matrix<F>& L, Matrix<F>& V )
           LogicError("V is the wrong height");
     )
     const Int m = V.Height();
+    betas.Resize( m, 1 );
 
     Matrix<F> z21;
 
@@ -44,83 +57,99 @@ void LowerUpdate( Matrix<F>& L, Matrix<F>& V )
         //                 \        | u^T |              /
         // where beta >= 0
         const F tau = RightReflector( lambda11, v1 );
+        betas(k) = tau;
 
-        // Apply the negative Householder reflector from the right:
-        // | l21 V2 | := -| l21 V2 | + tau | l21 V2 | | 1   | | 1 conj(u) |
-        //                                           | u^T |
-        //             = -| l21 V2 | + tau (l21 + V2 u^T) | 1 conj(u) |
+        // Apply the Householder reflector from the right and negate l21:
+        // | l21 V2 | := | l21 V2 | - tau | l21 V2 | | 1   | | 1 conj(u) |
+        //                                          | u^T |
+        //             = | l21 V2 | - tau (l21 + V2 u^T) | 1 conj(u) |
         lambda11 = -lambda11;
         z21 = l21;
         Gemv( NORMAL, F(1), V2, v1, F(1), z21 );
         l21 *= -1;
         Axpy( tau, z21, l21 );
-        V2 *= -1;
-        Ger( tau, z21, v1, V2 );
+        Ger( -tau, z21, v1, V2 );
     }
 }
 
 template<typename F>
-void LowerUpdate
-( AbstractDistMatrix<F>& LPre,
-  AbstractDistMatrix<F>& VPre )
+void LowerDowndate( Matrix<F>& L, Matrix<F>& V, Matrix<F>& betas )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( LPre.Height() != LPre.Width() )
+      if( L.Height() != L.Width() )
           LogicError("Cholesky factors must be square");
-      if( VPre.Height() != LPre.Height() )
+      if( V.Height() != L.Height() )
           LogicError("V is the wrong height");
-      AssertSameGrids( LPre, VPre );
     )
-
-    DistMatrixReadWriteProxy<F,F,MC,MR> LProx( LPre ), VProx( VPre );
-    auto& L = LProx.Get();
-    auto& V = VProx.Get();
-
     const Int m = V.Height();
-    const Grid& grid = L.Grid();
-    DistMatrix<F,MC,STAR> z21_MC_STAR(grid), b21_MC_STAR(grid);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(grid);
+    betas.Resize( m, 1 );
+
+    Matrix<F> z21;
 
     for( Int k=0; k<m; ++k )
     {
         const IR ind1( k ), ind2( k+1, END );
 
-        F lambda11 = L.Get( k, k );
+        F& lambda11 = L(k,k);
         auto l21 = L( ind2, ind1 );
 
         auto v1 = V( ind1, ALL );
         auto V2 = V( ind2, ALL );
 
         // Find tau and u such that
-        //  | lambda11 u | /I - tau | 1   | | 1 conj(u) |\ = | -beta 0 |
-        //                 \        | u^T |              /
-        // where beta >= 0
-        const F tau = RightReflector( lambda11, v1 );
-
-        // Apply the negative Householder reflector from the right:
-        // | l21 V2 | := -| l21 V2 | + tau | l21 V2 | | 1   | | 1 conj(u) |
-        //                                            | u^T |
-        //             = -| l21 V2 | + tau (l21 + V2 u^T) | 1 conj(u) |
-        L.Set( k, k, -lambda11 );
-        z21_MC_STAR.AlignWith( V2 );
-        b21_MC_STAR.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        z21_MC_STAR = l21;
-        v1_STAR_MR = v1;
-        Zeros( b21_MC_STAR, V2.Height(), 1 );
-        LocalGemv( NORMAL, F(1), V2, v1_STAR_MR, F(0), b21_MC_STAR );
-        El::AllReduce( b21_MC_STAR, V2.RowComm() );
-        z21_MC_STAR += b21_MC_STAR;
+        //  | lambda11 u | /I - 1/tau Sigma | 1   | | 1 conj(u) |\ = | -beta 0 |
+        //                 \                | u^T |              /
+        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
+        const F tau = RightHyperbolicReflector( lambda11, v1 );
+        betas(k) = F(1)/tau;
+
+        // Apply the hyperbolic Householder reflector from the right and
+        // negate l21:
+        // |l21 V2| := |l21 V2| - 1/tau |l21 V2| Sigma |1  | |1 conj(u)|
+        //                                             |u^T|
+        //           = |l21 V2| - 1/tau |l21 -V2| |1  | |1 conj(u)|
+        //                                        |u^T|
+        //           = |l21 V2| - 1/tau |l21 - V2 u^T| |1 conj(u)|
+        lambda11 = -lambda11;
+        z21 = l21;
+        Gemv( NORMAL, F(-1), V2, v1, F(1), z21 );
         l21 *= -1;
-        Axpy( tau, z21_MC_STAR, l21 );
-        V2 *= -1;
-        LocalGer( tau, z21_MC_STAR, v1_STAR_MR, V2 );
+        Axpy( F(1)/tau, z21, l21 );
+        Ger( -F(1)/tau, z21, v1, V2 );
+    }
+}
+
+// Form the upper-triangular T such that the product of the panel's
+// transformations (excluding the negations of the columns of L) is
+// I - J W T W^H, where W = [I; V1^T]
+template<typename F>
+void FormT
+( const Matrix<F>& V1,
+  const Matrix<F>& betas,
+        Matrix<F>& T,
+  bool downdate )
+{
+    EL_DEBUG_CSE
+    const Int nb = V1.Height();
+    const F sign = ( downdate ? F(-1) : F(1) );
+    Matrix<F> G;
+    Gemm( NORMAL, ADJOINT, F(1), V1, V1, G );
+    Zeros( T, nb, nb );
+    for( Int j=0; j<nb; ++j )
+    {
+        auto T00 = T( IR(0,j), IR(0,j) );
+        auto t01 = T( IR(0,j), IR(j)   );
+        for( Int i=0; i<j; ++i )
+            t01(i) = sign*G(j,i);
+        Trmv( UPPER, NORMAL, NON_UNIT, T00, t01 );
+        t01 *= -betas(j);
+        T(j,j) = betas(j);
     }
 }
 
 template<typename F>
-void LowerDowndate( Matrix<F>& L, Matrix<F>& V )
+void LowerBlocked( Matrix<F>& L, Matrix<F>& V, bool downdate )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -129,45 +158,47 @@ void LowerDowndate( Matrix<F>& L, Matrix<F>& V )
       if( V.Height() != L.Height() )
           LogicError("V is the wrong height");
     )
-    const Int m = V.Height();
-
-    Matrix<F> z21;
+    const Int n = L.Height();
+    const F sign = ( downdate ? F(-1) : F(1) );
 
-    for( Int k=0; k<m; ++k )
+    Matrix<F> betas, T, Z21, V1Conj;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
     {
-        const IR ind1( k ), ind2( k+1, END );
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, n );
 
-        F& lambda11 = L(k,k);
-        auto l21 = L( ind2, ind1 );
-
-        auto v1 = V( ind1, ALL );
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+        auto V1 = V( ind1, ALL );
         auto V2 = V( ind2, ALL );
 
-        // Find tau and u such that
-        //  | lambda11 u | /I - 1/tau Sigma | 1   | | 1 conj(u) |\ = | -beta 0 |
-        //                 \                | u^T |              /
-        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
-        const F tau = RightHyperbolicReflector( lambda11, v1 );
-
-        // Apply the negative of the hyperbolic Householder reflector from the
-        // right:
-        // |l21 V2| := -|l21 V2| + 1/tau |l21 V2| Sigma |1  | |1 conj(u)|
-        //                                              |u^T|
-        //           = -|l21 V2| + 1/tau |l21 -V2| |1  | |1 conj(u)|
-        //                                         |u^T|
-        //           = -|l21 V2| + 1/tau |l21 - V2 u^T| |1 conj(u)|
-        lambda11 = -lambda11;
-        z21 = l21;
-        Gemv( NORMAL, F(-1), V2, v1, F(1), z21 );
-        l21 *= -1;
-        V2 *= -1;
-        Axpy( F(1)/tau, z21, l21 );
-        Ger( F(1)/tau, z21, v1, V2 );
+        if( downdate )
+            LowerDowndate( L11, V1, betas );
+        else
+            LowerUpdate( L11, V1, betas );
+        if( k+nb == n )
+            break;
+
+        // [L21, V2] := [L21, V2] - (L21 +- V2 V1^T) T [I, conj(V1)],
+        // followed by L21 := -L21
+        FormT( V1, betas, T, downdate );
+        Z21 = L21;
+        Gemm( NORMAL, TRANSPOSE, sign, V2, V1, F(1), Z21 );
+        Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T, Z21 );
+        L21 -= Z21;
+        L21 *= -1;
+        V1Conj = V1;
+        Conjugate( V1Conj );
+        Gemm( NORMAL, NORMAL, F(-1), Z21, V1Conj, F(1), V2 );
     }
 }
 
 template<typename F>
-void LowerDowndate( AbstractDistMatrix<F>& LPre, AbstractDistMatrix<F>& VPre )
+void LowerBlocked
+( AbstractDistMatrix<F>& LPre,
+  AbstractDistMatrix<F>& VPre,
+  bool downdate )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -182,48 +213,63 @@ void LowerDowndate( AbstractDistMatrix<F>& LPre, AbstractDistMatrix<F>& VPre )
     auto& L = LProx.Get();
     auto& V = VProx.Get();
 
-    const Int m = V.Height();
+    const Int n = L.Height();
     const Grid& grid = L.Grid();
-    DistMatrix<F,MC,STAR> z21_MC_STAR(grid), b21_MC_STAR(grid);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(grid);
-
-    for( Int k=0; k<m; ++k )
+    const F sign = ( downdate ? F(-1) : F(1) );
+
+    Matrix<F> betas, T;
+    DistMatrix<F,STAR,STAR> L11_STAR_STAR(grid), V1_STAR_STAR(grid),
+      T_STAR_STAR(grid);
+    DistMatrix<F,MC,STAR> Z21_MC_STAR(grid), L21_MC_STAR(grid);
+    DistMatrix<F,STAR,MR> V1_STAR_MR(grid);
+    DistMatrix<F,MR,STAR> V1Trans_MR_STAR(grid);
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
     {
-        const IR ind1( k ), ind2( k+1, END );
-
-        F lambda11 = L.Get( k, k );
-        auto l21 = L( ind2, ind1 );
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, n );
 
-        auto v1 = V( ind1, ALL );
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+        auto V1 = V( ind1, ALL );
         auto V2 = V( ind2, ALL );
 
-        // Find tau and u such that
-        //  | lambda11 u | /I - 1/tau Sigma | 1   | | 1 conj(u) |\ = | -beta 0 |
-        //                 \                | u^T |              /
-        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
-        const F tau = RightHyperbolicReflector( lambda11, v1 );
-
-        // Apply the negative of the hyperbolic Householder reflector from the
-        // right:
-        // |l21 V2| := -|l21 V2| + 1/tau |l21 V2| Sigma |1  | |1 conj(u)|
-        //                                              |u^T|
-        //           = -|l21 V2| + 1/tau |l21 -V2| |1  | |1 conj(u)|
-        //                                         |u^T|
-        //           = -|l21 V2| + 1/tau |l21 - V2 u^T| |1 conj(u)|
-        L.Set( k, k, -lambda11 );
-        z21_MC_STAR.AlignWith( V2 );
-        b21_MC_STAR.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        z21_MC_STAR = l21;
-        v1_STAR_MR = v1;
-        Zeros( b21_MC_STAR, V2.Height(), 1 );
-        LocalGemv( NORMAL, F(-1), V2, v1_STAR_MR, F(0), b21_MC_STAR );
-        El::AllReduce( b21_MC_STAR, V2.RowComm() );
-        z21_MC_STAR += b21_MC_STAR;
-        l21 *= -1;
-        V2 *= -1;
-        Axpy( F(1)/tau, z21_MC_STAR, l21 );
-        LocalGer( F(1)/tau, z21_MC_STAR, v1_STAR_MR, V2 );
+        // The panel is processed redundantly
+        L11_STAR_STAR = L11;
+        V1_STAR_STAR = V1;
+        if( downdate )
+            LowerDowndate
+            ( L11_STAR_STAR.Matrix(), V1_STAR_STAR.Matrix(), betas );
+        else
+            LowerUpdate
+            ( L11_STAR_STAR.Matrix(), V1_STAR_STAR.Matrix(), betas );
+        L11 = L11_STAR_STAR;
+        V1 = V1_STAR_STAR;
+        if( k+nb == n )
+            break;
+
+        // [L21, V2] := [L21, V2] - (L21 +- V2 V1^T) T [I, conj(V1)],
+        // followed by L21 := -L21
+        FormT( V1_STAR_STAR.Matrix(), betas, T, downdate );
+        T_STAR_STAR.LockedAttach( grid, T );
+        V1_STAR_MR.AlignWith( V2 );
+        V1Trans_MR_STAR.AlignWith( V2 );
+        Z21_MC_STAR.AlignWith( V2 );
+        L21_MC_STAR.AlignWith( V2 );
+        V1_STAR_MR = V1_STAR_STAR;
+        Transpose( V1_STAR_MR, V1Trans_MR_STAR );
+        Zeros( Z21_MC_STAR, V2.Height(), nb );
+        LocalGemm
+        ( NORMAL, NORMAL, sign, V2, V1Trans_MR_STAR, F(0), Z21_MC_STAR );
+        El::AllReduce( Z21_MC_STAR, V2.RowComm() );
+        L21_MC_STAR = L21;
+        Z21_MC_STAR += L21_MC_STAR;
+        LocalTrmm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T_STAR_STAR, Z21_MC_STAR );
+        Axpy( F(-1), Z21_MC_STAR, L21 );
+        L21 *= -1;
+        Conjugate( V1_STAR_MR );
+        LocalGemm( NORMAL, NORMAL, F(-1), Z21_MC_STAR, V1_STAR_MR, F(1), V2 );
     }
 }
 
@@ -239,12 +285,12 @@ void LowerMod( Matrix<F>& L, Base<F> alpha, Matrix<F>& V )
     else if( alpha > Real(0) )
     {
         V *= Sqrt(alpha);
-        mod::LowerUpdate( L, V );
+        mod::LowerBlocked( L, V, false );
     }
     else
     {
         V *= Sqrt(-alpha);
-        mod::LowerDowndate( L, V );
+        mod::LowerBlocked( L, V, true );
     }
 }
 
@@ -261,12 +307,12 @@ void LowerMod
     else if( alpha > Real(0) )
     {
         V *= Sqrt(alpha);
-        mod::LowerUpdate( L, V );
+        mod::LowerBlocked( L, V, false );
     }
     else
     {
         V *= Sqrt(-alpha);
-        mod::LowerDowndate( L, V );
+        mod::LowerBlocked( L, V, true );
     }
 }
 
@@ -166,6 +166,53 @@ void ID
     }
 }
 
+namespace id {
+
+template<typename Real>
+QRCtrl<Real> SketchCtrl( const RandomizedCtrl<Real>& ctrl )
+{
+    auto qrCtrl = ctrl.qrCtrl;
+    if( qrCtrl.boundRank )
+        qrCtrl.maxRank = Min( qrCtrl.maxRank, ctrl.rank );
+    else
+        qrCtrl.maxRank = ctrl.rank;
+    qrCtrl.boundRank = true;
+    return qrCtrl;
+}
+
+} // namespace id
+
+template<typename F>
+void RandomizedID
+( const Matrix<F>& A,
+        Permutation& Omega,
+        Matrix<F>& Z,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    // Since A ~= Q Q^H A, an ID of Q^H A = (Q^H A) Omega^T [I, Z] yields
+    // A ~= (A Omega^T)(:,0:k) [I, Z]
+    Matrix<F> Q, Y;
+    RangeFinder( NORMAL, A, Q, ctrl );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, Y );
+    id::BusingerGolub( Y, Omega, Z, id::SketchCtrl(ctrl) );
+}
+
+template<typename F>
+void RandomizedID
+( const AbstractDistMatrix<F>& A,
+        DistPermutation& Omega,
+        AbstractDistMatrix<F>& Z,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<F> Q(g), Y(g);
+    RangeFinder( NORMAL, A, Q, ctrl );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, Y );
+    id::BusingerGolub( Y, Omega, Z, id::SketchCtrl(ctrl) );
+}
+
 #define PROTO(F) \
   template void ID \
   ( const Matrix<F>& A, \
@@ -188,7 +235,17 @@ void ID
     DistPermutation& Omega, \
     AbstractDistMatrix<F>& Z, \
     const QRCtrl<Base<F>>& ctrl, \
-    bool canOverwrite );
+    bool canOverwrite ); \
+  template void RandomizedID \
+  ( const Matrix<F>& A, \
+          Permutation& Omega, \
+          Matrix<F>& Z, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RandomizedID \
+  ( const AbstractDistMatrix<F>& A, \
+          DistPermutation& Omega, \
+          AbstractDistMatrix<F>& Z, \
+    const RandomizedCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -18,6 +18,8 @@
 #include "./Pivoted/Panel.hpp"
 #include "./Pivoted/Blocked.hpp"
 
+#include "./Pivoted/Aasen.hpp"
+
 namespace El {
 namespace ldl {
 
@@ -38,6 +40,9 @@ Pivoted
     case BUNCH_KAUFMAN_D:
         pivot::Blocked( A, dSub, P, conjugate, ctrl.pivotType, ctrl.gamma );
         break;
+    case AASEN:
+        pivot::Aasen( A, dSub, P, conjugate, ctrl.gamma );
+        break;
     default:
         pivot::Unblocked( A, dSub, P, conjugate, ctrl.pivotType, ctrl.gamma );
     }
@@ -60,6 +65,9 @@ Pivoted
     case BUNCH_KAUFMAN_D:
         pivot::Blocked( A, dSub, P, conjugate, ctrl.pivotType, ctrl.gamma );
         break;
+    case AASEN:
+        pivot::Aasen( A, dSub, P, conjugate, ctrl.gamma );
+        break;
     default:
         pivot::Unblocked( A, dSub, P, conjugate, ctrl.pivotType, ctrl.gamma );
     }
@@ -0,0 +1,635 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_PIVOTED_AASEN_HPP
+#define EL_LDL_PIVOTED_AASEN_HPP
+
+// A blocked, left-looking variant of Aasen's algorithm,
+//
+//   J.O. Aasen, "On the reduction of a symmetric matrix to tridiagonal form",
+//   BIT, 11, pp. 233--242, 1971,
+//
+// along the lines of
+//
+//   M. Rozloznik, G. Shklarski, and S. Toledo, "Partitioned triangular
+//   tridiagonalization", ACM Trans. Math. Softw., 37(4), 2011,
+//
+// is used to compute P A P^T = L T L^{T/H}, with L unit lower-triangular (with
+// |L(i,j)| <= 1) and T tridiagonal. Every pivot decision within a panel is made
+// using a redundant copy of the panel, the interchanges are applied to the
+// remainder of the matrix at once at the end of each panel, and the trailing
+// matrix then receives a single rank-(nb+1) update. T is then factored with
+// the tridiagonal pivoting strategy of
+//
+//   J.R. Bunch, "Partial pivoting strategies for symmetric matrices",
+//   SIAM J. Numer. Anal., 11(3), pp. 521--528, 1974,
+//
+// which requires no further interchanges, so that the result is returned in
+// the same form as the Bunch-Kaufman factorizations.
+//
+// During the first phase, T(j,j) and T(j+1,j) are stored in A(j,j) and
+// A(j+1,j), and L(j+2:n,j+1) is stored in A(j+2:n,j). The first column of L
+// is always e_0 and is therefore not stored.
+
+namespace El {
+namespace ldl {
+namespace pivot {
+namespace aasen {
+
+template<typename F>
+F MaybeConj( const F& alpha, bool conjugate )
+{ return conjugate ? Conj(alpha) : alpha; }
+
+// Compute the pivots, tridiagonal entries, and Gauss transforms of the panel
+// [k,k+nb). Rows of W and LPan correspond to indices [k,n) of the permuted
+// matrix; W holds the (full) columns [k,k+nb) of the trailing matrix and the
+// columns of LPan correspond to columns [k-1,k+nb] of L. 'perm' maps the
+// permuted indices back to the ordering at the beginning of the panel, and
+// 'fetch(q,col)' should return column q of the trailing matrix (in the
+// original ordering of the panel).
+template<typename F,class PermType,class FetchType>
+void PanelFactor
+( Int k,
+  Int nb,
+  Matrix<F>& W,
+  Matrix<F>& LPan,
+  vector<Int>& perm,
+  vector<F>& td,
+  vector<F>& te,
+  PermType& P,
+  bool conjugate,
+  const FetchType& fetch )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = td.size();
+    const Int h = n - k;
+
+    perm.resize( h );
+    for( Int i=0; i<h; ++i )
+        perm[i] = k + i;
+
+    // h(m) = T(m,:) L(j,:)^{T/H} for m in [k,j]
+    vector<F> hVec( nb );
+    Matrix<F> v, col;
+    Zeros( v, h, 1 );
+    for( Int j=k; j<k+nb; ++j )
+    {
+        const Int jPan = j - k;
+
+        // The contributions of T(k-1,k) are not contained in h(k)
+        const F gamma =
+          ( k > 0 ? MaybeConj(te[k-1],conjugate)*
+                    MaybeConj(LPan(jPan,1),conjugate) : F(0) );
+        for( Int m=k; m<j; ++m )
+        {
+            const Int mPan = m - k;
+            F eta = td[m]*MaybeConj(LPan(jPan,mPan+1),conjugate) +
+                    MaybeConj(te[m],conjugate)*
+                    MaybeConj(LPan(jPan,mPan+2),conjugate);
+            if( m > 0 )
+                eta += te[m-1]*MaybeConj(LPan(jPan,mPan),conjugate);
+            hVec[mPan] = eta;
+        }
+
+        // H(j,j) = A(j,j) - L(j,0:j) h(0:j)
+        F eta_jj = W(jPan,jPan) - LPan(jPan,0)*gamma;
+        for( Int m=k; m<j; ++m )
+            eta_jj -= LPan(jPan,m-k+1)*hVec[m-k];
+        td[j] = eta_jj;
+        if( j > 0 )
+            td[j] -= te[j-1]*MaybeConj(LPan(jPan,jPan),conjugate);
+        if( conjugate )
+            td[j] = RealPart(td[j]);
+        hVec[jPan] = eta_jj;
+        if( j == n-1 )
+            break;
+
+        // v := A(j+1:n,j) - L(j+1:n,0:j+1) h(0:j+1)
+        Int iPiv = jPan+1;
+        Real vMax = -1;
+        for( Int iPan=jPan+1; iPan<h; ++iPan )
+        {
+            F nu = W(iPan,jPan) - LPan(iPan,0)*gamma;
+            for( Int m=k; m<=j; ++m )
+                nu -= LPan(iPan,m-k+1)*hVec[m-k];
+            v(iPan) = nu;
+            const Real nuAbs = Abs(nu);
+            if( nuAbs > vMax )
+            {
+                iPiv = iPan;
+                vMax = nuAbs;
+            }
+        }
+
+        // Interchange j+1 with the entry of maximum magnitude
+        if( iPiv != jPan+1 )
+        {
+            const Int from = jPan+1;
+            RowSwap( LPan, from, iPiv );
+            RowSwap( W, from, iPiv );
+            std::swap( v(from), v(iPiv) );
+            std::swap( perm[from], perm[iPiv] );
+            P.Swap( k+from, k+iPiv );
+            if( from < nb )
+            {
+                // Column j+1 of W is still needed
+                if( iPiv < nb )
+                {
+                    ColSwap( W, from, iPiv );
+                }
+                else
+                {
+                    fetch( perm[from], col );
+                    for( Int iPan=0; iPan<h; ++iPan )
+                        W(iPan,from) = col(perm[iPan]-k);
+                }
+            }
+        }
+
+        // Store T(j+1,j) and form L(j+2:n,j+1)
+        const F pivot = v(jPan+1);
+        te[j] = pivot;
+        LPan(jPan+1,jPan+2) = 1;
+        for( Int iPan=jPan+2; iPan<h; ++iPan )
+            LPan(iPan,jPan+2) = ( pivot == F(0) ? F(0) : v(iPan)/pivot );
+    }
+}
+
+// Form the (nb+1) x (nb+1) portion of T over indices [k-1,k+nb), but without
+// the T(k-1,k-1) entry, which was already incorporated into the trailing
+// matrix by the previous update
+template<typename F>
+void FormTPan
+( Int k,
+  Int nb,
+  const vector<F>& td,
+  const vector<F>& te,
+        Matrix<F>& TPan,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    Zeros( TPan, nb+1, nb+1 );
+    for( Int a=0; a<=nb; ++a )
+    {
+        const Int m = k-1+a;
+        if( m < 0 )
+            continue;
+        if( a > 0 )
+            TPan(a,a) = td[m];
+        if( a < nb )
+        {
+            TPan(a+1,a) = te[m];
+            TPan(a,a+1) = MaybeConj(te[m],conjugate);
+        }
+    }
+}
+
+// Factor the tridiagonal T as Lt D Lt^{T/H}, where Lt is unit lower-triangular
+// with (at most) two subdiagonals and D is block-diagonal with 1x1 and 2x2
+// blocks. l1 and l2 contain the first and second subdiagonals of Lt.
+template<typename F>
+void TridiagonalBunch
+( const vector<F>& td,
+  const vector<F>& te,
+        vector<F>& d,
+        vector<F>& dSub,
+        vector<F>& l1,
+        vector<F>& l2,
+  bool conjugate,
+  Base<F> gamma )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = td.size();
+    Real sigma = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        sigma = Max( sigma, Abs(td[i]) );
+        if( i < n-1 )
+            sigma = Max( sigma, Abs(te[i]) );
+    }
+
+    vector<F> t( td );
+    d.assign( n, F(0) );
+    dSub.assign( Max(n-1,Int(0)), F(0) );
+    l1.assign( n, F(0) );
+    l2.assign( n, F(0) );
+    Int k=0;
+    while( k < n )
+    {
+        const Real eAbs = ( k < n-1 ? Abs(te[k]) : Real(0) );
+        if( k == n-1 || sigma*Abs(t[k]) >= gamma*eAbs*eAbs )
+        {
+            d[k] = t[k];
+            if( k < n-1 )
+            {
+                l1[k] = ( t[k] == F(0) ? F(0) : te[k]/t[k] );
+                t[k+1] -= l1[k]*MaybeConj(te[k],conjugate);
+                if( conjugate )
+                    t[k+1] = RealPart(t[k+1]);
+            }
+            k += 1;
+        }
+        else
+        {
+            const F alpha = t[k];
+            const F beta = te[k];
+            const F delta = t[k+1];
+            const F det = alpha*delta - beta*MaybeConj(beta,conjugate);
+            d[k] = alpha;
+            d[k+1] = delta;
+            dSub[k] = beta;
+            if( k+2 < n )
+            {
+                const F eta = te[k+1];
+                l2[k] = -eta*beta/det;
+                l1[k+1] = eta*alpha/det;
+                t[k+2] -= l1[k+1]*MaybeConj(eta,conjugate);
+                if( conjugate )
+                    t[k+2] = RealPart(t[k+2]);
+            }
+            k += 2;
+        }
+    }
+}
+
+// Overwrite row i of the Aasen storage of L with row i of L Lt and place
+// d(i) on the diagonal. 'row' should point to A(i,0) with stride 'stride'.
+template<typename F>
+void TransformRow
+( Int i,
+  F* row,
+  Int stride,
+  const vector<F>& d,
+  const vector<F>& l1,
+  const vector<F>& l2,
+  vector<F>& rowCopy )
+{
+    rowCopy.resize( i+1 );
+    for( Int c=0; c<i; ++c )
+        rowCopy[c] = row[c*stride];
+    // L(i,m) = 1 if m == i, L(i,0) = 0 if i > 0, and A(i,m-1) otherwise
+    auto L = [&]( Int m )
+      { return m == i ? F(1) : ( m > i || m == 0 ? F(0) : rowCopy[m-1] ); };
+    for( Int c=0; c<i; ++c )
+        row[c*stride] = L(c) + L(c+1)*l1[c] + L(c+2)*l2[c];
+    row[i*stride] = d[i];
+}
+
+} // namespace aasen
+
+template<typename F>
+void
+Aasen
+( Matrix<F>& A,
+  Matrix<F>& dSub,
+  Permutation& P,
+  bool conjugate=false,
+  Base<F> gamma=0 )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( gamma == Real(0) )
+        gamma = LDLPivotConstant<Real>( AASEN );
+    const Orientation orient = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+    if( n == 0 )
+    {
+        dSub.Resize( 0, 1 );
+        return;
+    }
+
+    vector<F> td(n), te(n);
+    vector<Int> perm, slot;
+    Matrix<F> W, LPan, TPan, Z, R;
+    const Int bsize = Blocksize();
+    Int k=0;
+    while( k < n )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int h = n-k;
+        const Range<Int> indB( k, n ), ind1( k, k+nb ), ind2( k+nb, n );
+
+        // Form the (full) panel columns and the previous two columns of L
+        W = A( indB, ind1 );
+        auto WT = W( IR(0,nb), ALL );
+        MakeSymmetric( LOWER, WT, conjugate );
+        Zeros( LPan, h, nb+2 );
+        LPan(0,1) = 1;
+        for( Int i=0; i<h; ++i )
+        {
+            if( k >= 2 )
+                LPan(i,0) = A(k+i,k-2);
+            if( k >= 1 && i >= 1 )
+                LPan(i,1) = A(k+i,k-1);
+        }
+
+        auto fetch =
+          [&]( Int q, Matrix<F>& col )
+          {
+              col.Resize( h, 1 );
+              for( Int i=k; i<q; ++i )
+                  col(i-k) = aasen::MaybeConj( A(q,i), conjugate );
+              for( Int i=q; i<n; ++i )
+                  col(i-k) = A(i,q);
+          };
+        aasen::PanelFactor
+        ( k, nb, W, LPan, perm, td, te, P, conjugate, fetch );
+
+        // Apply the interchanges to the rest of the matrix
+        slot.assign( h, -1 );
+        Int numSwapped = 0;
+        for( Int iPan=1; iPan<h; ++iPan )
+            if( perm[iPan] != k+iPan )
+                slot[iPan] = numSwapped++;
+        if( numSwapped > 0 )
+        {
+            // Gather the (full) rows of the affected indices
+            Zeros( R, numSwapped, n );
+            for( Int iPan=1; iPan<h; ++iPan )
+            {
+                if( slot[iPan] < 0 )
+                    continue;
+                const Int s = k+iPan;
+                for( Int j=0; j<=s; ++j )
+                    R(slot[iPan],j) = A(s,j);
+                for( Int i=s+1; i<n; ++i )
+                    R(slot[iPan],i) = aasen::MaybeConj( A(i,s), conjugate );
+            }
+            for( Int iPan=1; iPan<h; ++iPan )
+            {
+                if( slot[iPan] < 0 )
+                    continue;
+                const Int s = k+iPan;
+                const Int r = slot[perm[iPan]-k];
+                for( Int j=0; j<k; ++j )
+                    A(s,j) = R(r,j);
+                for( Int j=k+1; j<=s; ++j )
+                    A(s,j) = R(r,perm[j-k]);
+                for( Int i=s+1; i<n; ++i )
+                    A(i,s) = aasen::MaybeConj( R(r,perm[i-k]), conjugate );
+            }
+        }
+
+        // A22 := A22 - L21 T L21^{T/H}
+        if( k+nb < n )
+        {
+            aasen::FormTPan( k, nb, td, te, TPan, conjugate );
+            auto G = LPan( IR(nb,h), IR(0,nb+1) );
+            Gemm( NORMAL, NORMAL, F(1), G, TPan, Z );
+            auto A22 = A( ind2, ind2 );
+            Trrk( LOWER, NORMAL, orient, F(-1), Z, G, F(1), A22 );
+        }
+
+        // Store T and L for the panel
+        for( Int j=k; j<k+nb; ++j )
+        {
+            A(j,j) = td[j];
+            if( j+1 < n )
+                A(j+1,j) = te[j];
+            for( Int i=j+2; i<n; ++i )
+                A(i,j) = LPan(i-k,j-k+2);
+        }
+
+        k += nb;
+    }
+
+    // Factor T and form L := L Lt
+    vector<F> d, dSubVec, l1, l2, rowCopy;
+    aasen::TridiagonalBunch( td, te, d, dSubVec, l1, l2, conjugate, gamma );
+    for( Int i=0; i<n; ++i )
+        aasen::TransformRow
+        ( i, A.Buffer(i,0), A.LDim(), d, l1, l2, rowCopy );
+    dSub.Resize( n-1, 1 );
+    for( Int i=0; i<n-1; ++i )
+        dSub(i) = dSubVec[i];
+}
+
+template<typename F>
+void
+Aasen
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& dSubPre,
+  DistPermutation& P,
+  bool conjugate=false,
+  Base<F> gamma=0 )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, dSubPre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+    )
+    typedef Base<F> Real;
+    const Int n = APre.Height();
+    if( gamma == Real(0) )
+        gamma = LDLPivotConstant<Real>( AASEN );
+    const Orientation orient = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+    if( n == 0 )
+    {
+        dSubPre.Resize( 0, 1 );
+        return;
+    }
+    dSubPre.Resize( n-1, 1 );
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MC,STAR> dSubProx( dSubPre );
+    auto& A = AProx.Get();
+    auto& dSub = dSubProx.Get();
+
+    const Grid& g = A.Grid();
+    const Int localHeight = A.LocalHeight();
+    vector<F> td(n), te(n);
+    vector<Int> perm, slot;
+    Matrix<F> LPan, TPan, Z, R;
+    DistMatrix<F,STAR,STAR> W_STAR_STAR(g), L_STAR_STAR(g),
+      aRow_STAR_STAR(g), aCol_STAR_STAR(g),
+      Z_STAR_STAR(g), G_STAR_STAR(g);
+    DistMatrix<F,MC,STAR> Z_MC_STAR(g);
+    DistMatrix<F,MR,STAR> G_MR_STAR(g);
+    const Int bsize = Blocksize();
+    Int k=0;
+    while( k < n )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int h = n-k;
+        const Range<Int> indB( k, n ), ind1( k, k+nb ), ind2( k+nb, n );
+
+        // Form redundant copies of the (full) panel columns and the previous
+        // two columns of L
+        W_STAR_STAR = A( indB, ind1 );
+        auto& W = W_STAR_STAR.Matrix();
+        auto WT = W( IR(0,nb), ALL );
+        MakeSymmetric( LOWER, WT, conjugate );
+        Zeros( LPan, h, nb+2 );
+        LPan(0,1) = 1;
+        if( k >= 1 )
+        {
+            L_STAR_STAR = A( indB, IR(Max(k-2,Int(0)),k) );
+            const auto& LLoc = L_STAR_STAR.LockedMatrix();
+            for( Int i=1; i<h; ++i )
+                LPan(i,1) = LLoc(i,LLoc.Width()-1);
+            if( k >= 2 )
+                for( Int i=0; i<h; ++i )
+                    LPan(i,0) = LLoc(i,0);
+        }
+
+        auto fetch =
+          [&]( Int q, Matrix<F>& col )
+          {
+              aRow_STAR_STAR = A( IR(q), IR(k,q) );
+              aCol_STAR_STAR = A( IR(q,n), IR(q) );
+              const auto& aRow = aRow_STAR_STAR.LockedMatrix();
+              const auto& aCol = aCol_STAR_STAR.LockedMatrix();
+              col.Resize( h, 1 );
+              for( Int i=k; i<q; ++i )
+                  col(i-k) = aasen::MaybeConj( aRow(0,i-k), conjugate );
+              for( Int i=q; i<n; ++i )
+                  col(i-k) = aCol(i-q,0);
+          };
+        aasen::PanelFactor
+        ( k, nb, W, LPan, perm, td, te, P, conjugate, fetch );
+
+        // Apply the interchanges to the rest of the matrix
+        slot.assign( h, -1 );
+        Int numSwapped = 0;
+        for( Int iPan=1; iPan<h; ++iPan )
+            if( perm[iPan] != k+iPan )
+                slot[iPan] = numSwapped++;
+        if( numSwapped > 0 )
+        {
+            // Gather the (full) rows of the affected indices with a single
+            // summation over the grid
+            Zeros( R, numSwapped, n );
+            for( Int iPan=1; iPan<h; ++iPan )
+            {
+                if( slot[iPan] < 0 )
+                    continue;
+                const Int s = k+iPan;
+                if( A.IsLocalRow(s) )
+                {
+                    const Int sLoc = A.LocalRow(s);
+                    const Int jLocEnd = A.LocalColOffset(s+1);
+                    for( Int jLoc=0; jLoc<jLocEnd; ++jLoc )
+                        R(slot[iPan],A.GlobalCol(jLoc)) =
+                          A.GetLocal(sLoc,jLoc);
+                }
+                if( A.IsLocalCol(s) )
+                {
+                    const Int sLoc = A.LocalCol(s);
+                    for( Int iLoc=A.LocalRowOffset(s+1);
+                         iLoc<localHeight; ++iLoc )
+                        R(slot[iPan],A.GlobalRow(iLoc)) =
+                          aasen::MaybeConj( A.GetLocal(iLoc,sLoc), conjugate );
+                }
+            }
+            mpi::AllReduce( R.Buffer(), numSwapped*n, g.Comm() );
+
+            for( Int iPan=1; iPan<h; ++iPan )
+            {
+                if( slot[iPan] < 0 )
+                    continue;
+                const Int s = k+iPan;
+                const Int r = slot[perm[iPan]-k];
+                if( A.IsLocalRow(s) )
+                {
+                    const Int sLoc = A.LocalRow(s);
+                    const Int jLocEnd = A.LocalColOffset(s+1);
+                    for( Int jLoc=0; jLoc<jLocEnd; ++jLoc )
+                    {
+                        const Int j = A.GlobalCol(jLoc);
+                        if( j < k )
+                            A.SetLocal( sLoc, jLoc, R(r,j) );
+                        else if( j > k )
+                            A.SetLocal( sLoc, jLoc, R(r,perm[j-k]) );
+                    }
+                }
+                if( A.IsLocalCol(s) )
+                {
+                    const Int sLoc = A.LocalCol(s);
+                    for( Int iLoc=A.LocalRowOffset(s+1);
+                         iLoc<localHeight; ++iLoc )
+                    {
+                        const Int i = A.GlobalRow(iLoc);
+                        A.SetLocal
+                        ( iLoc, sLoc,
+                          aasen::MaybeConj( R(r,perm[i-k]), conjugate ) );
+                    }
+                }
+            }
+        }
+
+        // A22 := A22 - L21 T L21^{T/H}
+        // Both factors are available redundantly, so no communication is
+        // required beyond the local filtering into [MC,* ] and [MR,* ]
+        if( k+nb < n )
+        {
+            aasen::FormTPan( k, nb, td, te, TPan, conjugate );
+            auto G = LPan( IR(nb,h), IR(0,nb+1) );
+            Gemm( NORMAL, NORMAL, F(1), G, TPan, Z );
+            auto A22 = A( ind2, ind2 );
+            Z_STAR_STAR.LockedAttach( g, Z );
+            G_STAR_STAR.LockedAttach( g, G );
+            Z_MC_STAR.AlignWith( A22 );
+            G_MR_STAR.AlignWith( A22 );
+            Z_MC_STAR = Z_STAR_STAR;
+            G_MR_STAR = G_STAR_STAR;
+            LocalTrrk( LOWER, orient, F(-1), Z_MC_STAR, G_MR_STAR, F(1), A22 );
+        }
+
+        // Store T and L for the panel
+        for( Int jLoc=A.LocalColOffset(k); jLoc<A.LocalColOffset(k+nb);
+             ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=A.LocalRowOffset(j); iLoc<localHeight; ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                if( i == j )
+                    A.SetLocal( iLoc, jLoc, td[j] );
+                else if( i == j+1 )
+                    A.SetLocal( iLoc, jLoc, te[j] );
+                else
+                    A.SetLocal( iLoc, jLoc, LPan(i-k,j-k+2) );
+            }
+        }
+
+        k += nb;
+    }
+
+    // Factor T and form L := L Lt using complete rows of L
+    vector<F> d, dSubVec, l1, l2, rowCopy;
+    aasen::TridiagonalBunch( td, te, d, dSubVec, l1, l2, conjugate, gamma );
+    DistMatrix<F,VC,STAR> A_VC_STAR( A );
+    auto& ALoc = A_VC_STAR.Matrix();
+    for( Int iLoc=0; iLoc<A_VC_STAR.LocalHeight(); ++iLoc )
+        aasen::TransformRow
+        ( A_VC_STAR.GlobalRow(iLoc), ALoc.Buffer(iLoc,0), ALoc.LDim(),
+          d, l1, l2, rowCopy );
+    A = A_VC_STAR;
+
+    for( Int iLoc=0; iLoc<dSub.LocalHeight(); ++iLoc )
+        dSub.SetLocal( iLoc, 0, dSubVec[dSub.GlobalRow(iLoc)] );
+}
+
+} // namespace pivot
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_PIVOTED_AASEN_HPP
@@ -0,0 +1,326 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_BLR_HPP
+#define EL_LDL_BLR_HPP
+
+namespace El {
+namespace ldl {
+namespace blr {
+
+// Return an empty workspace over the same grid as the given matrix
+template<typename F>
+Matrix<F> Workspace( const Matrix<F>& A )
+{ return Matrix<F>(); }
+
+template<typename F>
+DistMatrix<F> Workspace( const DistMatrix<F>& A )
+{ return DistMatrix<F>( A.Grid() ); }
+
+// The factor of a tile which multiplies from the right: 'V' for low-rank tiles
+// and the tile itself for dense tiles
+template<typename MatType>
+const MatType& RightFactor( const BLRTile<MatType>& tile )
+{ return tile.lowRank ? tile.V : tile.U; }
+
+template<typename MatType>
+bool ZeroTile( const BLRTile<MatType>& tile )
+{ return tile.lowRank && tile.U.Width() == 0; }
+
+// The largest rank for which storing a tile as U V is cheaper than storing it
+// densely
+inline Int BreakEvenRank( Int m, Int n )
+{ return ( m*n > 0 ? (m*n-1)/(m+n) : 0 ); }
+
+template<typename Real>
+QRCtrl<Real> TileQRCtrl( Int maxRank, const BLRCtrl<Real>& ctrl )
+{
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.boundRank = true;
+    qrCtrl.maxRank = maxRank;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = ctrl.tol;
+    return qrCtrl;
+}
+
+// Store the tile as A ~= A(:,p(0:r)) [I, Z] p^T using an Interpolative
+// Decomposition unless its rank exceeds the break-even point
+template<typename F>
+void CompressTile
+( const Matrix<F>& A,
+        BLRTile<Matrix<F>>& tile,
+  const BLRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int maxRank = BreakEvenRank( m, n ) + 1;
+    const auto qrCtrl = TileQRCtrl( maxRank, ctrl );
+
+    Permutation Omega;
+    Matrix<F> Z;
+    if( ctrl.randomized )
+    {
+        RandomizedCtrl<Base<F>> randCtrl;
+        randCtrl.rank = maxRank;
+        randCtrl.qrCtrl = qrCtrl;
+        RandomizedID( A, Omega, Z, randCtrl );
+    }
+    else
+        ID( A, Omega, Z, qrCtrl );
+
+    const Int rank = Z.Height();
+    tile.lowRank = ( rank < maxRank );
+    if( !tile.lowRank )
+    {
+        tile.U = A;
+        tile.V.Empty();
+        return;
+    }
+
+    Matrix<F> APerm( A );
+    Omega.PermuteCols( APerm );
+    tile.U = APerm( ALL, IR(0,rank) );
+
+    Zeros( tile.V, rank, n );
+    auto VL = tile.V( ALL, IR(0,rank) );
+    auto VR = tile.V( ALL, IR(rank,n) );
+    FillDiagonal( VL, F(1) );
+    VR = Z;
+    Omega.InversePermuteCols( tile.V );
+}
+
+template<typename F>
+void CompressTile
+( const DistMatrix<F>& A,
+        BLRTile<DistMatrix<F>>& tile,
+  const BLRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int maxRank = BreakEvenRank( m, n ) + 1;
+    const auto qrCtrl = TileQRCtrl( maxRank, ctrl );
+
+    DistPermutation Omega(g);
+    DistMatrix<F> Z(g);
+    if( ctrl.randomized )
+    {
+        RandomizedCtrl<Base<F>> randCtrl;
+        randCtrl.rank = maxRank;
+        randCtrl.qrCtrl = qrCtrl;
+        RandomizedID( A, Omega, Z, randCtrl );
+    }
+    else
+        ID( A, Omega, Z, qrCtrl );
+
+    const Int rank = Z.Height();
+    tile.lowRank = ( rank < maxRank );
+    tile.U.SetGrid( g );
+    tile.V.SetGrid( g );
+    if( !tile.lowRank )
+    {
+        tile.U = A;
+        return;
+    }
+
+    DistMatrix<F> APerm( A );
+    Omega.PermuteCols( APerm );
+    tile.U = APerm( ALL, IR(0,rank) );
+
+    Zeros( tile.V, rank, n );
+    auto VL = tile.V( ALL, IR(0,rank) );
+    auto VR = tile.V( ALL, IR(rank,n) );
+    FillDiagonal( VL, F(1) );
+    VR = Z;
+    Omega.InversePermuteCols( tile.V );
+}
+
+template<typename F,class MatType>
+void Compress
+( const MatType& A,
+        BLRMatrix<MatType>& L,
+  const BLRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.tileSize <= 0 )
+        LogicError("The BLR tile size must be positive");
+    L.height = A.Height();
+    L.width = A.Width();
+    L.tileSize = ctrl.tileSize;
+    const Int numRowTiles = L.NumRowTiles();
+    const Int numColTiles = L.NumColTiles();
+    L.tiles.clear();
+    L.tiles.resize( numRowTiles*numColTiles );
+    for( Int j=0; j<numColTiles; ++j )
+    {
+        const Range<Int> indj( j*L.tileSize, Min((j+1)*L.tileSize,L.width) );
+        for( Int i=0; i<numRowTiles; ++i )
+        {
+            const Range<Int>
+              indi( i*L.tileSize, Min((i+1)*L.tileSize,L.height) );
+            auto Aij = A( indi, indj );
+            CompressTile( Aij, L.Tile(i,j), ctrl );
+        }
+    }
+}
+
+// ABR := ABR - L D op(L), where op(L) is either L^T or L^H.
+//
+// Each tile product L(i,k) D(k) op(L(j,k)) is formed from the low-rank
+// factors, e.g., as U(i,k) (V(i,k) D(k) op(V(j,k))) op(U(j,k)), so that only
+// the final (rank-limited) update of each tile of ABR has a cost proportional
+// to the square of the tile size. Only the lower triangle of ABR is
+// meaningful afterwards.
+template<typename F,class MatType,class DiagType>
+void SchurUpdate
+( const BLRMatrix<MatType>& L,
+  const DiagType& d,
+        MatType& ABR,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    const Int b = L.tileSize;
+    const Int numRowTiles = L.NumRowTiles();
+    const Int numColTiles = L.NumColTiles();
+
+    auto T = Workspace( ABR );
+    auto UT = Workspace( ABR );
+    vector<MatType> S( numRowTiles, Workspace(ABR) );
+    for( Int k=0; k<numColTiles; ++k )
+    {
+        const Range<Int> indk( k*b, Min((k+1)*b,L.width) );
+        auto dk = d( indk, ALL );
+
+        // Scale the right factors of the k'th column of tiles by D(k)
+        for( Int i=0; i<numRowTiles; ++i )
+        {
+            const auto& tile = L.Tile(i,k);
+            if( ZeroTile(tile) )
+                continue;
+            S[i] = RightFactor( tile );
+            DiagonalScale( RIGHT, NORMAL, dk, S[i] );
+        }
+
+        for( Int j=0; j<numRowTiles; ++j )
+        {
+            const auto& tileJ = L.Tile(j,k);
+            if( ZeroTile(tileJ) )
+                continue;
+            const Range<Int> indj( j*b, Min((j+1)*b,L.height) );
+            for( Int i=j; i<numRowTiles; ++i )
+            {
+                const auto& tileI = L.Tile(i,k);
+                if( ZeroTile(tileI) )
+                    continue;
+                const Range<Int> indi( i*b, Min((i+1)*b,L.height) );
+                auto ABRij = ABR( indi, indj );
+
+                Gemm( NORMAL, orientation, F(1), S[i], RightFactor(tileJ), T );
+                const MatType* left = &T;
+                if( tileI.lowRank )
+                {
+                    Gemm( NORMAL, NORMAL, F(1), tileI.U, T, UT );
+                    left = &UT;
+                }
+                if( tileJ.lowRank )
+                    Gemm
+                    ( NORMAL, orientation, F(-1), *left, tileJ.U, F(1), ABRij );
+                else
+                    Axpy( F(-1), *left, ABRij );
+            }
+        }
+    }
+}
+
+// Y := Y + alpha op(L) X, where op(L) is either L, L^T, or L^H
+template<typename F,class MatType,class XType,class YType>
+void Multiply
+( Orientation orientation,
+  F alpha,
+  const BLRMatrix<MatType>& L,
+  const XType& X,
+        YType& Y )
+{
+    EL_DEBUG_CSE
+    if( L.tiles.empty() )
+        return;
+    const Int b = L.tileSize;
+    const Int numRowTiles = L.NumRowTiles();
+    const Int numColTiles = L.NumColTiles();
+
+    auto T = Workspace( L.tiles[0].U );
+    for( Int k=0; k<numColTiles; ++k )
+    {
+        const Range<Int> indk( k*b, Min((k+1)*b,L.width) );
+        for( Int i=0; i<numRowTiles; ++i )
+        {
+            const auto& tile = L.Tile(i,k);
+            if( ZeroTile(tile) )
+                continue;
+            const Range<Int> indi( i*b, Min((i+1)*b,L.height) );
+            if( orientation == NORMAL )
+            {
+                auto Xk = X( indk, ALL );
+                auto Yi = Y( indi, ALL );
+                if( tile.lowRank )
+                {
+                    Gemm( NORMAL, NORMAL, F(1), tile.V, Xk, T );
+                    Gemm( NORMAL, NORMAL, alpha, tile.U, T, F(1), Yi );
+                }
+                else
+                    Gemm( NORMAL, NORMAL, alpha, tile.U, Xk, F(1), Yi );
+            }
+            else
+            {
+                // op(U V) = op(V) op(U)
+                auto Xi = X( indi, ALL );
+                auto Yk = Y( indk, ALL );
+                if( tile.lowRank )
+                {
+                    Gemm( orientation, NORMAL, F(1), tile.U, Xi, T );
+                    Gemm( orientation, NORMAL, alpha, tile.V, T, F(1), Yk );
+                }
+                else
+                    Gemm( orientation, NORMAL, alpha, tile.U, Xi, F(1), Yk );
+            }
+        }
+    }
+}
+
+template<typename MatType>
+Int NumLocalEntries( const BLRMatrix<MatType>& L )
+{
+    Int numEntries = 0;
+    for( const auto& tile : L.tiles )
+    {
+        numEntries += tile.U.LocalHeight()*tile.U.LocalWidth();
+        numEntries += tile.V.LocalHeight()*tile.V.LocalWidth();
+    }
+    return numEntries;
+}
+
+template<typename F>
+Int NumLocalEntries( const BLRMatrix<Matrix<F>>& L )
+{
+    Int numEntries = 0;
+    for( const auto& tile : L.tiles )
+    {
+        numEntries += tile.U.Height()*tile.U.Width();
+        numEntries += tile.V.Height()*tile.V.Width();
+    }
+    return numEntries;
+}
+
+} // namespace blr
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_BLR_HPP
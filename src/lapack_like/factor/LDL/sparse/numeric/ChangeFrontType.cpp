@@ -37,7 +37,15 @@ void ChangeFrontType( Front<F>& front, LDLFrontType type, bool recurse )
 {
     EL_DEBUG_CSE
 
-    if( type == SYMM_1D || type == SYMM_2D ||
+    if( front.type == LDL_BLR_2D || type == LDL_BLR_2D )
+    {
+        // BLR fronts can only be discarded in favor of an unfactored front
+        if( type == SYMM_2D )
+            front.LBLR.Empty();
+        else if( type != front.type )
+            LogicError("Unavailable front type change");
+    }
+    else if( type == SYMM_1D || type == SYMM_2D ||
         type == ConvertTo1D(front.type) || type == ConvertTo2D(front.type) )
     {
         // No-op
@@ -56,7 +64,15 @@ void ChangeFrontType( DistFront<F>& front, LDLFrontType type, bool recurse )
 {
     EL_DEBUG_CSE
 
-    if( type == SYMM_1D || type == ConvertTo1D(front.type) )
+    if( front.type == LDL_BLR_2D || type == LDL_BLR_2D )
+    {
+        // BLR fronts can only be discarded in favor of an unfactored front
+        if( type == SYMM_2D )
+            front.LBLR.Empty();
+        else if( type != front.type )
+            LogicError("Unavailable front type change");
+    }
+    else if( type == SYMM_1D || type == ConvertTo1D(front.type) )
     {
         if( !FrontIs1D(front.type) )
         {
@@ -23,6 +23,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./BLR.hpp"
 
 namespace El {
 namespace ldl {
@@ -224,6 +225,7 @@ void UnpackEntries
     const Int size = node.size;
     const Int off = node.off;
     const Int lowerSize = node.lowerStruct.size();
+    front.LBLR.Empty();
     front.L2D.SetGrid( grid );
     Zeros( front.L2D, size+lowerSize, size );
 
@@ -849,6 +851,8 @@ void DistFront<Field>::Unpack
   const DistNodeInfo& rootInfo ) const
 {
     EL_DEBUG_CSE
+    if( type == LDL_BLR_2D )
+        LogicError("Cannot unpack BLR fronts");
     A.SetGrid( rootInfo.Grid() );
     const Int n = rootInfo.off + rootInfo.size;
     Zeros( A, n, n );
@@ -1063,6 +1067,7 @@ DistFront<Field>::operator=( const DistFront<Field>& front )
         *child = *front.child;
         L1D = front.L1D;
         L2D = front.L2D;
+        LBLR = front.LBLR;
         diag = front.diag;
         subdiag = front.subdiag;
         p = front.p;
@@ -1089,6 +1094,7 @@ Int DistFront<Field>::NumLocalEntries() const
         // Add in L
         numEntries += front.L1D.LocalHeight() * front.L1D.LocalWidth();
         numEntries += front.L2D.LocalHeight() * front.L2D.LocalWidth();
+        numEntries += blr::NumLocalEntries( front.LBLR );
 
         // Add in the workspace
         numEntries += front.work.LocalHeight() * front.work.LocalWidth();
@@ -1157,6 +1163,7 @@ Int DistFront<Field>::NumBottomLeftLocalEntries() const
             const Int n = front.L2D.Width();
             auto FBL = front.L2D( IR(n,m), IR(0,n) );
             numEntries += FBL.LocalHeight() * FBL.LocalWidth();
+            numEntries += blr::NumLocalEntries( front.LBLR );
         }
       };
     count( *this );
@@ -1237,6 +1244,58 @@ double DistFront<Field>::LocalSolveGFlops( Int numRHS ) const
     return gflops;
 }
 
+template<typename Field>
+InertiaType DistFront<Field>::LocalInertia() const
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( Unfactored(type) )
+        LogicError("Front must be factored before computing the inertia");
+    if( BlockFactorization(type) )
+        LogicError("Inertia is not available for block LDL factorizations");
+
+    InertiaType inertia;
+    inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
+    function<void(const DistFront<Field>&)> count =
+      [&]( const DistFront<Field>& front )
+      {
+        if( front.duplicate != nullptr )
+        {
+            const InertiaType dupInertia = front.duplicate->Inertia();
+            inertia.numPositive += dupInertia.numPositive;
+            inertia.numNegative += dupInertia.numNegative;
+            inertia.numZero += dupInertia.numZero;
+            return;
+        }
+        count( *front.child );
+
+        // The (quasi-)diagonal of a separator is small relative to its front,
+        // so we replicate it within the front's team and let the team root
+        // contribute the count
+        const Grid& grid = front.diag.Grid();
+        const Int n = front.diag.Height();
+        DistMatrix<Field,STAR,STAR> diag(grid), subdiag(grid);
+        diag = front.diag;
+        if( PivotedFactorization(front.type) )
+            subdiag = front.subdiag;
+        else
+            Zeros( subdiag, Max(n-1,Int(0)), 1 );
+        if( grid.Rank() == 0 )
+        {
+            Matrix<Real> d( n, 1 );
+            for( Int i=0; i<n; ++i )
+                d(i) = RealPart(diag.GetLocal(i,0));
+            const InertiaType frontInertia =
+              ldl::Inertia( d, subdiag.LockedMatrix() );
+            inertia.numPositive += frontInertia.numPositive;
+            inertia.numNegative += frontInertia.numNegative;
+            inertia.numZero += frontInertia.numZero;
+        }
+      };
+    count( *this );
+    return inertia;
+}
+
 template<typename Field>
 void DistFront<Field>::ComputeRecvInds( const DistNodeInfo& info ) const
 {
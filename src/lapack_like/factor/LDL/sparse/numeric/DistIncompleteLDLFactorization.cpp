@@ -0,0 +1,124 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+DistIncompleteLDLFactorization<Field>::DistIncompleteLDLFactorization()
+{ }
+
+template<typename Field>
+void DistIncompleteLDLFactorization<Field>::FormLocalBlock
+( const DistSparseMatrix<Field>& A, SparseMatrix<Field>& ALoc ) const
+{
+    EL_DEBUG_CSE
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const Field* valueBuf = A.LockedValueBuffer();
+
+    Int numBlockEntries = 0;
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int jLoc = targetBuf[e] - firstLocalRow;
+        if( jLoc >= 0 && jLoc < localHeight )
+            ++numBlockEntries;
+    }
+
+    Zeros( ALoc, localHeight, localHeight );
+    ALoc.Reserve( numBlockEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int jLoc = targetBuf[e] - firstLocalRow;
+        if( jLoc >= 0 && jLoc < localHeight )
+            ALoc.QueueUpdate
+            ( sourceBuf[e]-firstLocalRow, jLoc, valueBuf[e] );
+    }
+    ALoc.ProcessQueues();
+}
+
+template<typename Field>
+void DistIncompleteLDLFactorization<Field>::Initialize
+( const DistSparseMatrix<Field>& A,
+        bool hermitian,
+  const BisectCtrl& bisectCtrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square matrix");
+    firstLocalRow_ = A.FirstLocalRow();
+    SparseMatrix<Field> ALoc;
+    FormLocalBlock( A, ALoc );
+    localFact_.Initialize( ALoc, hermitian, bisectCtrl );
+    initialized_ = true;
+}
+
+template<typename Field>
+void DistIncompleteLDLFactorization<Field>::ChangeNonzeroValues
+( const DistSparseMatrix<Field>& ANew )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
+    if( ANew.FirstLocalRow() != firstLocalRow_ )
+        LogicError("The new matrix has a different distribution");
+    SparseMatrix<Field> ALoc;
+    FormLocalBlock( ANew, ALoc );
+    localFact_.ChangeNonzeroValues( ALoc );
+}
+
+template<typename Field>
+void DistIncompleteLDLFactorization<Field>::Factor
+( const IncompleteLDLCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Factor()'");
+    localFact_.Factor( ctrl );
+}
+
+template<typename Field>
+void DistIncompleteLDLFactorization<Field>::Solve
+( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !Factored() )
+        LogicError("Must call Factor() before Solve()");
+    if( B.FirstLocalRow() != firstLocalRow_ ||
+        B.LocalHeight() != localFact_.Height() )
+        LogicError("B was not distributed conformally with the matrix");
+    localFact_.Solve( B.Matrix() );
+}
+
+template<typename Field>
+bool DistIncompleteLDLFactorization<Field>::Factored() const
+{ return initialized_ && localFact_.Factored(); }
+
+template<typename Field>
+Int DistIncompleteLDLFactorization<Field>::NumLocalEntries() const
+{ return localFact_.NumEntries(); }
+
+template<typename Field>
+const IncompleteLDLFactorization<Field>&
+DistIncompleteLDLFactorization<Field>::LocalFactorization() const
+{ return localFact_; }
+
+#define PROTO(Field) template class DistIncompleteLDLFactorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
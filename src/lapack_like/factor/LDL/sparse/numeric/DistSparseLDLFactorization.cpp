@@ -43,6 +43,129 @@ void DiagonalScale
   const DistFront<Field>& front,
         DistMatrixNode<Field>& B );
 
+namespace {
+
+// Solve against the nodal right-hand sides while restricting the forward and
+// backward solves within the sequential subtree to the given sets of fronts
+// (when they are non-null)
+template<typename Field,class NodeType>
+void PrunedSolve
+( const DistNodeInfo& info,
+  const DistFront<Field>& front,
+  const ActiveFronts* forwardActive,
+  const ActiveFronts* backwardActive,
+        NodeType& B )
+{
+    EL_DEBUG_CSE
+    LowerForwardSolve( info, front, B, forwardActive );
+    if( !BlockFactorization(front.type) )
+        DiagonalSolve( info, front, B );
+    LowerBackwardSolve( info, front, B, front.isHermitian, backwardActive );
+}
+
+template<typename Field>
+void PrunedSolve
+( const DistNodeInfo& info,
+  const DistFront<Field>& front,
+  const DistMap& invMap,
+  const ActiveFronts* forwardActive,
+  const ActiveFronts* backwardActive,
+        DistMultiVec<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( FrontIs1D(front.type) )
+    {
+        DistMultiVecNode<Field> BNodal( invMap, info, B );
+        PrunedSolve( info, front, forwardActive, backwardActive, BNodal );
+        BNodal.Push( invMap, info, B );
+    }
+    else
+    {
+        DistMatrixNode<Field> BNodal( invMap, info, B );
+        PrunedSolve( info, front, forwardActive, backwardActive, BNodal );
+        BNodal.Push( invMap, info, B );
+    }
+}
+
+// Return the sorted union of the given (original) indices over the team
+vector<Int> GatherIndices( const vector<Int>& inds, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int numLocalInds = inds.size();
+    vector<int> numInds( commSize );
+    mpi::AllGather( &numLocalInds, 1, numInds.data(), 1, comm );
+    vector<int> offs;
+    const int totalInds = Scan( numInds, offs );
+    vector<Int> allInds( totalInds );
+    mpi::AllGather
+    ( inds.data(), numLocalInds,
+      allInds.data(), numInds.data(), offs.data(), comm );
+    std::sort( allInds.begin(), allInds.end() );
+    allInds.erase
+    ( std::unique( allInds.begin(), allInds.end() ), allInds.end() );
+    return allInds;
+}
+
+// Insert the fronts of our sequential subtree which lie on the paths from the
+// given (sorted, original) indices to the root
+void MarkSubtreePaths
+( const DistNodeInfo& info,
+  const DistMap& map,
+  const vector<Int>& origInds,
+        ActiveFronts& active )
+{
+    EL_DEBUG_CSE
+    auto inds = origInds;
+    map.Translate( inds );
+    const DistNodeInfo* node = &info;
+    while( node->child.get() != nullptr )
+        node = node->child.get();
+    MarkActivePaths( *node->duplicate, inds, active );
+}
+
+// Form a dense copy of a sparse right-hand side along with the union of its
+// nonzero rows over the team
+template<typename Field>
+void DensifyRHS
+( const DistSparseMatrix<Field>& B,
+        DistMultiVec<Field>& X,
+        vector<Int>& rows )
+{
+    EL_DEBUG_CSE
+    X.SetGrid( B.Grid() );
+    Zeros( X, B.Height(), B.Width() );
+    const Int numLocalEntries = B.NumLocalEntries();
+    vector<Int> localRows( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        X.QueueUpdate( B.Row(e), B.Col(e), B.Value(e) );
+        localRows[e] = B.Row(e);
+    }
+    X.ProcessQueues();
+    rows = GatherIndices( localRows, B.Grid().Comm() );
+}
+
+// Zero all of the rows of 'X' which are not listed in the sorted 'rows'
+template<typename Field>
+void ZeroUnrequestedRows( const vector<Int>& rows, DistMultiVec<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int firstLocalRow = X.FirstLocalRow();
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    Matrix<Field>& XLoc = X.Matrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        if( !std::binary_search( rows.begin(), rows.end(), i ) )
+            for( Int j=0; j<width; ++j )
+                XLoc(iLoc,j) = 0;
+    }
+}
+
+} // anonymous namespace
+
 } // namespace ldl
 
 template<typename Field>
@@ -56,6 +179,10 @@ void DistSparseLDLFactorization<Field>::Initialize
   const BisectCtrl& bisectCtrl )
 {
     EL_DEBUG_CSE
+    const unsigned long long orderingHash = ldl::OrderingHash( bisectCtrl );
+    if( ReuseAnalysis( A, hermitian, orderingHash ) )
+        return;
+
     info_.reset( new ldl::DistNodeInfo(A.Grid()) );
     separator_.reset( new ldl::DistSeparator );
     ldl::NestedDissection
@@ -64,10 +191,63 @@ void DistSparseLDLFactorization<Field>::Initialize
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
 
+    pattern_ = A.LockedDistGraph();
+    orderingHash_ = orderingHash;
+    formedPullMetadata_ = false;
     initialized_ = true;
     factored_ = false;
 }
 
+template<typename Field>
+bool DistSparseLDLFactorization<Field>::ReuseAnalysis
+( const DistSparseMatrix<Field>& A,
+        bool hermitian,
+        unsigned long long orderingHash )
+{
+    EL_DEBUG_CSE
+    // The ordering fingerprint and the grid are the same on every process
+    if( !initialized_ || orderingHash != orderingHash_ ||
+        &info_->Grid() != &A.Grid() )
+        return false;
+
+    // Compare the local portion of the sparsity pattern exactly and then
+    // ensure that every process makes the same decision
+    const DistGraph& graph = A.LockedDistGraph();
+    graph.AssertLocallyConsistent();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int numLocalEdges = graph.NumLocalEdges();
+    bool samePattern =
+      graph.NumSources() == pattern_.NumSources() &&
+      graph.NumTargets() == pattern_.NumTargets() &&
+      graph.FirstLocalSource() == pattern_.FirstLocalSource() &&
+      numLocalSources == pattern_.NumLocalSources() &&
+      numLocalEdges == pattern_.NumLocalEdges();
+    samePattern = samePattern &&
+      std::equal
+      ( graph.LockedOffsetBuffer(),
+        graph.LockedOffsetBuffer()+numLocalSources+1,
+        pattern_.LockedOffsetBuffer() ) &&
+      std::equal
+      ( graph.LockedTargetBuffer(),
+        graph.LockedTargetBuffer()+numLocalEdges,
+        pattern_.LockedTargetBuffer() );
+    samePattern =
+      mpi::AllReduce( Int(samePattern), mpi::MIN, A.Grid().Comm() ) == 1;
+    if( !samePattern )
+        return false;
+    if( !formedPullMetadata_ )
+    {
+        A.MappedSources( map_, mappedSources_ );
+        A.MappedTargets( map_, mappedTargets_, columnOffsets_ );
+        formedPullMetadata_ = true;
+    }
+    front_->Pull
+    ( A, map_, *separator_, *info_,
+      mappedSources_, mappedTargets_, columnOffsets_, hermitian );
+    factored_ = false;
+    return true;
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::Initialize2DGridGraph
 ( Int gridDim0,
@@ -86,6 +266,11 @@ void DistSparseLDLFactorization<Field>::Initialize2DGridGraph
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
 
+    pattern_ = A.LockedDistGraph();
+    orderingHash_ =
+      ldl::NaturalOrderingHash
+      ( gridDim0, gridDim1, 1, bisectCtrl.cutoff );
+    formedPullMetadata_ = false;
     initialized_ = true;
     factored_ = false;
 }
@@ -109,6 +294,11 @@ void DistSparseLDLFactorization<Field>::Initialize3DGridGraph
     front_.reset
     ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
 
+    pattern_ = A.LockedDistGraph();
+    orderingHash_ =
+      ldl::NaturalOrderingHash
+      ( gridDim0, gridDim1, gridDim2, bisectCtrl.cutoff );
+    formedPullMetadata_ = false;
     initialized_ = true;
     factored_ = false;
 }
@@ -128,7 +318,8 @@ void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), blrCtrl_ );
     factored_ = true;
 
     // Convert the fronts from the initial factorization to the requested form
@@ -170,20 +361,125 @@ void DistSparseLDLFactorization<Field>::Solve( DistMultiVec<Field>& B ) const
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before Solve()");
-    if( FrontIs1D(front_->type) )
+    auto solve = [&]( DistMultiVec<Field>& X )
     {
-        ldl::DistMultiVecNode<Field> BNodal( inverseMap_, *info_, B );
-        Solve( BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        if( FrontIs1D(front_->type) )
+        {
+            ldl::DistMultiVecNode<Field> XNodal( inverseMap_, *info_, X );
+            Solve( XNodal );
+            XNodal.Push( inverseMap_, *info_, X );
+        }
+        else
+        {
+            ldl::DistMatrixNode<Field> XNodal( inverseMap_, *info_, X );
+            Solve( XNodal );
+            XNodal.Push( inverseMap_, *info_, X );
+        }
+    };
+
+    // The block width must be consistent over the team
+    const Int width = B.Width();
+    Int blockWidth = solveBlockWidth_;
+    if( blockWidth == 0 && width > Blocksize() )
+    {
+        const Int workRows =
+          3*B.LocalHeight() + ldl::MaxLocalFrontHeight(*info_);
+        blockWidth =
+          ldl::SolveBlockWidth<Field>
+          ( 0, mpi::AllReduce( workRows, mpi::MAX, B.Grid().Comm() ) );
     }
-    else
+    if( blockWidth == 0 || width <= blockWidth )
     {
-        ldl::DistMatrixNode<Field> BNodal( inverseMap_, *info_, B );
-        Solve( BNodal );
-        BNodal.Push( inverseMap_, *info_, B );
+        solve( B );
+        return;
+    }
+
+    // Solve against one block of columns at a time so that the nodal
+    // workspace (and the communication buffers of each redistribution) only
+    // need to hold a single block
+    DistMultiVec<Field> BBlock( B.Grid() );
+    for( Int jOff=0; jOff<width; jOff+=blockWidth )
+    {
+        const Int nb = Min( blockWidth, width-jOff );
+        auto BLocView = B.Matrix()( ALL, IR(jOff,jOff+nb) );
+        BBlock.Resize( B.Height(), nb );
+        BBlock.Matrix() = BLocView;
+        solve( BBlock );
+        BLocView = BBlock.LockedMatrix();
     }
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetSolveBlockWidth( Int blockWidth )
+{
+    EL_DEBUG_CSE
+    if( blockWidth < 0 )
+        LogicError("The solve block width must be non-negative");
+    solveBlockWidth_ = blockWidth;
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetBLRCtrl
+( const BLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.tileSize <= 0 )
+        LogicError("The BLR tile size must be positive");
+    blrCtrl_ = ctrl;
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Solve
+( const DistSparseMatrix<Field>& B, DistMultiVec<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    vector<Int> inputRows;
+    ldl::DensifyRHS( B, X, inputRows );
+    ldl::ActiveFronts forwardActive;
+    ldl::MarkSubtreePaths( *info_, map_, inputRows, forwardActive );
+    ldl::PrunedSolve
+    ( *info_, *front_, inverseMap_, &forwardActive, nullptr, X );
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Solve
+( const DistSparseMatrix<Field>& B,
+  const vector<Int>& outputRows,
+        DistMultiVec<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    vector<Int> inputRows;
+    ldl::DensifyRHS( B, X, inputRows );
+    const auto allOutputRows =
+      ldl::GatherIndices( outputRows, info_->Grid().Comm() );
+    ldl::ActiveFronts forwardActive, backwardActive;
+    ldl::MarkSubtreePaths( *info_, map_, inputRows, forwardActive );
+    ldl::MarkSubtreePaths( *info_, map_, allOutputRows, backwardActive );
+    ldl::PrunedSolve
+    ( *info_, *front_, inverseMap_, &forwardActive, &backwardActive, X );
+    ldl::ZeroUnrequestedRows( allOutputRows, X );
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Solve
+( DistMultiVec<Field>& B, const vector<Int>& outputRows ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    const auto allOutputRows =
+      ldl::GatherIndices( outputRows, info_->Grid().Comm() );
+    ldl::ActiveFronts backwardActive;
+    ldl::MarkSubtreePaths( *info_, map_, allOutputRows, backwardActive );
+    ldl::PrunedSolve
+    ( *info_, *front_, inverseMap_, nullptr, &backwardActive, B );
+    ldl::ZeroUnrequestedRows( allOutputRows, B );
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::Solve
 ( ldl::DistMultiVecNode<Field>& B ) const
@@ -578,6 +874,24 @@ double DistSparseLDLFactorization<Field>::LocalSolveGFlops( Int numRHS ) const
     return front_->LocalSolveGFlops( numRHS );
 }
 
+template<typename Field>
+InertiaType DistSparseLDLFactorization<Field>::Inertia() const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must factor before calling 'Inertia()'");
+    const InertiaType localInertia = front_->LocalInertia();
+    Int counts[3] = { localInertia.numPositive,
+                      localInertia.numNegative,
+                      localInertia.numZero };
+    mpi::AllReduce( counts, 3, info_->Grid().Comm() );
+    InertiaType inertia;
+    inertia.numPositive = counts[0];
+    inertia.numNegative = counts[1];
+    inertia.numZero = counts[2];
+    return inertia;
+}
+
 template<typename Field>
 ldl::DistFront<Field>& DistSparseLDLFactorization<Field>::Front()
 {
@@ -21,6 +21,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./BLR.hpp"
 
 namespace El {
 namespace ldl {
@@ -169,6 +170,7 @@ void Front<Field>::Pull
         }
         else
         {
+            front.LBLR.Empty();
             Zeros( front.LDense, node.size+lowerSize, node.size );
             for( Int t=0; t<node.size; ++t )
             {
@@ -289,6 +291,8 @@ void Front<Field>::Push
   const NodeInfo& rootInfo ) const
 {
     EL_DEBUG_CSE
+    if( type == LDL_BLR_2D )
+        LogicError("Cannot push BLR fronts");
 
     // Invert the reordering
     const Int n = reordering.size();
@@ -409,6 +413,8 @@ void Front<Field>::Unpack
 ( SparseMatrix<Field>& A, const NodeInfo& rootInfo ) const
 {
     EL_DEBUG_CSE
+    if( type == LDL_BLR_2D )
+        LogicError("Cannot unpack BLR fronts");
     const Int n = rootInfo.off + rootInfo.size;
     Zeros( A, n, n );
 
@@ -528,6 +534,7 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     type = front.type;
     LDense = front.LDense;
     LSparse = front.LSparse;
+    LBLR = front.LBLR;
     diag = front.diag;
     subdiag = front.subdiag;
     p = front.p;
@@ -550,7 +557,12 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
 
 template<typename Field>
 Int Front<Field>::Height() const
-{ return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height(); }
+{
+    if( sparseLeaf )
+        return LDense.Height()+LDense.Width();
+    // Compressed fronts only store their top-left block densely
+    return LDense.Height() + LBLR.height;
+}
 
 template<typename Field>
 Int Front<Field>::NumEntries() const
@@ -585,6 +597,7 @@ Int Front<Field>::NumEntries() const
         {
             // Add in L
             numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += blr::NumLocalEntries( front.LBLR );
         }
         // Add in the workspace for the Schur complement
         numEntries += front.workDense.Height()*front.workDense.Width();
@@ -647,6 +660,7 @@ Int Front<Field>::NumBottomLeftEntries() const
         else
         {
             numEntries += (m-n)*n;
+            numEntries += blr::NumLocalEntries( front.LBLR );
         }
       };
     count( *this );
@@ -726,6 +740,45 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
     return gflops;
 }
 
+template<typename Field>
+InertiaType Front<Field>::Inertia() const
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( Unfactored(type) )
+        LogicError("Front must be factored before computing the inertia");
+    if( BlockFactorization(type) )
+        LogicError("Inertia is not available for block LDL factorizations");
+
+    InertiaType inertia;
+    inertia.numPositive = inertia.numNegative = inertia.numZero = 0;
+    function<void(const Front<Field>&)> count =
+      [&]( const Front<Field>& front )
+      {
+        for( const auto& child : front.children )
+            count( *child );
+
+        const Int n = front.diag.Height();
+        Matrix<Real> d( n, 1 );
+        for( Int i=0; i<n; ++i )
+            d(i) = RealPart(front.diag(i));
+
+        // The sparse leaves are not yet pivoted
+        Matrix<Field> dSub;
+        if( PivotedFactorization(front.type) && !front.sparseLeaf )
+            dSub = front.subdiag;
+        else
+            Zeros( dSub, Max(n-1,Int(0)), 1 );
+
+        const InertiaType frontInertia = ldl::Inertia( d, dSub );
+        inertia.numPositive += frontInertia.numPositive;
+        inertia.numNegative += frontInertia.numNegative;
+        inertia.numZero += frontInertia.numZero;
+      };
+    count( *this );
+    return inertia;
+}
+
 #define PROTO(Field) template struct Front<Field>;
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -81,6 +81,7 @@ LDLFrontType ConvertTo2D( LDLFrontType type )
     case BLOCK_LDL_2D:           newType = BLOCK_LDL_2D;           break;
     case BLOCK_LDL_INTRAPIV_1D:
     case BLOCK_LDL_INTRAPIV_2D:  newType = BLOCK_LDL_INTRAPIV_2D;  break;
+    case LDL_BLR_2D:             newType = LDL_BLR_2D;             break;
     default: LogicError("Invalid front type");
     }
     return newType;
@@ -106,6 +107,7 @@ LDLFrontType ConvertTo1D( LDLFrontType type )
     case BLOCK_LDL_2D:           newType = BLOCK_LDL_1D;           break;
     case BLOCK_LDL_INTRAPIV_1D:
     case BLOCK_LDL_INTRAPIV_2D:  newType = BLOCK_LDL_INTRAPIV_1D;  break;
+    case LDL_BLR_2D: LogicError("BLR fronts are only stored in 2D");
     default: LogicError("Invalid front type");
     }
     return newType;
@@ -145,7 +147,7 @@ LDLFrontType InitialFactorType( LDLFrontType type )
 {
     if( Unfactored(type) )
         LogicError("Front type does not require factorization");
-    if( BlockFactorization(type) )
+    if( BlockFactorization(type) || type == LDL_BLR_2D )
         return ConvertTo2D(type);
     else if( PivotedFactorization(type) )
         return LDL_INTRAPIV_2D;
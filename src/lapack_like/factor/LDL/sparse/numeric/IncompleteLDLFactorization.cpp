@@ -0,0 +1,497 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <queue>
+
+namespace El {
+
+namespace ldl {
+namespace {
+
+// The subtree of each node is numbered contiguously, starting with the
+// subtree of its first child and ending with its own separator
+inline Int SubtreeBeg( const NodeInfo& node )
+{
+    const NodeInfo* leaf = &node;
+    while( !leaf->children.empty() )
+        leaf = leaf->children.front().get();
+    return leaf->off;
+}
+
+// Only spawn a task for a subtree if it has enough rows to amortize it
+inline bool SpawnIncompleteSubtree( const NodeInfo& child, Int numRHS=1 )
+{
+    const Int subtreeSize = child.off + child.size - SubtreeBeg(child);
+    return subtreeSize*numRHS >= 4096;
+}
+
+template<typename Field>
+struct IncompleteFactors
+{
+    // The entries of each column of L computed so far. Since an entry L(i,k)
+    // can only be nonzero if the separator of 'i' is an ancestor of (or equal
+    // to) that of 'k', the columns of sibling subtrees are disjoint.
+    vector<vector<Int>> colInds;
+    vector<vector<Field>> colVals;
+
+    // The entries of each row of L, sorted by column
+    vector<vector<Int>> rowInds;
+    vector<vector<Field>> rowVals;
+
+    vector<Field> d;
+
+    IncompleteFactors( Int n )
+    : colInds(n), colVals(n), rowInds(n), rowVals(n), d(n)
+    { }
+};
+
+// Form the i'th row of L and the i'th diagonal entry of D using the
+// previously computed columns of L within the subtree beginning at 'beg'.
+// The workspace vectors are indexed relative to 'beg' and must be zero (and
+// unmarked) upon entry and are returned as such.
+template<typename Field>
+void FactorRow
+( Int i,
+  Int beg,
+  const SparseMatrix<Field>& ALower,
+  bool conjugate,
+  const IncompleteLDLCtrl<Base<Field>>& ctrl,
+        IncompleteFactors<Field>& factors,
+        vector<Field>& w,
+        vector<bool>& marked )
+{
+    typedef Base<Field> Real;
+    const Int* offsetBuf = ALower.LockedOffsetBuffer();
+    const Int* targetBuf = ALower.LockedTargetBuffer();
+    const Field* valueBuf = ALower.LockedValueBuffer();
+
+    // Scatter the strictly lower portion of the row into the accumulator
+    std::priority_queue<Int,vector<Int>,std::greater<Int>> heap;
+    Field alpha = 0;
+    Real rowNormSquared = 0;
+    Int numOrigEntries = 0;
+    for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+    {
+        const Int k = targetBuf[e];
+        const Field value = valueBuf[e];
+        const Real valueAbs = Abs(value);
+        rowNormSquared += valueAbs*valueAbs;
+        if( k == i )
+        {
+            alpha = value;
+        }
+        else
+        {
+            w[k-beg] = value;
+            marked[k-beg] = true;
+            heap.push( k );
+            ++numOrigEntries;
+        }
+    }
+    const Real rowNorm = Sqrt( rowNormSquared );
+    const Real dropThresh = ctrl.dropTol*rowNorm;
+
+    // Eliminate the entries in increasing order of their columns. Each entry
+    // of the accumulator holds L(i,k) d(k) when it is eliminated.
+    vector<Int> inds;
+    vector<Field> vals;
+    while( !heap.empty() )
+    {
+        const Int k = heap.top();
+        heap.pop();
+        const Field omega = w[k-beg];
+        w[k-beg] = 0;
+        marked[k-beg] = false;
+        if( Abs(omega) < dropThresh )
+            continue;
+        inds.push_back( k );
+        vals.push_back( omega );
+
+        const auto& colInds = factors.colInds[k];
+        const auto& colVals = factors.colVals[k];
+        const Int numColEntries = colInds.size();
+        for( Int t=0; t<numColEntries; ++t )
+        {
+            const Int j = colInds[t];
+            const Field lambda =
+              ( conjugate ? Conj(colVals[t]) : colVals[t] );
+            if( !marked[j-beg] )
+            {
+                marked[j-beg] = true;
+                heap.push( j );
+            }
+            w[j-beg] -= omega*lambda;
+        }
+    }
+
+    // Only keep the largest entries beyond the number in the original row
+    Int numKept = inds.size();
+    if( ctrl.fill >= 0 && numKept > numOrigEntries+ctrl.fill )
+    {
+        vector<Int> perm( numKept );
+        for( Int t=0; t<numKept; ++t )
+            perm[t] = t;
+        numKept = numOrigEntries + ctrl.fill;
+        std::nth_element
+        ( perm.begin(), perm.begin()+numKept, perm.end(),
+          [&]( const Int& s, const Int& t )
+          { return Abs(vals[s]) > Abs(vals[t]); } );
+        perm.resize( numKept );
+        std::sort( perm.begin(), perm.end() );
+        for( Int t=0; t<numKept; ++t )
+        {
+            inds[t] = inds[perm[t]];
+            vals[t] = vals[perm[t]];
+        }
+        inds.resize( numKept );
+        vals.resize( numKept );
+    }
+
+    // Form the multipliers and the pivot consistent with the kept entries
+    Field delta = alpha;
+    for( Int t=0; t<numKept; ++t )
+    {
+        const Int k = inds[t];
+        const Field omega = vals[t];
+        vals[t] = omega / factors.d[k];
+        delta -= omega*( conjugate ? Conj(vals[t]) : vals[t] );
+    }
+    if( conjugate )
+        delta = RealPart(delta);
+    const Real pivotThresh = ctrl.pivotTol*rowNorm;
+    if( Abs(delta) <= pivotThresh )
+    {
+        const Real magnitude = ( pivotThresh > Real(0) ? pivotThresh : 1 );
+        delta = ( RealPart(delta) < Real(0) ? -magnitude : magnitude );
+    }
+    factors.d[i] = delta;
+
+    for( Int t=0; t<numKept; ++t )
+    {
+        factors.colInds[inds[t]].push_back( i );
+        factors.colVals[inds[t]].push_back( vals[t] );
+    }
+    factors.rowInds[i] = std::move( inds );
+    factors.rowVals[i] = std::move( vals );
+}
+
+template<typename Field>
+void FactorSubtree
+( const NodeInfo& node,
+  const SparseMatrix<Field>& ALower,
+  bool conjugate,
+  const IncompleteLDLCtrl<Base<Field>>& ctrl,
+        IncompleteFactors<Field>& factors )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = node.children.size();
+#ifdef EL_HYBRID
+    if( numChildren > 1 && !omp_in_parallel() )
+    {
+        // Open a team of threads which the recursion populates with tasks
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        FactorSubtree( node, ALower, conjugate, ctrl, factors );
+        return;
+    }
+#endif
+
+    for( Int c=0; c<numChildren; ++c )
+    {
+        EL_TASK_IF_FIRSTPRIVATE
+        ( numChildren > 1 && SpawnIncompleteSubtree(*node.children[c]), c )
+        FactorSubtree( *node.children[c], ALower, conjugate, ctrl, factors );
+    }
+    EL_TASKWAIT
+
+    const Int beg = SubtreeBeg( node );
+    const Int subtreeSize = node.off + node.size - beg;
+    vector<Field> w( subtreeSize, Field(0) );
+    vector<bool> marked( subtreeSize, false );
+    for( Int i=node.off; i<node.off+node.size; ++i )
+        FactorRow( i, beg, ALower, conjugate, ctrl, factors, w, marked );
+}
+
+// X := inv(L) X, where only the rows within the subtree are modified
+template<typename Field>
+void ForwardSolveSubtree
+( const NodeInfo& node,
+  const SparseMatrix<Field>& L,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = node.children.size();
+    const Int numRHS = X.Width();
+#ifdef EL_HYBRID
+    if( numChildren > 1 && !omp_in_parallel() )
+    {
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        ForwardSolveSubtree( node, L, X );
+        return;
+    }
+#endif
+
+    for( Int c=0; c<numChildren; ++c )
+    {
+        EL_TASK_IF_FIRSTPRIVATE
+        ( numChildren > 1 && SpawnIncompleteSubtree(*node.children[c],numRHS),
+          c )
+        ForwardSolveSubtree( *node.children[c], L, X );
+    }
+    EL_TASKWAIT
+
+    const Int* offsetBuf = L.LockedOffsetBuffer();
+    const Int* targetBuf = L.LockedTargetBuffer();
+    const Field* valueBuf = L.LockedValueBuffer();
+    for( Int i=node.off; i<node.off+node.size; ++i )
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+        {
+            const Int k = targetBuf[e];
+            const Field lambda = valueBuf[e];
+            for( Int j=0; j<numRHS; ++j )
+                X(i,j) -= lambda*X(k,j);
+        }
+}
+
+// X := inv(op(L)) X, where only the rows within the subtree are modified
+template<typename Field>
+void BackwardSolveSubtree
+( const NodeInfo& node,
+  const SparseMatrix<Field>& L,
+  bool conjugate,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = node.children.size();
+    const Int numRHS = X.Width();
+#ifdef EL_HYBRID
+    if( numChildren > 1 && !omp_in_parallel() )
+    {
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        BackwardSolveSubtree( node, L, conjugate, X );
+        return;
+    }
+#endif
+
+    // The rows of this separator only update rows within its subtree, and
+    // so they must be finished before descending
+    const Int* offsetBuf = L.LockedOffsetBuffer();
+    const Int* targetBuf = L.LockedTargetBuffer();
+    const Field* valueBuf = L.LockedValueBuffer();
+    for( Int i=node.off+node.size-1; i>=node.off; --i )
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+        {
+            const Int k = targetBuf[e];
+            const Field lambda =
+              ( conjugate ? Conj(valueBuf[e]) : valueBuf[e] );
+            for( Int j=0; j<numRHS; ++j )
+                X(k,j) -= lambda*X(i,j);
+        }
+
+    for( Int c=0; c<numChildren; ++c )
+    {
+        EL_TASK_IF_FIRSTPRIVATE
+        ( numChildren > 1 && SpawnIncompleteSubtree(*node.children[c],numRHS),
+          c )
+        BackwardSolveSubtree( *node.children[c], L, conjugate, X );
+    }
+    EL_TASKWAIT
+}
+
+} // anonymous namespace
+} // namespace ldl
+
+template<typename Field>
+IncompleteLDLFactorization<Field>::IncompleteLDLFactorization()
+{ }
+
+template<typename Field>
+void IncompleteLDLFactorization<Field>::Initialize
+( const SparseMatrix<Field>& A,
+        bool hermitian,
+  const BisectCtrl& bisectCtrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Expected a square matrix");
+    info_.reset( new ldl::NodeInfo );
+    separator_.reset( new ldl::Separator );
+    ldl::NestedDissection
+    ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
+    InvertMap( map_, inverseMap_ );
+
+    hermitian_ = hermitian;
+    FormLowerTriangle( A );
+    initialized_ = true;
+    factored_ = false;
+}
+
+template<typename Field>
+void IncompleteLDLFactorization<Field>::FormLowerTriangle
+( const SparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int numEntries = A.NumEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const Field* valueBuf = A.LockedValueBuffer();
+
+    Int numLowerEntries = 0;
+    for( Int e=0; e<numEntries; ++e )
+        if( map_[targetBuf[e]] <= map_[sourceBuf[e]] )
+            ++numLowerEntries;
+
+    Zeros( ALower_, n, n );
+    ALower_.Reserve( numLowerEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = map_[sourceBuf[e]];
+        const Int k = map_[targetBuf[e]];
+        if( k <= i )
+            ALower_.QueueUpdate( i, k, valueBuf[e] );
+    }
+    ALower_.ProcessQueues();
+}
+
+template<typename Field>
+void IncompleteLDLFactorization<Field>::ChangeNonzeroValues
+( const SparseMatrix<Field>& ANew )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'ChangeNonzeroValues()'");
+    if( ANew.Height() != Int(map_.size()) )
+        LogicError("The new matrix has a different size");
+    FormLowerTriangle( ANew );
+    factored_ = false;
+}
+
+template<typename Field>
+void IncompleteLDLFactorization<Field>::Factor
+( const IncompleteLDLCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Factor()'");
+    const Int n = ALower_.Height();
+
+    ldl::IncompleteFactors<Field> factors( n );
+    ldl::FactorSubtree( *info_, ALower_, hermitian_, ctrl, factors );
+    SwapClear( factors.colInds );
+    SwapClear( factors.colVals );
+
+    // Pack the rows of L into a sparse matrix
+    Int numEntries = 0;
+    for( Int i=0; i<n; ++i )
+        numEntries += factors.rowInds[i].size();
+    Zeros( L_, n, n );
+    L_.ForceNumEntries( numEntries );
+    Int* sourceBuf = L_.SourceBuffer();
+    Int* targetBuf = L_.TargetBuffer();
+    Int* offsetBuf = L_.OffsetBuffer();
+    Field* valueBuf = L_.ValueBuffer();
+    Int off = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        offsetBuf[i] = off;
+        const Int numRowEntries = factors.rowInds[i].size();
+        for( Int t=0; t<numRowEntries; ++t )
+        {
+            sourceBuf[off] = i;
+            targetBuf[off] = factors.rowInds[i][t];
+            valueBuf[off] = factors.rowVals[i][t];
+            ++off;
+        }
+        SwapClear( factors.rowInds[i] );
+        SwapClear( factors.rowVals[i] );
+    }
+    offsetBuf[n] = off;
+    L_.ForceConsistency();
+
+    d_.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        d_(i) = factors.d[i];
+
+    factored_ = true;
+}
+
+template<typename Field>
+void IncompleteLDLFactorization<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    const Int n = L_.Height();
+    const Int width = B.Width();
+    if( B.Height() != n )
+        LogicError("B was of the incorrect height");
+
+    Matrix<Field> X;
+    X.Resize( n, width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<n; ++i )
+            X(i,j) = B(inverseMap_[i],j);
+
+    ldl::ForwardSolveSubtree( *info_, L_, X );
+    DiagonalSolve( LEFT, NORMAL, d_, X );
+    ldl::BackwardSolveSubtree( *info_, L_, hermitian_, X );
+
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<n; ++i )
+            B(inverseMap_[i],j) = X(i,j);
+}
+
+template<typename Field>
+bool IncompleteLDLFactorization<Field>::Factored() const
+{ return factored_; }
+
+template<typename Field>
+Int IncompleteLDLFactorization<Field>::Height() const
+{ return map_.size(); }
+
+template<typename Field>
+Int IncompleteLDLFactorization<Field>::NumEntries() const
+{ return L_.NumEntries() + d_.Height(); }
+
+template<typename Field>
+const ldl::NodeInfo& IncompleteLDLFactorization<Field>::NodeInfo() const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before accessing the node information");
+    return *info_;
+}
+
+template<typename Field>
+const vector<Int>& IncompleteLDLFactorization<Field>::Map() const
+{
+    EL_DEBUG_CSE
+    return map_;
+}
+
+template<typename Field>
+const vector<Int>& IncompleteLDLFactorization<Field>::InverseMap() const
+{
+    EL_DEBUG_CSE
+    return inverseMap_;
+}
+
+#define PROTO(Field) template class IncompleteLDLFactorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
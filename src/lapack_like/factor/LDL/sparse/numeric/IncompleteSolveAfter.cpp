@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+template<typename Field>
+Int SolveAfter
+( const SparseMatrix<Field>& A,
+  const IncompleteLDLFactorization<Field>& incompleteFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+          incompleteFact.Solve( W );
+      };
+
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename Field>
+Int SolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistIncompleteLDLFactorization<Field>& incompleteFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+          incompleteFact.Solve( W );
+      };
+
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+#define PROTO(Field) \
+  template Int SolveAfter \
+  ( const SparseMatrix<Field>& A, \
+    const IncompleteLDLFactorization<Field>& incompleteFact, \
+          Matrix<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int SolveAfter \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistIncompleteLDLFactorization<Field>& incompleteFact, \
+          DistMultiVec<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
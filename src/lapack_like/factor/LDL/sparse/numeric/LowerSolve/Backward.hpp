@@ -25,13 +25,27 @@
 namespace El {
 namespace ldl {
 
+// If 'active' is non-null, only the children within it are visited (and the
+// solutions within the subtrees of the remaining children are not formed)
 template<typename F> 
 inline void LowerBackwardSolve
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X, bool conjugate )
+        MatrixNode<F>& X, bool conjugate,
+  const ActiveFronts* active=nullptr )
 {
     EL_DEBUG_CSE
+    const Int numChildren = front.children.size();
+#ifdef EL_HYBRID
+    if( numChildren > 1 && !omp_in_parallel() )
+    {
+        // Open a team of threads which the recursion populates with tasks
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        LowerBackwardSolve( info, front, X, conjugate, active );
+        return;
+    }
+#endif
 
     auto* dupMV = X.duplicateMV;
     auto* dupMat = X.duplicateMat;
@@ -51,9 +65,11 @@ inline void LowerBackwardSolve
     if( haveParent || haveDupMVParent || haveDupMatParent )
         X.matrix = W( IR(0,info.size), IR(0,numRHS) );
 
-    const Int numChildren = front.children.size();
     for( Int c=0; c<numChildren; ++c )
     {
+        if( !IsActive(*info.children[c],active) )
+            continue;
+
         // Set up a workspace for the child
         auto& childW = X.children[c]->work;
         childW.Resize( front.children[c]->Height(), numRHS );
@@ -79,20 +95,30 @@ inline void LowerBackwardSolve
         dupMat->work.Empty();
 
     for( Int c=0; c<numChildren; ++c )
+    {
+        if( !IsActive(*info.children[c],active) )
+            continue;
+        EL_TASK_IF_FIRSTPRIVATE
+        ( numChildren > 1 && SpawnSubtreeSolve(*info.children[c],numRHS), c )
         LowerBackwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c], conjugate );
+        ( *info.children[c], *front.children[c], *X.children[c], conjugate,
+          active );
+    }
+    EL_TASKWAIT
 }
 
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
-  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate )
+  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate,
+  const ActiveFronts* active=nullptr )
 {
     EL_DEBUG_CSE
     if( front.duplicate != nullptr )
     {
         LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate,
+          active );
         return;
     }
 
@@ -116,8 +142,9 @@ inline void LowerBackwardSolve
     )
     const Grid& childGrid =
       ( frontIs1D ? childFront.L1D.Grid() : childFront.L2D.Grid() );
+    // NOTE: Compressed (BLR) fronts only store their top-left block densely
     const Int childFrontHeight =
-      ( frontIs1D ? childFront.L1D.Height() : childFront.L2D.Height() );
+      info.child->size + info.child->lowerStruct.size();
     auto& childW = X.child->work;
     childW.SetGrid( childGrid );
     childW.Resize( childFrontHeight, numRHS );
@@ -183,20 +210,23 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, active );
 }
 
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X, bool conjugate )
+        DistMatrixNode<F>& X, bool conjugate,
+  const ActiveFronts* active=nullptr )
 {
     EL_DEBUG_CSE
     if( front.duplicate != nullptr )
     {
         LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate,
+          active );
         return;
     }
 
@@ -218,7 +248,8 @@ inline void LowerBackwardSolve
           LogicError("Incompatible front type mixture");
     )
     const Grid& childGrid = childFront.L2D.Grid();
-    const Int childFrontHeight = childFront.L2D.Height();
+    const Int childFrontHeight =
+      info.child->size + info.child->lowerStruct.size();
     auto& childW = X.child->work;
     childW.SetGrid( childGrid );
     childW.Align( 0, 0 );
@@ -291,7 +322,8 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, active );
 }
 
 } // namespace ldl
@@ -25,24 +25,44 @@
 namespace El {
 namespace ldl {
 
+// If 'active' is non-null, only the children within it are visited (the
+// right-hand sides within the subtrees of the remaining children must be zero)
 template<typename F> 
 void LowerForwardSolve
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X )
+        MatrixNode<F>& X,
+  const ActiveFronts* active=nullptr )
 {
     EL_DEBUG_CSE
-
     const Int numChildren = info.children.size();
+    const Int numRHS = X.matrix.Width();
+#ifdef EL_HYBRID
+    if( numChildren > 1 && !omp_in_parallel() )
+    {
+        // Open a team of threads which the recursion populates with tasks
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        LowerForwardSolve( info, front, X, active );
+        return;
+    }
+#endif
+
     for( Int c=0; c<numChildren; ++c )
+    {
+        if( !IsActive(*info.children[c],active) )
+            continue;
+        EL_TASK_IF_FIRSTPRIVATE
+        ( numChildren > 1 && SpawnSubtreeSolve(*info.children[c],numRHS), c )
         LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
+        ( *info.children[c], *front.children[c], *X.children[c], active );
+    }
+    EL_TASKWAIT
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
     //       (or a duplicate's parent)
     auto& W = X.work;
-    const Int numRHS = X.matrix.Width();
     W.Resize( front.Height(), numRHS );
     auto WT = W( IR(0,info.size), ALL );
     auto WB = W( IR(info.size,END), ALL );
@@ -52,6 +72,8 @@ void LowerForwardSolve
     // Update using the children (if they exist)
     for( Int c=0; c<numChildren; ++c )
     {
+        if( !IsActive(*info.children[c],active) )
+            continue;
         auto& childW = X.children[c]->work;
         const Int childSize = info.children[c]->size;
         const Int childHeight = childW.Height();
@@ -78,7 +100,8 @@ template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMultiVecNode<F>& X )
+        DistMultiVecNode<F>& X,
+  const ActiveFronts* active=nullptr )
 {
     EL_DEBUG_CSE
 
@@ -86,7 +109,8 @@ void LowerForwardSolve
     const Grid& grid = ( frontIs1D ? front.L1D.Grid() : front.L2D.Grid() );
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        LowerForwardSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, active );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -98,13 +122,13 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, active );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
     const Int numRHS = X.matrix.Width();
-    const Int frontHeight =
-      ( frontIs1D ? front.L1D.Height() : front.L2D.Height() );
+    // NOTE: Compressed (BLR) fronts only store their top-left block densely
+    const Int frontHeight = info.size + info.lowerStruct.size();
     auto& W = X.work;
     W.SetGrid( grid );
     W.Resize( frontHeight, numRHS );
@@ -183,7 +207,8 @@ template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X )
+        DistMatrixNode<F>& X,
+  const ActiveFronts* active=nullptr )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -194,7 +219,8 @@ void LowerForwardSolve
     const Grid& grid = front.L2D.Grid();
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        LowerForwardSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, active );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -206,12 +232,12 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, active );
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
     const Int numRHS = X.matrix.Width();
-    const Int frontHeight = front.L2D.Height();
+    const Int frontHeight = info.size + info.lowerStruct.size();
     auto& W = X.work;
     W.SetGrid( grid );
     W.Align( 0, 0 );
@@ -21,6 +21,7 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_FRONTBACKWARD_HPP
 
 #include "./FrontUtil.hpp"
+#include "../BLR.hpp"
 
 namespace El {
 namespace ldl {
@@ -652,6 +653,38 @@ void FrontBlockLowerBackwardSolve
     Gemm( NORMAL, NORMAL, F(-1), LT, YT, F(1), XT );
 }
 
+template<typename F>
+void FrontBLRLowerBackwardSolve
+( const Front<F>& front,
+        Matrix<F>& X,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int n = front.LDense.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    blr::Multiply( orientation, F(-1), front.LBLR, XB, XT );
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), front.LDense, XT, true );
+}
+
+template<typename F,class WType>
+void FrontBLRLowerBackwardSolve
+( const DistFront<F>& front,
+        WType& X,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int n = front.L2D.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    blr::Multiply( orientation, F(-1), front.LBLR, XB, XT );
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), front.L2D, XT );
+}
+
 template<typename F>
 void FrontLowerBackwardSolve
 ( const Front<F>& front,
@@ -686,7 +719,9 @@ void FrontLowerBackwardSolve
     }
     else
     {
-        if( BlockFactorization(type) )
+        if( type == LDL_BLR_2D && !front.LBLR.tiles.empty() )
+            FrontBLRLowerBackwardSolve( front, W, conjugate );
+        else if( BlockFactorization(type) )
             FrontBlockLowerBackwardSolve( front.LDense, W, conjugate );
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerBackwardSolve
@@ -710,7 +745,9 @@ void FrontLowerBackwardSolve
     )
     const bool blocked = BlockFactorization(type);
 
-    if( type == LDL_2D )
+    if( type == LDL_BLR_2D && !front.LBLR.tiles.empty() )
+        FrontBLRLowerBackwardSolve( front, W, conjugate );
+    else if( type == LDL_2D || type == LDL_BLR_2D )
         FrontVanillaLowerBackwardSolve( front.L2D, W, conjugate );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerBackwardSolve( front.L2D, W, conjugate );
@@ -740,9 +777,11 @@ void FrontLowerBackwardSolve
     )
     const bool blocked = BlockFactorization(type);
 
-    if( type == LDL_1D )
+    if( type == LDL_BLR_2D && !front.LBLR.tiles.empty() )
+        FrontBLRLowerBackwardSolve( front, W, conjugate );
+    else if( type == LDL_1D )
         FrontVanillaLowerBackwardSolve( front.L1D, W, conjugate );
-    else if( type == LDL_2D )
+    else if( type == LDL_2D || type == LDL_BLR_2D )
         FrontVanillaLowerBackwardSolve( front.L2D, W, conjugate );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerBackwardSolve( front.L1D, W, conjugate );
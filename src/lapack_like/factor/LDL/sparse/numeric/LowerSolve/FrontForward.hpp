@@ -21,6 +21,7 @@
 #define EL_FACTOR_LDL_NUMERIC_LOWERSOLVE_FRONTFORWARD_HPP
 
 #include "./FrontUtil.hpp"
+#include "../BLR.hpp"
 
 namespace El {
 namespace ldl {
@@ -86,6 +87,18 @@ void FrontBlockLowerForwardSolve
     Gemm( NORMAL, NORMAL, F(-1), LB, XT, F(1), XB );
 }
 
+template<typename F>
+void FrontBLRLowerForwardSolve( const Front<F>& front, Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = front.LDense.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), front.LDense, XT );
+    blr::Multiply( NORMAL, F(-1), front.LBLR, XT, XB );
+}
+
 template<typename F>
 void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
 {
@@ -115,7 +128,9 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
     }
     else
     {
-        if( BlockFactorization(type) )
+        if( type == LDL_BLR_2D && !front.LBLR.tiles.empty() )
+            FrontBLRLowerForwardSolve( front, W );
+        else if( BlockFactorization(type) )
             FrontBlockLowerForwardSolve( front.LDense, W );
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerForwardSolve( front.LDense, front.p, W );
@@ -656,6 +671,20 @@ void FrontBlockLowerForwardSolve
     Gemm( NORMAL, NORMAL, F(-1), LB, XT, F(1), XB );
 }
 
+// The compressed bottom-left block is applied tile-by-tile with the
+// distribution of the workspace left to Gemm
+template<typename F,class WType>
+void FrontBLRLowerForwardSolve( const DistFront<F>& front, WType& X )
+{
+    EL_DEBUG_CSE
+    const Int n = front.L2D.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), front.L2D, XT );
+    blr::Multiply( NORMAL, F(-1), front.LBLR, XT, XB );
+}
+
 template<typename F>
 void 
 FrontLowerForwardSolve
@@ -666,9 +695,11 @@ FrontLowerForwardSolve
     const LDLFrontType type = front.type;
 
     // TODO: Add support for LDL_2D
-    if( type == LDL_1D )
+    if( type == LDL_BLR_2D && !front.LBLR.tiles.empty() )
+        FrontBLRLowerForwardSolve( front, W );
+    else if( type == LDL_1D )
         FrontVanillaLowerForwardSolve( front.L1D, W );
-    else if( type == LDL_2D )
+    else if( type == LDL_2D || type == LDL_BLR_2D )
         FrontVanillaLowerForwardSolve( front.L2D, W );
     else if( type == LDL_SELINV_1D )
         FrontFastLowerForwardSolve( front.L1D, W );
@@ -693,7 +724,9 @@ FrontLowerForwardSolve( const DistFront<F>& front, DistMatrix<F>& W )
     EL_DEBUG_CSE
     const LDLFrontType type = front.type;
 
-    if( type == LDL_2D )
+    if( type == LDL_BLR_2D && !front.LBLR.tiles.empty() )
+        FrontBLRLowerForwardSolve( front, W );
+    else if( type == LDL_2D || type == LDL_BLR_2D )
         FrontVanillaLowerForwardSolve( front.L2D, W );
     else if( type == LDL_SELINV_2D )
         FrontFastLowerForwardSolve( front.L2D, W );
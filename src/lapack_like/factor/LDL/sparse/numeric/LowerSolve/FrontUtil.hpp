@@ -88,6 +88,100 @@ void AccumulateRHS( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,STAR,STAR>& Z )
     El::AllReduce( Z, X.ColComm() );
 }
 
+// A set of (sequential) fronts which is closed under taking parents. Solves
+// restricted to such a set only traverse the paths from a few fronts to the
+// root of the (sequential) tree.
+typedef std::set<const NodeInfo*> ActiveFronts;
+
+inline bool IsActive( const NodeInfo& info, const ActiveFronts* active )
+{ return active == nullptr || active->count(&info) != 0; }
+
+// Insert the fronts on the paths from the fronts containing the given
+// (reordered) indices to the root of the sequential tree. Indices outside of
+// the tree are ignored.
+inline void MarkActivePaths
+( const NodeInfo& root, const vector<Int>& inds, ActiveFronts& active )
+{
+    // The subtree of each node is numbered contiguously (starting with the
+    // subtree of its first child and ending with its own separator)
+    const NodeInfo* firstLeaf = &root;
+    while( !firstLeaf->children.empty() )
+        firstLeaf = firstLeaf->children.front().get();
+    const Int subtreeBeg = firstLeaf->off;
+    const Int subtreeEnd = root.off + root.size;
+
+    for( const Int i : inds )
+    {
+        if( i < subtreeBeg || i >= subtreeEnd )
+            continue;
+
+        // Descend to the front containing index i
+        const NodeInfo* node = &root;
+        while( i < node->off )
+        {
+            const NodeInfo* next = nullptr;
+            for( const auto& child : node->children )
+            {
+                if( i < child->off+child->size )
+                {
+                    next = child.get();
+                    break;
+                }
+            }
+            if( next == nullptr )
+                LogicError("Index ",i," was not within the subtree");
+            node = next;
+        }
+
+        // Mark the path to the root (stopping at the first marked ancestor)
+        for( ; node != nullptr; node = node->parent )
+            if( !active.insert(node).second )
+                break;
+    }
+}
+
+// Subtrees of sibling fronts can be solved against independently, but only
+// spawn a task for a child if its front is large enough to amortize it
+inline bool SpawnSubtreeSolve( const NodeInfo& child, Int numRHS )
+{
+    const Int frontHeight = child.size + child.lowerStruct.size();
+    return frontHeight*numRHS >= 4096;
+}
+
+// The number of bytes of nodal workspace that each process may devote to a
+// block of right-hand sides when the solve block width is chosen
+// automatically
+const double solveMemoryBudget = 256.*1024.*1024.;
+
+inline Int MaxFrontHeight( const NodeInfo& info )
+{
+    Int maxHeight = info.size + info.lowerStruct.size();
+    for( const auto& child : info.children )
+        maxHeight = Max( maxHeight, MaxFrontHeight(*child) );
+    return maxHeight;
+}
+
+inline Int MaxLocalFrontHeight( const DistNodeInfo& info )
+{
+    if( info.child.get() == nullptr )
+        return MaxFrontHeight( *info.duplicate );
+    const Int frontHeight = info.size + info.lowerStruct.size();
+    return Max
+      ( MaxLength(frontHeight,info.Grid().Size()),
+        MaxLocalFrontHeight(*info.child) );
+}
+
+// Choose the number of right-hand sides to solve against at once given the
+// (maximum local) number of rows of nodal workspace needed per column
+template<typename F>
+Int SolveBlockWidth( Int requestedWidth, Int workRowsPerColumn )
+{
+    if( requestedWidth > 0 )
+        return requestedWidth;
+    const double bytesPerColumn = double(Max(workRowsPerColumn,1))*sizeof(F);
+    return Max( Blocksize(), Int(solveMemoryBudget/bytesPerColumn) );
+}
+
 } // namespace ldl
 } // namespace El
 
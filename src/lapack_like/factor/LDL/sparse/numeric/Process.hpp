@@ -30,7 +30,10 @@ namespace ldl {
 
 template<typename Field>
 void Process
-( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+( const NodeInfo& info,
+        Front<Field>& front,
+        LDLFrontType factorType,
+  const BLRCtrl<Base<Field>>& blrCtrl=BLRCtrl<Base<Field>>() )
 {
     EL_DEBUG_CSE
     const int updateSize = info.lowerStruct.size();
@@ -123,7 +126,8 @@ void Process
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            Process
+            ( *info.children[c], *front.children[c], factorType, blrCtrl );
 
             auto& childU = front.children[c]->workDense;
             const int childUSize = childU.Height();
@@ -142,13 +146,16 @@ void Process
             }
             childU.Empty();
         }
-        ProcessFront( front, factorType );
+        ProcessFront( front, factorType, blrCtrl );
     }
 }
 
 template<typename Field>
 void Process
-( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType )
+( const DistNodeInfo& info,
+        DistFront<Field>& front,
+        LDLFrontType factorType,
+  const BLRCtrl<Base<Field>>& blrCtrl=BLRCtrl<Base<Field>>() )
 {
     EL_DEBUG_CSE
 
@@ -158,10 +165,15 @@ void Process
         const Grid& grid = info.Grid();
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        Process( *info.duplicate, frontDup, factorType, blrCtrl );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
+        if( factorType == LDL_BLR_2D )
+        {
+            // The dense storage of the duplicate may have been replaced
+            front.L2D.Attach( grid, frontDup.LDense );
+        }
         front.work.LockedAttach( grid, frontDup.workDense );
         if( !BlockFactorization(factorType) )
         {
@@ -179,7 +191,7 @@ void Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+    Process( childInfo, childFront, factorType, blrCtrl );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
@@ -272,7 +284,7 @@ void Process
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    ProcessFront( front, factorType );
+    ProcessFront( front, factorType, blrCtrl );
 }
 
 } // namespace ldl
@@ -23,6 +23,8 @@
 #ifndef EL_LDL_PROCESSFRONT_HPP
 #define EL_LDL_PROCESSFRONT_HPP
 
+#include "./BLR.hpp"
+
 namespace El {
 namespace ldl {
 
@@ -153,8 +155,48 @@ void ProcessFrontBlock
     }
 }
 
+// Factor the top-left block densely and then compress the bottom-left block
+// into a BLR format before forming the Schur complement from the compressed
+// representation (fronts which are too small are factored as usual)
+template<typename F>
+void ProcessFrontBLR( Front<F>& front, const BLRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto& AL = front.LDense;
+    auto& ABR = front.workDense;
+    const Int n = AL.Width();
+    front.LBLR.Empty();
+    if( n < ctrl.minSize || ABR.Height() == 0 )
+    {
+        ProcessFrontVanilla( AL, ABR, front.isHermitian );
+        GetDiagonal( AL, front.diag );
+        return;
+    }
+    const Orientation orientation =
+      ( front.isHermitian ? ADJOINT : TRANSPOSE );
+
+    auto ATL = AL( IR(0,n  ), ALL );
+    auto ABL = AL( IR(n,END), ALL );
+
+    LDL( ATL, front.isHermitian );
+    GetDiagonal( ATL, front.diag );
+    Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
+    DiagonalSolve( RIGHT, NORMAL, front.diag, ABL );
+
+    blr::Compress<F>( ABL, front.LBLR, ctrl );
+    blr::SchurUpdate<F>( front.LBLR, front.diag, ABR, front.isHermitian );
+
+    // Release the dense bottom-left block
+    Matrix<F> LTL( ATL );
+    AL.Empty();
+    AL = LTL;
+}
+
 template<typename F>
-void ProcessFront( Front<F>& front, LDLFrontType factorType )
+void ProcessFront
+( Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl=BLRCtrl<Base<F>>() )
 {
     EL_DEBUG_CSE
     front.type = factorType;
@@ -163,7 +205,11 @@ void ProcessFront( Front<F>& front, LDLFrontType factorType )
           LogicError("This should not be possible");
     )
     const bool pivoted = PivotedFactorization( factorType );
-    if( BlockFactorization(factorType) )
+    if( factorType == LDL_BLR_2D )
+    {
+        ProcessFrontBLR( front, blrCtrl );
+    }
+    else if( BlockFactorization(factorType) )
     {
         ProcessFrontBlock
         ( front.LDense,
@@ -358,7 +404,46 @@ void ProcessFrontBlock
 }
 
 template<typename F>
-void ProcessFront( DistFront<F>& front, LDLFrontType factorType )
+void ProcessFrontBLR( DistFront<F>& front, const BLRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto& AL = front.L2D;
+    auto& ABR = front.work;
+    const Grid& grid = AL.Grid();
+    const Int n = AL.Width();
+    front.LBLR.Empty();
+    front.diag.SetGrid( grid );
+    if( n < ctrl.minSize || ABR.Height() == 0 )
+    {
+        ProcessFrontVanilla( AL, ABR, front.isHermitian );
+        front.diag = GetDiagonal( AL );
+        return;
+    }
+    const Orientation orientation =
+      ( front.isHermitian ? ADJOINT : TRANSPOSE );
+
+    auto ATL = AL( IR(0,n  ), ALL );
+    auto ABL = AL( IR(n,END), ALL );
+
+    LDL( ATL, front.isHermitian );
+    front.diag = GetDiagonal( ATL );
+    Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
+    DiagonalSolve( RIGHT, NORMAL, front.diag, ABL );
+
+    blr::Compress<F>( ABL, front.LBLR, ctrl );
+    blr::SchurUpdate<F>( front.LBLR, front.diag, ABR, front.isHermitian );
+
+    // Release the dense bottom-left block
+    DistMatrix<F> LTL( ATL );
+    AL.Empty();
+    AL = LTL;
+}
+
+template<typename F>
+void ProcessFront
+( DistFront<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl=BLRCtrl<Base<F>>() )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -369,7 +454,11 @@ void ProcessFront( DistFront<F>& front, LDLFrontType factorType )
     const bool pivoted = PivotedFactorization( factorType );
     const Grid& grid = front.L2D.Grid();
 
-    if( BlockFactorization(factorType) )
+    if( factorType == LDL_BLR_2D )
+    {
+        ProcessFrontBLR( front, blrCtrl );
+    }
+    else if( BlockFactorization(factorType) )
     {
         ProcessFrontBlock( front.L2D, front.work, front.isHermitian, pivoted );
     }
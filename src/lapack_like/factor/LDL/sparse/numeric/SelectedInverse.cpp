@@ -0,0 +1,453 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The selected inverse is computed with a top-down traversal of the frontal
+// tree using the supernodal Takahashi equations: if the front of supernode J
+// has the lower structure S, and Z = inv(A), then
+//
+//   Z_{S,J} = -Z_{S,S} (L_{S,J} inv(L_{J,J})),
+//   Z_{J,J} = inv(L_{J,J} D_J L_{J,J}^H) - (L_{S,J} inv(L_{J,J}))^H Z_{S,J},
+//
+// where Z_{S,S} is a (permuted) submatrix of the inverse restricted to the
+// parent's front, and the transpose replaces the adjoint in the complex
+// symmetric case.
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Overwrite 'U' with L_{BL} inv(L_{TL}) and 'W' with
+// inv(L_{TL} D L_{TL}^H), with the latter explicitly Hermitian (or
+// symmetric). 'LTL' and 'LBL' are the top and bottom of the left portion of
+// a factored front; if 'block' is true, they instead hold
+// inv(L_{TL} D L_{TL}^H) and the original A_{BL} = L_{BL} D L_{TL}^H, and
+// if 'selInv' is true, then the strictly lower portion of 'LTL' holds
+// inv(L_{TL}).
+template<typename Field,class MatrixType,class DiagType>
+void InverseFactors
+( const MatrixType& LTL,
+  const MatrixType& LBL,
+  const DiagType& d,
+  bool block,
+  bool selInv,
+  bool conjugate,
+        MatrixType& U,
+        MatrixType& W )
+{
+    EL_DEBUG_CSE
+    W = LTL;
+    if( block )
+    {
+        Gemm( NORMAL, NORMAL, Field(1), LBL, LTL, U );
+        return;
+    }
+    if( !selInv )
+        TriangularInverse( LOWER, UNIT, W );
+    U = LBL;
+    Trmm( RIGHT, LOWER, NORMAL, UNIT, Field(1), W, U );
+    SetDiagonal( W, d );
+    Trdtrmm( LOWER, W, conjugate );
+    MakeSymmetric( LOWER, W, conjugate );
+}
+
+template<typename Field>
+void SelectedInverse
+( const NodeInfo& info,
+  const Front<Field>& front,
+  const Matrix<Field>& ZSS,
+        bool diagonalOnly,
+        vector<Entry<Field>>& entries )
+{
+    EL_DEBUG_CSE
+    const Int n = info.size;
+    const Int m = info.lowerStruct.size();
+    const bool conjugate = front.isHermitian;
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    Matrix<Field> U, W;
+    if( front.sparseLeaf )
+    {
+        // Sparse leaves store the unit lower triangle of L_{TL} as a sparse
+        // matrix (indexed by column) and L_{BL} as the entire dense front
+        Matrix<Field> LTL;
+        Identity( LTL, n, n );
+        const Int numLEntries = front.LSparse.NumEntries();
+        for( Int e=0; e<numLEntries; ++e )
+            LTL( front.LSparse.Col(e), front.LSparse.Row(e) ) =
+              front.LSparse.Value(e);
+        InverseFactors<Field>
+        ( LTL, front.LDense, front.diag, false, false, conjugate, U, W );
+    }
+    else
+    {
+        if( PivotedFactorization(front.type) &&
+            !BlockFactorization(front.type) )
+            LogicError("Selected inversion does not support pivoted fronts");
+        if( front.type == LDL_BLR_2D )
+            LogicError("Selected inversion does not support BLR fronts");
+        auto LTL = front.LDense( IR(0,n), ALL );
+        auto LBL = front.LDense( IR(n,END), ALL );
+        InverseFactors<Field>
+        ( LTL, LBL, front.diag, BlockFactorization(front.type), false,
+          conjugate, U, W );
+    }
+
+    Matrix<Field> ZSJ;
+    Gemm( NORMAL, NORMAL, Field(-1), ZSS, U, ZSJ );
+    Gemm( orientation, NORMAL, Field(-1), U, ZSJ, Field(1), W );
+    U.Empty();
+
+    // Store the lower-triangular entries of the inverse on the pattern of L
+    // (with the pattern of the top-left block of sparse leaves being that of
+    // their sparse factor)
+    for( Int j=0; j<n; ++j )
+        entries.push_back( Entry<Field>{ info.off+j, info.off+j, W(j,j) } );
+    if( !diagonalOnly )
+    {
+        if( front.sparseLeaf )
+        {
+            const Int numLEntries = front.LSparse.NumEntries();
+            for( Int e=0; e<numLEntries; ++e )
+            {
+                const Int i = front.LSparse.Col(e);
+                const Int j = front.LSparse.Row(e);
+                entries.push_back
+                ( Entry<Field>{ info.off+i, info.off+j, W(i,j) } );
+            }
+        }
+        else
+        {
+            for( Int j=0; j<n; ++j )
+                for( Int i=j+1; i<n; ++i )
+                    entries.push_back
+                    ( Entry<Field>{ info.off+i, info.off+j, W(i,j) } );
+        }
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                entries.push_back
+                ( Entry<Field>{ info.lowerStruct[i], info.off+j, ZSJ(i,j) } );
+    }
+
+    // Extract the portion of the inverse over the lower structure of each
+    // child from the (implicit) inverse over our front,
+    //
+    //   | W    ZSJ^H |
+    //   | ZSJ  ZSS   |,
+    //
+    // and recurse
+    auto frontInverse = [&]( Int i, Int j )
+    {
+        if( i < n )
+        {
+            if( j < n )
+                return W(i,j);
+            else
+                return conjugate ? Conj(ZSJ(j-n,i)) : ZSJ(j-n,i);
+        }
+        else
+        {
+            if( j < n )
+                return ZSJ(i-n,j);
+            else
+                return ZSS(i-n,j-n);
+        }
+    };
+    const Int numChildren = info.children.size();
+    Matrix<Field> ZSSChild;
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const auto& relInds = info.childRelInds[c];
+        const Int mChild = relInds.size();
+        ZSSChild.Resize( mChild, mChild );
+        for( Int jChild=0; jChild<mChild; ++jChild )
+            for( Int iChild=0; iChild<mChild; ++iChild )
+                ZSSChild(iChild,jChild) =
+                  frontInverse( relInds[iChild], relInds[jChild] );
+        SelectedInverse
+        ( *info.children[c], *front.children[c], ZSSChild, diagonalOnly,
+          entries );
+    }
+}
+
+template<typename Field>
+void SelectedInverse
+( const DistNodeInfo& info,
+  const DistFront<Field>& front,
+  const DistMatrix<Field>& ZSS,
+        bool diagonalOnly,
+        vector<Entry<Field>>& entries )
+{
+    EL_DEBUG_CSE
+    // Switch to the sequential algorithm if possible
+    if( front.duplicate.get() != nullptr )
+    {
+        SelectedInverse
+        ( *info.duplicate, *front.duplicate, ZSS.LockedMatrix(),
+          diagonalOnly, entries );
+        return;
+    }
+
+    const Grid& grid = info.Grid();
+    const Int n = info.size;
+    const Int m = info.lowerStruct.size();
+    const bool conjugate = front.isHermitian;
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    if( PivotedFactorization(front.type) && !BlockFactorization(front.type) )
+        LogicError("Selected inversion does not support pivoted fronts");
+    if( front.type == LDL_BLR_2D )
+        LogicError("Selected inversion does not support BLR fronts");
+
+    DistMatrix<Field> LCopy(grid);
+    if( FrontIs1D(front.type) )
+        LCopy = front.L1D;
+    const DistMatrix<Field>& L =
+      ( FrontIs1D(front.type) ? LCopy : front.L2D );
+    auto LTL = L( IR(0,n), ALL );
+    auto LBL = L( IR(n,END), ALL );
+
+    DistMatrix<Field> U(grid), W(grid);
+    InverseFactors<Field>
+    ( LTL, LBL, front.diag, BlockFactorization(front.type),
+      SelInvFactorization(front.type), conjugate, U, W );
+    LCopy.Empty();
+
+    DistMatrix<Field> ZSJ(grid);
+    Gemm( NORMAL, NORMAL, Field(-1), ZSS, U, ZSJ );
+    Gemm( orientation, NORMAL, Field(-1), U, ZSJ, Field(1), W );
+    U.Empty();
+
+    // Store our local lower-triangular entries of the inverse
+    const Int WLocHeight = W.LocalHeight();
+    const Int WLocWidth = W.LocalWidth();
+    for( Int jLoc=0; jLoc<WLocWidth; ++jLoc )
+    {
+        const Int j = W.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<WLocHeight; ++iLoc )
+        {
+            const Int i = W.GlobalRow(iLoc);
+            if( i == j || (i > j && !diagonalOnly) )
+                entries.push_back
+                ( Entry<Field>{ info.off+i, info.off+j,
+                                W.GetLocal(iLoc,jLoc) } );
+        }
+    }
+    const Int ZSJLocHeight = ZSJ.LocalHeight();
+    const Int ZSJLocWidth = ZSJ.LocalWidth();
+    if( !diagonalOnly )
+        for( Int jLoc=0; jLoc<ZSJLocWidth; ++jLoc )
+            for( Int iLoc=0; iLoc<ZSJLocHeight; ++iLoc )
+                entries.push_back
+                ( Entry<Field>{ info.lowerStruct[ZSJ.GlobalRow(iLoc)],
+                                info.off+ZSJ.GlobalCol(jLoc),
+                                ZSJ.GetLocal(iLoc,jLoc) } );
+
+    // Each process belongs to exactly one of the two child teams. Determine
+    // the rank within our communicator of each member of each child team.
+    const auto& childInfo = *info.child;
+    const Grid& childGrid = childInfo.Grid();
+    const int myChild = ( childInfo.onLeft ? 0 : 1 );
+    mpi::Comm comm = grid.VCComm();
+    const int commSize = mpi::Size( comm );
+    int myChildRank[2] = { myChild, childGrid.VCRank() };
+    vector<int> childRanks( 2*commSize );
+    mpi::AllGather( myChildRank, 2, childRanks.data(), 2, comm );
+    vector<vector<int>> childTeams(2);
+    for( int q=0; q<commSize; ++q )
+    {
+        const int c = childRanks[2*q];
+        const int childRank = childRanks[2*q+1];
+        if( Int(childTeams[c].size()) <= childRank )
+            childTeams[c].resize( childRank+1 );
+        childTeams[c][childRank] = q;
+    }
+    vector<int> childGridHeights, childGridWidths;
+    info.GetChildGridDims( childGridHeights, childGridWidths );
+
+    // Map each index of our front to the lower structure of each child
+    vector<vector<Int>> childInds(2);
+    for( Int c=0; c<2; ++c )
+    {
+        childInds[c].resize( n+m, -1 );
+        const auto& relInds = info.childRelInds[c];
+        const Int mChild = relInds.size();
+        for( Int iChild=0; iChild<mChild; ++iChild )
+            childInds[c][relInds[iChild]] = iChild;
+    }
+
+    // Send each of our local entries of the (implicit) inverse over our front
+    // to the owners of the corresponding entries of the children's lower
+    // structures. The upper-right block is formed from the bottom-left.
+    vector<int> sendSizes( commSize, 0 );
+    auto visit = [&]( const DistMatrix<Field>& Z, Int rowOff, Int colOff,
+                      bool mirror, function<void(int,Int,Int,Field)> func )
+    {
+        const Int locHeight = Z.LocalHeight();
+        const Int locWidth = Z.LocalWidth();
+        for( Int jLoc=0; jLoc<locWidth; ++jLoc )
+        {
+            const Int j = colOff + Z.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<locHeight; ++iLoc )
+            {
+                const Int i = rowOff + Z.GlobalRow(iLoc);
+                const Field value = Z.GetLocal(iLoc,jLoc);
+                for( Int c=0; c<2; ++c )
+                {
+                    const Int iChild = childInds[c][i];
+                    const Int jChild = childInds[c][j];
+                    if( iChild < 0 || jChild < 0 )
+                        continue;
+                    const int h = childGridHeights[c];
+                    const int w = childGridWidths[c];
+                    func
+                    ( childTeams[c][(iChild % h) + (jChild % w)*h],
+                      iChild, jChild, value );
+                    if( mirror )
+                        func
+                        ( childTeams[c][(jChild % h) + (iChild % w)*h],
+                          jChild, iChild, conjugate ? Conj(value) : value );
+                }
+            }
+        }
+    };
+    auto visitAll = [&]( function<void(int,Int,Int,Field)> func )
+    {
+        visit( W, 0, 0, false, func );
+        visit( ZSJ, n, 0, true, func );
+        visit( ZSS, n, n, false, func );
+    };
+    visitAll
+    ( [&]( int q, Int, Int, Field ) { ++sendSizes[q]; } );
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendSizes, sendOffs );
+    vector<Entry<Field>> sendBuf( totalSend );
+    auto offs = sendOffs;
+    visitAll
+    ( [&]( int q, Int iChild, Int jChild, Field value )
+      { sendBuf[offs[q]++] = Entry<Field>{ iChild, jChild, value }; } );
+    W.Empty();
+    ZSJ.Empty();
+    auto recvBuf = mpi::AllToAll( sendBuf, sendSizes, sendOffs, comm );
+    SwapClear( sendBuf );
+
+    const Int mChild = info.childRelInds[myChild].size();
+    DistMatrix<Field> ZSSChild(childGrid);
+    Zeros( ZSSChild, mChild, mChild );
+    for( const auto& entry : recvBuf )
+        ZSSChild.SetLocal
+        ( ZSSChild.LocalRow(entry.i), ZSSChild.LocalCol(entry.j),
+          entry.value );
+    SwapClear( recvBuf );
+
+    SelectedInverse
+    ( childInfo, *front.child, ZSSChild, diagonalOnly, entries );
+}
+
+} // anonymous namespace
+
+} // namespace ldl
+
+template<typename Field>
+void SelectedInverse
+( const SparseLDLFactorization<Field>& factorization,
+        SparseMatrix<Field>& selInv,
+        bool diagonalOnly )
+{
+    EL_DEBUG_CSE
+    if( !factorization.Factored() )
+        LogicError("Must factor before computing a selected inverse");
+    const auto& info = factorization.NodeInfo();
+    const auto& front = factorization.Front();
+    const auto& invMap = factorization.InverseMap();
+    const Int n = invMap.size();
+
+    vector<Entry<Field>> entries;
+    Matrix<Field> ZSS;
+    ldl::SelectedInverse( info, front, ZSS, diagonalOnly, entries );
+
+    // Permute back to the original ordering and fill in the upper triangle
+    Zeros( selInv, n, n );
+    selInv.Reserve( 2*entries.size() );
+    for( const auto& entry : entries )
+    {
+        const Int i = invMap[entry.i];
+        const Int j = invMap[entry.j];
+        selInv.QueueUpdate( i, j, entry.value );
+        if( i != j )
+            selInv.QueueUpdate
+            ( j, i, front.isHermitian ? Conj(entry.value) : entry.value );
+    }
+    selInv.ProcessQueues();
+}
+
+template<typename Field>
+void SelectedInverse
+( const DistSparseLDLFactorization<Field>& factorization,
+        DistSparseMatrix<Field>& selInv,
+        bool diagonalOnly )
+{
+    EL_DEBUG_CSE
+    if( !factorization.Factored() )
+        LogicError("Must factor before computing a selected inverse");
+    const auto& info = factorization.NodeInfo();
+    const auto& front = factorization.Front();
+    const auto& invMap = factorization.InverseMap();
+    const Grid& grid = info.Grid();
+    const Int n = invMap.NumSources();
+
+    vector<Entry<Field>> entries;
+    DistMatrix<Field> ZSS(grid);
+    ldl::SelectedInverse( info, front, ZSS, diagonalOnly, entries );
+
+    // Permute back to the original ordering
+    const Int numEntries = entries.size();
+    vector<Int> inds( 2*numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        inds[2*e+0] = entries[e].i;
+        inds[2*e+1] = entries[e].j;
+    }
+    invMap.Translate( inds );
+
+    // Fill in the upper triangle
+    selInv.SetGrid( grid );
+    Zeros( selInv, n, n );
+    selInv.Reserve( 2*numEntries, 2*numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = inds[2*e+0];
+        const Int j = inds[2*e+1];
+        const Field value = entries[e].value;
+        selInv.QueueUpdate( i, j, value );
+        if( i != j )
+            selInv.QueueUpdate
+            ( j, i, front.isHermitian ? Conj(value) : value );
+    }
+    selInv.ProcessQueues();
+}
+
+#define PROTO(Field) \
+  template void SelectedInverse \
+  ( const SparseLDLFactorization<Field>& factorization, \
+          SparseMatrix<Field>& selInv, \
+          bool diagonalOnly ); \
+  template void SelectedInverse \
+  ( const DistSparseLDLFactorization<Field>& factorization, \
+          DistSparseMatrix<Field>& selInv, \
+          bool diagonalOnly );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -33,6 +33,69 @@ void DiagonalScale
   const Front<Field>& front,
         MatrixNode<Field>& B );
 
+namespace {
+
+// Overwrite 'B' with the solution to 'A X = B' while restricting the forward
+// and backward solves to the given sets of fronts (when they are non-null)
+template<typename Field>
+void PrunedSolve
+( const NodeInfo& info,
+  const Front<Field>& front,
+  const vector<Int>& invMap,
+  const ActiveFronts* forwardActive,
+  const ActiveFronts* backwardActive,
+        Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    MatrixNode<Field> BNodal( invMap, info, B );
+    LowerForwardSolve( info, front, BNodal, forwardActive );
+    if( !BlockFactorization(front.type) )
+        DiagonalSolve( info, front, BNodal );
+    LowerBackwardSolve
+    ( info, front, BNodal, front.isHermitian, backwardActive );
+    BNodal.Push( invMap, info, B );
+}
+
+// Form a dense copy of a sparse right-hand side along with the fronts on the
+// paths from its nonzero rows to the root
+template<typename Field>
+void DensifyRHS
+( const NodeInfo& info,
+  const vector<Int>& map,
+  const SparseMatrix<Field>& B,
+        Matrix<Field>& X,
+        ActiveFronts& active )
+{
+    EL_DEBUG_CSE
+    Zeros( X, B.Height(), B.Width() );
+    const Int numEntries = B.NumEntries();
+    vector<Int> inds( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        X(B.Row(e),B.Col(e)) += B.Value(e);
+        inds[e] = map[B.Row(e)];
+    }
+    MarkActivePaths( info, inds, active );
+}
+
+// Zero all of the rows of 'X' which are not listed in 'rows'
+template<typename Field>
+void ZeroUnrequestedRows( const vector<Int>& rows, Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int height = X.Height();
+    const Int width = X.Width();
+    vector<bool> requested( height, false );
+    for( const Int i : rows )
+        requested[i] = true;
+    for( Int i=0; i<height; ++i )
+        if( !requested[i] )
+            for( Int j=0; j<width; ++j )
+                X(i,j) = 0;
+}
+
+} // anonymous namespace
+
 } // namespace ldl
 
 template<typename Field>
@@ -46,6 +109,10 @@ void SparseLDLFactorization<Field>::Initialize
   const BisectCtrl& bisectCtrl )
 {
     EL_DEBUG_CSE
+    const unsigned long long orderingHash = ldl::OrderingHash( bisectCtrl );
+    if( ReuseAnalysis( A, hermitian, orderingHash ) )
+        return;
+
     info_.reset( new ldl::NodeInfo );
     separator_.reset( new ldl::Separator );
     ldl::NestedDissection
@@ -53,10 +120,44 @@ void SparseLDLFactorization<Field>::Initialize
     InvertMap( map_, inverseMap_ );
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
+    pattern_ = A.LockedGraph();
+    orderingHash_ = orderingHash;
     initialized_ = true;
     factored_ = false;
 }
 
+template<typename Field>
+bool SparseLDLFactorization<Field>::ReuseAnalysis
+( const SparseMatrix<Field>& A,
+        bool hermitian,
+        unsigned long long orderingHash )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ || orderingHash != orderingHash_ )
+        return false;
+
+    // Compare the sparsity pattern exactly
+    const Graph& graph = A.LockedGraph();
+    const Int numSources = graph.NumSources();
+    const Int numEdges = graph.NumEdges();
+    if( numSources != pattern_.NumSources() ||
+        graph.NumTargets() != pattern_.NumTargets() ||
+        numEdges != pattern_.NumEdges() )
+        return false;
+    graph.AssertConsistent();
+    if( !std::equal
+        ( graph.LockedOffsetBuffer(), graph.LockedOffsetBuffer()+numSources+1,
+          pattern_.LockedOffsetBuffer() ) ||
+        !std::equal
+        ( graph.LockedTargetBuffer(), graph.LockedTargetBuffer()+numEdges,
+          pattern_.LockedTargetBuffer() ) )
+        return false;
+
+    front_->Pull( A, map_, *info_, hermitian );
+    factored_ = false;
+    return true;
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::Initialize2DGridGraph
 ( Int gridDim0,
@@ -74,6 +175,9 @@ void SparseLDLFactorization<Field>::Initialize2DGridGraph
     InvertMap( map_, inverseMap_ );
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
+    pattern_ = A.LockedGraph();
+    orderingHash_ =
+      ldl::NaturalOrderingHash( gridDim0, gridDim1, 1, bisectCtrl.cutoff );
     initialized_ = true;
     factored_ = false;
 }
@@ -96,6 +200,10 @@ void SparseLDLFactorization<Field>::Initialize3DGridGraph
     InvertMap( map_, inverseMap_ );
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
+    pattern_ = A.LockedGraph();
+    orderingHash_ =
+      ldl::NaturalOrderingHash
+      ( gridDim0, gridDim1, gridDim2, bisectCtrl.cutoff );
     initialized_ = true;
     factored_ = false;
 }
@@ -115,7 +223,8 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     ChangeFrontType( SYMM_2D );
     
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), blrCtrl_ );
     factored_ = true;
     
     // Convert the fronts from the initial factorization to the requested form
@@ -148,10 +257,99 @@ void SparseLDLFactorization<Field>::Solve( Matrix<Field>& B ) const
     EL_DEBUG_CSE
     if( !factored_ )
         LogicError("Must call Factor() before Solve()");
-    // TODO(poulson): Reuse a single MatrixNode data structure?
-    ldl::MatrixNode<Field> BNodal( inverseMap_, *info_, B );
-    Solve( BNodal );
-    BNodal.Push( inverseMap_, *info_, B );
+    const Int height = B.Height();
+    const Int width = B.Width();
+    const Int blockWidth =
+      ldl::SolveBlockWidth<Field>
+      ( solveBlockWidth_, 3*height+ldl::MaxFrontHeight(*info_) );
+    if( width <= blockWidth )
+    {
+        ldl::MatrixNode<Field> BNodal( inverseMap_, *info_, B );
+        Solve( BNodal );
+        BNodal.Push( inverseMap_, *info_, B );
+        return;
+    }
+
+    // Solve against one block of columns at a time, reusing the nodal
+    // data structure
+    ldl::MatrixNode<Field> BNodal;
+    for( Int jOff=0; jOff<width; jOff+=blockWidth )
+    {
+        const Int nb = Min( blockWidth, width-jOff );
+        auto BBlock = B( ALL, IR(jOff,jOff+nb) );
+        BNodal.Pull( inverseMap_, *info_, BBlock );
+        Solve( BNodal );
+        BNodal.Push( inverseMap_, *info_, BBlock );
+    }
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::SetSolveBlockWidth( Int blockWidth )
+{
+    EL_DEBUG_CSE
+    if( blockWidth < 0 )
+        LogicError("The solve block width must be non-negative");
+    solveBlockWidth_ = blockWidth;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::SetBLRCtrl
+( const BLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.tileSize <= 0 )
+        LogicError("The BLR tile size must be positive");
+    blrCtrl_ = ctrl;
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::Solve
+( const SparseMatrix<Field>& B, Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    ldl::ActiveFronts forwardActive;
+    ldl::DensifyRHS( *info_, map_, B, X, forwardActive );
+    ldl::PrunedSolve
+    ( *info_, *front_, inverseMap_, &forwardActive, nullptr, X );
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::Solve
+( const SparseMatrix<Field>& B,
+  const vector<Int>& outputRows,
+        Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    ldl::ActiveFronts forwardActive, backwardActive;
+    ldl::DensifyRHS( *info_, map_, B, X, forwardActive );
+    vector<Int> outputInds( outputRows.size() );
+    for( size_t k=0; k<outputRows.size(); ++k )
+        outputInds[k] = map_[outputRows[k]];
+    ldl::MarkActivePaths( *info_, outputInds, backwardActive );
+    ldl::PrunedSolve
+    ( *info_, *front_, inverseMap_, &forwardActive, &backwardActive, X );
+    ldl::ZeroUnrequestedRows( outputRows, X );
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::Solve
+( Matrix<Field>& B, const vector<Int>& outputRows ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Solve()");
+    ldl::ActiveFronts backwardActive;
+    vector<Int> outputInds( outputRows.size() );
+    for( size_t k=0; k<outputRows.size(); ++k )
+        outputInds[k] = map_[outputRows[k]];
+    ldl::MarkActivePaths( *info_, outputInds, backwardActive );
+    ldl::PrunedSolve
+    ( *info_, *front_, inverseMap_, nullptr, &backwardActive, B );
+    ldl::ZeroUnrequestedRows( outputRows, B );
 }
 
 template<typename Field>
@@ -396,6 +594,15 @@ double SparseLDLFactorization<Field>::SolveGFlops( Int numRHS ) const
     return front_->SolveGFlops( numRHS );
 }
 
+template<typename Field>
+InertiaType SparseLDLFactorization<Field>::Inertia() const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must factor before calling 'Inertia()'");
+    return front_->Inertia();
+}
+
 template<typename Field>
 ldl::Front<Field>& SparseLDLFactorization<Field>::Front()
 {
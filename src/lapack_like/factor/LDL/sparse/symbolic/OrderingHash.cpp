@@ -0,0 +1,61 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Combine a value into a running hash using the SplitMix64 finalizer
+inline unsigned long long
+HashCombine( unsigned long long hash, unsigned long long value )
+{
+    unsigned long long x = hash ^ (value + 0x9e3779b97f4a7c15ULL);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+} // anonymous namespace
+
+unsigned long long OrderingHash( const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    unsigned long long imbalanceBits;
+    static_assert
+    ( sizeof(imbalanceBits) == sizeof(ctrl.maxImbalance),
+      "Expected a 64-bit double" );
+    std::memcpy( &imbalanceBits, &ctrl.maxImbalance, sizeof(imbalanceBits) );
+
+    unsigned long long hash = HashCombine( 0, 0 );
+    hash = HashCombine( hash, ctrl.sequential );
+    hash = HashCombine( hash, ctrl.numDistSeps );
+    hash = HashCombine( hash, ctrl.numSeqSeps );
+    hash = HashCombine( hash, ctrl.cutoff );
+    hash = HashCombine( hash, ctrl.storeFactRecvInds );
+    hash = HashCombine( hash, ctrl.native );
+    return HashCombine( hash, imbalanceBits );
+}
+
+unsigned long long NaturalOrderingHash
+( Int gridDim0, Int gridDim1, Int gridDim2, Int cutoff )
+{
+    EL_DEBUG_CSE
+    // Start from a different seed than 'OrderingHash' so that the natural
+    // orderings are distinguished from the general nested dissections
+    unsigned long long hash = HashCombine( 0, 1 );
+    hash = HashCombine( hash, gridDim0 );
+    hash = HashCombine( hash, gridDim1 );
+    hash = HashCombine( hash, gridDim2 );
+    return HashCombine( hash, cutoff );
+}
+
+} // namespace ldl
+} // namespace El
@@ -16,6 +16,7 @@
 #include "./QR/Explicit.hpp"
 
 #include "./QR/ColSwap.hpp"
+#include "./QR/Mod.hpp"
 
 #include "./QR/TS.hpp"
 
@@ -123,6 +124,22 @@ void QR
     AbstractDistMatrix<Base<F>>& signature, \
     DistPermutation& Omega, \
     const QRCtrl<Base<F>>& ctrl ); \
+  template void QRAppendColumns \
+  (       Matrix<F>& Q, \
+          Matrix<F>& R, \
+    const Matrix<F>& C ); \
+  template void QRAppendColumns \
+  (       AbstractDistMatrix<F>& Q, \
+          AbstractDistMatrix<F>& R, \
+    const AbstractDistMatrix<F>& C ); \
+  template void QRDeleteColumns \
+  (       Matrix<F>& Q, \
+          Matrix<F>& R, \
+    const vector<Int>& deletions ); \
+  template void QRDeleteColumns \
+  (       AbstractDistMatrix<F>& Q, \
+          AbstractDistMatrix<F>& R, \
+    const vector<Int>& deletions ); \
   template void qr::ExplicitTriang \
   ( Matrix<F>& A, const QRCtrl<Base<F>>& ctrl ); \
   template void qr::ExplicitTriang \
@@ -195,6 +212,14 @@ void QR
   template void qr::Cholesky \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& R ); \
+  template CholeskyQRVariant qr::Cholesky \
+  ( Matrix<F>& A, \
+    Matrix<F>& R, \
+    CholeskyQRVariant variant ); \
+  template CholeskyQRVariant qr::Cholesky \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R, \
+    CholeskyQRVariant variant ); \
   template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
   template void qr::ExplicitTS \
   ( AbstractDistMatrix<F>& A, \
@@ -51,6 +51,142 @@ void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
     Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
 }
 
+namespace chol_qr {
+
+// Overwrite A with A inv(R), where R is the upper-triangular Cholesky factor of
+// the Gram matrix A^H A (which is summed over the rows distributed over
+// 'comm'), and then accumulate R into the triangular factor RAcc := R RAcc
+template<typename F>
+void Pass( Matrix<F>& A, Matrix<F>& RAcc, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    Matrix<F> R;
+    Zeros( R, n, n );
+    Herk( UPPER, ADJOINT, Base<F>(1), A, Base<F>(0), R );
+    El::AllReduce( R, comm );
+    El::Cholesky( UPPER, R );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A );
+    Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R, RAcc );
+}
+
+// Estimate the loss of orthogonality, || I - Q^H Q ||_2, of a single
+// CholeskyQR pass from the triangular factor R, which has the same condition
+// number as A
+template<typename F>
+Base<F> OrthogLossEstimate( const Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real kappa = TwoCondition( R );
+    return R.Height()*kappa*kappa*eps;
+}
+
+// 'A' holds the local rows of the tall-skinny matrix, whose global height is
+// 'm', and 'comm' is the communicator the rows are distributed over
+template<typename F>
+CholeskyQRVariant Helper
+( Matrix<F>& A,
+  Matrix<F>& R,
+  Int m,
+  mpi::Comm comm,
+  CholeskyQRVariant variant )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> G;
+    Zeros( G, n, n );
+    Herk( UPPER, ADJOINT, Real(1), A, Real(0), G );
+    El::AllReduce( G, comm );
+
+    if( variant == CHOLESKY_QR_ADAPTIVE )
+    {
+        // The second pass of CholeskyQR2 is only reliable if the first pass
+        // did not lose (almost) all orthogonality
+        R = G;
+        try
+        {
+            El::Cholesky( UPPER, R );
+            if( OrthogLossEstimate( R ) < Real(1)/Real(2) )
+                variant = CHOLESKY_QR2;
+            else
+                variant = SHIFTED_CHOLESKY_QR3;
+        }
+        catch( NonHPDMatrixException& )
+        {
+            variant = SHIFTED_CHOLESKY_QR3;
+        }
+    }
+    else if( variant != SHIFTED_CHOLESKY_QR3 )
+    {
+        R = G;
+        El::Cholesky( UPPER, R );
+    }
+
+    if( variant == SHIFTED_CHOLESKY_QR3 )
+    {
+        // Shift by 11 (m n + n (n+1)) eps || A ||_2^2, as suggested by
+        // Fukaya et al., but with || A ||_2^2 bounded by || A ||_F^2 = tr(G)
+        Real frobSquared = 0;
+        for( Int j=0; j<n; ++j )
+            frobSquared += RealPart(G(j,j));
+        const Real shift = 11*(Real(m)*n + Real(n)*(n+1))*eps*frobSquared;
+        R = G;
+        ShiftDiagonal( R, F(shift) );
+        El::Cholesky( UPPER, R );
+    }
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R, A );
+
+    if( variant == CHOLESKY_QR2 )
+    {
+        Pass( A, R, comm );
+    }
+    else if( variant == SHIFTED_CHOLESKY_QR3 )
+    {
+        Pass( A, R, comm );
+        Pass( A, R, comm );
+    }
+    return variant;
+}
+
+} // namespace chol_qr
+
+template<typename F>
+CholeskyQRVariant Cholesky
+( Matrix<F>& A, Matrix<F>& R, CholeskyQRVariant variant )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    if( m < A.Width() )
+        LogicError("A^H A will be singular");
+    return chol_qr::Helper( A, R, m, mpi::COMM_SELF, variant );
+}
+
+template<typename F>
+CholeskyQRVariant Cholesky
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& RPre,
+  CholeskyQRVariant variant )
+{
+    EL_DEBUG_CSE
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    if( m < n )
+        LogicError("A^H A will be singular");
+
+    DistMatrixReadWriteProxy<F,F,VC,STAR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
+    auto& A = AProx.Get();
+    auto& R = RProx.Get();
+
+    R.Resize( n, n );
+    return chol_qr::Helper( A.Matrix(), R.Matrix(), m, A.ColComm(), variant );
+}
+
 } // namespace qr
 } // namespace El
 
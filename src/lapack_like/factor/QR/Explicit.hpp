@@ -12,10 +12,24 @@
 namespace El {
 namespace qr {
 
+// CholeskyQR only produces the thin Q factor of unpivoted factorizations of
+// matrices with at least as many rows as columns
+template<typename Real>
+bool UseCholesky( Int m, Int n, bool thinQR, const QRCtrl<Real>& ctrl )
+{ return ctrl.cholesky && !ctrl.colPiv && thinQR && m >= n; }
+
 template<typename F>
 void ExplicitTriang( Matrix<F>& A, const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( UseCholesky( A.Height(), A.Width(), true, ctrl ) )
+    {
+        Matrix<F> R;
+        Cholesky( A, R, ctrl.cholVariant );
+        A = R;
+        return;
+    }
+
     Matrix<F> householderScalars;
     Matrix<Base<F>> signature;
     if( ctrl.colPiv )
@@ -34,6 +48,14 @@ template<typename F>
 void ExplicitTriang( AbstractDistMatrix<F>& A, const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( UseCholesky( A.Height(), A.Width(), true, ctrl ) )
+    {
+        DistMatrix<F,STAR,STAR> R(A.Grid());
+        Cholesky( A, R, ctrl.cholVariant );
+        Copy( R, A );
+        return;
+    }
+
     DistMatrix<F,MD,STAR> householderScalars(A.Grid());
     DistMatrix<Base<F>,MD,STAR> signature(A.Grid());
     if( ctrl.colPiv )
@@ -53,6 +75,13 @@ void ExplicitUnitary
 ( Matrix<F>& A, bool thinQR, const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( UseCholesky( A.Height(), A.Width(), thinQR, ctrl ) )
+    {
+        Matrix<F> R;
+        Cholesky( A, R, ctrl.cholVariant );
+        return;
+    }
+
     Matrix<F> householderScalars;
     Matrix<Base<F>> signature;
     if( ctrl.colPiv )
@@ -84,6 +113,12 @@ void ExplicitUnitary
 ( AbstractDistMatrix<F>& APre, bool thinQR, const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( UseCholesky( APre.Height(), APre.Width(), thinQR, ctrl ) )
+    {
+        DistMatrix<F,STAR,STAR> R(APre.Grid());
+        Cholesky( APre, R, ctrl.cholVariant );
+        return;
+    }
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -123,6 +158,12 @@ void Explicit
   const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( UseCholesky( A.Height(), A.Width(), thinQR, ctrl ) )
+    {
+        Cholesky( A, R, ctrl.cholVariant );
+        return;
+    }
+
     Matrix<F> householderScalars;
     Matrix<Base<F>> signature;
     if( ctrl.colPiv )
@@ -165,6 +206,11 @@ void Explicit
   const QRCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( UseCholesky( APre.Height(), APre.Width(), thinQR, ctrl ) )
+    {
+        Cholesky( APre, R, ctrl.cholVariant );
+        return;
+    }
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
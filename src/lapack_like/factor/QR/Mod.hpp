@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_MOD_HPP
+#define EL_QR_MOD_HPP
+
+// Updates of a thin QR factorization, A = Q R, where Q is m x n with
+// orthonormal columns and R is n x n and upper-triangular, after appending or
+// deleting columns of A. Both require O((m+n) n k) work for k columns, rather
+// than the O(m n^2) work of a refactorization.
+
+namespace El {
+namespace qr {
+namespace mod {
+
+// Restore the upper-triangularity of R, whose j'th column is assumed to be zero
+// below row lastRow[j] (with lastRow non-decreasing), using Householder
+// transformations over panels of columns, and apply them to the columns of Q
+template<typename F>
+void Retriangularize
+( Matrix<F>& Q,
+  Matrix<F>& R,
+  const vector<Int>& lastRow,
+  Int firstCol )
+{
+    EL_DEBUG_CSE
+    const Int n = R.Width();
+    Matrix<F> householderScalars;
+    Matrix<Base<F>> signature;
+    const Int bsize = Blocksize();
+    for( Int k=firstCol; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int rowEnd = Min( lastRow[k+nb-1]+1, R.Height() );
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, n ), indR( k, rowEnd );
+
+        auto RPan = R( indR, ind1 );
+        auto RRight = R( indR, ind2 );
+        auto QPan = Q( ALL, indR );
+        QR( RPan, householderScalars, signature );
+        ApplyQ( LEFT, ADJOINT, RPan, householderScalars, signature, RRight );
+        ApplyQ( RIGHT, NORMAL, RPan, householderScalars, signature, QPan );
+        MakeTrapezoidal( UPPER, RPan );
+    }
+}
+
+template<typename F>
+void Retriangularize
+( DistMatrix<F>& Q,
+  DistMatrix<F>& R,
+  const vector<Int>& lastRow,
+  Int firstCol )
+{
+    EL_DEBUG_CSE
+    const Int n = R.Width();
+    const Grid& g = R.Grid();
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    const Int bsize = Blocksize();
+    for( Int k=firstCol; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int rowEnd = Min( lastRow[k+nb-1]+1, R.Height() );
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, n ), indR( k, rowEnd );
+
+        auto RPan = R( indR, ind1 );
+        auto RRight = R( indR, ind2 );
+        auto QPan = Q( ALL, indR );
+        QR( RPan, householderScalars, signature );
+        ApplyQ( LEFT, ADJOINT, RPan, householderScalars, signature, RRight );
+        ApplyQ( RIGHT, NORMAL, RPan, householderScalars, signature, QPan );
+        MakeTrapezoidal( UPPER, RPan );
+    }
+}
+
+// Return the (sorted) indices of the columns which are kept, and the first
+// deleted index
+inline Int KeptColumns
+( Int n, const vector<Int>& deletions, vector<Int>& kept )
+{
+    EL_DEBUG_CSE
+    vector<Int> sortedDels( deletions );
+    std::sort( sortedDels.begin(), sortedDels.end() );
+    for( size_t l=0; l<sortedDels.size(); ++l )
+    {
+        if( sortedDels[l] < 0 || sortedDels[l] >= n )
+            LogicError("Column index ",sortedDels[l]," was out of bounds");
+        if( l > 0 && sortedDels[l] == sortedDels[l-1] )
+            LogicError("Column index ",sortedDels[l]," was repeated");
+    }
+    kept.resize( 0 );
+    kept.reserve( n-sortedDels.size() );
+    Int l = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        if( l < Int(sortedDels.size()) && sortedDels[l] == j )
+            ++l;
+        else
+            kept.push_back( j );
+    }
+    return ( sortedDels.empty() ? n : sortedDels[0] );
+}
+
+} // namespace mod
+} // namespace qr
+
+template<typename F>
+void QRAppendColumns
+( Matrix<F>& Q,
+  Matrix<F>& R,
+  const Matrix<F>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = Q.Height();
+    const Int n = Q.Width();
+    const Int k = C.Width();
+    if( R.Height() != n || R.Width() != n )
+        LogicError("R must be ",n," x ",n);
+    if( C.Height() != m )
+        LogicError("C must have the same height as Q");
+    if( n+k > m )
+        LogicError("Cannot append ",k," columns to an ",m," x ",n," Q");
+
+    // Orthogonalize C against Q twice (CGS2) and then factor the remainder
+    Matrix<F> S, SCorr, C2( C ), R22;
+    Gemm( ADJOINT, NORMAL, F(1), Q, C2, S );
+    Gemm( NORMAL, NORMAL, F(-1), Q, S, F(1), C2 );
+    Gemm( ADJOINT, NORMAL, F(1), Q, C2, SCorr );
+    Gemm( NORMAL, NORMAL, F(-1), Q, SCorr, F(1), C2 );
+    S += SCorr;
+    qr::Explicit( C2, R22 );
+
+    const Range<Int> ind1( 0, n ), ind2( n, n+k );
+    Matrix<F> QNew, RNew;
+    Zeros( QNew, m, n+k );
+    Zeros( RNew, n+k, n+k );
+    auto QNew1 = QNew( ALL, ind1 );
+    auto QNew2 = QNew( ALL, ind2 );
+    auto RNew11 = RNew( ind1, ind1 );
+    auto RNew12 = RNew( ind1, ind2 );
+    auto RNew22 = RNew( ind2, ind2 );
+    QNew1 = Q;
+    QNew2 = C2;
+    RNew11 = R;
+    RNew12 = S;
+    RNew22 = R22;
+    Q = QNew;
+    R = RNew;
+}
+
+template<typename F>
+void QRAppendColumns
+( AbstractDistMatrix<F>& QPre,
+  AbstractDistMatrix<F>& RPre,
+  const AbstractDistMatrix<F>& CPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( QPre, RPre, CPre ))
+    const Int m = QPre.Height();
+    const Int n = QPre.Width();
+    const Int k = CPre.Width();
+    if( RPre.Height() != n || RPre.Width() != n )
+        LogicError("R must be ",n," x ",n);
+    if( CPre.Height() != m )
+        LogicError("C must have the same height as Q");
+    if( n+k > m )
+        LogicError("Cannot append ",k," columns to an ",m," x ",n," Q");
+    const Grid& g = QPre.Grid();
+
+    const Range<Int> ind1( 0, n ), ind2( n, n+k );
+    DistMatrix<F> QNew(g), RNew(g);
+    Zeros( QNew, m, n+k );
+    Zeros( RNew, n+k, n+k );
+    auto QNew1 = QNew( ALL, ind1 );
+    auto QNew2 = QNew( ALL, ind2 );
+    auto RNew11 = RNew( ind1, ind1 );
+    auto RNew12 = RNew( ind1, ind2 );
+    auto RNew22 = RNew( ind2, ind2 );
+    Copy( QPre, QNew1 );
+    Copy( CPre, QNew2 );
+    Copy( RPre, RNew11 );
+
+    // Orthogonalize C against Q twice (CGS2) and then factor the remainder
+    DistMatrix<F> SCorr(g), R22(g);
+    Gemm( ADJOINT, NORMAL, F(1), QNew1, QNew2, RNew12 );
+    Gemm( NORMAL, NORMAL, F(-1), QNew1, RNew12, F(1), QNew2 );
+    Gemm( ADJOINT, NORMAL, F(1), QNew1, QNew2, SCorr );
+    Gemm( NORMAL, NORMAL, F(-1), QNew1, SCorr, F(1), QNew2 );
+    RNew12 += SCorr;
+    qr::Explicit( QNew2, R22 );
+    RNew22 = R22;
+
+    Copy( QNew, QPre );
+    Copy( RNew, RPre );
+}
+
+template<typename F>
+void QRDeleteColumns
+( Matrix<F>& Q,
+  Matrix<F>& R,
+  const vector<Int>& deletions )
+{
+    EL_DEBUG_CSE
+    const Int n = Q.Width();
+    if( R.Height() != n || R.Width() != n )
+        LogicError("R must be ",n," x ",n);
+    vector<Int> kept;
+    const Int firstCol = qr::mod::KeptColumns( n, deletions, kept );
+    const Int nNew = kept.size();
+
+    Matrix<F> RDel;
+    GetSubmatrix( R, IR(0,n), kept, RDel );
+    qr::mod::Retriangularize( Q, RDel, kept, firstCol );
+    Q.Resize( Q.Height(), nNew );
+    R = RDel( IR(0,nNew), ALL );
+}
+
+template<typename F>
+void QRDeleteColumns
+( AbstractDistMatrix<F>& QPre,
+  AbstractDistMatrix<F>& RPre,
+  const vector<Int>& deletions )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(AssertSameGrids( QPre, RPre ))
+    const Int n = QPre.Width();
+    if( RPre.Height() != n || RPre.Width() != n )
+        LogicError("R must be ",n," x ",n);
+    vector<Int> kept;
+    const Int firstCol = qr::mod::KeptColumns( n, deletions, kept );
+    const Int nNew = kept.size();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> QProx( QPre );
+    auto& Q = QProx.Get();
+    DistMatrix<F> RDel(QPre.Grid());
+    GetSubmatrix( RPre, IR(0,n), kept, RDel );
+    qr::mod::Retriangularize( Q, RDel, kept, firstCol );
+    Q.Resize( Q.Height(), nNew );
+    Copy( RDel( IR(0,nNew), ALL ), RPre );
+}
+
+} // namespace El
+
+#endif // ifndef EL_QR_MOD_HPP
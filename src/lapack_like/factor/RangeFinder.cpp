@@ -0,0 +1,408 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// See Algorithm 4.4 of
+//
+//   N. Halko, P.G. Martinsson, and J.A. Tropp,
+//   "Finding structure with randomness: Probabilistic algorithms for
+//   constructing approximate matrix decompositions", SIAM Review, 53(2), 2011.
+//
+// and Section 4.6 of the same paper for the Subsampled Randomized Hadamard
+// Transform (SRHT).
+
+namespace El {
+
+namespace range_finder {
+
+// Overwrite x with its (unnormalized) Walsh-Hadamard transform, where the
+// length N must be a power of two
+template<typename F>
+void WalshHadamard( F* x, Int N )
+{
+    for( Int h=1; h<N; h*=2 )
+    {
+        for( Int i=0; i<N; i+=2*h )
+        {
+            for( Int j=i; j<i+h; ++j )
+            {
+                const F alpha = x[j];
+                const F beta = x[j+h];
+                x[j] = alpha + beta;
+                x[j+h] = alpha - beta;
+            }
+        }
+    }
+}
+
+// Draw the random signs and samples of an SRHT of order n (padded to N) on the
+// root of 'comm' so that every process applies the same transform
+inline Int DrawSRHT
+( Int n, Int numSamples, vector<Int>& signs, vector<Int>& samples,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    Int N = 1;
+    while( N < n )
+        N *= 2;
+    signs.resize( n );
+    samples.resize( numSamples );
+    if( mpi::Rank(comm) == 0 )
+    {
+        for( Int j=0; j<n; ++j )
+            signs[j] = ( SampleUniform<Int>(0,2) == 0 ? -1 : 1 );
+
+        // Sample without replacement via a partial Fisher-Yates shuffle
+        vector<Int> candidates( N );
+        for( Int j=0; j<N; ++j )
+            candidates[j] = j;
+        for( Int t=0; t<numSamples; ++t )
+        {
+            std::swap( candidates[t], candidates[SampleUniform<Int>(t,N)] );
+            samples[t] = candidates[t];
+        }
+    }
+    mpi::Broadcast( signs.data(), n, 0, comm );
+    mpi::Broadcast( samples.data(), numSamples, 0, comm );
+    return N;
+}
+
+// Form Y := A D H S one row at a time, where A contains complete rows.
+// The usual scaling of sqrt(N/numSamples) is omitted since only the range of
+// Y is of interest.
+template<typename F>
+void LocalSRHT
+( const Matrix<F>& A,
+        Matrix<F>& Y,
+  const vector<Int>& signs,
+  const vector<Int>& samples,
+        Int N )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numSamples = samples.size();
+    Y.Resize( m, numSamples );
+    vector<F> row( N );
+    for( Int i=0; i<m; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+            row[j] = F(signs[j])*A(i,j);
+        for( Int j=n; j<N; ++j )
+            row[j] = 0;
+        WalshHadamard( row.data(), N );
+        for( Int t=0; t<numSamples; ++t )
+            Y(i,t) = row[samples[t]];
+    }
+}
+
+template<typename F>
+void Sketch
+( Orientation orientation,
+  const Matrix<F>& A,
+        Matrix<F>& Y,
+        Int numSamples,
+        SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( sketch == SRHT_SKETCH )
+    {
+        vector<Int> signs, samples;
+        if( orientation == NORMAL )
+        {
+            const Int N =
+              DrawSRHT( n, numSamples, signs, samples, mpi::COMM_SELF );
+            LocalSRHT( A, Y, signs, samples, N );
+        }
+        else
+        {
+            Matrix<F> AOp;
+            Transpose( A, AOp, orientation == ADJOINT );
+            const Int N =
+              DrawSRHT( m, numSamples, signs, samples, mpi::COMM_SELF );
+            LocalSRHT( AOp, Y, signs, samples, N );
+        }
+    }
+    else
+    {
+        Matrix<F> Omega;
+        Gaussian( Omega, (orientation==NORMAL ? n : m), numSamples );
+        Gemm( orientation, NORMAL, F(1), A, Omega, Y );
+    }
+}
+
+template<typename F>
+void Sketch
+( Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+        DistMatrix<F>& Y,
+        Int numSamples,
+        SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( sketch == SRHT_SKETCH )
+    {
+        // Each process transforms complete rows of op(A)
+        DistMatrix<F,VC,STAR> AOp(g);
+        if( orientation == NORMAL )
+            AOp = A;
+        else
+            Transpose( A, AOp, orientation == ADJOINT );
+        vector<Int> signs, samples;
+        const Int N =
+          DrawSRHT( AOp.Width(), numSamples, signs, samples, g.Comm() );
+        DistMatrix<F,VC,STAR> Y_VC_STAR(g);
+        Y_VC_STAR.AlignWith( AOp );
+        Y_VC_STAR.Resize( AOp.Height(), numSamples );
+        LocalSRHT
+        ( AOp.LockedMatrix(), Y_VC_STAR.Matrix(), signs, samples, N );
+        Y = Y_VC_STAR;
+    }
+    else
+    {
+        DistMatrix<F> Omega(g);
+        Gaussian( Omega, (orientation==NORMAL ? n : m), numSamples );
+        Gemm( orientation, NORMAL, F(1), A, Omega, Y );
+    }
+}
+
+template<typename F>
+void Sketch
+( Orientation orientation,
+  const SparseMatrix<F>& A,
+        Matrix<F>& Y,
+        Int numSamples,
+        SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Matrix<F> Omega;
+    Gaussian( Omega, (orientation==NORMAL ? n : m), numSamples );
+    Zeros( Y, (orientation==NORMAL ? m : n), numSamples );
+    Multiply( orientation, F(1), A, Omega, F(0), Y );
+}
+
+template<typename F>
+void Sketch
+( Orientation orientation,
+  const DistSparseMatrix<F>& A,
+        DistMultiVec<F>& Y,
+        Int numSamples,
+        SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    DistMultiVec<F> Omega(A.Grid());
+    Gaussian( Omega, (orientation==NORMAL ? n : m), numSamples );
+    Y.SetGrid( A.Grid() );
+    Zeros( Y, (orientation==NORMAL ? m : n), numSamples );
+    Multiply( orientation, F(1), A, Omega, F(0), Y );
+}
+
+template<typename F>
+void Apply
+( Orientation orientation, const Matrix<F>& A, const Matrix<F>& X,
+  Matrix<F>& Y )
+{ Gemm( orientation, NORMAL, F(1), A, X, Y ); }
+
+template<typename F>
+void Apply
+( Orientation orientation, const AbstractDistMatrix<F>& A,
+  const DistMatrix<F>& X, DistMatrix<F>& Y )
+{ Gemm( orientation, NORMAL, F(1), A, X, Y ); }
+
+template<typename F>
+void Apply
+( Orientation orientation, const SparseMatrix<F>& A, const Matrix<F>& X,
+  Matrix<F>& Y )
+{
+    Zeros( Y, (orientation==NORMAL ? A.Height() : A.Width()), X.Width() );
+    Multiply( orientation, F(1), A, X, F(0), Y );
+}
+
+template<typename F>
+void Apply
+( Orientation orientation, const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+{
+    Y.SetGrid( A.Grid() );
+    Zeros( Y, (orientation==NORMAL ? A.Height() : A.Width()), X.Width() );
+    Multiply( orientation, F(1), A, X, F(0), Y );
+}
+
+template<typename F>
+void ConjugateBlock( Matrix<F>& Y )
+{ Conjugate( Y ); }
+
+template<typename F>
+void ConjugateBlock( DistMatrix<F>& Y )
+{ Conjugate( Y ); }
+
+template<typename F>
+void ConjugateBlock( DistMultiVec<F>& Y )
+{ Conjugate( Y.Matrix() ); }
+
+// Overwrite Z with op(A)^H Q. Since (A^T)^H = conj(A), the transposed case
+// conjugates Q before, and the product after, applying A itself.
+template<typename MatType,typename BlockType>
+void ApplyAdjoint
+( Orientation orientation, const MatType& A, BlockType& Q, BlockType& Z )
+{
+    if( orientation == NORMAL )
+    {
+        Apply( ADJOINT, A, Q, Z );
+    }
+    else if( orientation == ADJOINT )
+    {
+        Apply( NORMAL, A, Q, Z );
+    }
+    else
+    {
+        ConjugateBlock( Q );
+        Apply( NORMAL, A, Q, Z );
+        ConjugateBlock( Q );
+        ConjugateBlock( Z );
+    }
+}
+
+template<typename F>
+void Orthonormalize( Matrix<F>& Y, const QRCtrl<Base<F>>& ctrl )
+{ qr::ExplicitUnitary( Y, true, ctrl ); }
+
+template<typename F>
+void Orthonormalize( DistMatrix<F>& Y, const QRCtrl<Base<F>>& ctrl )
+{ qr::ExplicitUnitary( Y, true, ctrl ); }
+
+template<typename F>
+void Orthonormalize( DistMultiVec<F>& Y, const QRCtrl<Base<F>>& ctrl )
+{
+    DistMatrix<F,VC,STAR> Y_VC_STAR(Y.Grid());
+    Copy( Y, Y_VC_STAR );
+    qr::ExplicitUnitary( Y_VC_STAR, true, ctrl );
+    Copy( Y_VC_STAR, Y );
+}
+
+template<typename MatType,typename BlockType,typename Real>
+void Helper
+( Orientation orientation,
+  const MatType& A,
+        BlockType& Q,
+  const RandomizedCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int minDim = Min( A.Height(), A.Width() );
+    const Int numSamples = Min( ctrl.rank+ctrl.oversample, minDim );
+    if( ctrl.rank <= 0 || ctrl.oversample < 0 )
+        LogicError("Invalid target rank or oversampling amount");
+
+    // Only the range of each block is needed, so column pivoting (which
+    // would permute the columns of Q) is disabled
+    auto qrCtrl = ctrl.qrCtrl;
+    qrCtrl.colPiv = false;
+
+    Sketch( orientation, A, Q, numSamples, ctrl.sketch );
+    Orthonormalize( Q, qrCtrl );
+
+    // Each subspace iteration multiplies by op(A) op(A)^H, but orthonormalizes
+    // after each application to avoid losing the smaller singular vectors
+    BlockType Z(Q);
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        ApplyAdjoint( orientation, A, Q, Z );
+        Orthonormalize( Z, qrCtrl );
+        Apply( orientation, A, Z, Q );
+        Orthonormalize( Q, qrCtrl );
+    }
+}
+
+} // namespace range_finder
+
+template<typename F>
+void RangeFinder
+( Orientation orientation,
+  const Matrix<F>& A,
+        Matrix<F>& Q,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    range_finder::Helper( orientation, A, Q, ctrl );
+}
+
+template<typename F>
+void RangeFinder
+( Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& Q,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F> QMCMR(A.Grid());
+    range_finder::Helper( orientation, A, QMCMR, ctrl );
+    Copy( QMCMR, Q );
+}
+
+template<typename F>
+void RangeFinder
+( Orientation orientation,
+  const SparseMatrix<F>& A,
+        Matrix<F>& Q,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    range_finder::Helper( orientation, A, Q, ctrl );
+}
+
+template<typename F>
+void RangeFinder
+( Orientation orientation,
+  const DistSparseMatrix<F>& A,
+        DistMultiVec<F>& Q,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    range_finder::Helper( orientation, A, Q, ctrl );
+}
+
+#define PROTO(F) \
+  template void RangeFinder \
+  ( Orientation orientation, \
+    const Matrix<F>& A, \
+          Matrix<F>& Q, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RangeFinder \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& Q, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RangeFinder \
+  ( Orientation orientation, \
+    const SparseMatrix<F>& A, \
+          Matrix<F>& Q, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RangeFinder \
+  ( Orientation orientation, \
+    const DistSparseMatrix<F>& A, \
+          DistMultiVec<F>& Q, \
+    const RandomizedCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
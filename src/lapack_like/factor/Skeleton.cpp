@@ -16,11 +16,40 @@
 // NOTE: There are *many* algorithms for (pseudo-)skeleton/CUR decompositions,
 //       and, for now, we will simply implement one.
 
-// TODO: Implement randomized algorithms from Jiawei Chiu and Laurent Demanet's
-//       "Sublinear randomized algorithms for skeleton decompositions"?
+// TODO: Implement the sublinear randomized algorithms from Jiawei Chiu and
+//       Laurent Demanet's "Sublinear randomized algorithms for skeleton
+//       decompositions"? RandomizedSkeleton instead pivots on sketches.
 
 namespace El {
 
+namespace skeleton {
+
+// Return the original indices of the first 'numSteps' entries of P A
+inline vector<Int> LeadingPreimages( const Permutation& P, Int numSteps )
+{
+    EL_DEBUG_CSE
+    Matrix<Int> p;
+    P.ExplicitVector( p );
+    vector<Int> preimages( numSteps );
+    for( Int j=0; j<numSteps; ++j )
+        preimages[j] = p(j);
+    return preimages;
+}
+
+inline vector<Int>
+LeadingPreimages( const DistPermutation& P, Int numSteps, const Grid& g )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Int,STAR,STAR> p(g);
+    P.ExplicitVector( p );
+    vector<Int> preimages( numSteps );
+    for( Int j=0; j<numSteps; ++j )
+        preimages[j] = p.GetLocal(j,0);
+    return preimages;
+}
+
+} // namespace skeleton
+
 template<typename F>
 void Skeleton
 ( const Matrix<F>& A,
@@ -101,6 +130,123 @@ void Skeleton
     qr::SolveAfter( NORMAL, B, householderScalars, signature, K, Z );
 }
 
+template<typename F>
+void RandomizedSkeleton
+( const Matrix<F>& A,
+        Permutation& PR,
+        Permutation& PC,
+        Matrix<F>& Z,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // Find the column permutation from a sketch of the row space, Q^H A
+    Matrix<F> Q, Y;
+    RangeFinder( NORMAL, A, Q, ctrl );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, Y );
+    auto colCtrl = ctrl.qrCtrl;
+    colCtrl.boundRank = true;
+    colCtrl.maxRank =
+      ( ctrl.qrCtrl.boundRank ? Min(ctrl.qrCtrl.maxRank,ctrl.rank) : ctrl.rank );
+    Matrix<F> householderScalars;
+    Matrix<Base<F>> signature;
+    QR( Y, householderScalars, signature, PC, colCtrl );
+    const Int numSteps = householderScalars.Height();
+
+    // Find the row permutation from a sketch of the column space, (A Q)^H
+    // (force the same number of steps)
+    RangeFinder( ADJOINT, A, Q, ctrl );
+    Gemm( ADJOINT, ADJOINT, F(1), Q, A, Y );
+    auto rowCtrl = ctrl.qrCtrl;
+    rowCtrl.adaptive = false;
+    rowCtrl.boundRank = true;
+    rowCtrl.maxRank = numSteps;
+    QR( Y, householderScalars, signature, PR, rowCtrl );
+
+    // Copy out only the selected columns and rows, AC and AR
+    Matrix<F> AC, AR;
+    GetSubmatrix
+    ( A, IR(0,m), skeleton::LeadingPreimages(PC,numSteps), AC );
+    GetSubmatrix
+    ( A, skeleton::LeadingPreimages(PR,numSteps), IR(0,n), AR );
+
+    // Form K := pinv(AC) A
+    Matrix<F> K;
+    QR( AC, householderScalars, signature );
+    qr::SolveAfter( NORMAL, AC, householderScalars, signature, A, K );
+
+    // Form Z := K pinv(AR) = (pinv(AR') K')'
+    Matrix<F> ARAdj, KAdj, ZAdj;
+    Adjoint( AR, ARAdj );
+    Adjoint( K, KAdj );
+    QR( ARAdj, householderScalars, signature );
+    qr::SolveAfter
+    ( NORMAL, ARAdj, householderScalars, signature, KAdj, ZAdj );
+    Adjoint( ZAdj, Z );
+}
+
+template<typename F>
+void RandomizedSkeleton
+( const AbstractDistMatrix<F>& APre,
+        DistPermutation& PR,
+        DistPermutation& PC,
+        AbstractDistMatrix<F>& Z,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // Find the column permutation from a sketch of the row space, Q^H A
+    DistMatrix<F> Q(g), Y(g);
+    RangeFinder( NORMAL, A, Q, ctrl );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, Y );
+    auto colCtrl = ctrl.qrCtrl;
+    colCtrl.boundRank = true;
+    colCtrl.maxRank =
+      ( ctrl.qrCtrl.boundRank ? Min(ctrl.qrCtrl.maxRank,ctrl.rank) : ctrl.rank );
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Base<F>,MD,STAR> signature(g);
+    QR( Y, householderScalars, signature, PC, colCtrl );
+    const Int numSteps = householderScalars.Height();
+
+    // Find the row permutation from a sketch of the column space, (A Q)^H
+    // (force the same number of steps)
+    RangeFinder( ADJOINT, A, Q, ctrl );
+    Gemm( ADJOINT, ADJOINT, F(1), Q, A, Y );
+    auto rowCtrl = ctrl.qrCtrl;
+    rowCtrl.adaptive = false;
+    rowCtrl.boundRank = true;
+    rowCtrl.maxRank = numSteps;
+    QR( Y, householderScalars, signature, PR, rowCtrl );
+
+    // Copy out only the selected columns and rows, AC and AR
+    DistMatrix<F> AC(g), AR(g);
+    GetSubmatrix
+    ( A, IR(0,m), skeleton::LeadingPreimages(PC,numSteps,g), AC );
+    GetSubmatrix
+    ( A, skeleton::LeadingPreimages(PR,numSteps,g), IR(0,n), AR );
+
+    // Form K := pinv(AC) A
+    DistMatrix<F> K(g);
+    QR( AC, householderScalars, signature );
+    qr::SolveAfter( NORMAL, AC, householderScalars, signature, A, K );
+
+    // Form Z := K pinv(AR) = (pinv(AR') K')'
+    DistMatrix<F> ARAdj(g), KAdj(g), ZAdj(g);
+    Adjoint( AR, ARAdj );
+    Adjoint( K, KAdj );
+    QR( ARAdj, householderScalars, signature );
+    qr::SolveAfter
+    ( NORMAL, ARAdj, householderScalars, signature, KAdj, ZAdj );
+    Adjoint( ZAdj, Z );
+}
+
 #define PROTO(F) \
   template void Skeleton \
   ( const Matrix<F>& A, \
@@ -113,7 +259,19 @@ void Skeleton
           DistPermutation& PR, \
           DistPermutation& PC, \
           AbstractDistMatrix<F>& Z, \
-    const QRCtrl<Base<F>>& ctrl );
+    const QRCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSkeleton \
+  ( const Matrix<F>& A, \
+          Permutation& PR, \
+          Permutation& PC, \
+          Matrix<F>& Z, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSkeleton \
+  ( const AbstractDistMatrix<F>& A, \
+          DistPermutation& PR, \
+          DistPermutation& PC, \
+          AbstractDistMatrix<F>& Z, \
+    const RandomizedCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,280 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovHermitianFunction
+( const SparseMatrix<Field>& A,
+        function<Base<Field>(const Base<Field>&)> func,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovHermitianFunction( n, applyA, func, B, X, ctrl );
+}
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovHermitianFunction
+( const DistSparseMatrix<Field>& A,
+        function<Base<Field>(const Base<Field>&)> func,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovHermitianFunction( n, applyA, func, B, X, ctrl );
+}
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovExp
+( const SparseMatrix<Field>& A,
+        Base<Field> t,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovExp( n, applyA, t, B, X, ctrl );
+}
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovExp
+( const DistSparseMatrix<Field>& A,
+        Base<Field> t,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovExp( n, applyA, t, B, X, ctrl );
+}
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovSquareRoot
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovSquareRoot( n, applyA, B, X, ctrl );
+}
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovSquareRoot
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovSquareRoot( n, applyA, B, X, ctrl );
+}
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovInverseSquareRoot
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovInverseSquareRoot( n, applyA, B, X, ctrl );
+}
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovInverseSquareRoot
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovInverseSquareRoot( n, applyA, B, X, ctrl );
+}
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovSign
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovSign( n, applyA, B, X, ctrl );
+}
+
+template<typename Field>
+KrylovFunctionInfo<Base<Field>> KrylovSign
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const KrylovFunctionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return KrylovSign( n, applyA, B, X, ctrl );
+}
+
+#define PROTO(Field) \
+  template KrylovFunctionInfo<Base<Field>> KrylovHermitianFunction \
+  ( const SparseMatrix<Field>& A, \
+          function<Base<Field>(const Base<Field>&)> func, \
+    const Matrix<Field>& B, \
+          Matrix<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template KrylovFunctionInfo<Base<Field>> KrylovHermitianFunction \
+  ( const DistSparseMatrix<Field>& A, \
+          function<Base<Field>(const Base<Field>&)> func, \
+    const DistMultiVec<Field>& B, \
+          DistMultiVec<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template KrylovFunctionInfo<Base<Field>> KrylovExp \
+  ( const SparseMatrix<Field>& A, \
+          Base<Field> t, \
+    const Matrix<Field>& B, \
+          Matrix<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template KrylovFunctionInfo<Base<Field>> KrylovExp \
+  ( const DistSparseMatrix<Field>& A, \
+          Base<Field> t, \
+    const DistMultiVec<Field>& B, \
+          DistMultiVec<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template KrylovFunctionInfo<Base<Field>> KrylovSquareRoot \
+  ( const SparseMatrix<Field>& A, \
+    const Matrix<Field>& B, \
+          Matrix<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template KrylovFunctionInfo<Base<Field>> KrylovSquareRoot \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Field>& B, \
+          DistMultiVec<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template KrylovFunctionInfo<Base<Field>> KrylovInverseSquareRoot \
+  ( const SparseMatrix<Field>& A, \
+    const Matrix<Field>& B, \
+          Matrix<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template KrylovFunctionInfo<Base<Field>> KrylovInverseSquareRoot \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Field>& B, \
+          DistMultiVec<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template KrylovFunctionInfo<Base<Field>> KrylovSign \
+  ( const SparseMatrix<Field>& A, \
+    const Matrix<Field>& B, \
+          Matrix<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl ); \
+  template KrylovFunctionInfo<Base<Field>> KrylovSign \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Field>& B, \
+          DistMultiVec<Field>& X, \
+    const KrylovFunctionCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace hpd_solve {
@@ -68,6 +70,181 @@ void HPDSolve
     hpd_solve::Overwrite( uplo, orientation, ACopy, B );
 }
 
+namespace hpd_solve {
+
+// Y := alpha op(A) X + beta Y, where op(A) is either A or conj(A) and only the
+// 'uplo' triangle of A is accessed
+template<class MatType,typename Field>
+void ApplyHPD
+( UpperOrLower uplo,
+  Orientation orientation,
+  const MatType& A,
+  Field alpha, const MatType& X,
+  Field beta,        MatType& Y )
+{
+    EL_DEBUG_CSE
+    if( orientation == TRANSPOSE )
+    {
+        // conj(A) X = conj(A conj(X))
+        MatType XConj( X );
+        Conjugate( XConj );
+        Conjugate( Y );
+        Hemm( LEFT, uplo, Conj(alpha), A, XConj, Conj(beta), Y );
+        Conjugate( Y );
+    }
+    else
+    {
+        Hemm( LEFT, uplo, alpha, A, X, beta, Y );
+    }
+}
+
+} // namespace hpd_solve
+
+template<typename Field>
+MixedPrecisionInfo<Base<Field>>
+HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Demote<Field> FieldLow;
+    MixedPrecisionInfo<Real> info;
+    info.factorEpsilon = limits::Epsilon<Base<FieldLow>>();
+    info.workingEpsilon = limits::Epsilon<Real>();
+
+    // A loss of definiteness in the lower precision results in a fallback
+    Matrix<FieldLow> ALow;
+    if( mixed_prec::Representable<FieldLow>( MaxNorm(A) ) )
+    {
+        try
+        {
+            Copy( A, ALow );
+            Cholesky( uplo, ALow );
+            info.factored = true;
+        }
+        catch( NonHPDMatrixException& e ) { }
+    }
+    if( !info.factored )
+    {
+        if( !ctrl.fallback )
+            RuntimeError("The low-precision Cholesky factorization broke down");
+        HPDSolve( uplo, orientation, A, B );
+        info.fellBack = true;
+        return info;
+    }
+
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          hpd_solve::ApplyHPD( uplo, orientation, A, alpha, X, beta, Y );
+      };
+    Matrix<FieldLow> YLow;
+    auto solveLow =
+      [&]( Matrix<FieldLow>& Z )
+      {
+          cholesky::SolveAfter( uplo, orientation, ALow, Z );
+      };
+    auto applyMInv =
+      [&]( Matrix<Field>& Y )
+      {
+          mixed_prec::LowSolve<Field>( Y, YLow, solveLow );
+      };
+
+    Matrix<Field> X;
+    mixed_prec::Refine<Field>
+    ( applyA, applyMInv, HermitianInfinityNorm(uplo,A), B, X, ctrl, info );
+    if( info.converged || !ctrl.fallback )
+    {
+        B = X;
+    }
+    else
+    {
+        HPDSolve( uplo, orientation, A, B );
+        info.fellBack = true;
+    }
+    return info;
+}
+
+template<typename Field>
+MixedPrecisionInfo<Base<Field>>
+HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Demote<Field> FieldLow;
+    MixedPrecisionInfo<Real> info;
+    info.factorEpsilon = limits::Epsilon<Base<FieldLow>>();
+    info.workingEpsilon = limits::Epsilon<Real>();
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& grid = A.Grid();
+
+    // A loss of definiteness in the lower precision results in a fallback
+    DistMatrix<FieldLow> ALow(grid);
+    if( mixed_prec::Representable<FieldLow>( MaxNorm(A) ) )
+    {
+        try
+        {
+            Copy( A, ALow );
+            Cholesky( uplo, ALow );
+            info.factored = true;
+        }
+        catch( NonHPDMatrixException& e ) { }
+    }
+    if( !info.factored )
+    {
+        if( !ctrl.fallback )
+            RuntimeError("The low-precision Cholesky factorization broke down");
+        HPDSolve( uplo, orientation, A, B );
+        info.fellBack = true;
+        return info;
+    }
+
+    auto applyA =
+      [&]( Field alpha, const DistMatrix<Field>& X,
+           Field beta,        DistMatrix<Field>& Y )
+      {
+          hpd_solve::ApplyHPD( uplo, orientation, A, alpha, X, beta, Y );
+      };
+    DistMatrix<FieldLow> YLow(grid);
+    auto solveLow =
+      [&]( DistMatrix<FieldLow>& Z )
+      {
+          cholesky::SolveAfter( uplo, orientation, ALow, Z );
+      };
+    auto applyMInv =
+      [&]( DistMatrix<Field>& Y )
+      {
+          mixed_prec::LowSolve<Field>( Y, YLow, solveLow );
+      };
+
+    DistMatrix<Field> X(grid);
+    mixed_prec::Refine<Field>
+    ( applyA, applyMInv, HermitianInfinityNorm(uplo,A), B, X, ctrl, info );
+    if( info.converged || !ctrl.fallback )
+    {
+        B = X;
+    }
+    else
+    {
+        HPDSolve( uplo, orientation, A, B );
+        info.fellBack = true;
+    }
+    return info;
+}
+
 // TODO(poulson): Add iterative refinement parameter
 template<typename Field>
 void HPDSolve
@@ -119,6 +296,14 @@ void HPDSolve
   template void HPDSolve \
   ( UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B ); \
+  template MixedPrecisionInfo<Base<Field>> HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const Matrix<Field>& A, Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template MixedPrecisionInfo<Base<Field>> HPDSolve \
+  ( UpperOrLower uplo, Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
   template void HPDSolve \
   ( const SparseMatrix<Field>& A, Matrix<Field>& B, const BisectCtrl& ctrl ); \
   template void HPDSolve \
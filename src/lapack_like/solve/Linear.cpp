@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./MixedPrecision.hpp"
+
 namespace El {
 
 namespace lu {
@@ -293,6 +295,147 @@ void LinearSolve
     lin_solve::Overwrite( ACopy, B );
 }
 
+template<typename Field>
+MixedPrecisionInfo<Base<Field>>
+LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Demote<Field> FieldLow;
+    MixedPrecisionInfo<Real> info;
+    info.factorEpsilon = limits::Epsilon<Base<FieldLow>>();
+    info.workingEpsilon = limits::Epsilon<Real>();
+
+    Matrix<FieldLow> ALow;
+    Permutation P;
+    if( mixed_prec::Representable<FieldLow>( MaxNorm(A) ) )
+    {
+        try
+        {
+            Copy( A, ALow );
+            LU( ALow, P );
+            info.factored = true;
+        }
+        catch( SingularMatrixException& e ) { }
+    }
+    if( !info.factored )
+    {
+        if( !ctrl.fallback )
+            RuntimeError("The low-precision LU factorization broke down");
+        LinearSolve( A, B );
+        info.fellBack = true;
+        return info;
+    }
+
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y );
+      };
+    Matrix<FieldLow> YLow;
+    auto solveLow =
+      [&]( Matrix<FieldLow>& Z )
+      {
+          lu::SolveAfter( NORMAL, ALow, P, Z );
+      };
+    auto applyMInv =
+      [&]( Matrix<Field>& Y )
+      {
+          mixed_prec::LowSolve<Field>( Y, YLow, solveLow );
+      };
+
+    Matrix<Field> X;
+    mixed_prec::Refine<Field>
+    ( applyA, applyMInv, InfinityNorm(A), B, X, ctrl, info );
+    if( info.converged || !ctrl.fallback )
+    {
+        B = X;
+    }
+    else
+    {
+        LinearSolve( A, B );
+        info.fellBack = true;
+    }
+    return info;
+}
+
+template<typename Field>
+MixedPrecisionInfo<Base<Field>>
+LinearSolve
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Demote<Field> FieldLow;
+    MixedPrecisionInfo<Real> info;
+    info.factorEpsilon = limits::Epsilon<Base<FieldLow>>();
+    info.workingEpsilon = limits::Epsilon<Real>();
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& grid = A.Grid();
+
+    DistMatrix<FieldLow> ALow(grid);
+    DistPermutation P(grid);
+    if( mixed_prec::Representable<FieldLow>( MaxNorm(A) ) )
+    {
+        try
+        {
+            Copy( A, ALow );
+            LU( ALow, P );
+            info.factored = true;
+        }
+        catch( SingularMatrixException& e ) { }
+    }
+    if( !info.factored )
+    {
+        if( !ctrl.fallback )
+            RuntimeError("The low-precision LU factorization broke down");
+        LinearSolve( A, B );
+        info.fellBack = true;
+        return info;
+    }
+
+    auto applyA =
+      [&]( Field alpha, const DistMatrix<Field>& X,
+           Field beta,        DistMatrix<Field>& Y )
+      {
+          Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y );
+      };
+    DistMatrix<FieldLow> YLow(grid);
+    auto solveLow =
+      [&]( DistMatrix<FieldLow>& Z )
+      {
+          lu::SolveAfter( NORMAL, ALow, P, Z );
+      };
+    auto applyMInv =
+      [&]( DistMatrix<Field>& Y )
+      {
+          mixed_prec::LowSolve<Field>( Y, YLow, solveLow );
+      };
+
+    DistMatrix<Field> X(grid);
+    mixed_prec::Refine<Field>
+    ( applyA, applyMInv, InfinityNorm(A), B, X, ctrl, info );
+    if( info.converged || !ctrl.fallback )
+    {
+        B = X;
+    }
+    else
+    {
+        LinearSolve( A, B );
+        info.fellBack = true;
+    }
+    return info;
+}
+
 template<typename Field>
 void LinearSolve
 ( const SparseMatrix<Field>& A,
@@ -326,6 +469,14 @@ void LinearSolve
   ( const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& B, \
     bool scalapack ); \
+  template MixedPrecisionInfo<Base<Field>> LinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template MixedPrecisionInfo<Base<Field>> LinearSolve \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
   template void LinearSolve \
   ( const SparseMatrix<Field>& A, \
           Matrix<Field>& B, \
@@ -0,0 +1,258 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_MIXEDPRECISION_HPP
+#define EL_SOLVE_MIXEDPRECISION_HPP
+
+namespace El {
+namespace mixed_prec {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const MatType& X, Field beta, MatType& Y )
+//
+// and overwrite Y := alpha op(A) X + beta Y, whereas 'applyMInv' should have
+// the form
+//
+//   void applyMInv( MatType& Y )
+//
+// and overwrite Y with inv(M) Y, where M is the low-precision factorization
+// of op(A). MatType may be either Matrix<Field> or DistMatrix<Field>.
+//
+
+// Whether a matrix whose entries are bounded in magnitude by 'maxAbs' can be
+// demoted to FieldLow without overflow
+template<typename FieldLow,typename Real>
+bool Representable( const Real& maxAbs )
+{ return maxAbs <= Real(limits::Max<Base<FieldLow>>()); }
+
+// Overwrite Y with the result of a low-precision solve. Y is temporarily
+// scaled to have unit max norm so that small residuals are not flushed to
+// zero (and large ones do not overflow) when demoted.
+template<typename Field,class MatType,class MatLowType,class SolveLowType>
+void LowSolve( MatType& Y, MatLowType& YLow, const SolveLowType& solveLow )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real YNorm = MaxNorm( Y );
+    if( YNorm == Real(0) )
+        return;
+    Y *= Real(1)/YNorm;
+    Copy( Y, YLow );
+    solveLow( YLow );
+    Copy( YLow, Y );
+    Y *= YNorm;
+}
+
+// Overwrite the single column r with an approximate solution of op(A) d = r
+// computed by GMRES (without restarts) applied to the left-preconditioned
+// system inv(M) op(A) d = inv(M) r. The number of iterations is returned.
+template<typename Field,class MatType,class ApplyAType,class ApplyMInvType>
+Int GMRES
+( const ApplyAType& applyA,
+  const ApplyMInvType& applyMInv,
+        MatType& r,
+        Base<Field> relTol,
+        Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = r.Height();
+
+    // w := inv(M) r
+    // =============
+    MatType w( r );
+    applyMInv( w );
+    const Real beta = FrobeniusNorm( w );
+    if( beta == Real(0) || !limits::IsFinite(beta) )
+    {
+        r = w;
+        return 0;
+    }
+
+    // v0 := w / beta
+    // ==============
+    MatType V( r );
+    Zeros( V, n, maxIts+1 );
+    auto v0 = V( ALL, IR(0) );
+    v0 = w;
+    v0 *= Real(1)/beta;
+
+    // t := beta e_0
+    // =============
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, t;
+    Zeros( cs, maxIts, 1 );
+    Zeros( sn, maxIts, 1 );
+    Zeros( H, maxIts, maxIts );
+    Zeros( t, maxIts+1, 1 );
+    t(0) = beta;
+
+    Int numIts = 0;
+    for( Int j=0; j<maxIts; ++j )
+    {
+        // w := inv(M) op(A) v_j
+        // =====================
+        auto vj = V( ALL, IR(j) );
+        applyA( Field(1), vj, Field(0), w );
+        applyMInv( w );
+
+        // Run the j'th step of Arnoldi with modified Gram-Schmidt
+        // =======================================================
+        for( Int i=0; i<=j; ++i )
+        {
+            auto vi = V( ALL, IR(i) );
+            H(i,j) = Dot( vi, w );
+            Axpy( -H(i,j), vi, w );
+        }
+        const Real delta = FrobeniusNorm( w );
+        if( !limits::IsFinite(delta) )
+            break;
+
+        // Apply the existing rotations to the new column of H
+        // ===================================================
+        for( Int i=0; i<j; ++i )
+        {
+            const Real& c = cs(i);
+            const Field& s = sn(i);
+            const Field sConj = Conj(s);
+            const Field eta_i_j = H(i,j);
+            const Field eta_ip1_j = H(i+1,j);
+            H(i,  j) =  c    *eta_i_j + s*eta_ip1_j;
+            H(i+1,j) = -sConj*eta_i_j + c*eta_ip1_j;
+        }
+
+        // Generate and apply a new rotation to both H and t
+        // =================================================
+        Real c;
+        Field s;
+        H(j,j) = Givens( H(j,j), Field(delta), c, s );
+        cs(j) = c;
+        sn(j) = s;
+        const Field sConj = Conj(s);
+        const Field tau_j = t(j);
+        const Field tau_jp1 = t(j+1);
+        t(j)   =  c    *tau_j + s*tau_jp1;
+        t(j+1) = -sConj*tau_j + c*tau_jp1;
+        numIts = j+1;
+
+        if( delta == Real(0) || Abs(t(j+1)) <= relTol*beta )
+            break;
+
+        // v_{j+1} := w / delta
+        // ====================
+        auto vjp1 = V( ALL, IR(j+1) );
+        vjp1 = w;
+        vjp1 *= Real(1)/delta;
+    }
+
+    // Minimize the residual and form d := V y
+    // =======================================
+    auto y = t( IR(0,numIts), ALL );
+    auto HTL = H( IR(0,numIts), IR(0,numIts) );
+    Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+    Zero( r );
+    for( Int i=0; i<numIts; ++i )
+    {
+        auto vi = V( ALL, IR(i) );
+        Axpy( y(i), vi, r );
+    }
+    return numIts;
+}
+
+// Overwrite X with an approximate solution of op(A) X = B by refining an
+// initial low-precision solution in the working precision. 'normA' should be
+// the infinity norm of A.
+template<typename Field,class MatType,class ApplyAType,class ApplyMInvType>
+void Refine
+( const ApplyAType& applyA,
+  const ApplyMInvType& applyMInv,
+        Base<Field> normA,
+  const MatType& B,
+        MatType& X,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl,
+        MixedPrecisionInfo<Base<Field>>& info )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = B.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol =
+      ( ctrl.relTol > Real(0) ? ctrl.relTol : Sqrt(Real(n))*eps );
+    const Real BNorm = MaxNorm( B );
+
+    // R := B - op(A) X and return the normwise backward error of X
+    auto residual =
+      [&]( const MatType& Y, MatType& R )
+      {
+          R = B;
+          applyA( Field(-1), Y, Field(1), R );
+          const Real denom = normA*MaxNorm(Y) + BNorm;
+          return denom == Real(0) ? Real(0) : MaxNorm(R) / denom;
+      };
+
+    X = B;
+    applyMInv( X );
+    MatType R( B ), D( B ), XCand( B );
+    Real backErr = residual( X, R );
+    if( ctrl.progress )
+        Output("initial backward error: ",backErr);
+
+    while( limits::IsFinite(backErr) )
+    {
+        if( backErr <= relTol )
+        {
+            info.converged = true;
+            break;
+        }
+        if( info.numRefineIts >= ctrl.maxRefineIts )
+            break;
+
+        // Solve for the correction, op(A) D = R
+        // =====================================
+        D = R;
+        if( ctrl.refine == MIXED_REFINE_GMRES )
+        {
+            for( Int j=0; j<D.Width(); ++j )
+            {
+                auto d = D( ALL, IR(j) );
+                info.numGMRESIts +=
+                  GMRES<Field>
+                  ( applyA, applyMInv, d, ctrl.gmresRelTol, ctrl.maxGMRESIts );
+            }
+        }
+        else
+        {
+            applyMInv( D );
+        }
+        ++info.numRefineIts;
+
+        // Only accept the update if it reduces the backward error
+        // =======================================================
+        XCand = X;
+        Axpy( Field(1), D, XCand );
+        const Real newBackErr = residual( XCand, D );
+        if( ctrl.progress )
+            Output("refined backward error: ",newBackErr);
+        if( !(newBackErr < backErr) )
+            break;
+        X = XCand;
+        R = D;
+        const bool stalled = newBackErr > ctrl.stallRatio*backErr;
+        backErr = newBackErr;
+        if( stalled && backErr > relTol )
+            break;
+    }
+    info.backwardError = backErr;
+}
+
+} // namespace mixed_prec
+} // namespace El
+
+#endif // ifndef EL_SOLVE_MIXEDPRECISION_HPP
@@ -30,6 +30,7 @@ ElError ElSecularEVDCtrlDefault_s
     ctrl->penalizeDerivative = false;
     ctrl->progress = false;
     ElCubicSecularCtrlDefault( &ctrl->cubicCtrl );
+    ctrl->batchCutoff = 256;
     return EL_SUCCESS;
 }
 
@@ -42,6 +43,7 @@ ElError ElSecularEVDCtrlDefault_d
     ctrl->penalizeDerivative = false;
     ctrl->progress = false;
     ElCubicSecularCtrlDefault( &ctrl->cubicCtrl );
+    ctrl->batchCutoff = 256;
     return EL_SUCCESS;
 }
 
@@ -55,6 +57,7 @@ ElError ElSecularSVDCtrlDefault_s
     ctrl->penalizeDerivative = false;
     ctrl->progress = false;
     ElCubicSecularCtrlDefault( &ctrl->cubicCtrl );
+    ctrl->batchCutoff = 256;
     return EL_SUCCESS;
 }
 
@@ -67,6 +70,7 @@ ElError ElSecularSVDCtrlDefault_d
     ctrl->penalizeDerivative = false;
     ctrl->progress = false;
     ElCubicSecularCtrlDefault( &ctrl->cubicCtrl );
+    ctrl->batchCutoff = 256;
     return EL_SUCCESS;
 }
 
@@ -110,6 +114,7 @@ ElError ElHermitianTridiagEigDCCtrlDefault_s
     ctrl->deflationFudge = float(8);
     ctrl->cutoff = 60;
     ctrl->exploitStructure = true;
+    ctrl->taskCutoff = 256;
     return EL_SUCCESS;
 }
 ElError ElHermitianTridiagEigDCCtrlDefault_d
@@ -119,6 +124,27 @@ ElError ElHermitianTridiagEigDCCtrlDefault_d
     ctrl->deflationFudge = double(8);
     ctrl->cutoff = 60;
     ctrl->exploitStructure = true;
+    ctrl->taskCutoff = 256;
+    return EL_SUCCESS;
+}
+
+/* HermitianTridiagEigMRRRCtrl */
+ElError ElHermitianTridiagEigMRRRCtrlDefault_s
+( ElHermitianTridiagEigMRRRCtrl_s* ctrl )
+{
+    ctrl->native = false;
+    ctrl->minRelGap = float(1)/float(1000);
+    ctrl->maxRQIIts = 10;
+    ctrl->maxDepth = 20;
+    return EL_SUCCESS;
+}
+ElError ElHermitianTridiagEigMRRRCtrlDefault_d
+( ElHermitianTridiagEigMRRRCtrl_d* ctrl )
+{
+    ctrl->native = false;
+    ctrl->minRelGap = double(1)/double(1000);
+    ctrl->maxRQIIts = 10;
+    ctrl->maxDepth = 20;
     return EL_SUCCESS;
 }
 
@@ -133,6 +159,7 @@ ElError ElHermitianTridiagEigCtrlDefault_s( ElHermitianTridiagEigCtrl_s* ctrl )
     ctrl->alg = EL_HERM_TRIDIAG_EIG_MRRR;
     ElHermitianTridiagEigQRCtrlDefault( &ctrl->qrCtrl );
     ElHermitianTridiagEigDCCtrlDefault_s( &ctrl->dcCtrl );
+    ElHermitianTridiagEigMRRRCtrlDefault_s( &ctrl->mrrrCtrl );
     return EL_SUCCESS;
 }
 
@@ -146,6 +173,7 @@ ElError ElHermitianTridiagEigCtrlDefault_d( ElHermitianTridiagEigCtrl_d* ctrl )
     ctrl->alg = EL_HERM_TRIDIAG_EIG_MRRR;
     ElHermitianTridiagEigQRCtrlDefault( &ctrl->qrCtrl );
     ElHermitianTridiagEigDCCtrlDefault_d( &ctrl->dcCtrl );
+    ElHermitianTridiagEigMRRRCtrlDefault_d( &ctrl->mrrrCtrl );
     return EL_SUCCESS;
 }
 
@@ -158,6 +186,7 @@ ElError ElHermitianSDCCtrlDefault_s( ElHermitianSDCCtrl_s* ctrl )
     ctrl->tol = 0;
     ctrl->spreadFactor = 1e-6f;
     ctrl->progress = false;
+    ctrl->qdwhEig = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl )
@@ -168,6 +197,7 @@ ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl )
     ctrl->tol = 0;
     ctrl->spreadFactor = 1e-6;
     ctrl->progress = false;
+    ctrl->qdwhEig = false;
     return EL_SUCCESS;
 }
 
@@ -295,6 +325,10 @@ ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl )
 
     ElBidiagSVDCtrlDefault_s( &ctrl->bidiagSVDCtrl );
 
+    ctrl->useQDWH = false;
+    ElQDWHCtrlDefault( &ctrl->qdwhCtrl );
+    ElHermitianSDCCtrlDefault_s( &ctrl->sdcCtrl );
+
     return EL_SUCCESS;
 }
 ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl )
@@ -310,6 +344,10 @@ ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl )
 
     ElBidiagSVDCtrlDefault_d( &ctrl->bidiagSVDCtrl );
 
+    ctrl->useQDWH = false;
+    ElQDWHCtrlDefault( &ctrl->qdwhCtrl );
+    ElHermitianSDCCtrlDefault_d( &ctrl->sdcCtrl );
+
     return EL_SUCCESS;
 }
 
@@ -339,6 +377,8 @@ ElError ElHessenbergSchurCtrlDefault( ElHessenbergSchurCtrl* ctrl )
     ctrl->scalapack = false;
     ctrl->blockHeight = DefaultBlockHeight();
     ctrl->numBulgesPerBlock = &hess_schur::multibulge::NumBulgesPerBlock;
+    ctrl->minDistAEDSize = 500;
+    ctrl->distAEDGridDim = &hess_schur::aed::DistGridDim;
 
     return EL_SUCCESS;
 }
@@ -426,6 +466,8 @@ ElError ElPseudospecCtrlDefault_s( ElPseudospecCtrl_s* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->numSubgrids = 1;
+    ctrl->shiftBatchSize = 0;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -451,6 +493,8 @@ ElError ElPseudospecCtrlDefault_d( ElPseudospecCtrl_d* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->numSubgrids = 1;
+    ctrl->shiftBatchSize = 0;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -607,48 +607,53 @@ Merge
     else
         VSecular.Resize( numUndeflated, numUndeflated );
 
-    // For temporarily storing dUndeflated + d(j)
-    Matrix<Real> plusShift;
+    // For temporarily storing dUndeflated + d(j) in the j'th column
+    Matrix<Real> plusShifts;
     if( ctrl.wantU )
-        View( plusShift, USecular, ALL, IR(0) );
+        View( plusShifts, USecular );
     else
-        plusShift.Resize( numUndeflated, 1 );
-
-    for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto minusShift = VSecular( ALL, IR(j) );
-
-        auto valueInfo =
-          SecularSingularValue
-          ( j, dUndeflated, rho, rUndeflated, d(j), minusShift, plusShift,
-            dcCtrl.secularCtrl );
-        if( ctrl.progress )
+        plusShifts.Resize( numUndeflated, numUndeflated );
+
+    // The secular equations are solved as a (possibly concurrent) batch, and
+    // the singular vectors are formed concurrently for sufficiently large
+    // merges.
+    auto dSecular = d( undeflatedInd, ALL );
+    auto batchInfo =
+      SecularSingularValues
+      ( dUndeflated, rho, rUndeflated, dSecular, VSecular, plusShifts,
+        dcCtrl.secularCtrl );
+    if( ctrl.progress )
+        for( Int j=0; j<numUndeflated; ++j )
             Output("Secular singular value ",j," is ",d(j));
-
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        // minusShift currently holds dUndeflated-d(j) and plusShift
-        // holds dUndeflated+d(j). Overwrite minusShift with their
-        // element-wise product since that is all we require from here on
-        // out.
+    secularInfo.numIterations += batchInfo.numIterations;
+    secularInfo.numAlternations += batchInfo.numAlternations;
+    secularInfo.numCubicIterations += batchInfo.numCubicIterations;
+    secularInfo.numCubicFailures += batchInfo.numCubicFailures;
+
+    // Column j of VSecular currently holds dUndeflated-d(j) and column j of
+    // plusShifts holds dUndeflated+d(j). Overwrite VSecular with their
+    // element-wise product since that is all we require from here on out.
+    EL_TASKLOOP_IF( numUndeflated >= dcCtrl.secularCtrl.batchCutoff )
+    for( Int j=0; j<numUndeflated; ++j )
         for( Int k=0; k<numUndeflated; ++k )
-            minusShift(k) *= plusShift(k);
+            VSecular(k,j) *= plusShifts(k,j);
 
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
+    // Each entry of the corrected update vector is a product over all of the
+    // secular solutions (accumulated in the same order as a loop over them)
+    EL_TASKLOOP_IF( numUndeflated >= dcCtrl.secularCtrl.batchCutoff )
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        for( Int j=0; j<numUndeflated; ++j )
         {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) /
-              ((dUndeflated(j)+dUndeflated(k))*
-               (dUndeflated(j)-dUndeflated(k)));
+            if( j == k )
+                rCorrected(k) *= VSecular(k,k);
+            else
+                rCorrected(k) *= VSecular(k,j) /
+                  ((dUndeflated(j)+dUndeflated(k))*
+                   (dUndeflated(j)-dUndeflated(k)));
         }
+        rCorrected(k) = Sgn(rUndeflated(k),false) * Sqrt(Abs(rCorrected(k)));
     }
-    for( Int j=0; j<numUndeflated; ++j )
-        rCorrected(j) = Sgn(rUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
     // Compute the unnormalized left and right singular vectors via Eqs. (3.4)
     // and (3.3), respectively, from Gu/Eisenstat [CITATION].
@@ -656,6 +661,7 @@ Merge
         Output("Computing unnormalized singular vectors");
     if( ctrl.wantU )
     {
+        EL_TASKLOOP_IF( numUndeflated >= dcCtrl.secularCtrl.batchCutoff )
         for( Int j=0; j<numUndeflated; ++j )
         {
             auto u = USecular(ALL,IR(j));
@@ -675,6 +681,7 @@ Merge
     }
     else
     {
+        EL_TASKLOOP_IF( numUndeflated >= dcCtrl.secularCtrl.batchCutoff )
         for( Int j=0; j<numUndeflated; ++j )
         {
             auto v = VSecular(ALL,IR(j));
@@ -700,6 +707,7 @@ Merge
     if( ctrl.wantU )
     {
         Zeros( Q, numUndeflated, numUndeflated );
+        EL_TASKLOOP_IF( numUndeflated >= dcCtrl.secularCtrl.batchCutoff )
         for( Int j=0; j<numUndeflated; ++j )
         {
             auto u = USecular(ALL,IR(j));
@@ -767,6 +775,7 @@ Merge
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     Q.Resize( numUndeflated, numUndeflated );
+    EL_TASKLOOP_IF( numUndeflated >= dcCtrl.secularCtrl.batchCutoff )
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto v = VSecular(ALL,IR(j));
@@ -59,8 +59,7 @@ Int MRRREstimate
 ( const AbstractDistMatrix<Real>& d,
   const AbstractDistMatrix<Real>& dSub,
         mpi::Comm wColComm,
-        Real vl,
-        Real vu );
+  const HermitianTridiagEigCtrl<Real>& ctrl );
 
 // Q is assumed to be sufficiently large and properly aligned
 template<typename Real>
@@ -70,9 +69,7 @@ MRRRPostEstimate
   const AbstractDistMatrix<Real>& dSub,
         AbstractDistMatrix<Real>& w,
         AbstractDistMatrix<Real>& Q,
-        SortType sort,
-        Real vl,
-        Real vu );
+  const HermitianTridiagEigCtrl<Real>& ctrl );
 
 } // namespace herm_tridiag_eig
 
@@ -889,7 +886,7 @@ MRRR
     {
         // Get an upper-bound on the number of local eigenvalues in the range
         kEst = herm_tridiag_eig::MRRREstimate
-          ( d, e, g.VRComm(), subset.lowerBound, subset.upperBound );
+          ( d, e, g.VRComm(), ctrl.tridiagEigCtrl );
     }
     else if( subset.indexSubset )
         kEst = subset.upperIndex-subset.lowerIndex+1;
@@ -928,9 +925,12 @@ MRRR
     // NOTE: We should be guaranteeing that Q_STAR_VR does not need to
     //       reallocate a buffer
     if( subset.rangeSubset )
+    {
+        auto tridiagEigCtrl( ctrl.tridiagEigCtrl );
+        tridiagEigCtrl.sort = UNSORTED;
         info.tridiagEigInfo = herm_tridiag_eig::MRRRPostEstimate
-        ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, UNSORTED,
-          subset.lowerBound, subset.upperBound );
+        ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, tridiagEigCtrl );
+    }
     else
         info.tridiagEigInfo = HermitianTridiagEig
         ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, ctrl.tridiagEigCtrl );
@@ -23,48 +23,81 @@ using El::schur::PullSubproblems;
 
 // TODO(poulson): Exploit symmetry in A := Q^H A Q. Routine for A := X^H A X?
 
-// G should be a rational function of A. If returnQ=true, G will be set to
-// the computed unitary matrix upon exit.
+// The QDWH-eig splitting of Nakatsukasa and Higham. G should be a shifted
+// copy of A; the sign of G is computed via the QDWH iteration, the rank of the
+// split is read off from the trace of the resulting spectral projector, and an
+// orthonormal basis for its range is computed via ctrl.maxInnerIts steps of
+// subspace iteration (which, unlike a pivoted QR decomposition, only requires
+// matrix-matrix products and unpivoted QR decompositions). If returnQ=true, G
+// will be set to the computed unitary matrix upon exit.
 template<typename F>
 ValueInt<Base<F>>
-QDWHDivide( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, bool returnQ=false )
+QDWHDivide
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& G,
+  bool returnQ,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real oneA = OneNorm( A );
 
     // G := sgn(G)
     // G := 1/2 ( G + I )
-    PolarCtrl ctrl;
-    ctrl.qdwh = true;
-    HermitianPolar( uplo, G, ctrl );
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    HermitianPolar( uplo, G, polarCtrl );
     ShiftDiagonal( G, F(1) );
     G *= F(1)/F(2);
 
-    // Compute the pivoted QR decomposition of the spectral projection 
-    Matrix<F> t;
-    Matrix<Base<F>> d;
-    Matrix<Int> p;
-    El::QR( G, t, d, p );
+    // G is (approximately) an orthogonal projector, so its trace is the
+    // dimension of its range
+    ValueInt<Real> part;
+    part.index = Int(Round(RealPart(Trace(G))));
+    if( part.index <= 0 || part.index >= n )
+    {
+        part.value = limits::Infinity<Real>();
+        return part;
+    }
+    const Int k = part.index;
+
+    // Compute an orthonormal basis for the range of G
+    Matrix<F> X, Y, t;
+    Matrix<Real> d;
+    const Int numIts = Max( ctrl.maxInnerIts, Int(1) );
+    Gaussian( X, n, k );
+    for( Int it=0; it<numIts; ++it )
+    {
+        Gemm( NORMAL, NORMAL, F(1), G, X, Y );
+        if( it < numIts-1 )
+        {
+            qr::ExplicitUnitary( Y );
+            X = Y;
+        }
+    }
+    El::QR( Y, t, d );
 
     // A := Q^H A Q
-    MakeHermitian( uplo, A );
-    const Base<F> oneA = OneNorm( A );
     if( returnQ )
     {
-        ExpandPackedReflectors( LOWER, VERTICAL, CONJUGATED, 0, G, t );
-        DiagonalScale( RIGHT, NORMAL, d, G );
+        Identity( G, n, n );
+        qr::ApplyQ( LEFT, NORMAL, Y, t, d, G );
         Matrix<F> B;
         Gemm( ADJOINT, NORMAL, F(1), G, A, B );
         Gemm( NORMAL, NORMAL, F(1), B, G, A );
     }
     else
     {
-        qr::ApplyQ( LEFT, ADJOINT, G, t, d, A );
-        qr::ApplyQ( RIGHT, NORMAL, G, t, d, A );
+        qr::ApplyQ( LEFT, ADJOINT, Y, t, d, A );
+        qr::ApplyQ( RIGHT, NORMAL, Y, t, d, A );
     }
 
     // Return || E21 ||1 / || A ||1 and the chosen rank
-    auto part = ComputePartition( A );
-    part.value /= oneA;
+    auto E21 = A( IR(k,n), IR(0,k) );
+    part.value = EntrywiseNorm( E21, Real(1) ) / oneA;
     return part;
 }
 
@@ -74,45 +107,70 @@ QDWHDivide
 ( UpperOrLower uplo,
   DistMatrix<F>& A,
   DistMatrix<F>& G,
-  bool returnQ=false )
+  bool returnQ,
+  const HermitianSDCCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    MakeHermitian( uplo, A );
+    const Real oneA = OneNorm( A );
 
     // G := sgn(G)
     // G := 1/2 ( G + I )
-    PolarCtrl ctrl;
-    ctrl.qdwh = true;
-    HermitianPolar( uplo, G, ctrl );
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    HermitianPolar( uplo, G, polarCtrl );
     ShiftDiagonal( G, F(1) );
     G *= F(1)/F(2);
 
-    // Compute the pivoted QR decomposition of the spectral projection 
-    const Grid& g = A.Grid();
+    // G is (approximately) an orthogonal projector, so its trace is the
+    // dimension of its range
+    ValueInt<Real> part;
+    part.index = Int(Round(RealPart(Trace(G))));
+    if( part.index <= 0 || part.index >= n )
+    {
+        part.value = limits::Infinity<Real>();
+        return part;
+    }
+    const Int k = part.index;
+
+    // Compute an orthonormal basis for the range of G
+    DistMatrix<F> X(g), Y(g);
     DistMatrix<F,MD,STAR> t(g);
-    DistMatrix<Base<F>,MD,STAR> d(g);
-    DistMatrix<Int,VR,STAR> p(g);
-    El::QR( G, t, d, p );
+    DistMatrix<Real,MD,STAR> d(g);
+    const Int numIts = Max( ctrl.maxInnerIts, Int(1) );
+    Gaussian( X, n, k );
+    for( Int it=0; it<numIts; ++it )
+    {
+        Gemm( NORMAL, NORMAL, F(1), G, X, Y );
+        if( it < numIts-1 )
+        {
+            qr::ExplicitUnitary( Y );
+            X = Y;
+        }
+    }
+    El::QR( Y, t, d );
 
     // A := Q^H A Q
-    MakeHermitian( uplo, A );
-    const Base<F> oneA = OneNorm( A );
     if( returnQ )
     {
-        ExpandPackedReflectors( LOWER, VERTICAL, CONJUGATED, 0, G, t );
-        DiagonalScale( RIGHT, NORMAL, d, G );
+        Identity( G, n, n );
+        qr::ApplyQ( LEFT, NORMAL, Y, t, d, G );
         DistMatrix<F> B(g);
         Gemm( ADJOINT, NORMAL, F(1), G, A, B );
         Gemm( NORMAL, NORMAL, F(1), B, G, A );
     }
     else
     {
-        qr::ApplyQ( LEFT, ADJOINT, G, t, d, A );
-        qr::ApplyQ( RIGHT, NORMAL, G, t, d, A );
+        qr::ApplyQ( LEFT, ADJOINT, Y, t, d, A );
+        qr::ApplyQ( RIGHT, NORMAL, Y, t, d, A );
     }
 
     // Return || E21 ||1 / || A ||1 and the chosen rank
-    auto part = ComputePartition( A );
-    part.value /= oneA;
+    auto E21 = A( IR(k,n), IR(0,k) );
+    part.value = EntrywiseNorm( E21, Real(1) ) / oneA;
     return part;
 }
 
@@ -210,7 +268,7 @@ RandomizedSignDivide
     auto S( G );
     PolarCtrl polarCtrl;
     polarCtrl.qdwh = true;
-    HermitianPolar( uplo, G, polarCtrl );
+    HermitianPolar( uplo, S, polarCtrl );
     ShiftDiagonal( S, F(1) );
     S *= F(1)/F(2);
 
@@ -283,12 +341,19 @@ SpectralDivide
         ACopy = A;
     while( it < ctrl.maxOuterIts )
     {
-        const Real shift = SampleBall<Real>(-median.value,spread);
+        // QDWH-eig first attempts to split exactly at the median
+        const Real shift =
+          ( ctrl.qdwhEig && it == 0 ?
+            -median.value :
+            SampleBall<Real>(-median.value,spread) );
 
         G = A;
         ShiftDiagonal( G, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, G, false, ctrl );
+        part =
+          ( ctrl.qdwhEig ?
+            QDWHDivide( uplo, A, G, false, ctrl ) :
+            RandomizedSignDivide( uplo, A, G, false, ctrl ) );
 
         ++it;
         if( part.value <= tol )
@@ -332,12 +397,19 @@ SpectralDivide
         ACopy = A;
     while( it < ctrl.maxOuterIts )
     {
-        const Real shift = SampleBall<Real>(-median.value,spread);
+        // QDWH-eig first attempts to split exactly at the median
+        const Real shift =
+          ( ctrl.qdwhEig && it == 0 ?
+            -median.value :
+            SampleBall<Real>(-median.value,spread) );
 
         Q = A;
         ShiftDiagonal( Q, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, Q, true, ctrl );
+        part =
+          ( ctrl.qdwhEig ?
+            QDWHDivide( uplo, A, Q, true, ctrl ) :
+            RandomizedSignDivide( uplo, A, Q, true, ctrl ) );
 
         ++it;
         if( part.value <= tol )
@@ -380,13 +452,20 @@ SpectralDivide
         ACopy = A;
     while( it < ctrl.maxOuterIts )
     {
-        Real shift = SampleBall<Real>(-median.value,spread);
+        // QDWH-eig first attempts to split exactly at the median
+        Real shift =
+          ( ctrl.qdwhEig && it == 0 ?
+            -median.value :
+            SampleBall<Real>(-median.value,spread) );
         mpi::Broadcast( shift, 0, A.Grid().VCComm() );
 
         G = A;
         ShiftDiagonal( G, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, G, false, ctrl );
+        part =
+          ( ctrl.qdwhEig ?
+            QDWHDivide( uplo, A, G, false, ctrl ) :
+            RandomizedSignDivide( uplo, A, G, false, ctrl ) );
 
         ++it;
         if( part.value <= tol )
@@ -430,13 +509,20 @@ SpectralDivide
         ACopy = A;
     while( it < ctrl.maxOuterIts )
     {
-        Real shift = SampleBall<Real>(-median.value,spread);
+        // QDWH-eig first attempts to split exactly at the median
+        Real shift =
+          ( ctrl.qdwhEig && it == 0 ?
+            -median.value :
+            SampleBall<Real>(-median.value,spread) );
         mpi::Broadcast( shift, 0, A.Grid().VCComm() );
 
         Q = A;
         ShiftDiagonal( Q, F(shift) );
 
-        part = RandomizedSignDivide( uplo, A, Q, true, ctrl );
+        part =
+          ( ctrl.qdwhEig ?
+            QDWHDivide( uplo, A, Q, true, ctrl ) :
+            RandomizedSignDivide( uplo, A, Q, true, ctrl ) );
 
         ++it;
         if( part.value <= tol )
@@ -10,6 +10,7 @@
 
 #include "./HermitianTridiagEig/QR.hpp"
 #include "./HermitianTridiagEig/DivideAndConquer.hpp"
+#include "./HermitianTridiagEig/MRRR.hpp"
 
 // NOTE: dSubReal and QReal could be packed into their complex counterparts
 
@@ -341,6 +342,21 @@ DCHelper
     return info;
 }
 
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianTridiagEigInfo info;
+    info.mrrrInfo = MRRR( d, dSub, w, ctrl );
+    Sort( w, ctrl.sort );
+    return info;
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -401,6 +417,10 @@ Helper
         auto dSubMod( dSub );
         return DCHelper( dMod, dSubMod, w, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, w, ctrl );
+    }
     // Both d and dSub need to be modifiable
     auto dMod( d );
     auto dSubMod( dSub );
@@ -424,12 +444,16 @@ Helper
         auto dSubMod( dSub );
         return QRHelper( d, dSubMod, w, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         auto dMod( d );
         auto dSubMod( dSub );
         return DCHelper( dMod, dSubMod, w, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, ctrl );
+    }
 }
 
 template<typename Real>
@@ -565,6 +589,48 @@ DCHelper
     return info;
 }
 
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const AbstractDistMatrix<Real>& d,
+  const AbstractDistMatrix<Real>& dSub,
+        AbstractDistMatrix<Real>& wPre,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    HermitianTridiagEigInfo info;
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR(d), dSub_STAR_STAR(dSub);
+
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+
+    Matrix<Real> wLoc;
+    info.mrrrInfo =
+      MRRR
+      ( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), wLoc,
+        w.Grid().VRComm(), ctrl );
+    Sort( wLoc, ctrl.sort );
+    w.Resize( wLoc.Height(), 1 );
+    w.Matrix() = wLoc;
+    return info;
+}
+
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const AbstractDistMatrix<Real         >& d,
+  const AbstractDistMatrix<Complex<Real>>& dSub,
+        AbstractDistMatrix<Real         >& wPre,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = d.Grid();
+    DistMatrix<Complex<Real>,STAR,STAR> dSub_STAR_STAR( dSub );
+    DistMatrix<Real,STAR,STAR> dSubReal(g);
+    RemovePhase( dSub_STAR_STAR, dSubReal );
+    return NativeMRRRHelper( d, dSubReal, wPre, ctrl );
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -635,6 +701,10 @@ Helper
     {
         return DCHelper( d, dSub, wPre, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, wPre, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, wPre, ctrl );
@@ -656,10 +726,14 @@ Helper
     {
         return QRHelper( d, dSub, w, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         return DCHelper( d, dSub, w, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, ctrl );
+    }
 }
 
 template<typename Real,
@@ -744,6 +818,10 @@ Helper
     {
         return DCHelper( d, dSub, wPre, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, wPre, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, wPre, ctrl );
@@ -765,10 +843,14 @@ Helper
     {
         return QRHelper( d, dSub, w, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         return DCHelper( d, dSub, w, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, ctrl );
+    }
 }
 
 } // namespace herm_tridiag_eig
@@ -833,6 +915,28 @@ DCHelper
     return info;
 }
 
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+        Matrix<Real>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.accumulateEigVecs )
+        LogicError("Accumulation not yet supported for MRRR");
+    HermitianTridiagEigInfo info;
+    info.mrrrInfo = MRRR( d, dSub, w, Q, ctrl );
+    const Int k = w.Height();
+    auto sortPairs = TaggedSort( w, ctrl.sort );
+    for( Int j=0; j<k; ++j )
+        w(j) = sortPairs[j].value;
+    ApplyTaggedSortToEachRow( sortPairs, Q );
+    return info;
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -908,6 +1012,10 @@ Helper
         auto dSubMod( dSub );
         return DCHelper( dMod, dSubMod, w, Q, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
     else
     {
         // Both d and dSub need to be modified
@@ -935,12 +1043,16 @@ Helper
         auto dSubMod( dSub );
         return QRHelper( d, dSubMod, w, Q, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         auto dMod( d );
         auto dSubMod( dSub );
         return DCHelper( dMod, dSubMod, w, Q, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
 }
 
 // (Y^H T Y) QHat = QHat Lambda
@@ -1150,6 +1262,72 @@ DCHelper
     return info;
 }
 
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const AbstractDistMatrix<Real>& d,
+  const AbstractDistMatrix<Real>& dSub,
+        AbstractDistMatrix<Real>& wPre,
+        AbstractDistMatrix<Real>& QPre,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.accumulateEigVecs )
+        LogicError("Accumulation not yet supported for MRRR");
+    HermitianTridiagEigInfo info;
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR(d), dSub_STAR_STAR(dSub);
+
+    // Each eigenvector is computed by a single process
+    ElementalProxyCtrl QCtrl;
+    QCtrl.rowConstrain = true;
+    QCtrl.rowAlign = 0;
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    DistMatrixWriteProxy<Real,Real,STAR,VR> QProx( QPre, QCtrl );
+    auto& w = wProx.Get();
+    auto& Q = QProx.Get();
+
+    Matrix<Real> wLoc;
+    info.mrrrInfo =
+      MRRR( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), wLoc, Q, ctrl );
+
+    const Int k = wLoc.Height();
+    auto sortPairs = TaggedSort( wLoc, ctrl.sort );
+    for( Int j=0; j<k; ++j )
+        wLoc(j) = sortPairs[j].value;
+    ApplyTaggedSortToEachRow( sortPairs, Q );
+    w.Resize( k, 1 );
+    w.Matrix() = wLoc;
+
+    return info;
+}
+
+template<typename Real>
+HermitianTridiagEigInfo
+NativeMRRRHelper
+( const AbstractDistMatrix<Real         >& d,
+  const AbstractDistMatrix<Complex<Real>>& dSub,
+        AbstractDistMatrix<Real         >& w,
+        AbstractDistMatrix<Complex<Real>>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> F;
+    const Grid& g = d.Grid();
+
+    DistMatrix<F,STAR,STAR> dSub_STAR_STAR( dSub );
+    DistMatrix<Real,STAR,STAR> dSubReal(g);
+    DistMatrix<F,STAR,STAR> phase(g);
+    RemovePhase( dSub_STAR_STAR, dSubReal, phase );
+
+    DistMatrix<Real,STAR,VR> QReal(g);
+    auto info = NativeMRRRHelper( d, dSubReal, w, QReal, ctrl );
+
+    Copy( QReal, Q );
+    DiagonalScale( LEFT, NORMAL, phase, Q );
+
+    return info;
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -1344,6 +1522,10 @@ Helper
     {
         return DCHelper( d, dSub, w, Q, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, w, Q, ctrl );
@@ -1366,10 +1548,14 @@ Helper
     {
         return QRHelper( d, dSub, w, Q, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         return DCHelper( d, dSub, w, Q, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
 }
 
 template<typename Real,
@@ -1391,6 +1577,10 @@ Helper
     {
         return DCHelper( d, dSub, w, Q, ctrl );
     }
+    else if( ctrl.mrrrCtrl.native )
+    {
+        return NativeMRRRHelper( d, dSub, w, Q, ctrl );
+    }
     else
     {
         return MRRRHelper( d, dSub, w, Q, ctrl );
@@ -1413,10 +1603,14 @@ Helper
     {
         return QRHelper( d, dSub, w, QPre, ctrl );
     }
-    else
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_DC )
     {
         return DCHelper( d, dSub, w, QPre, ctrl );
     }
+    else
+    {
+        return NativeMRRRHelper( d, dSub, w, QPre, ctrl );
+    }
 }
 
 } // namespace herm_tridiag_eig
@@ -1442,11 +1636,16 @@ Int MRRREstimateHelper
 ( const AbstractDistMatrix<Real>& d,
   const AbstractDistMatrix<Real>& dSub,
         mpi::Comm wColComm,
-        Real vl,
-        Real vu )
+  const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
     const Int n = d.Height();
+    if( ctrl.mrrrCtrl.native )
+    {
+        DistMatrix<Real,STAR,STAR> d_STAR_STAR(d), dSub_STAR_STAR(dSub);
+        return MRRRNumEigenvalues
+        ( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), ctrl.subset );
+    }
     DistMatrix<double,STAR,STAR> d_STAR_STAR( d.Grid() );
     DistMatrix<double,STAR,STAR> dSub_STAR_STAR( d.Grid() );
     Copy( d, d_STAR_STAR );
@@ -1457,7 +1656,7 @@ Int MRRREstimateHelper
     MemCopy( dSubVector.data(), dSub_STAR_STAR.Buffer(), n-1 );
     auto estimate = herm_tridiag_eig::EigEstimate
     ( int(n), dVector.data(), dSubVector.data(), wVector.data(), wColComm,
-      vl, vu );
+      ctrl.subset.lowerBound, ctrl.subset.upperBound );
     return estimate.numGlobalEigenvalues;
 }
 
@@ -1468,12 +1667,12 @@ Int MRRREstimateHelper
 ( const AbstractDistMatrix<Real>& d,
   const AbstractDistMatrix<Real>& dSub,
         mpi::Comm wColComm,
-        Real vl,
-        Real vu )
+  const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    LogicError("MRRREstimate not yet supported for nonstandard datatypes");
-    return 0;
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR(d), dSub_STAR_STAR(dSub);
+    return MRRRNumEigenvalues
+    ( d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(), ctrl.subset );
 }
 
 // Q is assumed to be sufficiently large and properly aligned
@@ -1485,11 +1684,12 @@ MRRRPostEstimateHelper
   const AbstractDistMatrix<Real>& dSub,
         AbstractDistMatrix<Real>& wPre,
         AbstractDistMatrix<Real>& QPre,
-        SortType sort,
-        Real vl,
-        Real vu )
+  const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.mrrrCtrl.native )
+        return NativeMRRRHelper( d, dSub, wPre, QPre, ctrl );
+
     HermitianTridiagEigInfo info;
 
     ElementalProxyCtrl wCtrl, QCtrl;
@@ -1513,7 +1713,8 @@ MRRRPostEstimateHelper
     vector<double> wVector(n);
     auto rangeInfo = herm_tridiag_eig::Eig
     ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(), wVector.data(),
-      Q.Buffer(), Q.LDim(), w.ColComm(), vl, vu );
+      Q.Buffer(), Q.LDim(), w.ColComm(),
+      ctrl.subset.lowerBound, ctrl.subset.upperBound );
     const Int k = rangeInfo.numGlobalEigenvalues;
 
     w.Resize( k, 1 );
@@ -1523,7 +1724,7 @@ MRRRPostEstimateHelper
     // Shrink Q
     Q.Resize( n, k );
 
-    auto sortPairs = TaggedSort( w, sort );
+    auto sortPairs = TaggedSort( w, ctrl.sort );
     for( Int j=0; j<n; ++j )
         w.Set( j, 0, sortPairs[j].value );
     ApplyTaggedSortToEachRow( sortPairs, Q );
@@ -1540,27 +1741,23 @@ MRRRPostEstimateHelper
   const AbstractDistMatrix<Real>& dSub,
         AbstractDistMatrix<Real>& wPre,
         AbstractDistMatrix<Real>& QPre,
-        SortType sort,
-        Real vl,
-        Real vu )
+  const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    LogicError
-    ("HermitianTridiagEigEstimate not yet supported for nonstandard datatypes");
-    HermitianTridiagEigInfo info;
-    return info;
+    return NativeMRRRHelper( d, dSub, wPre, QPre, ctrl );
 }
 
+// Return an upper bound on the number of eigenvalues in the requested range
+// (which is exact for the native MRRR implementation)
 template<typename Real>
 Int MRRREstimate
 ( const AbstractDistMatrix<Real>& d,
   const AbstractDistMatrix<Real>& dSub,
         mpi::Comm wColComm,
-        Real vl,
-        Real vu )
+  const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    return MRRREstimateHelper( d, dSub, wColComm, vl, vu );
+    return MRRREstimateHelper( d, dSub, wColComm, ctrl );
 }
 
 // Q is assumed to be sufficiently large and properly aligned
@@ -1571,12 +1768,10 @@ MRRRPostEstimate
   const AbstractDistMatrix<Real>& dSub,
         AbstractDistMatrix<Real>& w,
         AbstractDistMatrix<Real>& Q,
-        SortType sort,
-        Real vl,
-        Real vu )
+  const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    return MRRRPostEstimateHelper( d, dSub, w, Q, sort, vl, vu );
+    return MRRRPostEstimateHelper( d, dSub, w, Q, ctrl );
 }
 
 } // namespace herm_tridiag_eig
@@ -1624,15 +1819,14 @@ MRRRPostEstimate
   template Int herm_tridiag_eig::MRRREstimate \
   ( const AbstractDistMatrix<Real>& d, \
     const AbstractDistMatrix<Real>& dSub, \
-          mpi::Comm wColComm, Real vl, Real vu ); \
+          mpi::Comm wColComm, \
+    const HermitianTridiagEigCtrl<Real>& ctrl ); \
   template HermitianTridiagEigInfo herm_tridiag_eig::MRRRPostEstimate \
   ( const AbstractDistMatrix<Real>& d, \
     const AbstractDistMatrix<Real>& dSub, \
           AbstractDistMatrix<Real>& w, \
           AbstractDistMatrix<Real>& Q, \
-          SortType sort, \
-          Real vl, \
-          Real vu );
+    const HermitianTridiagEigCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
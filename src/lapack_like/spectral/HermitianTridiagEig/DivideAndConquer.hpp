@@ -431,36 +431,46 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
-    for( Int j=0; j<numUndeflated; ++j )
-    {
-        auto minusShift = QSecular( ALL, IR(j) );
-
-        auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
-            dcCtrl.secularCtrl );
-        if( ctrl.progress )
+    // The secular equations are solved as a (possibly concurrent) batch, and
+    // the eigenvectors are formed concurrently for sufficiently large merges.
+#ifdef EL_HYBRID
+    const bool parallelMerge = ( n >= dcCtrl.taskCutoff );
+#else
+    const bool parallelMerge = false;
+#endif
+    auto dSecular = d( undeflatedInd, ALL );
+    auto batchInfo =
+      SecularEigenvalues
+      ( dUndeflated, rho, zUndeflated, dSecular, QSecular,
+        dcCtrl.secularCtrl );
+    if( ctrl.progress )
+        for( Int j=0; j<numUndeflated; ++j )
             Output("Secular eigenvalue ",j," is ",d(j));
-
-        secularInfo.numIterations += valueInfo.numIterations;
-        secularInfo.numAlternations += valueInfo.numAlternations;
-        secularInfo.numCubicIterations += valueInfo.numCubicIterations;
-        secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
+    secularInfo.numIterations += batchInfo.numIterations;
+    secularInfo.numAlternations += batchInfo.numAlternations;
+    secularInfo.numCubicIterations += batchInfo.numCubicIterations;
+    secularInfo.numCubicFailures += batchInfo.numCubicFailures;
+
+    // Each entry of the corrected update vector is a product over all of the
+    // secular solutions (accumulated in the same order as a loop over them)
+    EL_TASKLOOP_IF( parallelMerge )
+    for( Int k=0; k<numUndeflated; ++k )
+    {
+        for( Int j=0; j<numUndeflated; ++j )
         {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
+            if( j == k )
+                rCorrected(k) *= QSecular(k,k);
+            else
+                rCorrected(k) *=
+                  QSecular(k,j) / (dUndeflated(j)-dUndeflated(k));
         }
+        rCorrected(k) = Sgn(zUndeflated(k),false) * Sqrt(Abs(rCorrected(k)));
     }
-    for( Int j=0; j<numUndeflated; ++j )
-        rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
     // Compute the unnormalized eigenvectors.
     if( ctrl.progress )
         Output("Computing unnormalized eigenvectors");
+    EL_TASKLOOP_IF( parallelMerge )
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto q = QSecular(ALL,IR(j));
@@ -476,6 +486,7 @@ Merge
     if( ctrl.progress )
         Output("Forming undeflated right singular vectors");
     U.Resize( numUndeflated, numUndeflated );
+    EL_TASKLOOP_IF( parallelMerge )
     for( Int j=0; j<numUndeflated; ++j )
     {
         auto q = QSecular(ALL,IR(j));
@@ -501,58 +512,54 @@ Merge
     //                      |-------------|
     //                      | Z_{1,1} U_1 |
     //
+    // When only the two rows of the eigenvectors are wanted, the block rows
+    // are each a single row.
     if( ctrl.progress )
         Output("Overwriting eigenvectors");
     auto QUndeflated = Q( ALL, undeflatedInd );
-    if( ctrl.wantEigVecs )
-    {
+    const Range<Int> firstBlockRows = ( ctrl.wantEigVecs ? IR(0,n0) : IR(0) );
+    const Range<Int> secondBlockRows = ( ctrl.wantEigVecs ? IR(n0,n) : IR(1) );
+    auto updateEigenvectors =
+      [&]( const Range<Int>& colInd )
+      {
+        auto QUpdate = QUndeflated( ALL, colInd );
         if( dcCtrl.exploitStructure )
         {
             auto Z2 = QPacked( ALL, packingInd2 );
-            auto U2 = U( packingInd2, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z2, U2, QUndeflated );
+            auto U2 = U( packingInd2, colInd );
+            Gemm( NORMAL, NORMAL, Real(1), Z2, U2, QUpdate );
 
             // Finish updating the first block row
-            auto Q0Undeflated = QUndeflated( IR(0,n0), ALL );
-            auto Z00 = QPacked( IR(0,n0), packingInd0 );
-            auto U0 = U( packingInd0, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z00, U0, Real(1), Q0Undeflated );
+            auto Q0Update = QUpdate( firstBlockRows, ALL );
+            auto Z00 = QPacked( firstBlockRows, packingInd0 );
+            auto U0 = U( packingInd0, colInd );
+            Gemm( NORMAL, NORMAL, Real(1), Z00, U0, Real(1), Q0Update );
 
             // Finish updating the second block row
-            auto Q1Undeflated = QUndeflated( IR(n0,n), ALL );
-            auto Z11 = QPacked( IR(n0,n), packingInd1 );
-            auto U1 = U( packingInd1, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z11, U1, Real(1), Q1Undeflated );
+            auto Q1Update = QUpdate( secondBlockRows, ALL );
+            auto Z11 = QPacked( secondBlockRows, packingInd1 );
+            auto U1 = U( packingInd1, colInd );
+            Gemm( NORMAL, NORMAL, Real(1), Z11, U1, Real(1), Q1Update );
         }
         else
         {
-            Gemm( NORMAL, NORMAL, Real(1), QPacked, U, QUndeflated );
+            auto UCols = U( ALL, colInd );
+            Gemm( NORMAL, NORMAL, Real(1), QPacked, UCols, QUpdate );
         }
+      };
+    if( parallelMerge )
+    {
+        // Split the update into column panels
+        const Int bsize = Max( Blocksize(), Int(1) );
+        const Int numPanels = (numUndeflated+bsize-1) / bsize;
+        EL_TASKLOOP_IF( parallelMerge )
+        for( Int panel=0; panel<numPanels; ++panel )
+            updateEigenvectors
+            ( IR(panel*bsize,Min((panel+1)*bsize,numUndeflated)) );
     }
     else
     {
-        if( dcCtrl.exploitStructure )
-        {
-            auto Z2 = QPacked( ALL, packingInd2 );
-            auto U2 = U( packingInd2, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z2, U2, QUndeflated );
-
-            // Finish updating the first block row
-            auto Q0Undeflated = QUndeflated( IR(0), ALL );
-            auto Z00 = QPacked( IR(0), packingInd0 );
-            auto U0 = U( packingInd0, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z00, U0, Real(1), Q0Undeflated );
-
-            // Finish updating the second block row
-            auto Q1Undeflated = QUndeflated( IR(1), ALL );
-            auto Z11 = QPacked( IR(1), packingInd1 );
-            auto U1 = U( packingInd1, ALL );
-            Gemm( NORMAL, NORMAL, Real(1), Z11, U1, Real(1), Q1Undeflated );
-        }
-        else
-        {
-            Gemm( NORMAL, NORMAL, Real(1), QPacked, U, QUndeflated );
-        }
+        updateEigenvectors( undeflatedInd );
     }
 
     // Rescale the eigenvalues
@@ -1121,7 +1128,8 @@ DivideAndConquer
         Matrix<Real>& superDiag,
         Matrix<Real>& w,
         Matrix<Real>& Q,
-  const HermitianTridiagEigCtrl<Real>& ctrl )
+  const HermitianTridiagEigCtrl<Real>& ctrl,
+  bool topLevel=true )
 {
     EL_DEBUG_CSE
     const Int n = mainDiag.Height();
@@ -1132,6 +1140,16 @@ DivideAndConquer
          "computation");
 
     DCInfo info;
+#ifdef EL_HYBRID
+    if( topLevel && !omp_in_parallel() && n >= dcCtrl.taskCutoff )
+    {
+        // Open a team of threads which the recursion populates with tasks
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        info = DivideAndConquer( mainDiag, superDiag, w, Q, ctrl, false );
+        return info;
+    }
+#endif
     auto& secularInfo = info.secularInfo;
     if( n <= Max(dcCtrl.cutoff,3) )
     {
@@ -1179,11 +1197,15 @@ DivideAndConquer
         Zeros( Q1, 2, n-split );
     }
 
-    Matrix<Real> w0;
-    auto info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl );
-
-    Matrix<Real> w1;
-    auto info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl );
+    // The two subproblems are independent and, for sufficiently large
+    // problems, are solved as concurrent tasks.
+    Matrix<Real> w0, w1;
+    DCInfo info0, info1;
+    EL_TASK_IF( n >= dcCtrl.taskCutoff )
+    info0 = DivideAndConquer( mainDiag0, superDiag0, w0, Q0, ctrl, false );
+    EL_TASK_IF( n >= dcCtrl.taskCutoff )
+    info1 = DivideAndConquer( mainDiag1, superDiag1, w1, Q1, ctrl, false );
+    EL_TASKWAIT
 
     if( !ctrl.wantEigVecs )
     {
@@ -0,0 +1,1342 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERM_TRIDIAG_EIG_MRRR_HPP
+#define EL_HERM_TRIDIAG_EIG_MRRR_HPP
+
+namespace El {
+namespace herm_tridiag_eig {
+
+// A native implementation of Dhillon and Parlett's algorithm of Multiple
+// Relatively Robust Representations (MRRR) [CITATION] which loosely follows
+// LAPACK's {s,d}stemr [CITATION] (and its subroutines {s,d}larr{b,e,v} and
+// {s,d}lar1v). Unlike PMRRR, it supports arbitrary real datatypes and its
+// only source of shared-memory parallelism is OpenMP.
+//
+// After scaling the tridiagonal matrix and splitting it wherever its
+// off-diagonal entries are negligible, a root representation
+//
+//     L D L^T = T - sigma I
+//
+// is formed for each diagonal block by shifting just past whichever end of its
+// spectrum is closest to the requested eigenvalues. The requested eigenvalues
+// (along with one neighbor on each side, so that their gaps are known) are then
+// bisected to high relative accuracy and partitioned into singletons and
+// clusters. The eigenvector of each singleton is computed from a twisted
+// factorization (with Rayleigh Quotient Iteration), whereas each cluster is
+// shifted to a new representation in which its eigenvalues are relatively
+// well-separated.
+//
+// Since the groups at the root of each representation tree are independent,
+// they are distributed over the processes and threads.
+
+namespace mrrr {
+
+// A relatively robust representation L D L^T = T - shift I of a diagonal block
+// of the (scaled) tridiagonal matrix, where L is unit lower bidiagonal with
+// subdiagonal 'L'. The products L D and L L D are used by the differential qd
+// transforms.
+template<typename Real>
+struct Representation
+{
+    Real shift;
+    vector<Real> D, L, LD, LLD;
+};
+
+template<typename Real>
+void FormProducts( Representation<Real>& rep )
+{
+    const Int n = rep.D.size();
+    rep.LD.resize( n-1 );
+    rep.LLD.resize( n-1 );
+    for( Int i=0; i<n-1; ++i )
+    {
+        rep.LD[i] = rep.L[i]*rep.D[i];
+        rep.LLD[i] = rep.L[i]*rep.LD[i];
+    }
+}
+
+// Return the number of eigenvalues of L D L^T less than x using the
+// differential stationary qd transform. As in LAPACK's {s,d}laneg
+// [CITATION], the (IEEE) semantics of tiny pivots are emulated: the pivot
+// following a tiny pivot is effectively infinite (with an explicitly computed
+// sign), and the one after that is recomputed from scratch. This avoids any
+// reliance on infinities for the extended-precision datatypes.
+template<typename Real>
+Int NegCount
+( const Representation<Real>& rep, const Real& x, const Real& pivmin )
+{
+    const Int n = rep.D.size();
+    const Real* D = rep.D.data();
+    const Real* LLD = rep.LLD.data();
+
+    Int numNeg = 0;
+    Real t = -x;
+    Int i = 0;
+    while( i < n-1 )
+    {
+        const Real dPlus = D[i] + t;
+        if( dPlus < Real(0) )
+            ++numNeg;
+        if( Abs(dPlus) < pivmin )
+        {
+            if( t == Real(0) || LLD[i] == Real(0) )
+            {
+                t = ( t == Real(0) ? LLD[i] - x : -x );
+                ++i;
+                continue;
+            }
+            // The next pivot is (t/dPlus)*LLD[i], which is effectively
+            // infinite, and the ratio of the following update is one
+            const bool nextNeg =
+              ((t < Real(0)) != (dPlus < Real(0))) != (LLD[i] < Real(0));
+            if( nextNeg )
+                ++numNeg;
+            if( i+1 == n-1 )
+                return numNeg;
+            t = LLD[i+1] - x;
+            i += 2;
+            continue;
+        }
+        t = (t/dPlus)*LLD[i] - x;
+        ++i;
+    }
+    if( i == n-1 && D[n-1] + t < Real(0) )
+        ++numNeg;
+    return numNeg;
+}
+
+// Return the number of eigenvalues of the tridiagonal matrix with diagonal 'd'
+// and squared off-diagonal 'eSq' which are less than x
+template<typename Real>
+Int TridiagNegCount
+( Int n, const Real* d, const Real* eSq, const Real& x, const Real& pivmin )
+{
+    Int numNeg = 0;
+    Real q = d[0] - x;
+    if( Abs(q) < pivmin )
+        q = -pivmin;
+    if( q < Real(0) )
+        ++numNeg;
+    for( Int i=1; i<n; ++i )
+    {
+        q = d[i] - x - eSq[i-1]/q;
+        if( Abs(q) < pivmin )
+            q = -pivmin;
+        if( q < Real(0) )
+            ++numNeg;
+    }
+    return numNeg;
+}
+
+// Refine the interval [lower,upper], which must satisfy
+//
+//   count(lower) <= j < count(upper),
+//
+// until it contains the j'th eigenvalue to the requested tolerance
+template<typename Real,class CountFunctor>
+void Bisect
+( const CountFunctor& count,
+  Int j,
+  Real& lower,
+  Real& upper,
+  const Real& relTol,
+  const Real& absTol )
+{
+    const Int maxIts = 4*NumMantissaBits<Real>() + 64;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        const Real tol = Max( absTol, relTol*Max(Abs(lower),Abs(upper)) );
+        if( upper-lower <= tol )
+            break;
+        const Real mid = (lower+upper)/Real(2);
+        if( mid == lower || mid == upper )
+            break;
+        if( count(mid) <= j )
+            lower = mid;
+        else
+            upper = mid;
+    }
+}
+
+// Compute (an outer approximation of) the Gershgorin interval of the
+// tridiagonal matrix with diagonal 'd' and off-diagonal 'e'
+template<typename Real>
+void GershgorinBounds
+( Int n, const Real* d, const Real* e, const Real& pivmin,
+  Real& lower, Real& upper )
+{
+    const Real eps = limits::Epsilon<Real>();
+    lower = upper = d[0];
+    for( Int i=0; i<n; ++i )
+    {
+        Real radius = 0;
+        if( i > 0 )
+            radius += Abs(e[i-1]);
+        if( i < n-1 )
+            radius += Abs(e[i]);
+        lower = Min( lower, d[i]-radius );
+        upper = Max( upper, d[i]+radius );
+    }
+    const Real margin =
+      4*eps*n*Max(Abs(lower),Abs(upper)) + Real(2)*pivmin;
+    lower -= margin;
+    upper += margin;
+}
+
+// Form L+ D+ L+^T = L D L^T - tau I using the differential stationary qd
+// transform and return whether the result is finite, as well as its element
+// growth, max_i |D+(i)|.
+template<typename Real>
+bool ShiftRepresentation
+( const Representation<Real>& rep,
+  const Real& tau,
+  const Real& pivmin,
+        Representation<Real>& child,
+        Real& growth )
+{
+    const Int n = rep.D.size();
+    child.shift = rep.shift + tau;
+    child.D.resize( n );
+    child.L.resize( n-1 );
+    Real s = -tau;
+    for( Int i=0; i<n-1; ++i )
+    {
+        Real dPlus = rep.D[i] + s;
+        if( Abs(dPlus) < pivmin )
+            dPlus = -pivmin;
+        child.D[i] = dPlus;
+        child.L[i] = rep.LD[i] / dPlus;
+        s = child.L[i]*rep.L[i]*s - tau;
+    }
+    child.D[n-1] = rep.D[n-1] + s;
+    if( Abs(child.D[n-1]) < pivmin )
+        child.D[n-1] = -pivmin;
+
+    growth = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        if( !limits::IsFinite(child.D[i]) )
+            return false;
+        growth = Max( growth, Abs(child.D[i]) );
+    }
+    FormProducts( child );
+    return true;
+}
+
+// Compute an (unnormalized) approximate eigenvector z of L D L^T for the
+// eigenvalue estimate lambda from the twisted factorization
+//
+//     L D L^T - lambda I = N_r Delta_r N_r^T
+//
+// whose twist index, r, minimizes |gamma_r|, as in LAPACK's {s,d}lar1v
+// [CITATION]. On exit, gamma = gamma_r and zNormSquared = || z ||_2^2, so that
+// the residual norm is |gamma| / || z ||_2 and the Rayleigh Quotient
+// correction is gamma / || z ||_2^2.
+template<typename Real>
+void TwistedVector
+( const Representation<Real>& rep,
+  const Real& lambda,
+  const Real& pivmin,
+        Real* z,
+        Real& gamma,
+        Real& zNormSquared )
+{
+    const Int n = rep.D.size();
+    const Real* D = rep.D.data();
+    const Real* L = rep.L.data();
+    const Real* LD = rep.LD.data();
+    const Real* LLD = rep.LLD.data();
+    vector<Real> s(n), p(n), LPlus(n-1), UMinus(n-1);
+
+    // Top-down stationary qd transform
+    s[0] = -lambda;
+    for( Int i=0; i<n-1; ++i )
+    {
+        Real dPlus = D[i] + s[i];
+        if( Abs(dPlus) < pivmin )
+            dPlus = -pivmin;
+        LPlus[i] = LD[i] / dPlus;
+        s[i+1] = LPlus[i]*L[i]*s[i] - lambda;
+    }
+
+    // Bottom-up progressive qd transform
+    p[n-1] = D[n-1] - lambda;
+    for( Int i=n-2; i>=0; --i )
+    {
+        Real dMinus = LLD[i] + p[i+1];
+        if( Abs(dMinus) < pivmin )
+            dMinus = -pivmin;
+        const Real ratio = D[i] / dMinus;
+        UMinus[i] = L[i]*ratio;
+        p[i] = p[i+1]*ratio - lambda;
+    }
+
+    Int r = 0;
+    gamma = s[0] + p[0] + lambda;
+    for( Int i=1; i<n; ++i )
+    {
+        const Real gammaCand = s[i] + p[i] + lambda;
+        if( Abs(gammaCand) < Abs(gamma) )
+        {
+            gamma = gammaCand;
+            r = i;
+        }
+    }
+
+    // Solve N_r^T z = e_r, recovering from (rare) exact zeros using the
+    // original equations
+    z[r] = 1;
+    for( Int i=r-1; i>=0; --i )
+    {
+        z[i] = -LPlus[i]*z[i+1];
+        if( z[i] == Real(0) && i+2 <= r )
+            z[i] = -(LD[i+1]/LD[i])*z[i+2];
+    }
+    for( Int i=r; i<n-1; ++i )
+    {
+        z[i+1] = -UMinus[i]*z[i];
+        if( z[i+1] == Real(0) && i-1 >= r )
+            z[i+1] = -(LD[i-1]/LD[i])*z[i-1];
+    }
+
+    zNormSquared = 0;
+    for( Int i=0; i<n; ++i )
+        zNormSquared += z[i]*z[i];
+}
+
+// Partition the (ascending) eigenvalue estimates into the half-open index
+// ranges of singletons and clusters
+template<typename Real>
+vector<pair<Int,Int>>
+FormGroups( const vector<Real>& lambda, const Real& minRelGap )
+{
+    const Int k = lambda.size();
+    vector<pair<Int,Int>> groups;
+    Int groupBeg = 0;
+    for( Int t=0; t<k-1; ++t )
+    {
+        const Real gap = lambda[t+1] - lambda[t];
+        if( gap >= minRelGap*Max(Abs(lambda[t]),Abs(lambda[t+1])) )
+        {
+            groups.emplace_back( groupBeg, t+1 );
+            groupBeg = t+1;
+        }
+    }
+    if( k > 0 )
+        groups.emplace_back( groupBeg, k );
+    return groups;
+}
+
+template<typename Real>
+struct Block
+{
+    // The diagonal block T(offset:offset+size,offset:offset+size)
+    Int offset=0, size=0;
+
+    Representation<Real> root;
+
+    // Bounds on the spectrum of the block (relative to the root shift) and the
+    // width of its Gershgorin interval
+    Real lowerBound=Real(0), upperBound=Real(0);
+    Real spectralDiameter=Real(0);
+
+    // The (block-local) indices of the requested eigenpairs
+    Int wantBeg=0, wantEnd=0;
+
+    // The eigenvalues [guardBeg,guardEnd) are bisected relative to the root
+    // representation. This range extends the requested range by one on each
+    // side (where possible) so that the gaps of the requested eigenvalues are
+    // known.
+    Int guardBeg=0, guardEnd=0;
+    vector<Real> lambda, lower, upper;
+
+    // The output column of each requested eigenpair (relative to wantBeg)
+    vector<Int> columns;
+};
+
+template<typename Real>
+struct Problem
+{
+    Int n=0;
+    Real scale=Real(1);
+    Real pivmin=Real(0);
+
+    // The scaled diagonal, off-diagonal, and squared off-diagonal, with the
+    // negligible off-diagonal entries set to zero
+    vector<Real> d, e, eSq;
+
+    // The diagonal blocks containing at least one candidate eigenvalue
+    vector<Block<Real>> blocks;
+
+    // The number of eigenvalues (of all blocks) below the window
+    Int numBelow=0;
+
+    Int numWanted=0;
+};
+
+// Scale and split the tridiagonal matrix and determine which eigenvalues of
+// each diagonal block lie within the requested window. For index subsets, the
+// window is an outer approximation which is later trimmed by SelectWanted.
+template<typename Real>
+void Preprocess
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+  const HermitianEigSubset<Real>& subset,
+        Problem<Real>& problem )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    problem.n = n;
+    problem.blocks.clear();
+    problem.numBelow = 0;
+    problem.numWanted = 0;
+    if( subset.indexSubset && subset.rangeSubset )
+        LogicError("Cannot mix index and range subsets");
+    if( subset.indexSubset &&
+        (subset.lowerIndex < 0 || subset.upperIndex >= n) &&
+        subset.lowerIndex <= subset.upperIndex )
+        LogicError
+        ("Invalid index subset [",subset.lowerIndex,",",subset.upperIndex,
+         "] for n=",n);
+    if( n == 0 ||
+        (subset.indexSubset && subset.lowerIndex > subset.upperIndex) ||
+        (subset.rangeSubset && subset.lowerBound >= subset.upperBound) )
+        return;
+
+    Real scale = 0;
+    for( Int i=0; i<n; ++i )
+        scale = Max( scale, Abs(d(i)) );
+    for( Int i=0; i<n-1; ++i )
+        scale = Max( scale, Abs(dSub(i)) );
+    if( scale == Real(0) )
+        scale = 1;
+    problem.scale = scale;
+
+    problem.d.resize( n );
+    problem.e.resize( n-1 );
+    problem.eSq.resize( n-1 );
+    Real maxAbs = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        problem.d[i] = d(i) / scale;
+        maxAbs = Max( maxAbs, Abs(problem.d[i]) );
+    }
+    for( Int i=0; i<n-1; ++i )
+    {
+        problem.e[i] = dSub(i) / scale;
+        maxAbs = Max( maxAbs, Abs(problem.e[i]) );
+    }
+    Real maxESq = 0;
+    for( Int i=0; i<n-1; ++i )
+    {
+        if( Abs(problem.e[i]) <= eps*maxAbs )
+            problem.e[i] = 0;
+        problem.eSq[i] = problem.e[i]*problem.e[i];
+        maxESq = Max( maxESq, problem.eSq[i] );
+    }
+    problem.pivmin = safeMin*Max(Real(1),maxESq);
+    const Real pivmin = problem.pivmin;
+
+    // Determine the window of eigenvalues (if any)
+    const bool windowed = subset.indexSubset || subset.rangeSubset;
+    Real lowerBound=0, upperBound=0;
+    if( subset.rangeSubset )
+    {
+        lowerBound = subset.lowerBound / scale;
+        upperBound = subset.upperBound / scale;
+    }
+    else if( subset.indexSubset )
+    {
+        Real gl, gu;
+        GershgorinBounds
+        ( n, problem.d.data(), problem.e.data(), pivmin, gl, gu );
+        auto count =
+          [&]( const Real& x )
+          { return TridiagNegCount
+                   ( n, problem.d.data(), problem.eSq.data(), x, pivmin ); };
+        Real lower=gl, upper=gu;
+        Bisect( count, subset.lowerIndex, lower, upper, 2*eps, pivmin );
+        lowerBound = lower - (4*eps*Abs(lower) + Real(2)*pivmin);
+        lower = gl;
+        upper = gu;
+        Bisect( count, subset.upperIndex, lower, upper, 2*eps, pivmin );
+        upperBound = upper + (4*eps*Abs(upper) + Real(2)*pivmin);
+    }
+
+    // Split into diagonal blocks
+    Int blockBeg = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        if( i < n-1 && problem.e[i] != Real(0) )
+            continue;
+        const Int blockEnd = i+1;
+        const Int blockSize = blockEnd - blockBeg;
+        Int numLower=0, numUpper=blockSize;
+        if( windowed )
+        {
+            const Real* dBlock = problem.d.data() + blockBeg;
+            const Real* eSqBlock = problem.eSq.data() + blockBeg;
+            numLower = TridiagNegCount
+              ( blockSize, dBlock, eSqBlock, lowerBound, pivmin );
+            numUpper = TridiagNegCount
+              ( blockSize, dBlock, eSqBlock, upperBound, pivmin );
+            problem.numBelow += numLower;
+        }
+        if( numUpper > numLower )
+        {
+            Block<Real> block;
+            block.offset = blockBeg;
+            block.size = blockSize;
+            block.wantBeg = numLower;
+            block.wantEnd = numUpper;
+            problem.blocks.push_back( std::move(block) );
+        }
+        blockBeg = blockEnd;
+    }
+}
+
+// Form the root representation of each block by shifting to just outside
+// of the end of its spectrum which is closest to the requested eigenvalues
+template<typename Real>
+void FormRootRepresentations( Problem<Real>& problem )
+{
+    EL_DEBUG_CSE
+    const Real eps = limits::Epsilon<Real>();
+    const Real pivmin = problem.pivmin;
+    const Int maxAttempts = 64;
+    for( auto& block : problem.blocks )
+    {
+        const Int m = block.size;
+        block.guardBeg = Max( block.wantBeg-1, Int(0) );
+        block.guardEnd = Min( block.wantEnd+1, m );
+        const Int numRoot = block.guardEnd - block.guardBeg;
+        block.lambda.assign( numRoot, Real(0) );
+        block.lower.assign( numRoot, Real(0) );
+        block.upper.assign( numRoot, Real(0) );
+
+        const Real* dBlock = problem.d.data() + block.offset;
+        const Real* eBlock = problem.e.data() + block.offset;
+        const Real* eSqBlock = problem.eSq.data() + block.offset;
+        auto& root = block.root;
+        if( m == 1 )
+        {
+            root.shift = dBlock[0];
+            root.D.assign( 1, Real(0) );
+            continue;
+        }
+
+        Real gl, gu;
+        GershgorinBounds( m, dBlock, eBlock, pivmin, gl, gu );
+        block.spectralDiameter = gu - gl;
+
+        const bool fromLeft = ( block.wantBeg+block.wantEnd <= m );
+        auto count =
+          [&]( const Real& x )
+          { return TridiagNegCount( m, dBlock, eSqBlock, x, pivmin ); };
+        Real lower=gl, upper=gu;
+        Bisect( count, fromLeft ? 0 : m-1, lower, upper, 4*eps, pivmin );
+        const Real sigma = ( fromLeft ? lower : upper );
+        Real delta = Max( upper-lower, Max(4*eps*Abs(sigma),pivmin) );
+
+        root.D.resize( m );
+        root.L.resize( m-1 );
+        bool definite = false;
+        for( Int attempt=0; attempt<maxAttempts; ++attempt )
+        {
+            root.shift = ( fromLeft ? sigma-delta : sigma+delta );
+            definite = true;
+            root.D[0] = dBlock[0] - root.shift;
+            for( Int i=0; i<m-1; ++i )
+            {
+                if( (fromLeft && root.D[i] <= Real(0)) ||
+                    (!fromLeft && root.D[i] >= Real(0)) )
+                {
+                    definite = false;
+                    break;
+                }
+                root.L[i] = eBlock[i] / root.D[i];
+                root.D[i+1] = dBlock[i+1] - root.shift - root.L[i]*eBlock[i];
+            }
+            if( definite &&
+                ((fromLeft && root.D[m-1] > Real(0)) ||
+                 (!fromLeft && root.D[m-1] < Real(0))) )
+                break;
+            definite = false;
+            delta *= 2;
+        }
+        if( !definite )
+            RuntimeError("Could not form a definite root representation");
+        FormProducts( root );
+        block.lowerBound = gl - root.shift;
+        block.upperBound = gu - root.shift;
+    }
+}
+
+template<typename Real>
+Int NumRootEigenvalues( const Problem<Real>& problem )
+{
+    Int numRoot = 0;
+    for( const auto& block : problem.blocks )
+        numRoot += block.guardEnd - block.guardBeg;
+    return numRoot;
+}
+
+// Bisect the root eigenvalues with (flattened) indices in [beg,end)
+template<typename Real>
+void RootEigenvalues( Problem<Real>& problem, Int beg, Int end )
+{
+    EL_DEBUG_CSE
+    const Real eps = limits::Epsilon<Real>();
+    const Real pivmin = problem.pivmin;
+    const Int numBlocks = problem.blocks.size();
+    vector<Int> offsets( numBlocks+1, 0 );
+    for( Int b=0; b<numBlocks; ++b )
+        offsets[b+1] = offsets[b] +
+          problem.blocks[b].guardEnd - problem.blocks[b].guardBeg;
+
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int k=beg; k<end; ++k )
+    {
+        const Int b =
+          std::upper_bound( offsets.begin(), offsets.end(), k ) -
+          offsets.begin() - 1;
+        auto& block = problem.blocks[b];
+        if( block.size == 1 )
+            continue;
+        const Int t = k - offsets[b];
+        auto count =
+          [&]( const Real& x ) { return NegCount( block.root, x, pivmin ); };
+        Real lower=block.lowerBound, upper=block.upperBound;
+        Bisect( count, block.guardBeg+t, lower, upper, 2*eps, pivmin );
+        block.lower[t] = lower;
+        block.upper[t] = upper;
+        block.lambda[t] = (lower+upper)/Real(2);
+    }
+}
+
+// Combine the root eigenvalues bisected by each process
+template<typename Real>
+void ShareRootEigenvalues
+( Problem<Real>& problem, Int beg, Int end, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int numRoot = NumRootEigenvalues( problem );
+    vector<Real> buf( 2*numRoot, Real(0) );
+    Int k = 0;
+    for( const auto& block : problem.blocks )
+    {
+        const Int numBlockRoot = block.guardEnd - block.guardBeg;
+        for( Int t=0; t<numBlockRoot; ++t, ++k )
+        {
+            if( k >= beg && k < end )
+            {
+                buf[2*k] = block.lower[t];
+                buf[2*k+1] = block.upper[t];
+            }
+        }
+    }
+    mpi::AllReduce( buf.data(), int(2*numRoot), comm );
+    k = 0;
+    for( auto& block : problem.blocks )
+    {
+        const Int numBlockRoot = block.guardEnd - block.guardBeg;
+        for( Int t=0; t<numBlockRoot; ++t, ++k )
+        {
+            block.lower[t] = buf[2*k];
+            block.upper[t] = buf[2*k+1];
+            block.lambda[t] = (block.lower[t]+block.upper[t])/Real(2);
+        }
+    }
+}
+
+// Trim the candidates of an index subset to the requested eigenvalues and
+// assign the output columns in ascending order of the eigenvalue estimates
+template<typename Real>
+void SelectWanted
+( Problem<Real>& problem, const HermitianEigSubset<Real>& subset )
+{
+    EL_DEBUG_CSE
+    const Int numBlocks = problem.blocks.size();
+    if( subset.indexSubset )
+    {
+        const Int numBefore = problem.numBelow;
+        vector<ValueInt<Real>> candidates;
+        for( Int b=0; b<numBlocks; ++b )
+        {
+            const auto& block = problem.blocks[b];
+            for( Int j=block.wantBeg; j<block.wantEnd; ++j )
+                candidates.push_back
+                ( ValueInt<Real>{
+                    block.root.shift+block.lambda[j-block.guardBeg], b } );
+        }
+        std::stable_sort
+        ( candidates.begin(), candidates.end(), ValueInt<Real>::Lesser );
+
+        const Int numCandidates = candidates.size();
+        const Int candBeg =
+          Max( Min(subset.lowerIndex-numBefore,numCandidates), Int(0) );
+        const Int candEnd =
+          Max( Min(subset.upperIndex+1-numBefore,numCandidates), candBeg );
+        vector<Int> numSkipped(numBlocks,0), numKept(numBlocks,0);
+        for( Int c=0; c<candEnd; ++c )
+        {
+            if( c < candBeg )
+                ++numSkipped[candidates[c].index];
+            else
+                ++numKept[candidates[c].index];
+        }
+        for( Int b=0; b<numBlocks; ++b )
+        {
+            auto& block = problem.blocks[b];
+            block.wantBeg += numSkipped[b];
+            block.wantEnd = block.wantBeg + numKept[b];
+        }
+    }
+
+    vector<ValueInt<Real>> wanted;
+    for( const auto& block : problem.blocks )
+        for( Int j=block.wantBeg; j<block.wantEnd; ++j )
+            wanted.push_back
+            ( ValueInt<Real>{
+                block.root.shift+block.lambda[j-block.guardBeg],
+                Int(wanted.size()) } );
+    std::stable_sort( wanted.begin(), wanted.end(), ValueInt<Real>::Lesser );
+    problem.numWanted = wanted.size();
+
+    vector<Int> columns( problem.numWanted );
+    for( Int c=0; c<problem.numWanted; ++c )
+        columns[wanted[c].index] = c;
+    Int offset = 0;
+    for( auto& block : problem.blocks )
+    {
+        const Int numBlockWanted = block.wantEnd - block.wantBeg;
+        block.columns.assign
+        ( columns.begin()+offset, columns.begin()+offset+numBlockWanted );
+        offset += numBlockWanted;
+    }
+}
+
+// The data shared by the nodes of the representation tree of a block
+template<typename Real>
+struct TreeContext
+{
+    const Block<Real>& block;
+    const Real pivmin;
+    const Real scale;
+    const MRRRCtrl<Real>& ctrl;
+    // The column of Z (and entry of w) for each requested eigenpair of the
+    // block, indexed relative to block.wantBeg
+    const Int* columns;
+    Matrix<Real>& Z;
+    Matrix<Real>& w;
+    MRRRInfo& info;
+};
+
+template<typename Real>
+void ProcessNode
+( const Representation<Real>& rep,
+  Int jBeg,
+  const vector<Real>& lambda,
+  const vector<Real>& lower,
+  const vector<Real>& upper,
+  const Real& leftGap,
+  const Real& rightGap,
+  Int depth,
+  TreeContext<Real>& context );
+
+// The last resort for a cluster which could not be resolved with a new
+// representation: explicitly orthogonalize the twisted-factorization
+// eigenvector approximations
+template<typename Real>
+void OrthogonalizeCluster
+( const Representation<Real>& rep,
+  Int jBeg,
+  const vector<Real>& lambda,
+  Int groupBeg,
+  Int groupEnd,
+  TreeContext<Real>& context )
+{
+    EL_DEBUG_CSE
+    const auto& block = context.block;
+    const Int m = block.size;
+    const Int wantBeg = Max( jBeg+groupBeg, block.wantBeg );
+    const Int wantEnd = Min( jBeg+groupEnd, block.wantEnd );
+    ++context.info.numOrthogonalizedClusters;
+
+    Real gamma, zNormSquared;
+    for( Int j=wantBeg; j<wantEnd; ++j )
+    {
+        const Int column = context.columns[j-block.wantBeg];
+        Real* z = context.Z.Buffer( block.offset, column );
+        TwistedVector( rep, lambda[j-jBeg], context.pivmin, z, gamma,
+          zNormSquared );
+        Real zNorm = Sqrt(zNormSquared);
+        for( Int i=0; i<m; ++i )
+            z[i] /= zNorm;
+
+        // Two passes of Modified Gram-Schmidt
+        for( Int pass=0; pass<2; ++pass )
+        {
+            for( Int jPrev=wantBeg; jPrev<j; ++jPrev )
+            {
+                const Real* zPrev =
+                  context.Z.LockedBuffer
+                  ( block.offset, context.columns[jPrev-block.wantBeg] );
+                Real alpha = 0;
+                for( Int i=0; i<m; ++i )
+                    alpha += zPrev[i]*z[i];
+                for( Int i=0; i<m; ++i )
+                    z[i] -= alpha*zPrev[i];
+            }
+            zNormSquared = 0;
+            for( Int i=0; i<m; ++i )
+                zNormSquared += z[i]*z[i];
+            zNorm = Sqrt(zNormSquared);
+            for( Int i=0; i<m; ++i )
+                z[i] /= zNorm;
+        }
+        context.w(column) = context.scale*(rep.shift+lambda[j-jBeg]);
+    }
+}
+
+// Compute the requested eigenpairs of the group [groupBeg,groupEnd) of the
+// eigenvalues of a representation
+template<typename Real>
+void ProcessGroup
+( const Representation<Real>& rep,
+  Int jBeg,
+  const vector<Real>& lambda,
+  const vector<Real>& lower,
+  const vector<Real>& upper,
+  Int groupBeg,
+  Int groupEnd,
+  const Real& leftGap,
+  const Real& rightGap,
+  Int depth,
+  TreeContext<Real>& context )
+{
+    EL_DEBUG_CSE
+    const Real eps = limits::Epsilon<Real>();
+    const auto& block = context.block;
+    const auto& ctrl = context.ctrl;
+    const Real pivmin = context.pivmin;
+    auto& info = context.info;
+    const Int m = block.size;
+
+    if( groupEnd-groupBeg == 1 )
+    {
+        // Singleton: Rayleigh Quotient Iteration with twisted factorizations,
+        // keeping the eigenvalue estimate within its bisection interval
+        const Int t = groupBeg;
+        const Int column = context.columns[jBeg+t-block.wantBeg];
+        Real* z = context.Z.Buffer( block.offset, column );
+        const Real gap = Min( leftGap, rightGap );
+        const Real tol = 4*Log(Real(m+1))*eps*gap;
+        const Int maxIts = Max( ctrl.maxRQIIts, Int(1) );
+        Real estimate = lambda[t];
+        Real gamma, zNormSquared;
+        for( Int it=0; it<maxIts; ++it )
+        {
+            TwistedVector( rep, estimate, pivmin, z, gamma, zNormSquared );
+            ++info.numRQIIterations;
+            const Real residual = Abs(gamma) / Sqrt(zNormSquared);
+            const Real correction = gamma / zNormSquared;
+            if( residual <= tol || Abs(correction) <= 2*eps*Abs(estimate) )
+                break;
+            const Real newEstimate = estimate + correction;
+            if( newEstimate < lower[t] || newEstimate > upper[t] )
+                break;
+            estimate = newEstimate;
+        }
+        const Real zNorm = Sqrt(zNormSquared);
+        for( Int i=0; i<m; ++i )
+            z[i] /= zNorm;
+        context.w(column) = context.scale*(rep.shift+estimate);
+        return;
+    }
+
+    // Cluster: search for a shift just outside of either end of the cluster
+    // which yields a representation with modest element growth
+    if( depth >= ctrl.maxDepth )
+    {
+        OrthogonalizeCluster( rep, jBeg, lambda, groupBeg, groupEnd, context );
+        return;
+    }
+    const Int first = groupBeg;
+    const Int last = groupEnd-1;
+    const Real clusterWidth = lambda[last] - lambda[first];
+    Real leftDelta =
+      Max( lambda[first]-lower[first],
+           Max(4*eps*Abs(lambda[first]),eps*clusterWidth) );
+    Real rightDelta =
+      Max( upper[last]-lambda[last],
+           Max(4*eps*Abs(lambda[last]),eps*clusterWidth) );
+    const Int maxAttempts = 8;
+    Representation<Real> child, candidate;
+    bool found = false;
+    Real tau=0, minGrowth=0;
+    for( Int attempt=0; attempt<maxAttempts; ++attempt )
+    {
+        for( Int side=0; side<2; ++side )
+        {
+            const Real shift =
+              ( side==0 ? lambda[first]-leftDelta : lambda[last]+rightDelta );
+            Real growth;
+            if( !ShiftRepresentation( rep, shift, pivmin, candidate, growth ) )
+                continue;
+            if( !found || growth < minGrowth )
+            {
+                found = true;
+                minGrowth = growth;
+                tau = shift;
+                std::swap( child, candidate );
+            }
+        }
+        if( found && minGrowth <= 8*block.spectralDiameter )
+            break;
+        leftDelta = Min( 2*leftDelta, leftGap/Real(4) );
+        rightDelta = Min( 2*rightDelta, rightGap/Real(4) );
+    }
+    if( !found )
+    {
+        OrthogonalizeCluster( rep, jBeg, lambda, groupBeg, groupEnd, context );
+        return;
+    }
+
+    // Refine the eigenvalues of the cluster relative to the new representation
+    const Int numChild = groupEnd - groupBeg;
+    vector<Real> childLambda(numChild), childLower(numChild),
+                 childUpper(numChild);
+    auto count =
+      [&]( const Real& x ) { return NegCount( child, x, pivmin ); };
+    const Int maxExpansions = 64;
+    for( Int t=groupBeg; t<groupEnd; ++t )
+    {
+        const Int j = jBeg + t;
+        Real childLow = lower[t] - tau;
+        Real childHigh = upper[t] - tau;
+        const Real minStep = 4*eps*Abs(lambda[t]-tau) + pivmin;
+
+        bool bracketed = false;
+        Real step = Max( childHigh-childLow, minStep );
+        for( Int expansion=0; expansion<maxExpansions; ++expansion )
+        {
+            if( count(childLow) <= j )
+            {
+                bracketed = true;
+                break;
+            }
+            childLow -= step;
+            step *= 2;
+        }
+        if( bracketed )
+        {
+            bracketed = false;
+            step = Max( childHigh-childLow, minStep );
+            for( Int expansion=0; expansion<maxExpansions; ++expansion )
+            {
+                if( count(childHigh) > j )
+                {
+                    bracketed = true;
+                    break;
+                }
+                childHigh += step;
+                step *= 2;
+            }
+        }
+        if( !bracketed )
+        {
+            OrthogonalizeCluster
+            ( rep, jBeg, lambda, groupBeg, groupEnd, context );
+            return;
+        }
+        Bisect( count, j, childLow, childHigh, 2*eps, pivmin );
+        childLower[t-groupBeg] = childLow;
+        childUpper[t-groupBeg] = childHigh;
+        childLambda[t-groupBeg] = (childLow+childHigh)/Real(2);
+    }
+    ++info.numRepresentations;
+
+    ProcessNode
+    ( child, jBeg+groupBeg, childLambda, childLower, childUpper,
+      leftGap, rightGap, depth+1, context );
+}
+
+template<typename Real>
+void ProcessNode
+( const Representation<Real>& rep,
+  Int jBeg,
+  const vector<Real>& lambda,
+  const vector<Real>& lower,
+  const vector<Real>& upper,
+  const Real& leftGap,
+  const Real& rightGap,
+  Int depth,
+  TreeContext<Real>& context )
+{
+    EL_DEBUG_CSE
+    const auto& block = context.block;
+    const Int numNode = lambda.size();
+    const auto groups = FormGroups( lambda, context.ctrl.minRelGap );
+    for( const auto& group : groups )
+    {
+        const Int groupBeg = group.first;
+        const Int groupEnd = group.second;
+        if( jBeg+groupEnd <= block.wantBeg || jBeg+groupBeg >= block.wantEnd )
+            continue;
+        const Real groupLeftGap =
+          ( groupBeg == 0 ? leftGap : lambda[groupBeg]-lambda[groupBeg-1] );
+        const Real groupRightGap =
+          ( groupEnd == numNode ?
+            rightGap : lambda[groupEnd]-lambda[groupEnd-1] );
+        ProcessGroup
+        ( rep, jBeg, lambda, lower, upper, groupBeg, groupEnd,
+          groupLeftGap, groupRightGap, depth, context );
+    }
+}
+
+// A singleton or cluster of eigenvalues of a root representation (indexed
+// relative to the block's guardBeg) containing at least one requested
+// eigenvalue
+struct RootGroup
+{
+    Int block;
+    Int beg, end;
+    Int numWanted;
+};
+
+template<typename Real>
+vector<RootGroup>
+FormRootGroups( const Problem<Real>& problem, const Real& minRelGap )
+{
+    EL_DEBUG_CSE
+    vector<RootGroup> rootGroups;
+    const Int numBlocks = problem.blocks.size();
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const auto& block = problem.blocks[b];
+        const auto groups = FormGroups( block.lambda, minRelGap );
+        for( const auto& group : groups )
+        {
+            const Int numWanted =
+              Min( block.guardBeg+group.second, block.wantEnd ) -
+              Max( block.guardBeg+group.first, block.wantBeg );
+            if( numWanted > 0 )
+                rootGroups.push_back
+                ( RootGroup{ b, group.first, group.second, numWanted } );
+        }
+    }
+    return rootGroups;
+}
+
+// Compute the eigenpairs of a root group, storing the eigenvector and
+// eigenvalue of the j'th eigenpair of the block into column columns[j-wantBeg]
+// of Z and entry columns[j-wantBeg] of w
+template<typename Real>
+void ProcessRootGroup
+( const Problem<Real>& problem,
+  const RootGroup& group,
+  const MRRRCtrl<Real>& ctrl,
+  const Int* columns,
+        Matrix<Real>& Z,
+        Matrix<Real>& w,
+        MRRRInfo& info )
+{
+    EL_DEBUG_CSE
+    const auto& block = problem.blocks[group.block];
+    if( block.size == 1 )
+    {
+        Z(block.offset,columns[0]) = 1;
+        w(columns[0]) = problem.scale*block.root.shift;
+        return;
+    }
+    const Int numRoot = block.lambda.size();
+    const Real leftGap =
+      ( group.beg == 0 ?
+        block.spectralDiameter :
+        block.lambda[group.beg]-block.lambda[group.beg-1] );
+    const Real rightGap =
+      ( group.end == numRoot ?
+        block.spectralDiameter :
+        block.lambda[group.end]-block.lambda[group.end-1] );
+    TreeContext<Real> context
+    { block, problem.pivmin, problem.scale, ctrl, columns, Z, w, info };
+    ProcessGroup
+    ( block.root, block.guardBeg, block.lambda, block.lower, block.upper,
+      group.beg, group.end, leftGap, rightGap, Int(0), context );
+}
+
+// Assign contiguous sequences of root groups to the processes so that the
+// amount of work, which is roughly proportional to the number of requested
+// eigenvectors times their heights, is balanced
+template<typename Real>
+vector<int> GroupOwners
+( const Problem<Real>& problem,
+  const vector<RootGroup>& groups,
+  int commSize )
+{
+    const Int numGroups = groups.size();
+    vector<double> costs( numGroups );
+    double totalCost = 0;
+    for( Int g=0; g<numGroups; ++g )
+    {
+        costs[g] =
+          double(groups[g].numWanted)*problem.blocks[groups[g].block].size;
+        totalCost += costs[g];
+    }
+    vector<int> owners( numGroups );
+    double partialCost = 0;
+    for( Int g=0; g<numGroups; ++g )
+    {
+        const double midpoint = partialCost + costs[g]/2;
+        owners[g] = Min( int(commSize*midpoint/totalCost), commSize-1 );
+        partialCost += costs[g];
+    }
+    return owners;
+}
+
+template<typename Real>
+void Eigenvalues( const Problem<Real>& problem, Matrix<Real>& w )
+{
+    EL_DEBUG_CSE
+    Zeros( w, problem.numWanted, 1 );
+    for( const auto& block : problem.blocks )
+        for( Int j=block.wantBeg; j<block.wantEnd; ++j )
+            w(block.columns[j-block.wantBeg]) =
+              problem.scale*(block.root.shift+block.lambda[j-block.guardBeg]);
+}
+
+inline void AccumulateInfo( const MRRRInfo& groupInfo, MRRRInfo& info )
+{
+    info.numRepresentations += groupInfo.numRepresentations;
+    info.numRQIIterations += groupInfo.numRQIIterations;
+    info.numOrthogonalizedClusters += groupInfo.numOrthogonalizedClusters;
+}
+
+} // namespace mrrr
+
+// Return the number of eigenvalues within the requested subset
+template<typename Real>
+Int MRRRNumEigenvalues
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+  const HermitianEigSubset<Real>& subset )
+{
+    EL_DEBUG_CSE
+    if( subset.indexSubset )
+        return Max( subset.upperIndex-subset.lowerIndex+1, Int(0) );
+    mrrr::Problem<Real> problem;
+    mrrr::Preprocess( d, dSub, subset, problem );
+    Int numEigenvalues = 0;
+    for( const auto& block : problem.blocks )
+        numEigenvalues += block.wantEnd - block.wantBeg;
+    return numEigenvalues;
+}
+
+// Compute the (unsorted) requested eigenvalues of the real symmetric
+// tridiagonal matrix with diagonal d and subdiagonal dSub
+template<typename Real>
+MRRRInfo MRRR
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    MRRRInfo info;
+    mrrr::Problem<Real> problem;
+    mrrr::Preprocess( d, dSub, ctrl.subset, problem );
+    mrrr::FormRootRepresentations( problem );
+    mrrr::RootEigenvalues( problem, 0, mrrr::NumRootEigenvalues(problem) );
+    mrrr::SelectWanted( problem, ctrl.subset );
+    mrrr::Eigenvalues( problem, w );
+    return info;
+}
+
+// Compute the (unsorted) requested eigenpairs
+template<typename Real>
+MRRRInfo MRRR
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+        Matrix<Real>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    mrrr::Problem<Real> problem;
+    mrrr::Preprocess( d, dSub, ctrl.subset, problem );
+    mrrr::FormRootRepresentations( problem );
+    mrrr::RootEigenvalues( problem, 0, mrrr::NumRootEigenvalues(problem) );
+    mrrr::SelectWanted( problem, ctrl.subset );
+
+    const Int k = problem.numWanted;
+    Zeros( w, k, 1 );
+    Zeros( Q, n, k );
+    const auto groups =
+      mrrr::FormRootGroups( problem, ctrl.mrrrCtrl.minRelGap );
+    const Int numGroups = groups.size();
+    vector<MRRRInfo> groupInfo( numGroups );
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int g=0; g<numGroups; ++g )
+    {
+        const auto& group = groups[g];
+        mrrr::ProcessRootGroup
+        ( problem, group, ctrl.mrrrCtrl,
+          problem.blocks[group.block].columns.data(), Q, w, groupInfo[g] );
+    }
+
+    MRRRInfo info;
+    for( const auto& subInfo : groupInfo )
+        mrrr::AccumulateInfo( subInfo, info );
+    return info;
+}
+
+// Compute the (unsorted) requested eigenvalues, with the bisection of the root
+// eigenvalues distributed over the given communicator. The result is
+// replicated over the communicator.
+template<typename Real>
+MRRRInfo MRRR
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+        mpi::Comm comm,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int commSize = mpi::Size( comm );
+    const Int commRank = mpi::Rank( comm );
+    MRRRInfo info;
+    mrrr::Problem<Real> problem;
+    mrrr::Preprocess( d, dSub, ctrl.subset, problem );
+    mrrr::FormRootRepresentations( problem );
+    const Int numRoot = mrrr::NumRootEigenvalues( problem );
+    const Int rootBeg = (numRoot*commRank) / commSize;
+    const Int rootEnd = (numRoot*(commRank+1)) / commSize;
+    mrrr::RootEigenvalues( problem, rootBeg, rootEnd );
+    mrrr::ShareRootEigenvalues( problem, rootBeg, rootEnd, comm );
+    mrrr::SelectWanted( problem, ctrl.subset );
+    mrrr::Eigenvalues( problem, w );
+    return info;
+}
+
+// Compute the (unsorted) requested eigenpairs, with the eigenvalues replicated
+// over the process grid and the eigenvectors distributed over the columns
+// of Q, which must be a [STAR,VR] matrix with a row alignment of zero. The
+// groups of root eigenvalues (and hence all clusters) are distributed over the
+// processes, so each cluster is resolved entirely by a single process.
+template<typename Real>
+MRRRInfo MRRR
+( const Matrix<Real>& d,
+  const Matrix<Real>& dSub,
+        Matrix<Real>& w,
+        DistMatrix<Real,STAR,VR>& Q,
+  const HermitianTridiagEigCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    mpi::Comm comm = Q.Grid().VRComm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    mrrr::Problem<Real> problem;
+    mrrr::Preprocess( d, dSub, ctrl.subset, problem );
+    mrrr::FormRootRepresentations( problem );
+    const Int numRoot = mrrr::NumRootEigenvalues( problem );
+    const Int rootBeg = (numRoot*commRank) / commSize;
+    const Int rootEnd = (numRoot*(commRank+1)) / commSize;
+    mrrr::RootEigenvalues( problem, rootBeg, rootEnd );
+    mrrr::ShareRootEigenvalues( problem, rootBeg, rootEnd, comm );
+    mrrr::SelectWanted( problem, ctrl.subset );
+    const Int k = problem.numWanted;
+
+    // Determine which groups, and hence which eigenpairs, are computed locally
+    const auto groups =
+      mrrr::FormRootGroups( problem, ctrl.mrrrCtrl.minRelGap );
+    const auto owners = mrrr::GroupOwners( problem, groups, commSize );
+    const Int numGroups = groups.size();
+    const Int numBlocks = problem.blocks.size();
+    vector<vector<Int>> localColumns( numBlocks );
+    vector<Int> localGroups;
+    Int numLocal = 0, numLocalEntries = 0;
+    for( Int g=0; g<numGroups; ++g )
+    {
+        if( owners[g] != commRank )
+            continue;
+        const auto& group = groups[g];
+        const auto& block = problem.blocks[group.block];
+        auto& columns = localColumns[group.block];
+        if( columns.empty() )
+            columns.assign( block.wantEnd-block.wantBeg, -1 );
+        const Int wantBeg = Max( block.guardBeg+group.beg, block.wantBeg );
+        const Int wantEnd = Min( block.guardBeg+group.end, block.wantEnd );
+        for( Int j=wantBeg; j<wantEnd; ++j )
+            columns[j-block.wantBeg] = numLocal++;
+        numLocalEntries += (wantEnd-wantBeg)*block.size;
+        localGroups.push_back( g );
+    }
+
+    Matrix<Real> ZLoc, wLoc;
+    Zeros( ZLoc, n, numLocal );
+    Zeros( wLoc, numLocal, 1 );
+    const Int numLocalGroups = localGroups.size();
+    vector<MRRRInfo> groupInfo( numLocalGroups );
+    EL_PARALLEL_FOR_DYNAMIC
+    for( Int l=0; l<numLocalGroups; ++l )
+    {
+        const auto& group = groups[localGroups[l]];
+        mrrr::ProcessRootGroup
+        ( problem, group, ctrl.mrrrCtrl, localColumns[group.block].data(),
+          ZLoc, wLoc, groupInfo[l] );
+    }
+
+    // Replicate the eigenvalues and redistribute the eigenvectors
+    Zeros( w, k, 1 );
+    Q.Resize( n, k );
+    Zero( Q );
+    Q.Reserve( numLocalEntries );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const auto& block = problem.blocks[b];
+        const auto& columns = localColumns[b];
+        if( columns.empty() )
+            continue;
+        for( Int j=block.wantBeg; j<block.wantEnd; ++j )
+        {
+            const Int localColumn = columns[j-block.wantBeg];
+            if( localColumn < 0 )
+                continue;
+            const Int column = block.columns[j-block.wantBeg];
+            w(column) = wLoc(localColumn);
+            for( Int i=block.offset; i<block.offset+block.size; ++i )
+                Q.QueueUpdate( i, column, ZLoc(i,localColumn) );
+        }
+    }
+    Q.ProcessQueues();
+    mpi::AllReduce( w.Buffer(), int(k), comm );
+
+    MRRRInfo info;
+    for( const auto& subInfo : groupInfo )
+        mrrr::AccumulateInfo( subInfo, info );
+    Int counts[3] =
+      { info.numRepresentations, info.numRQIIterations,
+        info.numOrthogonalizedClusters };
+    mpi::AllReduce( counts, 3, comm );
+    info.numRepresentations = counts[0];
+    info.numRQIIterations = counts[1];
+    info.numOrthogonalizedClusters = counts[2];
+    return info;
+}
+
+} // namespace herm_tridiag_eig
+} // namespace El
+
+#endif // ifndef EL_HERM_TRIDIAG_EIG_MRRR_HPP
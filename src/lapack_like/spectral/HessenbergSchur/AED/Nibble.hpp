@@ -15,61 +15,44 @@ namespace El {
 namespace hess_schur {
 namespace aed {
 
-// The spike value will be overwritten
-template<typename Real>
-AEDInfo NibbleHelper
-( Matrix<Real>& H,
-  Real& spikeValue,
-  Matrix<Complex<Real>>& w,
-  Matrix<Real>& V,
-  const HessenbergSchurCtrl& ctrl )
+// The control structure for computing the Schur decomposition of an n x n
+// deflation window
+inline HessenbergSchurCtrl WindowCtrl( const HessenbergSchurCtrl& ctrl, Int n )
 {
-    EL_DEBUG_CSE
-    const Int n = H.Height();
-    AEDInfo info;
-
-    const Real zero(0);
-    const Real ulp = limits::Precision<Real>();
-    const Real safeMin = limits::SafeMin<Real>();
-    const Real smallNum = safeMin*(Real(n)/ulp);
-
-    Zeros( V, 0, 0 );
-    if( n == 1 )
-    {
-        w(0) = H(0,0);
-        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
-        {
-            // The offdiagonal entry was small enough to deflate
-            info.numDeflated = 1;
-            spikeValue = zero;
-        }
-        else
-        {
-            // The offdiagonal entry was too large to deflate
-            info.numShiftCandidates = 1;
-        }
-        return info;
-    }
-
-    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
-    auto T( H ); // TODO(poulson): Reuse this matrix?
-    Identity( V, n, n );
     auto ctrlSub( ctrl );
     ctrlSub.winBeg = 0;
     ctrlSub.winEnd = n;
     ctrlSub.fullTriangle = true;
     ctrlSub.wantSchurVecs = true;
+    ctrlSub.accumulateSchurVecs = false;
     ctrlSub.demandConverged = false;
     ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
                                       : HESSENBERG_SCHUR_MULTIBULGE );
-    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
-    EL_DEBUG_ONLY(
-      if( infoSub.numUnconverged != 0 )
-          Output(infoSub.numUnconverged," eigenvalues did not converge");
-    )
+    return ctrlSub;
+}
+
+// Given the (partial) Schur decomposition, H = V T V', of a deflation window
+// whose first 'numUnconverged' eigenvalues did not converge, deflate as much of
+// the spike as possible, reform the eigenvalues and shift candidates, and
+// overwrite H with a Hessenberg matrix similar to T. The spike value will be
+// overwritten, and V will be emptied if no transformation is required.
+template<typename Real>
+AEDInfo DeflateWindow
+( Matrix<Real>& H,
+  Matrix<Real>& T,
+  Real& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Matrix<Real>& V,
+  Int numUnconverged,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = T.Height();
+    const Real zero(0);
+    AEDInfo info;
 
     vector<Real> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -186,16 +169,16 @@ AEDInfo NibbleHelper
     return info;
 }
 
+// The spike value will be overwritten
 template<typename Real>
 AEDInfo NibbleHelper
-( Matrix<Complex<Real>>& H,
-  Complex<Real>& spikeValue,
+( Matrix<Real>& H,
+  Real& spikeValue,
   Matrix<Complex<Real>>& w,
-  Matrix<Complex<Real>>& V,
+  Matrix<Real>& V,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
-    typedef Complex<Real> Field;
     const Int n = H.Height();
     AEDInfo info;
 
@@ -208,7 +191,7 @@ AEDInfo NibbleHelper
     if( n == 1 )
     {
         w(0) = H(0,0);
-        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
         {
             // The offdiagonal entry was small enough to deflate
             info.numDeflated = 1;
@@ -225,22 +208,34 @@ AEDInfo NibbleHelper
     // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
     auto T( H ); // TODO(poulson): Reuse this matrix?
     Identity( V, n, n );
-    auto ctrlSub( ctrl );
-    ctrlSub.winBeg = 0;
-    ctrlSub.winEnd = n;
-    ctrlSub.fullTriangle = true;
-    ctrlSub.wantSchurVecs = true;
-    ctrlSub.demandConverged = false;
-    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
-                                      : HESSENBERG_SCHUR_MULTIBULGE );
-    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
+    auto infoSub = HessenbergSchur( T, w, V, WindowCtrl( ctrl, n ) );
     EL_DEBUG_ONLY(
       if( infoSub.numUnconverged != 0 )
           Output(infoSub.numUnconverged," eigenvalues did not converge");
     )
 
+    return DeflateWindow
+      ( H, T, spikeValue, w, V, infoSub.numUnconverged, ctrl );
+}
+
+template<typename Real>
+AEDInfo DeflateWindow
+( Matrix<Complex<Real>>& H,
+  Matrix<Complex<Real>>& T,
+  Complex<Real>& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Matrix<Complex<Real>>& V,
+  Int numUnconverged,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> Field;
+    const Int n = T.Height();
+    const Real zero(0);
+    AEDInfo info;
+
     vector<Field> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -337,6 +332,54 @@ AEDInfo NibbleHelper
     return info;
 }
 
+template<typename Real>
+AEDInfo NibbleHelper
+( Matrix<Complex<Real>>& H,
+  Complex<Real>& spikeValue,
+  Matrix<Complex<Real>>& w,
+  Matrix<Complex<Real>>& V,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    AEDInfo info;
+
+    const Real zero(0);
+    const Real ulp = limits::Precision<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    Zeros( V, 0, 0 );
+    if( n == 1 )
+    {
+        w(0) = H(0,0);
+        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        {
+            // The offdiagonal entry was small enough to deflate
+            info.numDeflated = 1;
+            spikeValue = zero;
+        }
+        else
+        {
+            // The offdiagonal entry was too large to deflate
+            info.numShiftCandidates = 1;
+        }
+        return info;
+    }
+
+    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
+    auto T( H ); // TODO(poulson): Reuse this matrix?
+    Identity( V, n, n );
+    auto infoSub = HessenbergSchur( T, w, V, WindowCtrl( ctrl, n ) );
+    EL_DEBUG_ONLY(
+      if( infoSub.numUnconverged != 0 )
+          Output(infoSub.numUnconverged," eigenvalues did not converge");
+    )
+
+    return DeflateWindow
+      ( H, T, spikeValue, w, V, infoSub.numUnconverged, ctrl );
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( Matrix<Field>& H,
@@ -396,6 +439,68 @@ AEDInfo Nibble
     return info;
 }
 
+// Compute the Schur decomposition of the deflation window HDefl on a
+// subgridDim x subgridDim subgrid formed from the first processes of its grid
+// and return the number of unconverged eigenvalues. The quasi-triangular
+// factor, the eigenvalues, and the Schur vectors are only returned on the root
+// of the subgrid, which is the process of rank zero in the original grid.
+template<typename Field>
+Int SubgridSchur
+( const DistMatrix<Field,MC,MR,BLOCK>& HDefl,
+  Int subgridDim,
+  Matrix<Field>& T,
+  Matrix<Complex<Base<Field>>>& w,
+  Matrix<Field>& V,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& grid = HDefl.Grid();
+    const Int n = HDefl.Height();
+
+    const int subgridSize = subgridDim*subgridDim;
+    vector<int> subgridRanks(subgridSize);
+    for( int q=0; q<subgridSize; ++q )
+        subgridRanks[q] = q;
+    mpi::Group subgridGroup;
+    mpi::Incl
+    ( grid.OwningGroup(), subgridSize, subgridRanks.data(), subgridGroup );
+
+    Int numUnconverged = 0;
+    {
+        const Grid subgrid( grid.VCComm(), subgridGroup, subgridDim );
+        const Int blockHeight = HDefl.BlockHeight();
+        DistMatrix<Field,MC,MR,BLOCK>
+          TSub(subgrid,blockHeight,blockHeight),
+          VSub(subgrid,blockHeight,blockHeight);
+        copy::GeneralPurpose( HDefl, TSub );
+        if( TSub.Participating() )
+        {
+            DistMatrix<Complex<Real>,STAR,STAR> wSub(subgrid);
+            auto infoSub =
+              HessenbergSchur( TSub, wSub, VSub, WindowCtrl( ctrl, n ) );
+            numUnconverged = infoSub.numUnconverged;
+            EL_DEBUG_ONLY(
+              if( numUnconverged != 0 && subgrid.Rank() == 0 )
+                  Output(numUnconverged," eigenvalues did not converge");
+            )
+
+            // Gather the Schur factors onto the root of the subgrid
+            DistMatrix<Field,CIRC,CIRC> TSub_CIRC_CIRC( TSub ),
+                                        VSub_CIRC_CIRC( VSub );
+            if( TSub_CIRC_CIRC.CrossRank() == TSub_CIRC_CIRC.Root() )
+            {
+                T = TSub_CIRC_CIRC.Matrix();
+                V = VSub_CIRC_CIRC.Matrix();
+                w = wSub.Matrix();
+            }
+        }
+    }
+    mpi::Free( subgridGroup );
+
+    return numUnconverged;
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( DistMatrix<Field,MC,MR,BLOCK>& H,
@@ -423,19 +528,47 @@ AEDInfo Nibble
     auto HDefl = H( deflateInd, deflateInd );
     auto wDefl = w( deflateInd, ALL );
 
-    const int owner = HDefl.Owner(0,0);
-    DistMatrix<Field,CIRC,CIRC> HDefl_CIRC_CIRC( grid, owner );
-    HDefl_CIRC_CIRC = HDefl;
+    Int subgridDim = 1;
+    if( blockSize >= ctrl.minDistAEDSize )
+        subgridDim =
+          Min( ctrl.distAEDGridDim(blockSize,H.BlockHeight()),
+               Int(Sqrt(double(grid.Size()))) );
+
     Field spikeValue =
       ( deflateBeg==winBeg ? Field(0) : H.Get(deflateBeg,deflateBeg-1) );
     Int VSize = 0;
     Matrix<Field> V;
-    if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+    DistMatrix<Field,CIRC,CIRC> HDefl_CIRC_CIRC(grid);
+    if( subgridDim > 1 )
     {
-        info =
-          NibbleHelper
-          ( HDefl_CIRC_CIRC.Matrix(), spikeValue, wDefl.Matrix(), V, ctrl );
-        VSize = V.Height();
+        // Compute the Schur decomposition of the deflation window on a
+        // subgrid and then deflate the spike on its root, which is the root
+        // of the VC communicator of the full grid
+        HDefl_CIRC_CIRC.SetRoot( 0 );
+        HDefl_CIRC_CIRC.Resize( blockSize, blockSize );
+        Matrix<Field> T;
+        const Int numUnconverged =
+          SubgridSchur( HDefl, subgridDim, T, wDefl.Matrix(), V, ctrl );
+        if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+        {
+            info =
+              DeflateWindow
+              ( HDefl_CIRC_CIRC.Matrix(), T, spikeValue, wDefl.Matrix(), V,
+                numUnconverged, ctrl );
+            VSize = V.Height();
+        }
+    }
+    else
+    {
+        HDefl_CIRC_CIRC.SetRoot( HDefl.Owner(0,0) );
+        HDefl_CIRC_CIRC = HDefl;
+        if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
+        {
+            info =
+              NibbleHelper
+              ( HDefl_CIRC_CIRC.Matrix(), spikeValue, wDefl.Matrix(), V, ctrl );
+            VSize = V.Height();
+        }
     }
     El::Broadcast( wDefl, HDefl_CIRC_CIRC.CrossComm(), HDefl_CIRC_CIRC.Root() );
 
@@ -107,7 +107,6 @@ void LocalChase
     EL_DEBUG_CSE
     const Grid& grid = H.Grid();
 
-    Matrix<Field> W;
     auto& HLoc = H.Matrix();
     const auto& shiftsLoc = shifts.LockedMatrix();
 
@@ -117,7 +116,8 @@ void LocalChase
       ( state.firstBlockSize == state.blockSize ?
         state.introBlock+1 : Max(state.introBlock+1,1) );
 
-    // Count the number of diagonal blocks assigned to this process
+    // Form the list of diagonal blocks assigned to this process
+    vector<Int> localDiagBlocks;
     {
         // Only loop over the row blocks that are assigned to our process row
         // and occur within the active window.
@@ -125,103 +125,95 @@ void LocalChase
         while( diagBlock < intraBlockStart )
             diagBlock += grid.Height();
 
-        Int numLocalBlocks = 0;
         // Recall that packets are never left in the last block of the window
         while( diagBlock < Min(state.endBlock,state.numWinBlocks-1) )
         {
             const int ownerCol =
               Mod( state.winRowAlign+diagBlock, grid.Width() );
             if( ownerCol == grid.Col() )
-                ++numLocalBlocks;
+                localDiagBlocks.push_back( diagBlock );
             diagBlock += grid.Height();
         }
-        UList.resize(numLocalBlocks);
     }
+    const Int numLocalBlocks = localDiagBlocks.size();
+    UList.resize(numLocalBlocks);
 
     // Chase bulges down the local diagonal blocks and store the accumulations
-    // of the Householder reflections. We only loop over the row blocks that
-    // are assigned to our process row and filter based upon whether or not
-    // we are in the correct process column.
-    Int localDiagBlock = 0;
-    Int diagBlock = state.activeRowBlockBeg;
-    while( diagBlock < intraBlockStart )
-        diagBlock += grid.Height();
-    Zeros( W, 3, state.numBulgesPerBlock );
-    Matrix<Field> ZDummy;
-    while( diagBlock < Min(state.endBlock,state.numWinBlocks-1) )
+    // of the Householder reflections. Since the chases within distinct
+    // diagonal blocks touch disjoint portions of H, they may be performed
+    // concurrently.
+    EL_PARALLEL_FOR
+    for( Int localDiagBlock=0; localDiagBlock<numLocalBlocks; ++localDiagBlock )
     {
+        const Int diagBlock = localDiagBlocks[localDiagBlock];
         const Int numBlockBulges =
           ( diagBlock==state.endBlock-1 ?
             state.numBulgesInLastBlock :
             state.numBulgesPerBlock );
 
-        const int ownerCol = Mod( state.winRowAlign+diagBlock, grid.Width() );
-        if( ownerCol == grid.Col() )
+        const Int diagOffset = state.winBeg +
+          ( diagBlock == 0 ?
+            0 :
+            state.firstBlockSize + (diagBlock-1)*state.blockSize );
+
+        // View the local diagonal block of H
+        const Int localRowOffset = H.LocalRowOffset( diagOffset );
+        const Int localColOffset = H.LocalColOffset( diagOffset );
+        auto HBlockLoc =
+          HLoc
+          ( IR(0,state.blockSize)+localRowOffset,
+            IR(0,state.blockSize)+localColOffset );
+
+        // View the local shifts for this diagonal block
+        const Int bulgeOffset = state.bulgeBeg +
+          state.numBulgesPerBlock*(diagBlock-intraBlockStart);
+        auto packetShifts =
+          shiftsLoc( IR(0,2*numBlockBulges)+(2*bulgeOffset), ALL );
+
+        // Initialize the accumulated reflection matrix; recall that it
+        // does not effect the first or last index of the block. For
+        // example, consider the effects of a single 3x3 Householder
+        // similarity bulge chase step
+        //
+        //        ~ ~ ~                 ~ ~ ~
+        //     -----------           -----------
+        //    | B B B B x |  |->    | x x x x x |
+        //  ~ | B B B B x |       ~ | x B B B B |
+        //  ~ | B B B B x |       ~ |   B B B B |.
+        //  ~ | B B B B x |       ~ |   B B B B |
+        //    |       x x |         |   B B B B |
+        //     -----------           -----------
+        //
+        auto& UBlock = UList[localDiagBlock];
+        Identity( UBlock, state.blockSize-2, state.blockSize-2 );
+
+        // Perform the diagonal block sweep and accumulate the
+        // reflections in UBlock. The number of diagonal entries spanned
+        // by numBlockBulges bulges is 1 + 3 numBlockBulges, so the number
+        // of steps is blockSize - (1 + 3*numBlockBulges).
+        Matrix<Field> W, ZDummy;
+        Zeros( W, 3, state.numBulgesPerBlock );
+        const Int numSteps = state.blockSize - (1 + 3*numBlockBulges);
+        const Int blockWinBeg = 0;
+        const Int blockWinEnd = state.blockSize;
+        const Int chaseBeg = 0;
+        const Int transformRowBeg = 0;
+        const Int transformColEnd = state.blockSize;
+        const bool wantSchurVecsSub = false;
+        const bool accumulateSub = true;
+        const Int firstBulge = 0;
+        for( Int step=0; step<numSteps; ++step )
         {
-            const Int diagOffset = state.winBeg +
-              ( diagBlock == 0 ?
-                0 :
-                state.firstBlockSize + (diagBlock-1)*state.blockSize );
-
-            // View the local diagonal block of H
-            const Int localRowOffset = H.LocalRowOffset( diagOffset );
-            const Int localColOffset = H.LocalColOffset( diagOffset );
-            auto HBlockLoc =
-              HLoc
-              ( IR(0,state.blockSize)+localRowOffset,
-                IR(0,state.blockSize)+localColOffset );
-
-            // View the local shifts for this diagonal block
-            const Int bulgeOffset = state.bulgeBeg +
-              state.numBulgesPerBlock*(diagBlock-intraBlockStart);
-            auto packetShifts =
-              shiftsLoc( IR(0,2*numBlockBulges)+(2*bulgeOffset), ALL );
-
-            // Initialize the accumulated reflection matrix; recall that it
-            // does not effect the first or last index of the block. For
-            // example, consider the effects of a single 3x3 Householder
-            // similarity bulge chase step
-            //
-            //        ~ ~ ~                 ~ ~ ~
-            //     -----------           -----------
-            //    | B B B B x |  |->    | x x x x x |
-            //  ~ | B B B B x |       ~ | x B B B B |
-            //  ~ | B B B B x |       ~ |   B B B B |.
-            //  ~ | B B B B x |       ~ |   B B B B |
-            //    |       x x |         |   B B B B |
-            //     -----------           -----------
-            //
-            auto& UBlock = UList[localDiagBlock];
-            Identity( UBlock, state.blockSize-2, state.blockSize-2 );
-
-            // Perform the diagonal block sweep and accumulate the
-            // reflections in UBlock. The number of diagonal entries spanned
-            // by numBlockBulges bulges is 1 + 3 numBlockBulges, so the number
-            // of steps is blockSize - (1 + 3*numBlockBulges).
-            const Int numSteps = state.blockSize - (1 + 3*numBlockBulges);
-            const Int blockWinBeg = 0;
-            const Int blockWinEnd = state.blockSize;
-            const Int chaseBeg = 0;
-            const Int transformRowBeg = 0;
-            const Int transformColEnd = state.blockSize;
-            const bool wantSchurVecsSub = false;
-            const bool accumulateSub = true;
-            const Int firstBulge = 0;
-            for( Int step=0; step<numSteps; ++step )
-            {
-                const Int packetBeg = step;
-                ComputeReflectors
-                ( HBlockLoc, blockWinBeg, blockWinEnd, packetShifts, W,
-                  packetBeg, firstBulge, numBlockBulges, ctrl.progress );
-                ApplyReflectorsOpt
-                ( HBlockLoc, blockWinBeg, blockWinEnd, chaseBeg, packetBeg,
-                  transformRowBeg, transformColEnd, ZDummy, wantSchurVecsSub,
-                  UBlock, W, firstBulge, numBlockBulges, accumulateSub,
-                  ctrl.progress );
-            }
-            ++localDiagBlock;
+            const Int packetBeg = step;
+            ComputeReflectors
+            ( HBlockLoc, blockWinBeg, blockWinEnd, packetShifts, W,
+              packetBeg, firstBulge, numBlockBulges, ctrl.progress );
+            ApplyReflectorsOpt
+            ( HBlockLoc, blockWinBeg, blockWinEnd, chaseBeg, packetBeg,
+              transformRowBeg, transformColEnd, ZDummy, wantSchurVecsSub,
+              UBlock, W, firstBulge, numBlockBulges, accumulateSub,
+              ctrl.progress );
         }
-        diagBlock += grid.Height();
     }
 }
 
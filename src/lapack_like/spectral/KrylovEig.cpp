@@ -0,0 +1,198 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+KrylovEigInfo ThickRestartLanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    if( ctrl.shiftInvert )
+    {
+        // Find the largest eigenvalues (in magnitude) of inv(A - shift I)
+        SparseMatrix<Field> AShift( A );
+        ShiftDiagonal( AShift, Field(-ctrl.shift) );
+        SparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.Initialize( AShift, true );
+        sparseLDLFact.Factor();
+        auto applyAInv =
+          [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+          {
+              Y = X;
+              sparseLDLFact.Solve( Y );
+          };
+        auto invCtrl( ctrl );
+        invCtrl.target = EIG_LARGEST_MAGNITUDE;
+        auto info = ThickRestartLanczos( n, applyAInv, w, X, invCtrl );
+        for( Int j=0; j<w.Height(); ++j )
+            w(j) = ctrl.shift + Real(1)/w(j);
+        return info;
+    }
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return ThickRestartLanczos( n, applyA, w, X, ctrl );
+}
+
+template<typename Field>
+KrylovEigInfo ThickRestartLanczos
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        DistMultiVec<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    if( ctrl.shiftInvert )
+    {
+        // Find the largest eigenvalues (in magnitude) of inv(A - shift I)
+        DistSparseMatrix<Field> AShift( A );
+        ShiftDiagonal( AShift, Field(-ctrl.shift) );
+        DistSparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.Initialize( AShift, true );
+        sparseLDLFact.Factor();
+        auto applyAInv =
+          [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+          {
+              Y = X;
+              sparseLDLFact.Solve( Y );
+          };
+        auto invCtrl( ctrl );
+        invCtrl.target = EIG_LARGEST_MAGNITUDE;
+
+        DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+        auto& w = wProx.Get();
+        auto info = ThickRestartLanczos( n, applyAInv, w, X, invCtrl );
+        auto& wLoc = w.Matrix();
+        for( Int j=0; j<wLoc.Height(); ++j )
+            wLoc(j) = ctrl.shift + Real(1)/wLoc(j);
+        return info;
+    }
+
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    return ThickRestartLanczos( n, applyA, wPre, X, ctrl );
+}
+
+template<typename Field>
+KrylovEigInfo LOBPCG
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    if( ctrl.shiftInvert )
+    {
+        SparseMatrix<Field> AShift( A );
+        ShiftDiagonal( AShift, Field(-ctrl.shift) );
+        SparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.Initialize( AShift, true );
+        sparseLDLFact.Factor();
+        auto applyPrecond =
+          [&]( Matrix<Field>& W ) { sparseLDLFact.Solve( W ); };
+        return LOBPCG( n, applyA, applyPrecond, w, X, ctrl );
+    }
+    return LOBPCG( n, applyA, w, X, ctrl );
+}
+
+template<typename Field>
+KrylovEigInfo LOBPCG
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+  const KrylovEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    if( ctrl.shiftInvert )
+    {
+        DistSparseMatrix<Field> AShift( A );
+        ShiftDiagonal( AShift, Field(-ctrl.shift) );
+        DistSparseLDLFactorization<Field> sparseLDLFact;
+        sparseLDLFact.Initialize( AShift, true );
+        sparseLDLFact.Factor();
+        auto applyPrecond =
+          [&]( DistMultiVec<Field>& W ) { sparseLDLFact.Solve( W ); };
+        return LOBPCG( n, applyA, applyPrecond, w, X, ctrl );
+    }
+    return LOBPCG( n, applyA, w, X, ctrl );
+}
+
+#define PROTO(Field) \
+  template KrylovEigInfo ThickRestartLanczos \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+    const KrylovEigCtrl<Base<Field>>& ctrl ); \
+  template KrylovEigInfo ThickRestartLanczos \
+  ( const DistSparseMatrix<Field>& A, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          DistMultiVec<Field>& X, \
+    const KrylovEigCtrl<Base<Field>>& ctrl ); \
+  template KrylovEigInfo LOBPCG \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+    const KrylovEigCtrl<Base<Field>>& ctrl ); \
+  template KrylovEigInfo LOBPCG \
+  ( const DistSparseMatrix<Field>& A, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          DistMultiVec<Field>& X, \
+    const KrylovEigCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
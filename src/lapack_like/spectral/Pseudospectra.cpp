@@ -14,6 +14,7 @@
 #include "./Pseudospectra/IRA.hpp"
 #include "./Pseudospectra/IRL.hpp"
 #include "./Pseudospectra/Analytic.hpp"
+#include "./Pseudospectra/Schedule.hpp"
 
 // For one-norm pseudospectra. An adaptation of the more robust algorithm of
 // Higham and Tisseur will hopefully be implemented soon.
@@ -286,6 +287,17 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
 
+    // Distribute batches of shifts over several subgrids if requested
+    if( psCtrl.numSubgrids > 1 && g.Size() > 1 )
+        return pspec::SubgridCloud<Field>
+        ( UPre, shiftsPre, invNorms, psCtrl,
+          []( const DistMatrix<Field>& USub,
+              const DistMatrix<C,VR,STAR>& batchShifts,
+                    DistMatrix<Real,VR,STAR>& batchInvNorms,
+              const PseudospecCtrl<Real>& batchCtrl )
+          { return TriangularSpectralCloud
+            ( USub, batchShifts, batchInvNorms, batchCtrl ); } );
+
     // Force 'U' to be complex and in a [MC,MR] distribution
     DistMatrixReadProxy<Field,C,MC,MR> UProx( UPre );
     auto& U = UProx.GetLocked();
@@ -344,6 +356,18 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
 
+    // Distribute batches of shifts over several subgrids if requested
+    if( psCtrl.numSubgrids > 1 && g.Size() > 1 )
+        return pspec::SubgridCloud<Field>
+        ( UPre, QPre, shiftsPre, invNorms, psCtrl,
+          []( const DistMatrix<Field>& USub,
+              const DistMatrix<Field>& QSub,
+              const DistMatrix<C,VR,STAR>& batchShifts,
+                    DistMatrix<Real,VR,STAR>& batchInvNorms,
+              const PseudospecCtrl<Real>& batchCtrl )
+          { return TriangularSpectralCloud
+            ( USub, QSub, batchShifts, batchInvNorms, batchCtrl ); } );
+
     // Force 'U' to be complex and in a [MC,MR] distribution
     DistMatrixReadProxy<Field,C,MC,MR> UProx( UPre );
     auto& U = UProx.GetLocked();
@@ -406,6 +430,17 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
 
+    // Distribute batches of shifts over several subgrids if requested
+    if( psCtrl.numSubgrids > 1 && g.Size() > 1 )
+        return pspec::SubgridCloud<Real>
+        ( UPre, shiftsPre, invNorms, psCtrl,
+          []( const DistMatrix<Real>& USub,
+              const DistMatrix<C,VR,STAR>& batchShifts,
+                    DistMatrix<Real,VR,STAR>& batchInvNorms,
+              const PseudospecCtrl<Real>& batchCtrl )
+          { return QuasiTriangularSpectralCloud
+            ( USub, batchShifts, batchInvNorms, batchCtrl ); } );
+
     // Force 'U' to be in a [MC,MR] distribution
     DistMatrixReadProxy<Real,Real,MC,MR> UProx( UPre );
     auto& U = UProx.GetLocked();
@@ -452,6 +487,18 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
 
+    // Distribute batches of shifts over several subgrids if requested
+    if( psCtrl.numSubgrids > 1 && g.Size() > 1 )
+        return pspec::SubgridCloud<Real>
+        ( UPre, QPre, shiftsPre, invNorms, psCtrl,
+          []( const DistMatrix<Real>& USub,
+              const DistMatrix<Real>& QSub,
+              const DistMatrix<C,VR,STAR>& batchShifts,
+                    DistMatrix<Real,VR,STAR>& batchInvNorms,
+              const PseudospecCtrl<Real>& batchCtrl )
+          { return QuasiTriangularSpectralCloud
+            ( USub, QSub, batchShifts, batchInvNorms, batchCtrl ); } );
+
     // Force 'U' to be in a [MC,MR] distribution
     DistMatrixReadProxy<Real,Real,MC,MR> UProx( UPre );
     auto& U = UProx.GetLocked();
@@ -497,6 +544,17 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    // Distribute batches of shifts over several subgrids if requested
+    if( psCtrl.numSubgrids > 1 && HPre.Grid().Size() > 1 )
+        return pspec::SubgridCloud<Field>
+        ( HPre, shiftsPre, invNorms, psCtrl,
+          []( const DistMatrix<Field>& HSub,
+              const DistMatrix<C,VR,STAR>& batchShifts,
+                    DistMatrix<Real,VR,STAR>& batchInvNorms,
+              const PseudospecCtrl<Real>& batchCtrl )
+          { return HessenbergSpectralCloud
+            ( HSub, batchShifts, batchInvNorms, batchCtrl ); } );
+
     // Force 'H' to be complex in a [MC,MR] distribution
     DistMatrixReadProxy<Field,C,MC,MR> HProx( HPre );
     auto& H = HProx.GetLocked();
@@ -536,6 +594,18 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
+    // Distribute batches of shifts over several subgrids if requested
+    if( psCtrl.numSubgrids > 1 && HPre.Grid().Size() > 1 )
+        return pspec::SubgridCloud<Field>
+        ( HPre, QPre, shiftsPre, invNorms, psCtrl,
+          []( const DistMatrix<Field>& HSub,
+              const DistMatrix<Field>& QSub,
+              const DistMatrix<C,VR,STAR>& batchShifts,
+                    DistMatrix<Real,VR,STAR>& batchInvNorms,
+              const PseudospecCtrl<Real>& batchCtrl )
+          { return HessenbergSpectralCloud
+            ( HSub, QSub, batchShifts, batchInvNorms, batchCtrl ); } );
+
     // Force 'H' to be complex and in a [MC,MR] distribution
     DistMatrixReadProxy<Field,C,MC,MR> HProx( HPre );
     auto& H = HProx.GetLocked();
@@ -0,0 +1,395 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_SCHEDULE_HPP
+#define EL_PSEUDOSPECTRA_SCHEDULE_HPP
+
+namespace El {
+
+namespace pspec {
+
+// Since each shift is deflated as soon as it converges, running every shift
+// in lock-step on a single grid leads to iterations over an ever-narrowing
+// set of right-hand sides. The following instead splits the processes into
+// several subgrids which each hold a copy of the (quasi-)triangular or
+// Hessenberg matrix and which repeatedly claim batches of shifts from a
+// shared pool until it has been exhausted.
+
+// The subgrids are formed from contiguous ranges of owning ranks; this returns
+// the first owning rank of the given subgrid.
+inline int SubgridOffset( int gridSize, Int numSubgrids, Int subgrid )
+{ return int((Int(gridSize)*subgrid)/numSubgrids); }
+
+// Every process constructs every subgrid (so that matrices may be
+// redistributed to any of them) but is a member of exactly one of them, whose
+// index is returned.
+inline Int SplitIntoSubgrids
+( const Grid& grid,
+  Int numSubgrids,
+  vector<unique_ptr<Grid>>& subgrids )
+{
+    EL_DEBUG_CSE
+    const int gridSize = grid.Size();
+    const int rank = grid.Rank();
+    if( numSubgrids < 1 || numSubgrids > gridSize )
+        LogicError
+        ("Cannot split ",gridSize," processes into ",numSubgrids," subgrids");
+
+    subgrids.resize( numSubgrids );
+    Int mySubgrid = -1;
+    for( Int subgrid=0; subgrid<numSubgrids; ++subgrid )
+    {
+        const int offset = SubgridOffset( gridSize, numSubgrids, subgrid );
+        const int subgridSize =
+          SubgridOffset( gridSize, numSubgrids, subgrid+1 ) - offset;
+        vector<int> ranks(subgridSize);
+        for( int q=0; q<subgridSize; ++q )
+            ranks[q] = offset + q;
+        mpi::Group group;
+        mpi::Incl( grid.OwningGroup(), subgridSize, ranks.data(), group );
+        subgrids[subgrid].reset
+        ( new Grid
+          ( grid.VCComm(), group, Grid::DefaultHeight(subgridSize),
+            grid.Order() ) );
+        mpi::Free( group );
+        if( rank >= offset && rank < offset+subgridSize )
+            mySubgrid = subgrid;
+    }
+    return mySubgrid;
+}
+
+// Redistribute A from its grid into an [MC,MR] distribution over the subgrid
+// this process belongs to. Each redistribution involves every process of the
+// original grid.
+template<typename Field>
+void DistributeToSubgrid
+( const AbstractDistMatrix<Field>& A,
+  const vector<unique_ptr<Grid>>& subgrids,
+        Int mySubgrid,
+        DistMatrix<Field>& ASub )
+{
+    EL_DEBUG_CSE
+    const Int numSubgrids = subgrids.size();
+    for( Int subgrid=0; subgrid<numSubgrids; ++subgrid )
+    {
+        if( subgrid == mySubgrid )
+        {
+            ASub.SetGrid( *subgrids[subgrid] );
+            copy::GeneralPurpose( A, ASub );
+        }
+        else
+        {
+            DistMatrix<Field> AOther( *subgrids[subgrid] );
+            copy::GeneralPurpose( A, AOther );
+        }
+    }
+}
+
+// Hand out batch indices to the subgrids on demand. The root of the first
+// subgrid doubles as the dispatcher and services requests in between its own
+// batches. In order to hide the latency of the dispatcher, the root of every
+// other subgrid requests its next batch as soon as it begins processing its
+// current one.
+class BatchScheduler
+{
+public:
+    BatchScheduler
+    ( const Grid& grid,
+      const vector<unique_ptr<Grid>>& subgrids,
+      Int mySubgrid,
+      Int numBatches )
+    : subgrid_(*subgrids[mySubgrid]),
+      mySubgrid_(mySubgrid),
+      numBatches_(numBatches),
+      nextBatch_(subgrids.size())
+    {
+        EL_DEBUG_CSE
+        const Int numSubgrids = subgrids.size();
+        isRoot_ = ( subgrid_.Rank() == 0 );
+        isDispatcher_ = ( isRoot_ && mySubgrid == 0 );
+        numExpected_ = Max( Min(numSubgrids,numBatches)-1, Int(0) );
+        // Requests are exchanged over a private communicator so that they
+        // cannot be confused with any other traffic
+        mpi::Dup( grid.Comm(), comm_ );
+        request_ = grid.Rank();
+    }
+
+    ~BatchScheduler()
+    {
+        if( !mpi::Finalized() )
+            mpi::Free( comm_ );
+    }
+
+    // Collectively (over the subgrid) return the index of the next batch, or
+    // -1 if none remain
+    Int Next()
+    {
+        EL_DEBUG_CSE
+        Int batch = -1;
+        if( isRoot_ )
+        {
+            if( first_ )
+            {
+                batch = ( mySubgrid_ < numBatches_ ? mySubgrid_ : -1 );
+                first_ = false;
+            }
+            else if( isDispatcher_ )
+            {
+                batch = Claim();
+            }
+            else
+            {
+                mpi::Wait( sendRequest_ );
+                mpi::Wait( recvRequest_ );
+                batch = reply_;
+            }
+
+            if( isDispatcher_ )
+            {
+                if( batch >= 0 )
+                    Service();
+                else
+                    Drain();
+            }
+            else if( batch >= 0 )
+            {
+                mpi::TaggedISend
+                ( &request_, 1, 0, requestTag_, comm_, sendRequest_ );
+                mpi::TaggedIRecv
+                ( &reply_, 1, 0, replyTag_, comm_, recvRequest_ );
+            }
+        }
+        mpi::Broadcast( batch, 0, subgrid_.Comm() );
+        return batch;
+    }
+
+private:
+    const Grid& subgrid_;
+    Int mySubgrid_, numBatches_, nextBatch_;
+    Int numExpected_, numFinished_=0;
+    bool isRoot_, isDispatcher_, first_=true;
+    mpi::Comm comm_;
+    Int request_, reply_=-1;
+    mpi::Request<Int> sendRequest_, recvRequest_;
+
+    static const int requestTag_ = 1;
+    static const int replyTag_ = 2;
+
+    Int Claim()
+    { return ( nextBatch_ < numBatches_ ? nextBatch_++ : Int(-1) ); }
+
+    void Reply( Int source )
+    {
+        const Int batch = Claim();
+        if( batch < 0 )
+            ++numFinished_;
+        mpi::TaggedSend( batch, int(source), replyTag_, comm_ );
+    }
+
+    // Answer any outstanding requests without blocking
+    void Service()
+    {
+        mpi::Status status;
+        while( mpi::IProbe( mpi::ANY_SOURCE, requestTag_, comm_, status ) )
+        {
+            const Int source =
+              mpi::TaggedRecv<Int>( status.MPI_SOURCE, requestTag_, comm_ );
+            Reply( source );
+        }
+    }
+
+    // Answer requests until every other subgrid has been informed that no
+    // batches remain
+    void Drain()
+    {
+        while( numFinished_ < numExpected_ )
+        {
+            const Int source =
+              mpi::TaggedRecv<Int>( mpi::ANY_SOURCE, requestTag_, comm_ );
+            Reply( source );
+        }
+    }
+};
+
+// Compute the inverse norms for the given shifts by having the subgrids claim
+// batches of shifts until none remain. The 'batchCloud' routine is called
+// collectively over a subgrid for each batch claimed by said subgrid.
+template<typename Real>
+DistMatrix<Int,VR,STAR>
+ScheduleShifts
+( const Grid& grid,
+  const vector<unique_ptr<Grid>>& subgrids,
+        Int mySubgrid,
+  const AbstractDistMatrix<Complex<Real>>& shifts,
+        AbstractDistMatrix<Real>& invNorms,
+        PseudospecCtrl<Real> psCtrl,
+  function<DistMatrix<Int,VR,STAR>
+           (const DistMatrix<Complex<Real>,VR,STAR>&,
+                  DistMatrix<Real,VR,STAR>&,
+            const PseudospecCtrl<Real>&)> batchCloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Int numShifts = shifts.Height();
+    const Int numSubgrids = subgrids.size();
+    const Grid& subgrid = *subgrids[mySubgrid];
+
+    // Default to roughly four batches per subgrid so that the last batches
+    // to be claimed are small relative to the total amount of work
+    const Int batchSize =
+      ( psCtrl.shiftBatchSize > 0 ?
+        psCtrl.shiftBatchSize :
+        Max( (numShifts+4*numSubgrids-1)/(4*numSubgrids), Int(1) ) );
+    const Int numBatches = (numShifts+batchSize-1) / batchSize;
+    if( psCtrl.progress && grid.Rank() == 0 )
+        Output
+        ("Scheduling ",numBatches," batches of up to ",batchSize,
+         " shifts over ",numSubgrids," subgrids");
+
+    // Every subgrid must be able to form any batch
+    DistMatrix<C,STAR,STAR> shifts_STAR_STAR( shifts );
+    const auto& shiftsLoc = shifts_STAR_STAR.LockedMatrix();
+
+    // The results of each batch are accumulated on the root of the subgrid
+    // which computed them and then summed over the entire grid
+    DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR(grid);
+    DistMatrix<Int,STAR,STAR> itCounts_STAR_STAR(grid);
+    Zeros( invNorms_STAR_STAR, numShifts, 1 );
+    Zeros( itCounts_STAR_STAR, numShifts, 1 );
+    auto& invNormsLoc = invNorms_STAR_STAR.Matrix();
+    auto& itCountsLoc = itCounts_STAR_STAR.Matrix();
+
+    // Snapshots of individual batches would be meaningless, so only a final
+    // snapshot of the entire set of shifts is taken
+    auto batchCtrl( psCtrl );
+    batchCtrl.numSubgrids = 1;
+    batchCtrl.snapCtrl.realSize = 0;
+    batchCtrl.snapCtrl.imagSize = 0;
+
+    BatchScheduler scheduler( grid, subgrids, mySubgrid, numBatches );
+    DistMatrix<C,VR,STAR> batchShifts(subgrid);
+    DistMatrix<Real,VR,STAR> batchInvNorms(subgrid);
+    while( true )
+    {
+        const Int batch = scheduler.Next();
+        if( batch < 0 )
+            break;
+        const Int batchBeg = batch*batchSize;
+        const Int batchEnd = Min( batchBeg+batchSize, numShifts );
+
+        batchShifts.Resize( batchEnd-batchBeg, 1 );
+        const Int localHeight = batchShifts.LocalHeight();
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = batchShifts.GlobalRow(iLoc);
+            batchShifts.SetLocal( iLoc, 0, shiftsLoc(batchBeg+i) );
+        }
+
+        auto batchItCounts =
+          batchCloud( batchShifts, batchInvNorms, batchCtrl );
+
+        DistMatrix<Real,CIRC,CIRC> batchInvNorms_CIRC_CIRC( batchInvNorms );
+        DistMatrix<Int,CIRC,CIRC> batchItCounts_CIRC_CIRC( batchItCounts );
+        if( batchInvNorms_CIRC_CIRC.CrossRank() ==
+            batchInvNorms_CIRC_CIRC.Root() )
+        {
+            const auto& batchInvNormsLoc = batchInvNorms_CIRC_CIRC.Matrix();
+            const auto& batchItCountsLoc = batchItCounts_CIRC_CIRC.Matrix();
+            for( Int i=batchBeg; i<batchEnd; ++i )
+            {
+                invNormsLoc(i) = batchInvNormsLoc(i-batchBeg);
+                itCountsLoc(i) = batchItCountsLoc(i-batchBeg);
+            }
+        }
+    }
+    mpi::AllReduce( invNormsLoc.Buffer(), numShifts, grid.VCComm() );
+    mpi::AllReduce( itCountsLoc.Buffer(), numShifts, grid.VCComm() );
+
+    DistMatrix<Real,VR,STAR> invNorms_VR_STAR( invNorms_STAR_STAR );
+    DistMatrix<Int,VR,STAR> itCounts( itCounts_STAR_STAR );
+    Copy( invNorms_VR_STAR, invNorms );
+    FinalSnapshot( invNorms_VR_STAR, itCounts, psCtrl.snapCtrl );
+    return itCounts;
+}
+
+// Redistribute A to the subgrids and then schedule the shifts over them
+template<typename Field>
+DistMatrix<Int,VR,STAR>
+SubgridCloud
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Complex<Base<Field>>>& shifts,
+        AbstractDistMatrix<Base<Field>>& invNorms,
+  const PseudospecCtrl<Base<Field>>& psCtrl,
+  function<DistMatrix<Int,VR,STAR>
+           (const DistMatrix<Field>&,
+            const DistMatrix<Complex<Base<Field>>,VR,STAR>&,
+                  DistMatrix<Base<Field>,VR,STAR>&,
+            const PseudospecCtrl<Base<Field>>&)> cloud )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Complex<Real> C;
+    const Grid& grid = A.Grid();
+
+    vector<unique_ptr<Grid>> subgrids;
+    const Int mySubgrid =
+      SplitIntoSubgrids
+      ( grid, Min(psCtrl.numSubgrids,Int(grid.Size())), subgrids );
+    DistMatrix<Field> ASub;
+    DistributeToSubgrid( A, subgrids, mySubgrid, ASub );
+
+    return ScheduleShifts<Real>
+    ( grid, subgrids, mySubgrid, shifts, invNorms, psCtrl,
+      [&]( const DistMatrix<C,VR,STAR>& batchShifts,
+                 DistMatrix<Real,VR,STAR>& batchInvNorms,
+           const PseudospecCtrl<Real>& batchCtrl )
+      { return cloud( ASub, batchShifts, batchInvNorms, batchCtrl ); } );
+}
+
+// Redistribute A and B to the subgrids and then schedule the shifts over them
+template<typename Field>
+DistMatrix<Int,VR,STAR>
+SubgridCloud
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const AbstractDistMatrix<Complex<Base<Field>>>& shifts,
+        AbstractDistMatrix<Base<Field>>& invNorms,
+  const PseudospecCtrl<Base<Field>>& psCtrl,
+  function<DistMatrix<Int,VR,STAR>
+           (const DistMatrix<Field>&,
+            const DistMatrix<Field>&,
+            const DistMatrix<Complex<Base<Field>>,VR,STAR>&,
+                  DistMatrix<Base<Field>,VR,STAR>&,
+            const PseudospecCtrl<Base<Field>>&)> cloud )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Complex<Real> C;
+    const Grid& grid = A.Grid();
+
+    vector<unique_ptr<Grid>> subgrids;
+    const Int mySubgrid =
+      SplitIntoSubgrids
+      ( grid, Min(psCtrl.numSubgrids,Int(grid.Size())), subgrids );
+    DistMatrix<Field> ASub, BSub;
+    DistributeToSubgrid( A, subgrids, mySubgrid, ASub );
+    DistributeToSubgrid( B, subgrids, mySubgrid, BSub );
+
+    return ScheduleShifts<Real>
+    ( grid, subgrids, mySubgrid, shifts, invNorms, psCtrl,
+      [&]( const DistMatrix<C,VR,STAR>& batchShifts,
+                 DistMatrix<Real,VR,STAR>& batchInvNorms,
+           const PseudospecCtrl<Real>& batchCtrl )
+      { return cloud( ASub, BSub, batchShifts, batchInvNorms, batchCtrl ); } );
+}
+
+} // namespace pspec
+
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_SCHEDULE_HPP
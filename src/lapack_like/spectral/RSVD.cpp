@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+// Given A ~= Q Q^H A, with Q having only a few (k+p) columns, the SVD of
+// B' = A^H Q = W diag(s) X^H yields A ~= (Q X) diag(s) W^H
+
+template<typename F>
+void RSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> Q;
+    RangeFinder( NORMAL, A, Q, ctrl );
+
+    Matrix<F> BAdj, X;
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, BAdj );
+    SVD( BAdj, V, s, X );
+
+    const Int rank = Min( ctrl.rank, s.Height() );
+    s.Resize( rank, 1 );
+    V.Resize( V.Height(), rank );
+    auto XL = X( ALL, IR(0,rank) );
+    Gemm( NORMAL, NORMAL, F(1), Q, XL, U );
+}
+
+template<typename F>
+void RSVD
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& s,
+        AbstractDistMatrix<F>& V,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<F> Q(g);
+    RangeFinder( NORMAL, A, Q, ctrl );
+
+    DistMatrix<F> BAdj(g), W(g), X(g);
+    DistMatrix<Base<F>,VR,STAR> sFull(g);
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, BAdj );
+    SVD( BAdj, W, sFull, X );
+
+    const Int rank = Min( ctrl.rank, sFull.Height() );
+    Copy( sFull( IR(0,rank), ALL ), s );
+    Copy( W( ALL, IR(0,rank) ), V );
+    auto XL = X( ALL, IR(0,rank) );
+    Gemm( NORMAL, NORMAL, F(1), Q, XL, U );
+}
+
+template<typename F>
+void RSVD
+( const SparseMatrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> Q;
+    RangeFinder( NORMAL, A, Q, ctrl );
+
+    Matrix<F> BAdj, X;
+    Zeros( BAdj, A.Width(), Q.Width() );
+    Multiply( ADJOINT, F(1), A, Q, F(0), BAdj );
+    SVD( BAdj, V, s, X );
+
+    const Int rank = Min( ctrl.rank, s.Height() );
+    s.Resize( rank, 1 );
+    V.Resize( V.Height(), rank );
+    auto XL = X( ALL, IR(0,rank) );
+    Gemm( NORMAL, NORMAL, F(1), Q, XL, U );
+}
+
+template<typename F>
+void RSVD
+( const DistSparseMatrix<F>& A,
+        DistMultiVec<F>& U,
+        Matrix<Base<F>>& s,
+        DistMultiVec<F>& V,
+  const RandomizedCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMultiVec<F> Q(g);
+    RangeFinder( NORMAL, A, Q, ctrl );
+
+    DistMultiVec<F> BAdj(g);
+    Zeros( BAdj, A.Width(), Q.Width() );
+    Multiply( ADJOINT, F(1), A, Q, F(0), BAdj );
+
+    // The SVD of the tall-skinny n x (k+p) matrix A^H Q is dense
+    DistMatrix<F> BAdjDist(g), W(g), X(g);
+    DistMatrix<Base<F>,VR,STAR> sFull(g);
+    Copy( BAdj, BAdjDist );
+    SVD( BAdjDist, W, sFull, X );
+
+    const Int rank = Min( ctrl.rank, sFull.Height() );
+    DistMatrix<Base<F>,STAR,STAR> s_STAR_STAR( sFull( IR(0,rank), ALL ) );
+    s = s_STAR_STAR.Matrix();
+    DistMatrix<F,VC,STAR> V_VC_STAR( W( ALL, IR(0,rank) ) );
+    Copy( V_VC_STAR, V );
+
+    // U := Q X(:,0:rank) only requires a local multiplication since the small
+    // factor X can be stored redundantly
+    DistMatrix<F,STAR,STAR> XL( X( ALL, IR(0,rank) ) );
+    U.SetGrid( g );
+    U.Resize( A.Height(), rank );
+    Gemm
+    ( NORMAL, NORMAL,
+      F(1), Q.LockedMatrix(), XL.LockedMatrix(),
+      F(0), U.Matrix() );
+}
+
+#define PROTO(F) \
+  template void RSVD \
+  ( const Matrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RSVD \
+  ( const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& U, \
+          AbstractDistMatrix<Base<F>>& s, \
+          AbstractDistMatrix<F>& V, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RSVD \
+  ( const SparseMatrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+    const RandomizedCtrl<Base<F>>& ctrl ); \
+  template void RSVD \
+  ( const DistSparseMatrix<F>& A, \
+          DistMultiVec<F>& U, \
+          Matrix<Base<F>>& s, \
+          DistMultiVec<F>& V, \
+    const RandomizedCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
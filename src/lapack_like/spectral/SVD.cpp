@@ -10,6 +10,7 @@
 
 #include "./SVD/Chan.hpp"
 #include "./SVD/Product.hpp"
+#include "./SVD/QDWH.hpp"
 
 namespace El {
 
@@ -249,6 +250,10 @@ SVDInfo SVD
 
     SVDInfo info;
     auto approach = ctrl.bidiagSVDCtrl.approach;
+    if( ctrl.useQDWH && (approach == THIN_SVD || approach == COMPACT_SVD) )
+    {
+        return svd::QDWH( A, U, s, V, ctrl );
+    }
     if( approach == PRODUCT_SVD )
     {
         auto tolType = ctrl.bidiagSVDCtrl.tolType;
@@ -317,6 +322,10 @@ SVDInfo SVD
     {
         return SVD( A, s, ctrl );
     }
+    if( ctrl.useQDWH && (approach == THIN_SVD || approach == COMPACT_SVD) )
+    {
+        return svd::QDWH( A, U, s, V, ctrl );
+    }
 
     SVDInfo info;
     if( approach == PRODUCT_SVD )
@@ -530,6 +539,8 @@ SVDInfo SVD
         ctrl.bidiagSVDCtrl.approach == COMPACT_SVD ||
         ctrl.bidiagSVDCtrl.approach == FULL_SVD )
     {
+        if( ctrl.useQDWH )
+            return svd::QDWH( AMod, s, ctrl );
         return svd::Chan( A, s, ctrl );
     }
     else
@@ -560,6 +571,8 @@ SVDInfo SVD
         ctrl.bidiagSVDCtrl.approach == FULL_SVD )
     {
         DistMatrix<Field> ACopy( A );
+        if( ctrl.useQDWH )
+            return svd::QDWH( ACopy, s, ctrl );
         return svd::Chan( ACopy, s, ctrl );
     }
     else
@@ -600,6 +613,8 @@ SVDInfo SVD
         DistMatrix<Field> ACopy( A );
         return SVD( ACopy, s, ctrlMod );
     }
+    if( ctrl.useQDWH )
+        return svd::QDWH( A, s, ctrl );
     return svd::Chan( A, s, ctrl );
 }
 
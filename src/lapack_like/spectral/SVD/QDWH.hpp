@@ -0,0 +1,259 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVD_QDWH_HPP
+#define EL_SVD_QDWH_HPP
+
+namespace El {
+namespace svd {
+
+// The QDWH-SVD of Nakatsukasa and Higham: the polar decomposition A = U_p H
+// is computed via the QDWH iteration and then the eigenvalue decomposition
+// H = V diag(s) V^H is computed via the QDWH-based spectral divide and conquer
+// so that A = (U_p V) diag(s) V^H. Both stages are built almost entirely out of
+// matrix-matrix products and QR/Cholesky decompositions, and the subproblems
+// of the spectral divide and conquer are solved on independent subgrids.
+
+template<typename Field>
+HermitianEigCtrl<Field> QDWHEigCtrl( const SVDCtrl<Base<Field>>& ctrl )
+{
+    HermitianEigCtrl<Field> eigCtrl;
+    eigCtrl.useSDC = true;
+    eigCtrl.sdcCtrl = ctrl.sdcCtrl;
+    eigCtrl.sdcCtrl.qdwhEig = true;
+    eigCtrl.tridiagEigCtrl.sort = DESCENDING;
+    return eigCtrl;
+}
+
+// H is only positive semi-definite up to rounding errors, so clip any
+// negative eigenvalues to zero and, for compact SVDs, return the numerical
+// rank
+template<typename Real>
+Int QDWHRank( Int m, Int n, Matrix<Real>& s, const SVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    for( Int j=0; j<k; ++j )
+        s(j) = Max( s(j), Real(0) );
+    if( ctrl.bidiagSVDCtrl.approach != COMPACT_SVD )
+        return k;
+
+    const Real twoNorm = ( k==0 ? Real(0) : s(0) );
+    const Real thresh =
+      bidiag_svd::APosterioriThreshold( m, n, twoNorm, ctrl.bidiagSVDCtrl );
+    Int rank = k;
+    for( Int j=0; j<k; ++j )
+    {
+        if( s(j) <= thresh )
+        {
+            rank = j;
+            break;
+        }
+    }
+    return rank;
+}
+
+template<typename Real>
+Int QDWHRank
+( Int m, Int n, AbstractDistMatrix<Real>& s, const SVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto& sLoc = s.Matrix();
+    const Int localHeight = sLoc.Height();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        sLoc(iLoc) = Max( sLoc(iLoc), Real(0) );
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( s );
+    return QDWHRank( m, n, s_STAR_STAR.Matrix(), ctrl );
+}
+
+template<typename Field>
+SVDInfo QDWH
+(       Matrix<Field>& A,
+        Matrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        return QDWH( AAdj, s, ctrl );
+    }
+    SVDInfo info;
+
+    // A := U_p, where A = U_p H
+    Matrix<Field> ACopy( A );
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
+    Polar( A, polarCtrl );
+
+    // Form the lower triangle of H := U_p^H A
+    Matrix<Field> H;
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, Field(1), A, ACopy, Field(0), H );
+
+    HermitianEig( LOWER, H, s, QDWHEigCtrl<Field>(ctrl) );
+    const Int rank = QDWHRank( m, n, s, ctrl );
+    s.Resize( rank, 1 );
+
+    return info;
+}
+
+template<typename Field>
+SVDInfo QDWH
+(       Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+    {
+        // A^H = U' diag(s) V'^H implies A = V' diag(s) U'^H
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        auto ctrlAdj( ctrl );
+        ctrlAdj.bidiagSVDCtrl.wantU = ctrl.bidiagSVDCtrl.wantV;
+        ctrlAdj.bidiagSVDCtrl.wantV = ctrl.bidiagSVDCtrl.wantU;
+        return QDWH( AAdj, V, s, U, ctrlAdj );
+    }
+    SVDInfo info;
+
+    // A := U_p, where A = U_p H
+    Matrix<Field> ACopy( A );
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
+    Polar( A, polarCtrl );
+
+    // Form the lower triangle of H := U_p^H A
+    Matrix<Field> H;
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, Field(1), A, ACopy, Field(0), H );
+
+    Matrix<Field> W;
+    HermitianEig( LOWER, H, s, W, QDWHEigCtrl<Field>(ctrl) );
+    const Int rank = QDWHRank( m, n, s, ctrl );
+    s.Resize( rank, 1 );
+    W.Resize( n, rank );
+
+    if( ctrl.bidiagSVDCtrl.wantU )
+        Gemm( NORMAL, NORMAL, Field(1), A, W, U );
+    if( ctrl.bidiagSVDCtrl.wantV )
+        V = W;
+
+    return info;
+}
+
+template<typename Field>
+SVDInfo QDWH
+(       AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    if( m < n )
+    {
+        DistMatrix<Field> AAdj(g);
+        Adjoint( APre, AAdj );
+        return QDWH( AAdj, s, ctrl );
+    }
+    SVDInfo info;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    // A := U_p, where A = U_p H
+    DistMatrix<Field> ACopy( A );
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
+    Polar( A, polarCtrl );
+
+    // Form the lower triangle of H := U_p^H A
+    DistMatrix<Field> H(g);
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, Field(1), A, ACopy, Field(0), H );
+
+    HermitianEig( LOWER, H, s, QDWHEigCtrl<Field>(ctrl) );
+    const Int rank = QDWHRank( m, n, s, ctrl );
+    s.Resize( rank, 1 );
+
+    return info;
+}
+
+template<typename Field>
+SVDInfo QDWH
+(       AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& UPre,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& VPre,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    if( m < n )
+    {
+        // A^H = U' diag(s) V'^H implies A = V' diag(s) U'^H
+        DistMatrix<Field> AAdj(g);
+        Adjoint( APre, AAdj );
+        auto ctrlAdj( ctrl );
+        ctrlAdj.bidiagSVDCtrl.wantU = ctrl.bidiagSVDCtrl.wantV;
+        ctrlAdj.bidiagSVDCtrl.wantV = ctrl.bidiagSVDCtrl.wantU;
+        return QDWH( AAdj, VPre, s, UPre, ctrlAdj );
+    }
+    SVDInfo info;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    // A := U_p, where A = U_p H
+    DistMatrix<Field> ACopy( A );
+    PolarCtrl polarCtrl;
+    polarCtrl.qdwh = true;
+    polarCtrl.qdwhCtrl = ctrl.qdwhCtrl;
+    Polar( A, polarCtrl );
+
+    // Form the lower triangle of H := U_p^H A
+    DistMatrix<Field> H(g);
+    Zeros( H, n, n );
+    Trrk( LOWER, ADJOINT, NORMAL, Field(1), A, ACopy, Field(0), H );
+
+    DistMatrix<Field> W(g);
+    HermitianEig( LOWER, H, s, W, QDWHEigCtrl<Field>(ctrl) );
+    const Int rank = QDWHRank( m, n, s, ctrl );
+    s.Resize( rank, 1 );
+    W.Resize( n, rank );
+
+    if( ctrl.bidiagSVDCtrl.wantU )
+    {
+        DistMatrixWriteProxy<Field,Field,MC,MR> UProx( UPre );
+        auto& U = UProx.Get();
+        Gemm( NORMAL, NORMAL, Field(1), A, W, U );
+    }
+    if( ctrl.bidiagSVDCtrl.wantV )
+        Copy( W, VPre );
+
+    return info;
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_QDWH_HPP
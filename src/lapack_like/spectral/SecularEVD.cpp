@@ -21,6 +21,7 @@
 #endif
 
 #include "./SecularEVD/TwoByTwo.hpp"
+#include "./SecularEVD/PoleSums.hpp"
 
 namespace El {
 
@@ -115,34 +116,24 @@ void EvaluateSecular
     // approximation of the error
     // (see Ren-Cang Li, "Solving Secular Equations Stably and Efficiently",
     // LAPACK Working Note 89, 1993 [CITATION], as well as LAPACK's 
-    // {s,d}laed4 [CITATION]). The loop direction is chosen to heuristically
-    // sum from small to large components.
-    state.psiMinus = 0;
-    state.psiMinusDeriv = 0;
-    state.relErrorBound = 0;
-    for( Int j=0; j<origin; ++j )
-    {
-        // Compute the j'th term divided by z(j)
-        temp = z(j) / state.dMinusShift(j);
-        state.psiMinus += z(j)*temp; // This should be a negative contribution
-        state.psiMinusDeriv += temp*temp;
-        state.relErrorBound += state.psiMinus;
-    }
-    state.relErrorBound = Abs(state.relErrorBound); // This should be negation
+    // {s,d}laed4 [CITATION]). The terms are summed from the furthest pole
+    // towards the origin to heuristically sum from small to large components.
+    const Real* zBuf = z.LockedBuffer();
+    const Real* dMinusShiftBuf = state.dMinusShift.LockedBuffer();
+    const Real* dPlusShiftBuf = nullptr;
+    Real psiPartialSum;
+    secular_evd::PoleSums
+    ( Int(0), origin, origin, zBuf, dMinusShiftBuf, dPlusShiftBuf,
+      state.psiMinus, state.psiMinusDeriv, psiPartialSum );
+    state.relErrorBound = Abs(psiPartialSum); // This should be negation
 
     // Compute phi, its derivative, and accumulate an approximation of the
-    // error in both psi_{m-1} and phi_m, where m is the origin index. The loop
-    // direction is chosen to heuristically sum from small to large components.
-    state.phi = 0;
-    state.phiDeriv = 0;
-    for( Int j=n-1; j>origin; --j )
-    {
-        // Compute the j'th term divided by z(j)
-        temp = z(j) / state.dMinusShift(j);
-        state.phi += z(j)*temp;
-        state.phiDeriv += temp*temp;
-        state.relErrorBound += state.phi;
-    }
+    // error in both psi_{m-1} and phi_m, where m is the origin index.
+    Real phiPartialSum;
+    secular_evd::PoleSums
+    ( origin+1, n, origin, zBuf, dMinusShiftBuf, dPlusShiftBuf,
+      state.phi, state.phiDeriv, phiPartialSum );
+    state.relErrorBound += phiPartialSum;
 
     // Compute the secular function with the origin term removed
     // (and its derivative)
@@ -175,18 +166,14 @@ void EvaluateSecularLast
     const Real rhoInv = one / rho;
     Real temp;
 
-    state.psiMinus = 0;
-    state.psiMinusDeriv = 0;
-    state.relErrorBound = 0;
-    for( Int j=0; j<origin; ++j )
-    {
-        // Compute the j'th term divided by z(j)
-        temp = z(j) / state.dMinusShift(j);
-        state.psiMinus += z(j)*temp;
-        state.psiMinusDeriv += temp*temp;
-        state.relErrorBound += state.psiMinus; // This should be negative
-    }
-    state.relErrorBound = Abs(state.relErrorBound); // This should be negation
+    Real psiPartialSum; // This should be negative
+    secular_evd::PoleSums
+    ( Int(0), origin, origin,
+      z.LockedBuffer(),
+      state.dMinusShift.LockedBuffer(),
+      static_cast<const Real*>(nullptr),
+      state.psiMinus, state.psiMinusDeriv, psiPartialSum );
+    state.relErrorBound = Abs(psiPartialSum); // This should be negation
 
     // Compute the origin term divided by z(origin)
     temp = z(origin) / state.dMinusShift(origin);
@@ -1239,6 +1226,58 @@ SecularEigenvalue
     return info;
 }
 
+template<typename Real,typename>
+SecularEVDInfo
+SecularEigenvalues
+( const Matrix<Real>& d,
+  const Real& rho,
+  const Matrix<Real>& z,
+        Matrix<Real>& w,
+        Matrix<Real>& dMinusShifts,
+  const SecularEVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    SecularEVDInfo info;
+#if defined(EL_HYBRID) && defined(EL_HAVE_OMP_TASKLOOP)
+    // Open a team of threads for the roots to be distributed over
+    if( !omp_in_parallel() && n >= ctrl.batchCutoff )
+    {
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        info = SecularEigenvalues( d, rho, z, w, dMinusShifts, ctrl );
+        return info;
+    }
+#endif
+
+    // The roots are independent, so we solve them concurrently (when possible)
+    // and sum their iteration counts afterwards.
+    w.Resize( n, 1 );
+    dMinusShifts.Resize( n, n );
+    Matrix<Int> counts;
+    Zeros( counts, n, 4 );
+    EL_TASKLOOP_IF( n >= ctrl.batchCutoff )
+    for( Int j=0; j<n; ++j )
+    {
+        auto dMinusShift = dMinusShifts( ALL, IR(j) );
+        auto valueInfo =
+          SecularEigenvalue( j, d, rho, z, w(j), dMinusShift, ctrl );
+        counts(j,0) = valueInfo.numIterations;
+        counts(j,1) = valueInfo.numAlternations;
+        counts(j,2) = valueInfo.numCubicIterations;
+        counts(j,3) = valueInfo.numCubicFailures;
+    }
+    for( Int j=0; j<n; ++j )
+    {
+        info.numIterations += counts(j,0);
+        info.numAlternations += counts(j,1);
+        info.numCubicIterations += counts(j,2);
+        info.numCubicFailures += counts(j,3);
+    }
+
+    return info;
+}
+
 template<typename Real,typename>
 SecularEVDInfo
 SecularEVD
@@ -1272,15 +1311,27 @@ SecularEVD
         return info;
     }
 
-    // TODO(poulson): Batch secular equation solvers?
-    //
-    // Compute all of the eigenvalues and the vector r ~= sqrt(rho) z which
-    // would produce the given eigenvalues to high relative accuracy.
+#if defined(EL_HYBRID) && defined(EL_HAVE_OMP_TASKLOOP)
+    // Open a team of threads for the roots and eigenvectors to be distributed
+    // over
+    if( !omp_in_parallel() && n >= ctrl.batchCutoff )
+    {
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        info = SecularEVD( d, rho, z, w, Q, ctrl );
+        return info;
+    }
+#endif
+
+    // Compute all of the eigenvalues, temporarily storing d - w(j) in the j'th
+    // column of Q.
+    info = SecularEigenvalues( d, rho, z, w, Q, ctrl );
+
+    // Compute the vector r ~= sqrt(rho) z which would produce the given
+    // eigenvalues to high relative accuracy.
     //
-    // We accumulate the products involved in computing r in an online manner
-    // and take the square-root of the absolute value (and the correct sign)
-    // at the end. The key is to recognize that the only term left out of entry
-    // i of the corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
+    // The key is to recognize that the only term left out of entry i of the
+    // corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
     //
     //    prod_{k=0}^{n-1} (lambda_k - d(i)) / (d(k) - d(i))
     //
@@ -1297,35 +1348,27 @@ SecularEVD
     //      prod_{k=0  }^{i-1} (lambda_k - d(i)) / (d(k) - d(i)) *
     //      prod_{k=i+1}^{n-1} (lambda_k - d(i)) / (d(k) - d(i)).
     //
-    // Given that we have available only one lambda_j at a time, we greedily
-    // update all r(i) products given each lambda_j
+    // Each entry of r is independent of the others and is formed by
+    // accumulating the product in order of increasing k
     // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach).
     //
-    Q.Resize( n, n );
     Matrix<Real> r;
-    Ones( r, n, 1 );
-    for( Int j=0; j<n; ++j )
+    r.Resize( n, 1 );
+    EL_TASKLOOP_IF( n >= ctrl.batchCutoff )
+    for( Int i=0; i<n; ++i )
     {
-        // While we will temporarily store dMinusShift in the j'th column of Q.
-        auto q = Q(ALL,IR(j));
-        auto valueInfo = SecularEigenvalue( j, d, rho, z, w(j), q, ctrl );
-        
-        info.numIterations += valueInfo.numIterations;
-        info.numAlternations += valueInfo.numAlternations;
-        info.numCubicIterations += valueInfo.numCubicIterations;
-        info.numCubicFailures += valueInfo.numCubicFailures;
-
-        r(j) *= q(j);
+        Real rProd = 1;
         for( Int k=0; k<n; ++k )
         {
-            if( k == j )
-                continue;
-            r(k) *= q(k) / (d(j)-d(k));
+            if( k == i )
+                rProd *= Q(i,i);
+            else
+                rProd *= Q(i,k) / (d(k)-d(i));
         }
+        r(i) = Sgn(z(i),false) * Sqrt(Abs(rProd));
     }
-    for( Int j=0; j<n; ++j )
-        r(j) = Sgn(z(j),false) * Sqrt(Abs(r(j)));
 
+    EL_TASKLOOP_IF( n >= ctrl.batchCutoff )
     for( Int j=0; j<n; ++j )
     {
         // Compute the j'th eigenvectors via Eqs. (3.4) and (3.3), respectively.
@@ -1359,6 +1402,14 @@ SecularEVD
           Matrix<Real>& dMinusShift, \
     const SecularEVDCtrl<Real>& ctrl ); \
   template SecularEVDInfo \
+  SecularEigenvalues \
+  ( const Matrix<Real>& d, \
+    const Real& rho, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& w, \
+          Matrix<Real>& dMinusShifts, \
+    const SecularEVDCtrl<Real>& ctrl ); \
+  template SecularEVDInfo \
   SecularEVD \
   ( const Matrix<Real>& d, \
     const Real& rho, \
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SECULAR_EVD_POLESUMS_HPP
+#define EL_SECULAR_EVD_POLESUMS_HPP
+
+namespace El {
+namespace secular_evd {
+
+// Accumulate the terms
+//
+//     z(j)^2 / (dPlusShift(j) dMinusShift(j))
+//
+// of a secular function over the poles j in [jBeg,jEnd), which must lie
+// entirely on one side of 'origin', as well as the sum of the squares of
+// z(j) / (dPlusShift(j) dMinusShift(j)) (which yields the derivative) and the
+// sum of the partial sums accumulated from the pole furthest from the origin
+// (which is the contribution of these terms to the error bound of
+// Ren-Cang Li's LAPACK Working Note 89 [CITATION]). The latter sum is formed
+// as the sum of each term weighted by its distance from the origin.
+//
+// If 'dPlusShift' is null, it is treated as a vector of all ones (as is the
+// case for eigenvalue problems).
+//
+
+template<typename Real>
+void PoleSumsSequential
+( Int jBeg, Int jEnd, Int origin,
+  const Real* z,
+  const Real* dMinusShift,
+  const Real* dPlusShift,
+        Real& sum,
+        Real& derivSum,
+        Real& partialSum )
+{
+    // Sum from the pole furthest from the origin towards it (which
+    // heuristically sums from small to large components)
+    const bool leftOfOrigin = ( jEnd <= origin );
+    sum = derivSum = partialSum = Real(0);
+    for( Int k=0; k<jEnd-jBeg; ++k )
+    {
+        const Int j = ( leftOfOrigin ? jBeg+k : jEnd-1-k );
+        const Real temp =
+          ( dPlusShift == nullptr ?
+            z[j] / dMinusShift[j] :
+            z[j] / (dPlusShift[j]*dMinusShift[j]) );
+        sum += z[j]*temp;
+        derivSum += temp*temp;
+        partialSum += sum;
+    }
+}
+
+template<typename Real,
+         typename=DisableIf<IsBlasScalar<Real>>,
+         typename=void>
+void PoleSums
+( Int jBeg, Int jEnd, Int origin,
+  const Real* z,
+  const Real* dMinusShift,
+  const Real* dPlusShift,
+        Real& sum,
+        Real& derivSum,
+        Real& partialSum )
+{
+    PoleSumsSequential
+    ( jBeg, jEnd, origin, z, dMinusShift, dPlusShift,
+      sum, derivSum, partialSum );
+}
+
+// Since the terms on each side of the origin share a sign, reassociating their
+// sums to allow for vectorization does not affect their accuracy.
+template<typename Real,
+         typename=EnableIf<IsBlasScalar<Real>>>
+void PoleSums
+( Int jBeg, Int jEnd, Int origin,
+  const Real* z,
+  const Real* dMinusShift,
+  const Real* dPlusShift,
+        Real& sum,
+        Real& derivSum,
+        Real& partialSum )
+{
+#if defined(EL_HYBRID) && defined(EL_HAVE_OMP_SIMD)
+    Real sumLoc=0, derivSumLoc=0, partialSumLoc=0;
+    if( dPlusShift == nullptr )
+    {
+        EL_SIMD_REDUCTION(+:sumLoc,derivSumLoc,partialSumLoc)
+        for( Int j=jBeg; j<jEnd; ++j )
+        {
+            const Real temp = z[j] / dMinusShift[j];
+            const Real term = z[j]*temp;
+            const Real distance = ( j < origin ? origin-j : j-origin );
+            sumLoc += term;
+            derivSumLoc += temp*temp;
+            partialSumLoc += distance*term;
+        }
+    }
+    else
+    {
+        EL_SIMD_REDUCTION(+:sumLoc,derivSumLoc,partialSumLoc)
+        for( Int j=jBeg; j<jEnd; ++j )
+        {
+            const Real temp = z[j] / (dPlusShift[j]*dMinusShift[j]);
+            const Real term = z[j]*temp;
+            const Real distance = ( j < origin ? origin-j : j-origin );
+            sumLoc += term;
+            derivSumLoc += temp*temp;
+            partialSumLoc += distance*term;
+        }
+    }
+    sum = sumLoc;
+    derivSum = derivSumLoc;
+    partialSum = partialSumLoc;
+#else
+    PoleSumsSequential
+    ( jBeg, jEnd, origin, z, dMinusShift, dPlusShift,
+      sum, derivSum, partialSum );
+#endif
+}
+
+} // namespace secular_evd
+} // namespace El
+
+#endif // ifndef EL_SECULAR_EVD_POLESUMS_HPP
@@ -21,6 +21,7 @@
 #endif
 
 #include "./SecularSVD/TwoByTwo.hpp"
+#include "./SecularEVD/PoleSums.hpp"
 
 namespace El {
 
@@ -140,34 +141,24 @@ void EvaluateSecular
     // approximation of the error
     // (see Ren-Cang Li, "Solving Secular Equations Stably and Efficiently",
     // LAPACK Working Note 89, 1993 [CITATION], as well as LAPACK's 
-    // {s,d}lasd4 [CITATION]). The loop direction is chosen to heuristically
-    // sum from small to large components.
-    state.psiMinus = 0;
-    state.psiMinusDeriv = 0;
-    state.relErrorBound = 0;
-    for( Int j=0; j<origin; ++j )
-    {
-        // Compute the j'th term divided by z(j)
-        temp = z(j) / (state.dPlusShift(j)*state.dMinusShift(j));
-        state.psiMinus += z(j)*temp; // This should be a negative contribution
-        state.psiMinusDeriv += temp*temp;
-        state.relErrorBound += state.psiMinus;
-    }
-    state.relErrorBound = Abs(state.relErrorBound); // This should be negation
+    // {s,d}lasd4 [CITATION]). The terms are summed from the furthest pole
+    // towards the origin to heuristically sum from small to large components.
+    const Real* zBuf = z.LockedBuffer();
+    const Real* dMinusShiftBuf = state.dMinusShift.LockedBuffer();
+    const Real* dPlusShiftBuf = state.dPlusShift.LockedBuffer();
+    Real psiPartialSum;
+    secular_evd::PoleSums
+    ( Int(0), origin, origin, zBuf, dMinusShiftBuf, dPlusShiftBuf,
+      state.psiMinus, state.psiMinusDeriv, psiPartialSum );
+    state.relErrorBound = Abs(psiPartialSum); // This should be negation
 
     // Compute phi, its derivative, and accumulate an approximation of the
-    // error in both psi_{m-1} and phi_m, where m is the origin index. The loop
-    // direction is chosen to heuristically sum from small to large components.
-    state.phi = 0;
-    state.phiDeriv = 0;
-    for( Int j=n-1; j>origin; --j )
-    {
-        // Compute the j'th term divided by z(j)
-        temp = z(j) / (state.dPlusShift(j)*state.dMinusShift(j));
-        state.phi += z(j)*temp;
-        state.phiDeriv += temp*temp;
-        state.relErrorBound += state.phi;
-    }
+    // error in both psi_{m-1} and phi_m, where m is the origin index.
+    Real phiPartialSum;
+    secular_evd::PoleSums
+    ( origin+1, n, origin, zBuf, dMinusShiftBuf, dPlusShiftBuf,
+      state.phi, state.phiDeriv, phiPartialSum );
+    state.relErrorBound += phiPartialSum;
 
     // Compute the secular function with the origin term removed
     // (and its derivative)
@@ -200,18 +191,14 @@ void EvaluateSecularLast
     const Real rhoInv = one / rho;
     Real temp;
 
-    state.psiMinus = 0;
-    state.psiMinusDeriv = 0;
-    state.relErrorBound = 0;
-    for( Int j=0; j<origin; ++j )
-    {
-        // Compute the j'th term divided by z(j)
-        temp = z(j) / (state.dPlusShift(j)*state.dMinusShift(j));
-        state.psiMinus += z(j)*temp;
-        state.psiMinusDeriv += temp*temp;
-        state.relErrorBound += state.psiMinus; // This should be negative
-    }
-    state.relErrorBound = Abs(state.relErrorBound); // This should be negation
+    Real psiPartialSum; // This should be negative
+    secular_evd::PoleSums
+    ( Int(0), origin, origin,
+      z.LockedBuffer(),
+      state.dMinusShift.LockedBuffer(),
+      state.dPlusShift.LockedBuffer(),
+      state.psiMinus, state.psiMinusDeriv, psiPartialSum );
+    state.relErrorBound = Abs(psiPartialSum); // This should be negation
 
     // Compute the origin term divided by z(origin)
     temp = z(origin) / (state.dPlusShift(origin)*state.dMinusShift(origin));
@@ -1419,6 +1406,63 @@ SecularSingularValue
     return info;
 }
 
+template<typename Real,typename>
+SecularSVDInfo
+SecularSingularValues
+( const Matrix<Real>& d,
+  const Real& rho,
+  const Matrix<Real>& z,
+        Matrix<Real>& s,
+        Matrix<Real>& dMinusShifts,
+        Matrix<Real>& dPlusShifts,
+  const SecularSVDCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = d.Height();
+    SecularSVDInfo info;
+#if defined(EL_HYBRID) && defined(EL_HAVE_OMP_TASKLOOP)
+    // Open a team of threads for the roots to be distributed over
+    if( !omp_in_parallel() && n >= ctrl.batchCutoff )
+    {
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        info =
+          SecularSingularValues( d, rho, z, s, dMinusShifts, dPlusShifts, ctrl );
+        return info;
+    }
+#endif
+
+    // The roots are independent, so we solve them concurrently (when possible)
+    // and sum their iteration counts afterwards.
+    s.Resize( n, 1 );
+    dMinusShifts.Resize( n, n );
+    dPlusShifts.Resize( n, n );
+    Matrix<Int> counts;
+    Zeros( counts, n, 4 );
+    EL_TASKLOOP_IF( n >= ctrl.batchCutoff )
+    for( Int j=0; j<n; ++j )
+    {
+        auto dMinusShift = dMinusShifts( ALL, IR(j) );
+        auto dPlusShift = dPlusShifts( ALL, IR(j) );
+        auto valueInfo =
+          SecularSingularValue
+          ( j, d, rho, z, s(j), dMinusShift, dPlusShift, ctrl );
+        counts(j,0) = valueInfo.numIterations;
+        counts(j,1) = valueInfo.numAlternations;
+        counts(j,2) = valueInfo.numCubicIterations;
+        counts(j,3) = valueInfo.numCubicFailures;
+    }
+    for( Int j=0; j<n; ++j )
+    {
+        info.numIterations += counts(j,0);
+        info.numAlternations += counts(j,1);
+        info.numCubicIterations += counts(j,2);
+        info.numCubicFailures += counts(j,3);
+    }
+
+    return info;
+}
+
 template<typename Real,typename>
 SecularSVDInfo
 SecularSVD
@@ -1459,15 +1503,32 @@ SecularSVD
         return info;
     }
 
-    // TODO(poulson): Batch secular equation solvers?
-    //
-    // Compute all of the singular values and the vector r ~= sqrt(rho) z which
-    // would produce the given singular values to high relative accuracy.
+#if defined(EL_HYBRID) && defined(EL_HAVE_OMP_TASKLOOP)
+    // Open a team of threads for the roots and singular vectors to be
+    // distributed over
+    if( !omp_in_parallel() && n >= ctrl.batchCutoff )
+    {
+        EL_PARALLEL_REGION
+        EL_SINGLE
+        info = SecularSVD( d, rho, z, U, s, V, ctrl );
+        return info;
+    }
+#endif
+
+    // Compute all of the singular values, temporarily storing d-s(j) and
+    // d+s(j) in the j'th columns of U and V, respectively. It is worth noting
+    // that we only require access to their Hadamard product afterwards.
+    info = SecularSingularValues( d, rho, z, s, U, V, ctrl );
+    EL_TASKLOOP_IF( n >= ctrl.batchCutoff )
+    for( Int j=0; j<n; ++j )
+        for( Int k=0; k<n; ++k )
+            U(k,j) *= V(k,j);
+
+    // Compute the vector r ~= sqrt(rho) z which would produce the given
+    // singular values to high relative accuracy.
     //
-    // We accumulate the products involved in computing r in an online manner
-    // and take the square-root of the absolute value (and the correct sign)
-    // at the end. The key is to recognize that the only term left out of entry
-    // i of the corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
+    // The key is to recognize that the only term left out of entry i of the
+    // corrected vector in Eq. (3.6) of Gu/Eisenstat in the product
     //
     //    prod_{k=0}^{n-1} (sigma_k^2 - d(i)^2) / (d(k)^2 - d(i)^2)
     //
@@ -1484,46 +1545,27 @@ SecularSVD
     //      prod_{k=0  }^{i-1} (sigma_k^2 - d(i)^2) / (d(k)^2 - d(i)^2) *
     //      prod_{k=i+1}^{n-1} (sigma_k^2 - d(i)^2) / (d(k)^2 - d(i)^2).
     //
-    // Given that we have available only one sigma_j at a time, we greedily
-    // update all r(i) products given each sigma_j
+    // Each entry of r is independent of the others and is formed by
+    // accumulating the product in order of increasing k
     // (Cf. LAPACK's {s,d}lasd8 [CITATION] for this approach).
     //
-    U.Resize( n, n );
-    V.Resize( n, n );
     Matrix<Real> r;
-    Ones( r, n, 1 );
-    auto vScratch = V(ALL,IR(0));
-    for( Int j=0; j<n; ++j )
+    r.Resize( n, 1 );
+    EL_TASKLOOP_IF( n >= ctrl.batchCutoff )
+    for( Int i=0; i<n; ++i )
     {
-        // While we will temporarily store dMinusShift and dPlusShift in the
-        // j'th columns of U and V, respectively, it is worth noting that we 
-        // only require access to their Hadamard product after this loop ends.
-        auto u = U(ALL,IR(j));
-        auto valueInfo =
-          SecularSingularValue( j, d, rho, z, s(j), u, vScratch, ctrl );
-        
-        info.numIterations += valueInfo.numIterations;
-        info.numAlternations += valueInfo.numAlternations;
-        info.numCubicIterations += valueInfo.numCubicIterations;
-        info.numCubicFailures += valueInfo.numCubicFailures;
-
-        // u currently hold d-s(j) and vScratch currently holds d+s(j).
-        // Overwrite u with their element-wise product since that is all we 
-        // require from here on out.
-        for( Int k=0; k<n; ++k )
-            u(k) *= vScratch(k);
-      
-        r(j) *= u(j);
+        Real rProd = 1;
         for( Int k=0; k<n; ++k )
         {
-            if( k == j )
-                continue;
-            r(k) *= u(k) / ((d(j)+d(k))*(d(j)-d(k)));
+            if( k == i )
+                rProd *= U(i,i);
+            else
+                rProd *= U(i,k) / ((d(k)+d(i))*(d(k)-d(i)));
         }
+        r(i) = Sgn(z(i),false) * Sqrt(Abs(rProd));
     }
-    for( Int j=0; j<n; ++j )
-        r(j) = Sgn(z(j),false) * Sqrt(Abs(r(j)));
 
+    EL_TASKLOOP_IF( n >= ctrl.batchCutoff )
     for( Int j=0; j<n; ++j )
     {
         // Compute the j'th left and right singular vectors via
@@ -1568,6 +1610,15 @@ SecularSVD
           Matrix<Real>& dPlusShift, \
     const SecularSVDCtrl<Real>& ctrl ); \
   template SecularSVDInfo \
+  SecularSingularValues \
+  ( const Matrix<Real>& d, \
+    const Real& rho, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& s, \
+          Matrix<Real>& dMinusShifts, \
+          Matrix<Real>& dPlusShifts, \
+    const SecularSVDCtrl<Real>& ctrl ); \
+  template SecularSVDInfo \
   SecularSVD \
   ( const Matrix<Real>& d, \
     const Real& rho, \
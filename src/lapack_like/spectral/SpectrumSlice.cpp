@@ -0,0 +1,651 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace spectrum_slice {
+
+// Return the window (lowerBound,upperBound] to be sliced. If no subset was
+// requested, the window is widened from the Gershgorin interval [lower,upper]
+// so that its left end is exclusive.
+template<typename Real>
+pair<Real,Real> Window
+( const HermitianEigSubset<Real>& subset, Real lower, Real upper )
+{
+    EL_DEBUG_CSE
+    if( subset.indexSubset )
+        LogicError("Index subsets are not yet supported by spectrum slicing");
+    if( subset.rangeSubset )
+    {
+        if( subset.lowerBound >= subset.upperBound )
+            LogicError("Invalid eigenvalue window");
+        return pair<Real,Real>(subset.lowerBound,subset.upperBound);
+    }
+    const Real eps = limits::Epsilon<Real>();
+    const Real pad = Max(Abs(lower),Abs(upper))*eps*Real(16) + eps;
+    return pair<Real,Real>(lower-pad,upper+pad);
+}
+
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+GershgorinInterval( const SparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    Real lower = limits::Max<Real>(), upper = limits::Lowest<Real>();
+    for( Int i=0; i<n; ++i )
+    {
+        Real center=0, radius=0;
+        const Int offset = A.RowOffset(i);
+        const Int numConn = A.NumConnections(i);
+        for( Int e=offset; e<offset+numConn; ++e )
+        {
+            if( A.Col(e) == i )
+                center += RealPart(A.Value(e));
+            else
+                radius += Abs(A.Value(e));
+        }
+        lower = Min( lower, center-radius );
+        upper = Max( upper, center+radius );
+    }
+    return pair<Real,Real>(lower,upper);
+}
+
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+GershgorinInterval( const DistSparseMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int localHeight = A.LocalHeight();
+    Real lower = limits::Max<Real>(), upper = limits::Lowest<Real>();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        Real center=0, radius=0;
+        const Int offset = A.RowOffset(iLoc);
+        const Int numConn = A.NumConnections(iLoc);
+        for( Int e=offset; e<offset+numConn; ++e )
+        {
+            if( A.Col(e) == i )
+                center += RealPart(A.Value(e));
+            else
+                radius += Abs(A.Value(e));
+        }
+        lower = Min( lower, center-radius );
+        upper = Max( upper, center+radius );
+    }
+    mpi::Comm comm = A.Grid().Comm();
+    lower = mpi::AllReduce( lower, mpi::MIN, comm );
+    upper = mpi::AllReduce( upper, mpi::MAX, comm );
+    return pair<Real,Real>(lower,upper);
+}
+
+// Recursively bisect the window (lowerBound,upperBound] until no slice
+// contains more than 'maxEigsPerSlice' eigenvalues. The function
+// 'countEigs( shifts )' should return the number of eigenvalues less than or
+// equal to each shift; each call is handed an entire level of shifts so that
+// the counts can be computed in parallel.
+//
+// On exit, the i'th slice is (bounds[i],bounds[i+1]] and contains
+// sliceCounts[i] eigenvalues.
+template<typename Real,class CountFunction>
+Int Bisect
+( Real lowerBound,
+  Real upperBound,
+  Int numInitialSlices,
+  Int maxEigsPerSlice,
+  const CountFunction& countEigs,
+  vector<Real>& bounds,
+  vector<Int>& sliceCounts,
+  bool progress,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Real eps = limits::Epsilon<Real>();
+    numInitialSlices = Max( numInitialSlices, Int(1) );
+    maxEigsPerSlice = Max( maxEigsPerSlice, Int(1) );
+
+    bounds.resize( numInitialSlices+1 );
+    for( Int i=0; i<=numInitialSlices; ++i )
+        bounds[i] =
+          lowerBound + (upperBound-lowerBound)*Real(i)/Real(numInitialSlices);
+    bounds[numInitialSlices] = upperBound;
+    vector<Int> cumCounts = countEigs( bounds );
+    Int numCountShifts = cumCounts.size();
+
+    for( Int level=0; true; ++level )
+    {
+        // Find the midpoints of the slices which are too full (but which are
+        // still wide enough to be split)
+        const Int numSlices = bounds.size()-1;
+        vector<Real> mids;
+        vector<bool> split( numSlices, false );
+        for( Int i=0; i<numSlices; ++i )
+        {
+            const Int count = cumCounts[i+1] - cumCounts[i];
+            const Real lower = bounds[i];
+            const Real upper = bounds[i+1];
+            const Real minWidth =
+              Real(4)*eps*Max(Abs(lower),Abs(upper)) + limits::Min<Real>();
+            if( count > maxEigsPerSlice && upper-lower > minWidth )
+            {
+                split[i] = true;
+                mids.push_back( lower + (upper-lower)/Real(2) );
+            }
+        }
+        if( progress )
+            OutputFromRoot
+            (comm,"level ",level,": ",numSlices," slices, ",mids.size(),
+             " too full");
+        if( mids.size() == 0 )
+            break;
+
+        const vector<Int> midCounts = countEigs( mids );
+        numCountShifts += midCounts.size();
+        vector<Real> newBounds;
+        vector<Int> newCumCounts;
+        for( Int i=0, k=0; i<numSlices; ++i )
+        {
+            newBounds.push_back( bounds[i] );
+            newCumCounts.push_back( cumCounts[i] );
+            if( split[i] )
+            {
+                // Guard against inconsistent counts from an unstable
+                // factorization
+                const Int midCount =
+                  Min( Max(midCounts[k],cumCounts[i]), cumCounts[i+1] );
+                newBounds.push_back( mids[k] );
+                newCumCounts.push_back( midCount );
+                ++k;
+            }
+        }
+        newBounds.push_back( bounds[numSlices] );
+        newCumCounts.push_back( cumCounts[numSlices] );
+        bounds = newBounds;
+        cumCounts = newCumCounts;
+    }
+
+    const Int numSlices = bounds.size()-1;
+    sliceCounts.resize( numSlices );
+    for( Int i=0; i<numSlices; ++i )
+        sliceCounts[i] = Max( cumCounts[i+1]-cumCounts[i], Int(0) );
+    return numCountShifts;
+}
+
+// Assign the nonempty slices to teams using a greedy largest-first heuristic
+// (the cost of a slice is modeled as one factorization plus one unit per
+// eigenpair, in units of maxEigsPerSlice)
+inline vector<Int>
+AssignSlices( const vector<Int>& sliceCounts, Int numTeams )
+{
+    EL_DEBUG_CSE
+    const Int numSlices = sliceCounts.size();
+    vector<Int> order( numSlices );
+    for( Int i=0; i<numSlices; ++i )
+        order[i] = i;
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( Int i, Int j ) { return sliceCounts[i] > sliceCounts[j]; } );
+
+    const Int maxCount =
+      ( numSlices > 0 ?
+        *std::max_element(sliceCounts.begin(),sliceCounts.end()) : 0 );
+    vector<Int> teams( numSlices, -1 ), loads( numTeams, 0 );
+    for( const Int i : order )
+    {
+        if( sliceCounts[i] == 0 )
+            continue;
+        const Int team =
+          std::min_element(loads.begin(),loads.end()) - loads.begin();
+        teams[i] = team;
+        loads[team] += maxCount + sliceCounts[i];
+    }
+    return teams;
+}
+
+// Compute the (at most numEigs) eigenpairs of A with eigenvalues in
+// (lower,upper] using thick-restart Lanczos on inv(A - sigma I), where
+// 'applyShiftedInv' overwrites its argument W with inv(A - sigma I) W.
+// Converged eigenvectors are deflated from the operator and Lanczos is
+// restarted until either numEigs eigenpairs have been found, a pass makes
+// no progress, or maxPasses passes have been run. The result is polished with
+// a Rayleigh-Ritz projection of A itself.
+//
+// As in El/lapack_like/spectral/KrylovEig.hpp, all of the blocks of vectors
+// are the local rows of row-distributed matrices (summed over 'comm').
+template<typename Field,class ApplyAType,class ApplyInvType>
+void Slice
+(       Int n,
+        Int localHeight,
+        mpi::Comm comm,
+  const ApplyAType& applyA,
+  const ApplyInvType& applyShiftedInv,
+        Base<Field> sigma,
+        Base<Field> lower,
+        Base<Field> upper,
+        Int numEigs,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    Matrix<Field> V, VNew, H;
+    Matrix<Real> mu, norms;
+    Zeros( V, localHeight, 0 );
+
+    auto applyDeflatedInv =
+      [&]( const Matrix<Field>& XLoc, Matrix<Field>& YLoc )
+      {
+          YLoc = XLoc;
+          if( V.Width() > 0 )
+              krylov_eig::Orthogonalize( V, YLoc, H, comm );
+          applyShiftedInv( YLoc );
+          if( V.Width() > 0 )
+              krylov_eig::Orthogonalize( V, YLoc, H, comm );
+      };
+
+    for( Int pass=0; pass<ctrl.maxPasses; ++pass )
+    {
+        const Int numFound = V.Width();
+        const Int numWanted = numEigs - numFound;
+        if( numWanted <= 0 )
+            break;
+
+        auto krylovCtrl = ctrl.krylovCtrl;
+        krylovCtrl.numEigs = numWanted;
+        krylovCtrl.target = EIG_LARGEST_MAGNITUDE;
+        krylovCtrl.shiftInvert = false;
+        Matrix<Field> XPass;
+        krylov_eig::ThickRestartLanczos
+        ( n-numFound, localHeight, comm, applyDeflatedInv, mu, XPass,
+          krylovCtrl );
+
+        // Keep the Ritz vectors whose eigenvalues lie within the slice
+        vector<Int> keepInds;
+        for( Int j=0; j<mu.Height(); ++j )
+        {
+            if( mu(j) == Real(0) )
+                continue;
+            const Real lambda = sigma + Real(1)/mu(j);
+            if( lambda > lower && lambda <= upper )
+                keepInds.push_back( j );
+        }
+        if( keepInds.size() == 0 )
+            break;
+        GetSubmatrix( XPass, IR(0,localHeight), keepInds, VNew );
+        if( numFound > 0 )
+            krylov_eig::Orthogonalize( V, VNew, H, comm );
+        krylov_eig::ColumnNorms( VNew, norms, comm );
+        for( Int j=0; j<VNew.Width(); ++j )
+        {
+            auto vNew = VNew( ALL, IR(j) );
+            vNew *= Real(1)/norms(j);
+        }
+
+        Matrix<Field> VOld( V );
+        Zeros( V, localHeight, numFound+VNew.Width() );
+        auto VL = V( ALL, IR(0,numFound) );
+        auto VR = V( ALL, IR(numFound,END) );
+        VL = VOld;
+        VR = VNew;
+    }
+
+    // Rayleigh-Ritz with A itself
+    const Int numFound = V.Width();
+    if( numFound == 0 )
+    {
+        w.Resize( 0, 1 );
+        X.Resize( localHeight, 0 );
+        return;
+    }
+    Matrix<Field> AV, U;
+    applyA( V, AV );
+    krylov_eig::RayleighRitz( V, AV, EIG_SMALLEST, numFound, U, w, comm );
+    Gemm( NORMAL, NORMAL, Field(1), V, U, X );
+}
+
+} // namespace spectrum_slice
+
+template<typename Field>
+SpectrumSliceInfo
+HermitianEig
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto gershgorin = spectrum_slice::GershgorinInterval( A );
+    auto window =
+      spectrum_slice::Window( ctrl.subset, gershgorin.first, gershgorin.second );
+
+    // Ensure that the diagonal is explicitly stored so that shifts can be
+    // applied without changing the sparsity pattern
+    SparseMatrix<Field> ABase( A ), AShift;
+    ShiftDiagonal( ABase, Field(0) );
+
+    SpectrumSliceInfo info;
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( ABase, true, ctrl.bisectCtrl );
+    auto factorShifted =
+      [&]( Real sigma )
+      {
+          AShift = ABase;
+          ShiftDiagonal( AShift, Field(-sigma), 0, true );
+          sparseLDLFact.ChangeNonzeroValues( AShift );
+          sparseLDLFact.Factor( ctrl.frontType );
+          ++info.numFactorizations;
+      };
+    auto countEigs =
+      [&]( const vector<Real>& shifts )
+      {
+          vector<Int> counts( shifts.size() );
+          for( Int k=0; k<Int(shifts.size()); ++k )
+          {
+              factorShifted( shifts[k] );
+              const InertiaType inertia = sparseLDLFact.Inertia();
+              counts[k] = inertia.numNegative + inertia.numZero;
+          }
+          return counts;
+      };
+
+    vector<Real> bounds;
+    vector<Int> sliceCounts;
+    spectrum_slice::Bisect
+    ( window.first, window.second, Int(1), ctrl.maxEigsPerSlice, countEigs,
+      bounds, sliceCounts, ctrl.progress, mpi::COMM_SELF );
+    const Int numSlices = sliceCounts.size();
+    info.numSlices = numSlices;
+
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+      };
+    auto applyShiftedInv =
+      [&]( Matrix<Field>& W ) { sparseLDLFact.Solve( W ); };
+
+    vector<Matrix<Real>> sliceW( numSlices );
+    vector<Matrix<Field>> sliceX( numSlices );
+    for( Int i=0; i<numSlices; ++i )
+    {
+        if( sliceCounts[i] == 0 )
+            continue;
+        const Real lower = bounds[i];
+        const Real upper = bounds[i+1];
+        const Real sigma = lower + (upper-lower)/Real(2);
+        if( ctrl.progress )
+            Output
+            ("Slice ",i," of ",numSlices,": (",lower,",",upper,"] with ",
+             sliceCounts[i]," eigenvalues");
+        factorShifted( sigma );
+        spectrum_slice::Slice
+        ( n, n, mpi::COMM_SELF, applyA, applyShiftedInv, sigma, lower, upper,
+          sliceCounts[i], ctrl, sliceW[i], sliceX[i] );
+        info.numEigs += sliceCounts[i];
+        info.numFound += sliceW[i].Height();
+    }
+
+    Zeros( w, info.numFound, 1 );
+    Zeros( X, n, info.numFound );
+    for( Int i=0, off=0; i<numSlices; ++i )
+    {
+        const Int numSliceEigs = sliceW[i].Height();
+        if( numSliceEigs == 0 )
+            continue;
+        auto wSlice = w( IR(off,off+numSliceEigs), ALL );
+        auto XSlice = X( ALL, IR(off,off+numSliceEigs) );
+        wSlice = sliceW[i];
+        XSlice = sliceX[i];
+        off += numSliceEigs;
+    }
+    info.converged = ( info.numFound == info.numEigs );
+    return info;
+}
+
+template<typename Field>
+SpectrumSliceInfo
+HermitianEig
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        DistMultiVec<Field>& X,
+  const SpectrumSliceCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    auto gershgorin = spectrum_slice::GershgorinInterval( A );
+    auto window =
+      spectrum_slice::Window( ctrl.subset, gershgorin.first, gershgorin.second );
+
+    // Split the processes into contiguous teams
+    // =========================================
+    const Int numTeams =
+      ( ctrl.numTeams > 0 ? Min(ctrl.numTeams,Int(commSize)) : commSize );
+    const int team = (Int(commRank)*numTeams) / commSize;
+    auto teamOffset =
+      [&]( Int t ) { return int((t*commSize+numTeams-1)/numTeams); };
+    mpi::Comm teamComm;
+    mpi::Split( comm, team, commRank-teamOffset(team), teamComm );
+    // The team's sparse matrices and multivectors only use the VC
+    // communicator of its grid, but the sparse LDL factors its root front
+    // over the full 2D grid, so keep the default (nearly square) shape.
+    Grid teamGrid( teamComm );
+    mpi::Free( teamComm );
+    const bool teamRoot = ( teamGrid.Rank() == 0 );
+
+    // Give each team a copy of A
+    // ==========================
+    // The row distribution of a DistSparseMatrix over p processes uses blocks
+    // of ceil(n/p) rows.
+    DistSparseMatrix<Field> ABase(teamGrid), AShift(teamGrid);
+    {
+        auto teamOwner =
+          [&]( Int t, Int i )
+          {
+              const Int teamSize = teamOffset(t+1) - teamOffset(t);
+              Int blocksize = n / teamSize;
+              if( blocksize*teamSize < n || n == 0 )
+                  ++blocksize;
+              return teamOffset(t) + int(i/blocksize);
+          };
+        const Int numLocalEntries = A.NumLocalEntries();
+        vector<int> sendCounts(commSize,0);
+        for( Int e=0; e<numLocalEntries; ++e )
+            for( Int t=0; t<numTeams; ++t )
+                ++sendCounts[teamOwner(t,A.Row(e))];
+        vector<int> sendOffs;
+        const int totalSend = Scan( sendCounts, sendOffs );
+        vector<Entry<Field>> sendBuf( totalSend );
+        auto offs = sendOffs;
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            const Entry<Field> entry{ A.Row(e), A.Col(e), A.Value(e) };
+            for( Int t=0; t<numTeams; ++t )
+                sendBuf[offs[teamOwner(t,entry.i)]++] = entry;
+        }
+        auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+        SwapClear( sendBuf );
+
+        ABase.Resize( n, n );
+        ABase.Reserve( recvBuf.size() );
+        const Int firstLocalRow = ABase.FirstLocalRow();
+        for( const auto& entry : recvBuf )
+            ABase.QueueLocalUpdate( entry.i-firstLocalRow, entry.j, entry.value );
+        ABase.ProcessLocalQueues();
+    }
+    // Ensure that the diagonal is explicitly stored so that shifts can be
+    // applied without changing the sparsity pattern
+    ShiftDiagonal( ABase, Field(0) );
+
+    // Count the eigenvalues below each shift in parallel over the teams
+    // =================================================================
+    SpectrumSliceInfo info;
+    Int numTeamFactorizations = 0;
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( ABase, true, ctrl.bisectCtrl );
+    auto factorShifted =
+      [&]( Real sigma )
+      {
+          AShift = ABase;
+          ShiftDiagonal( AShift, Field(-sigma), 0, true );
+          sparseLDLFact.ChangeNonzeroValues( AShift );
+          sparseLDLFact.Factor( ctrl.frontType );
+          if( teamRoot )
+              ++numTeamFactorizations;
+      };
+    auto countEigs =
+      [&]( const vector<Real>& shifts )
+      {
+          vector<Int> counts( shifts.size(), 0 );
+          for( Int k=team; k<Int(shifts.size()); k+=numTeams )
+          {
+              factorShifted( shifts[k] );
+              const InertiaType inertia = sparseLDLFact.Inertia();
+              if( teamRoot )
+                  counts[k] = inertia.numNegative + inertia.numZero;
+          }
+          mpi::AllReduce( counts.data(), counts.size(), comm );
+          return counts;
+      };
+
+    vector<Real> bounds;
+    vector<Int> sliceCounts;
+    spectrum_slice::Bisect
+    ( window.first, window.second, numTeams, ctrl.maxEigsPerSlice, countEigs,
+      bounds, sliceCounts, ctrl.progress, comm );
+    const Int numSlices = sliceCounts.size();
+    info.numSlices = numSlices;
+    for( Int i=0; i<numSlices; ++i )
+        info.numEigs += sliceCounts[i];
+
+    // Have each team compute the eigenpairs of its slices
+    // ===================================================
+    const vector<Int> sliceTeams =
+      spectrum_slice::AssignSlices( sliceCounts, numTeams );
+    const Int localHeight = ABase.LocalHeight();
+    DistMultiVec<Field> XTeam(teamGrid), YTeam(teamGrid);
+    auto applyA =
+      [&]( const Matrix<Field>& XLoc, Matrix<Field>& YLoc )
+      {
+          Zeros( XTeam, n, XLoc.Width() );
+          XTeam.Matrix() = XLoc;
+          Zeros( YTeam, n, XLoc.Width() );
+          Multiply( NORMAL, Field(1), ABase, XTeam, Field(0), YTeam );
+          YLoc = YTeam.LockedMatrix();
+      };
+    auto applyShiftedInv =
+      [&]( Matrix<Field>& WLoc )
+      {
+          Zeros( XTeam, n, WLoc.Width() );
+          XTeam.Matrix() = WLoc;
+          sparseLDLFact.Solve( XTeam );
+          WLoc = XTeam.LockedMatrix();
+      };
+
+    vector<Matrix<Real>> sliceW( numSlices );
+    vector<Matrix<Field>> sliceX( numSlices );
+    vector<Int> sliceNumFound( numSlices, 0 );
+    for( Int i=0; i<numSlices; ++i )
+    {
+        if( sliceTeams[i] != team )
+            continue;
+        const Real lower = bounds[i];
+        const Real upper = bounds[i+1];
+        const Real sigma = lower + (upper-lower)/Real(2);
+        factorShifted( sigma );
+        spectrum_slice::Slice
+        ( n, localHeight, teamGrid.Comm(), applyA, applyShiftedInv,
+          sigma, lower, upper, sliceCounts[i], ctrl, sliceW[i], sliceX[i] );
+        if( teamRoot )
+            sliceNumFound[i] = sliceW[i].Height();
+        if( ctrl.progress && teamRoot )
+            Output
+            ("Team ",team,": slice (",lower,",",upper,"] with ",
+             sliceCounts[i]," eigenvalues, found ",sliceW[i].Height());
+    }
+    mpi::AllReduce( sliceNumFound.data(), numSlices, comm );
+    info.numFactorizations = mpi::AllReduce( numTeamFactorizations, comm );
+    vector<Int> sliceOffs;
+    info.numFound = Scan( sliceNumFound, sliceOffs );
+
+    // Gather the eigenvalues and redistribute the eigenvectors
+    // ========================================================
+    vector<Real> wAll( info.numFound, Real(0) );
+    Int numLocalUpdates = 0;
+    for( Int i=0; i<numSlices; ++i )
+    {
+        if( sliceTeams[i] != team )
+            continue;
+        if( teamRoot )
+            for( Int j=0; j<sliceNumFound[i]; ++j )
+                wAll[sliceOffs[i]+j] = sliceW[i](j);
+        numLocalUpdates += localHeight*sliceNumFound[i];
+    }
+    mpi::AllReduce( wAll.data(), info.numFound, comm );
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    auto& w = wProx.Get();
+    w.Resize( info.numFound, 1 );
+    for( Int j=0; j<info.numFound; ++j )
+        w.SetLocal( j, 0, wAll[j] );
+
+    X.SetGrid( grid );
+    Zeros( X, n, info.numFound );
+    X.Reserve( numLocalUpdates );
+    for( Int i=0; i<numSlices; ++i )
+    {
+        if( sliceTeams[i] != team )
+            continue;
+        for( Int j=0; j<sliceNumFound[i]; ++j )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                X.QueueUpdate
+                ( ABase.GlobalRow(iLoc), sliceOffs[i]+j, sliceX[i](iLoc,j) );
+    }
+    X.ProcessQueues();
+
+    info.converged = ( info.numFound == info.numEigs );
+    return info;
+}
+
+#define PROTO(Field) \
+  template SpectrumSliceInfo HermitianEig \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+    const SpectrumSliceCtrl<Base<Field>>& ctrl ); \
+  template SpectrumSliceInfo HermitianEig \
+  ( const DistSparseMatrix<Field>& A, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          DistMultiVec<Field>& X, \
+    const SpectrumSliceCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -12,7 +12,7 @@
 
 #ifdef EL_HAVE_PARMETIS
 # include "parmetis.h"
-#else
+#elif defined(EL_HAVE_METIS)
 # include "metis.h"
 #endif
 
@@ -27,6 +27,9 @@ Int Bisect
 {
     EL_DEBUG_CSE
 #ifdef EL_HAVE_METIS
+    if( ctrl.native )
+        return MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
+
     // METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
     const Int numSources = graph.NumSources();
@@ -90,8 +93,7 @@ Int Bisect
     ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
     return sizes[2];
 #else
-    LogicError("METIS interface was not available");
-    return -1;
+    return MultilevelBisect( graph, leftChild, rightChild, perm, ctrl );
 #endif
 }
 
@@ -105,6 +107,14 @@ Int Bisect
 {
     EL_DEBUG_CSE
 #ifdef EL_HAVE_METIS
+#ifdef EL_HAVE_PARMETIS
+    if( ctrl.native )
+#else
+    if( ctrl.native || !ctrl.sequential )
+#endif
+        return MultilevelBisect
+        ( graph, childGrid, child, perm, onLeft, ctrl );
+
     const Grid& grid = graph.Grid();
     const int commSize = grid.Size();
     const int commRank = grid.Rank();
@@ -314,8 +324,6 @@ Int Bisect
 
         // Since idx_t might be different than Int
         std::copy( perm_idx_t.begin(), perm_idx_t.end(), perm.Buffer() );
-#else
-        LogicError("ParMETIS was not available");
 #endif
     }
     EL_DEBUG_ONLY(EnsurePermutation( perm ))
@@ -323,8 +331,7 @@ Int Bisect
     ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child );
     return sizes[2];
 #else
-    LogicError("METIS was not available");
-    return -1;
+    return MultilevelBisect( graph, childGrid, child, perm, onLeft, ctrl );
 #endif
 }
 
@@ -0,0 +1,1522 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <queue>
+
+// A native multilevel vertex separator in the spirit of (Par)METIS:
+//
+//  1. The graph is repeatedly coarsened by contracting a heavy-edge matching,
+//     which is computed by a thread-parallel handshake algorithm. In the
+//     distributed case, each process only matches its own vertices so that
+//     the coarsening requires no communication beyond a ghost exchange.
+//
+//  2. Once the graph is sufficiently small, it is gathered onto every
+//     process and bisected using greedy graph growing followed by
+//     Fiduccia-Mattheyses refinement. Each process uses different seeds and
+//     the best bisection is kept.
+//
+//  3. The bisection is projected back to the original graph and the edge cut
+//     is refined after each projection: with Fiduccia-Mattheyses in the
+//     sequential case and with one-directional greedy passes (which cannot
+//     conflict with the simultaneous moves of other processes) in the
+//     distributed case.
+//
+//  4. A vertex separator is extracted from the edge separator. Sequentially,
+//     a minimum vertex cover of the bipartite graph of cut edges is used
+//     (via Koenig's theorem); in the distributed case, the boundary of the
+//     side with the smaller boundary is taken and then greedily improved by
+//     moving separator vertices into either side.
+
+namespace El {
+namespace multilevel {
+
+// The vertex and edge weights of the (local portion of a) symmetric graph
+// without self-connections. The targets are global indices, and the local
+// vertices are [firstVertex,firstVertex+numVertices).
+struct WeightedGraph
+{
+    Int numVertices=0;
+    Int firstVertex=0;
+    vector<Int> offsets, targets, edgeWeights, vertexWeights;
+};
+
+// Sequential coarsening stops at this number of vertices
+const Int coarsestSize = 128;
+// Coarsening stops if a level shrinks by less than 5 percent
+const double minCoarseningRatio = 0.95;
+const Int numMatchingRounds = 8;
+const Int numInitialTrials = 4;
+const Int numRefinePasses = 8;
+
+inline Int MaxThreads()
+{
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+// The SplitMix64 finalizer, which is used to deterministically randomize
+inline unsigned long long Mix( unsigned long long x )
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+inline Int TotalWeight( const vector<Int>& weights )
+{
+    Int total = 0;
+    for( const Int& weight : weights )
+        total += weight;
+    return total;
+}
+
+inline Int MaxSideWeight
+( Int totalWeight, Int maxVertexWeight, double maxImbalance )
+{
+    const Int half = (totalWeight+1) / 2;
+    return Max( Int(maxImbalance*half), half+maxVertexWeight );
+}
+
+WeightedGraph FromGraph( const Graph& graph )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    WeightedGraph wGraph;
+    wGraph.numVertices = numSources;
+    wGraph.offsets.resize( numSources+1 );
+    wGraph.targets.reserve( graph.NumEdges() );
+    for( Int s=0; s<numSources; ++s )
+    {
+        wGraph.offsets[s] = wGraph.targets.size();
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+            if( targetBuf[e] != s && targetBuf[e] < numSources )
+                wGraph.targets.push_back( targetBuf[e] );
+    }
+    wGraph.offsets[numSources] = wGraph.targets.size();
+    wGraph.edgeWeights.resize( wGraph.targets.size(), 1 );
+    wGraph.vertexWeights.resize( numSources, 1 );
+    return wGraph;
+}
+
+WeightedGraph FromGraph( const DistGraph& graph )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    WeightedGraph wGraph;
+    wGraph.numVertices = numLocalSources;
+    wGraph.firstVertex = firstLocalSource;
+    wGraph.offsets.resize( numLocalSources+1 );
+    wGraph.targets.reserve( graph.NumLocalEdges() );
+    for( Int s=0; s<numLocalSources; ++s )
+    {
+        wGraph.offsets[s] = wGraph.targets.size();
+        const Int source = firstLocalSource + s;
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+            if( targetBuf[e] != source && targetBuf[e] < numSources )
+                wGraph.targets.push_back( targetBuf[e] );
+    }
+    wGraph.offsets[numLocalSources] = wGraph.targets.size();
+    wGraph.edgeWeights.resize( wGraph.targets.size(), 1 );
+    wGraph.vertexWeights.resize( numLocalSources, 1 );
+    return wGraph;
+}
+
+// Compute a heavy-edge matching of the local vertices using rounds of
+// proposals: each unmatched vertex proposes to the unmatched local neighbor
+// connected by the largest edge (with ties broken by a symmetric hash so
+// that the edges are totally ordered) and mutual proposals are matched.
+// The heaviest remaining edge is always mutually proposed, so every round
+// makes progress. Unmatched vertices are matched with themselves.
+void HandshakeMatching
+( const WeightedGraph& graph,
+        Int maxVertexWeight,
+        unsigned long long seed,
+        vector<Int>& match )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+    const Int firstVertex = graph.firstVertex;
+    match.assign( numVertices, -1 );
+    vector<Int> proposal( numVertices );
+    for( Int round=0; round<numMatchingRounds; ++round )
+    {
+        EL_PARALLEL_FOR
+        for( Int v=0; v<numVertices; ++v )
+        {
+            proposal[v] = -1;
+            if( match[v] != -1 )
+                continue;
+            const Int vGlobal = firstVertex + v;
+            const Int vWeight = graph.vertexWeights[v];
+            Int bestWeight = -1;
+            unsigned long long bestKey = 0;
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                const Int u = graph.targets[e] - firstVertex;
+                if( u < 0 || u >= numVertices || match[u] != -1 )
+                    continue;
+                if( vWeight+graph.vertexWeights[u] > maxVertexWeight )
+                    continue;
+                const Int uGlobal = graph.targets[e];
+                const unsigned long long key =
+                  Mix( seed ^ Mix(Min(uGlobal,vGlobal)) ^
+                       Mix(~Max(uGlobal,vGlobal)) );
+                const Int weight = graph.edgeWeights[e];
+                if( weight > bestWeight ||
+                    (weight == bestWeight && key > bestKey) )
+                {
+                    bestWeight = weight;
+                    bestKey = key;
+                    proposal[v] = u;
+                }
+            }
+        }
+
+        Int numNewMatches = 0;
+        for( Int v=0; v<numVertices; ++v )
+        {
+            const Int u = proposal[v];
+            if( u >= 0 && proposal[u] == v )
+            {
+                match[v] = u;
+                ++numNewMatches;
+            }
+        }
+        if( numNewMatches == 0 )
+            break;
+    }
+    for( Int v=0; v<numVertices; ++v )
+        if( match[v] == -1 )
+            match[v] = v;
+}
+
+// Number the coarse vertices in the order of the smaller vertex of each
+// matched pair and return the number of local coarse vertices
+Int CoarseMap( const vector<Int>& match, vector<Int>& cmap )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = match.size();
+    cmap.resize( numVertices );
+    Int numCoarse = 0;
+    for( Int v=0; v<numVertices; ++v )
+        if( match[v] >= v )
+            cmap[v] = numCoarse++;
+    for( Int v=0; v<numVertices; ++v )
+        if( match[v] < v )
+            cmap[v] = cmap[match[v]];
+    return numCoarse;
+}
+
+// Contract the matched pairs into a coarse graph whose local vertices begin
+// at 'firstCoarse'. The global coarse index of the target of each fine edge
+// is given by 'edgeMap'.
+void Contract
+( const WeightedGraph& fine,
+  const vector<Int>& match,
+  const vector<Int>& cmap,
+        Int numCoarse,
+        Int firstCoarse,
+  const vector<Int>& edgeMap,
+        WeightedGraph& coarse )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = fine.numVertices;
+    vector<Int> reps( numCoarse );
+    for( Int v=0; v<numVertices; ++v )
+        if( match[v] >= v )
+            reps[cmap[v]] = v;
+
+    coarse.numVertices = numCoarse;
+    coarse.firstVertex = firstCoarse;
+    coarse.vertexWeights.resize( numCoarse );
+    coarse.offsets.assign( numCoarse+1, 0 );
+
+    // Form the adjacency of each coarse vertex by sorting and combining the
+    // (mapped) adjacencies of its constituents
+    const Int numChunks = Max( Min(4*MaxThreads(),numCoarse), Int(1) );
+    const Int chunkSize = (numCoarse+numChunks-1) / numChunks;
+    vector<vector<Int>> chunkTargets(numChunks), chunkWeights(numChunks);
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        vector<pair<Int,Int>> neighbors;
+        const Int first = chunk*chunkSize;
+        const Int last = Min( first+chunkSize, numCoarse );
+        for( Int c=first; c<last; ++c )
+        {
+            const Int v = reps[c];
+            const Int u = match[v];
+            coarse.vertexWeights[c] = fine.vertexWeights[v] +
+              ( u != v ? fine.vertexWeights[u] : 0 );
+
+            neighbors.clear();
+            for( Int w : { v, u } )
+            {
+                for( Int e=fine.offsets[w]; e<fine.offsets[w+1]; ++e )
+                    if( edgeMap[e] != firstCoarse+c )
+                        neighbors.emplace_back
+                        ( edgeMap[e], fine.edgeWeights[e] );
+                if( u == v )
+                    break;
+            }
+            std::sort( neighbors.begin(), neighbors.end() );
+
+            Int degree = 0;
+            const Int numNeighbors = neighbors.size();
+            for( Int k=0; k<numNeighbors; ++k )
+            {
+                if( degree > 0 &&
+                    chunkTargets[chunk].back() == neighbors[k].first )
+                {
+                    chunkWeights[chunk].back() += neighbors[k].second;
+                }
+                else
+                {
+                    chunkTargets[chunk].push_back( neighbors[k].first );
+                    chunkWeights[chunk].push_back( neighbors[k].second );
+                    ++degree;
+                }
+            }
+            coarse.offsets[c+1] = degree;
+        }
+    }
+    for( Int c=0; c<numCoarse; ++c )
+        coarse.offsets[c+1] += coarse.offsets[c];
+
+    coarse.targets.resize( coarse.offsets[numCoarse] );
+    coarse.edgeWeights.resize( coarse.offsets[numCoarse] );
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int first = Min( chunk*chunkSize, numCoarse );
+        std::copy
+        ( chunkTargets[chunk].begin(), chunkTargets[chunk].end(),
+          coarse.targets.begin()+coarse.offsets[first] );
+        std::copy
+        ( chunkWeights[chunk].begin(), chunkWeights[chunk].end(),
+          coarse.edgeWeights.begin()+coarse.offsets[first] );
+    }
+}
+
+// Grow side 0 from the given seed by repeatedly absorbing the vertex which
+// most decreases the edge cut until it holds half of the weight
+void GreedyGrow
+( const WeightedGraph& graph, Int seedVertex, vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+    const Int targetWeight = TotalWeight( graph.vertexWeights ) / 2;
+    part.assign( numVertices, 1 );
+
+    // The change in the cut from moving each vertex into side 0
+    vector<Int> gains( numVertices, 0 );
+    for( Int v=0; v<numVertices; ++v )
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            gains[v] -= graph.edgeWeights[e];
+
+    std::priority_queue<pair<Int,Int>> queue;
+    queue.emplace( gains[seedVertex], seedVertex );
+    Int weight = 0, nextUnvisited = 0;
+    while( weight < targetWeight )
+    {
+        if( queue.empty() )
+        {
+            // Jump to another connected component
+            while( nextUnvisited < numVertices && part[nextUnvisited] == 0 )
+                ++nextUnvisited;
+            if( nextUnvisited == numVertices )
+                break;
+            queue.emplace( gains[nextUnvisited], nextUnvisited );
+        }
+        const Int gain = queue.top().first;
+        const Int v = queue.top().second;
+        queue.pop();
+        if( part[v] != 1 || gain != gains[v] )
+            continue;
+
+        part[v] = 0;
+        weight += graph.vertexWeights[v];
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            gains[u] += 2*graph.edgeWeights[e];
+            if( part[u] == 1 )
+                queue.emplace( gains[u], u );
+        }
+    }
+}
+
+// Refine a sequential bisection with passes of Fiduccia-Mattheyses: each
+// pass greedily moves the unlocked vertex of largest gain (subject to the
+// balance constraint), locks it, and finally rolls back to the best
+// intermediate bisection. Returns the weight of the edge cut.
+Int Refine( const WeightedGraph& graph, vector<Int>& part, Int maxSide )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+    vector<Int> external(numVertices), internal(numVertices);
+    EL_PARALLEL_FOR
+    for( Int v=0; v<numVertices; ++v )
+    {
+        Int ext=0, in=0;
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            if( part[graph.targets[e]] == part[v] )
+                in += graph.edgeWeights[e];
+            else
+                ext += graph.edgeWeights[e];
+        }
+        external[v] = ext;
+        internal[v] = in;
+    }
+    Int cut = 0;
+    Int sideWeights[2] = { 0, 0 };
+    for( Int v=0; v<numVertices; ++v )
+    {
+        cut += external[v];
+        sideWeights[part[v]] += graph.vertexWeights[v];
+    }
+    cut /= 2;
+
+    typedef std::priority_queue<pair<Int,Int>> Queue;
+    Queue queues[2];
+    vector<char> locked( numVertices );
+    vector<Int> moves;
+    auto move = [&]( Int v, bool enqueue )
+    {
+        const Int from = part[v];
+        const Int to = 1-from;
+        part[v] = to;
+        sideWeights[from] -= graph.vertexWeights[v];
+        sideWeights[to] += graph.vertexWeights[v];
+        cut -= external[v] - internal[v];
+        std::swap( external[v], internal[v] );
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            const Int weight = graph.edgeWeights[e];
+            if( part[u] == to )
+            {
+                external[u] -= weight;
+                internal[u] += weight;
+            }
+            else
+            {
+                external[u] += weight;
+                internal[u] -= weight;
+            }
+            if( enqueue && !locked[u] && external[u] > 0 )
+                queues[part[u]].emplace( external[u]-internal[u], u );
+        }
+    };
+    auto feasible =
+      [&]() { return Max(sideWeights[0],sideWeights[1]) <= maxSide; };
+
+    const Int maxFruitless = Max( Int(50), numVertices/100 );
+    for( Int pass=0; pass<numRefinePasses; ++pass )
+    {
+        std::fill( locked.begin(), locked.end(), 0 );
+        moves.clear();
+        queues[0] = Queue();
+        queues[1] = Queue();
+        for( Int v=0; v<numVertices; ++v )
+            if( external[v] > 0 )
+                queues[part[v]].emplace( external[v]-internal[v], v );
+
+        bool bestFeasible = feasible();
+        Int bestCut = cut;
+        Int bestImbalance = Abs(sideWeights[0]-sideWeights[1]);
+        Int bestNumMoves = 0;
+        while( Int(moves.size())-bestNumMoves < maxFruitless )
+        {
+            // Discard the stale entries and determine the admissible moves
+            bool admissible[2] = { false, false };
+            for( Int from=0; from<2; ++from )
+            {
+                auto& queue = queues[from];
+                while( !queue.empty() )
+                {
+                    const Int v = queue.top().second;
+                    if( locked[v] || part[v] != from ||
+                        queue.top().first != external[v]-internal[v] )
+                        queue.pop();
+                    else
+                        break;
+                }
+                if( queue.empty() )
+                    continue;
+                const Int newTo =
+                  sideWeights[1-from] + graph.vertexWeights[queue.top().second];
+                admissible[from] =
+                  ( newTo <= maxSide || newTo < sideWeights[from] );
+            }
+            Int from;
+            if( admissible[0] && admissible[1] )
+            {
+                const Int gain0 = queues[0].top().first;
+                const Int gain1 = queues[1].top().first;
+                if( gain0 != gain1 )
+                    from = ( gain0 > gain1 ? 0 : 1 );
+                else
+                    from = ( sideWeights[0] >= sideWeights[1] ? 0 : 1 );
+            }
+            else if( admissible[0] )
+                from = 0;
+            else if( admissible[1] )
+                from = 1;
+            else
+                break;
+
+            const Int v = queues[from].top().second;
+            queues[from].pop();
+            locked[v] = true;
+            move( v, true );
+            moves.push_back( v );
+
+            const bool isFeasible = feasible();
+            const Int imbalance = Abs(sideWeights[0]-sideWeights[1]);
+            if( (isFeasible && !bestFeasible) ||
+                (isFeasible == bestFeasible &&
+                 (cut < bestCut ||
+                  (cut == bestCut && imbalance < bestImbalance))) )
+            {
+                bestFeasible = isFeasible;
+                bestCut = cut;
+                bestImbalance = imbalance;
+                bestNumMoves = moves.size();
+            }
+        }
+        for( Int k=Int(moves.size())-1; k>=bestNumMoves; --k )
+            move( moves[k], false );
+        if( bestNumMoves == 0 )
+            break;
+    }
+    return cut;
+}
+
+inline bool BetterBisection
+( bool feasible, Int cut, Int imbalance,
+  bool bestFeasible, Int bestCut, Int bestImbalance )
+{
+    if( feasible != bestFeasible )
+        return feasible;
+    if( cut != bestCut )
+        return cut < bestCut;
+    return imbalance < bestImbalance;
+}
+
+// Compute a multilevel edge bisection of a sequential graph and return the
+// weight of the cut
+Int EdgeBisection
+( const WeightedGraph& graph,
+        vector<Int>& part,
+        unsigned long long seed,
+        double maxImbalance )
+{
+    EL_DEBUG_CSE
+    const Int totalWeight = TotalWeight( graph.vertexWeights );
+    const Int maxVertexWeight = Max( Int(1), 3*totalWeight/(2*coarsestSize) );
+
+    // Coarsen
+    // =======
+    vector<WeightedGraph> coarseGraphs;
+    vector<vector<Int>> cmaps;
+    vector<Int> match, edgeMap;
+    while( true )
+    {
+        const WeightedGraph& fine =
+          ( coarseGraphs.empty() ? graph : coarseGraphs.back() );
+        if( fine.numVertices <= coarsestSize )
+            break;
+        HandshakeMatching
+        ( fine, maxVertexWeight, Mix(seed+coarseGraphs.size()), match );
+        vector<Int> cmap;
+        const Int numCoarse = CoarseMap( match, cmap );
+        if( numCoarse > minCoarseningRatio*fine.numVertices )
+            break;
+
+        const Int numEdges = fine.targets.size();
+        edgeMap.resize( numEdges );
+        EL_PARALLEL_FOR
+        for( Int e=0; e<numEdges; ++e )
+            edgeMap[e] = cmap[fine.targets[e]];
+        WeightedGraph coarse;
+        Contract( fine, match, cmap, numCoarse, 0, edgeMap, coarse );
+        coarseGraphs.emplace_back( std::move(coarse) );
+        cmaps.emplace_back( std::move(cmap) );
+    }
+
+    // Bisect the coarsest graph
+    // =========================
+    const WeightedGraph& coarsest =
+      ( coarseGraphs.empty() ? graph : coarseGraphs.back() );
+    const Int numCoarsest = coarsest.numVertices;
+    if( numCoarsest == 0 )
+    {
+        part.resize( 0 );
+        return 0;
+    }
+    const Int coarsestMaxVertexWeight =
+      *std::max_element
+      ( coarsest.vertexWeights.begin(), coarsest.vertexWeights.end() );
+    const Int coarsestMaxSide =
+      MaxSideWeight( totalWeight, coarsestMaxVertexWeight, maxImbalance );
+    vector<vector<Int>> trialParts( numInitialTrials );
+    vector<Int> trialCuts( numInitialTrials );
+    EL_PARALLEL_FOR
+    for( Int trial=0; trial<numInitialTrials; ++trial )
+    {
+        const Int seedVertex = Mix(seed^Mix(trial+1)) % numCoarsest;
+        GreedyGrow( coarsest, seedVertex, trialParts[trial] );
+        trialCuts[trial] =
+          Refine( coarsest, trialParts[trial], coarsestMaxSide );
+    }
+    Int bestTrial = 0;
+    bool bestFeasible = false;
+    Int bestCut = 0, bestImbalance = 0;
+    for( Int trial=0; trial<numInitialTrials; ++trial )
+    {
+        Int weight0 = 0;
+        for( Int v=0; v<numCoarsest; ++v )
+            if( trialParts[trial][v] == 0 )
+                weight0 += coarsest.vertexWeights[v];
+        const Int imbalance = Abs(totalWeight-2*weight0);
+        const bool feasible =
+          ( Max(weight0,totalWeight-weight0) <= coarsestMaxSide );
+        if( trial == 0 ||
+            BetterBisection
+            ( feasible, trialCuts[trial], imbalance,
+              bestFeasible, bestCut, bestImbalance ) )
+        {
+            bestTrial = trial;
+            bestFeasible = feasible;
+            bestCut = trialCuts[trial];
+            bestImbalance = imbalance;
+        }
+    }
+    part = trialParts[bestTrial];
+
+    // Project and refine
+    // ==================
+    Int cut = bestCut;
+    vector<Int> finePart;
+    for( Int level=Int(coarseGraphs.size())-1; level>=0; --level )
+    {
+        const WeightedGraph& fine =
+          ( level == 0 ? graph : coarseGraphs[level-1] );
+        const auto& cmap = cmaps[level];
+        finePart.resize( fine.numVertices );
+        for( Int v=0; v<fine.numVertices; ++v )
+            finePart[v] = part[cmap[v]];
+        part.swap( finePart );
+
+        const Int fineMaxVertexWeight =
+          *std::max_element
+          ( fine.vertexWeights.begin(), fine.vertexWeights.end() );
+        cut = Refine
+          ( fine, part,
+            MaxSideWeight(totalWeight,fineMaxVertexWeight,maxImbalance) );
+    }
+    return cut;
+}
+
+// Convert an edge bisection into a vertex separator (marked with part 2)
+// using a minimum vertex cover of the bipartite graph of cut edges. The
+// cover is computed from a maximum matching via Koenig's theorem: if Z is
+// the set of vertices reachable from the unmatched left vertices by
+// alternating paths, then (Left \ Z) union (Right intersect Z) is a minimum
+// cover.
+void VertexSeparator( const WeightedGraph& graph, vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+    vector<Int> index( numVertices, -1 ), left, right;
+    for( Int v=0; v<numVertices; ++v )
+    {
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            if( part[graph.targets[e]] != part[v] )
+            {
+                auto& boundary = ( part[v] == 0 ? left : right );
+                index[v] = boundary.size();
+                boundary.push_back( v );
+                break;
+            }
+        }
+    }
+    const Int numLeft = left.size();
+    const Int numRight = right.size();
+    vector<Int> cutOffsets( numLeft+1 ), cutTargets;
+    for( Int l=0; l<numLeft; ++l )
+    {
+        cutOffsets[l] = cutTargets.size();
+        const Int v = left[l];
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            if( part[graph.targets[e]] == 1 )
+                cutTargets.push_back( index[graph.targets[e]] );
+    }
+    cutOffsets[numLeft] = cutTargets.size();
+
+    // Form a maximum matching, starting from a greedy matching and then
+    // augmenting along vertex-disjoint shortest augmenting paths found by
+    // breadth-first searches from all of the unmatched left vertices
+    vector<Int> matchLeft( numLeft, -1 ), matchRight( numRight, -1 );
+    for( Int l=0; l<numLeft; ++l )
+    {
+        for( Int e=cutOffsets[l]; e<cutOffsets[l+1]; ++e )
+        {
+            const Int r = cutTargets[e];
+            if( matchRight[r] == -1 )
+            {
+                matchLeft[l] = r;
+                matchRight[r] = l;
+                break;
+            }
+        }
+    }
+    vector<Int> parent( numRight ), queue, endpoints;
+    vector<char> reached( numLeft ), used( numLeft );
+    while( true )
+    {
+        std::fill( parent.begin(), parent.end(), -1 );
+        std::fill( reached.begin(), reached.end(), 0 );
+        queue.clear();
+        endpoints.clear();
+        for( Int l=0; l<numLeft; ++l )
+        {
+            if( matchLeft[l] == -1 )
+            {
+                reached[l] = true;
+                queue.push_back( l );
+            }
+        }
+        for( size_t head=0; head<queue.size(); ++head )
+        {
+            const Int l = queue[head];
+            for( Int e=cutOffsets[l]; e<cutOffsets[l+1]; ++e )
+            {
+                const Int r = cutTargets[e];
+                if( parent[r] != -1 )
+                    continue;
+                parent[r] = l;
+                const Int lNext = matchRight[r];
+                if( lNext == -1 )
+                    endpoints.push_back( r );
+                else if( !reached[lNext] )
+                {
+                    reached[lNext] = true;
+                    queue.push_back( lNext );
+                }
+            }
+        }
+        if( endpoints.empty() )
+            break;
+
+        std::fill( used.begin(), used.end(), 0 );
+        for( const Int endpoint : endpoints )
+        {
+            bool disjoint = true;
+            for( Int r=endpoint; r!=-1; r=matchLeft[parent[r]] )
+            {
+                if( used[parent[r]] )
+                {
+                    disjoint = false;
+                    break;
+                }
+            }
+            if( !disjoint )
+                continue;
+            Int r = endpoint;
+            while( r != -1 )
+            {
+                const Int l = parent[r];
+                const Int rNext = matchLeft[l];
+                used[l] = true;
+                matchLeft[l] = r;
+                matchRight[r] = l;
+                r = rNext;
+            }
+        }
+    }
+
+    // Find the vertices reachable by alternating paths from the unmatched
+    // left vertices
+    vector<char> inZLeft( numLeft, 0 ), inZRight( numRight, 0 );
+    queue.clear();
+    for( Int l=0; l<numLeft; ++l )
+    {
+        if( matchLeft[l] == -1 )
+        {
+            inZLeft[l] = true;
+            queue.push_back( l );
+        }
+    }
+    for( size_t head=0; head<queue.size(); ++head )
+    {
+        const Int l = queue[head];
+        for( Int e=cutOffsets[l]; e<cutOffsets[l+1]; ++e )
+        {
+            const Int r = cutTargets[e];
+            if( inZRight[r] )
+                continue;
+            inZRight[r] = true;
+            const Int lNext = matchRight[r];
+            if( lNext != -1 && !inZLeft[lNext] )
+            {
+                inZLeft[lNext] = true;
+                queue.push_back( lNext );
+            }
+        }
+    }
+    for( Int l=0; l<numLeft; ++l )
+        if( !inZLeft[l] )
+            part[left[l]] = 2;
+    for( Int r=0; r<numRight; ++r )
+        if( inZRight[r] )
+            part[right[r]] = 2;
+}
+
+// Compute a vertex separator of a sequential graph and return its size
+Int VertexBisection
+( const WeightedGraph& graph,
+        vector<Int>& part,
+        unsigned long long seed,
+        double maxImbalance )
+{
+    EL_DEBUG_CSE
+    EdgeBisection( graph, part, seed, maxImbalance );
+    VertexSeparator( graph, part );
+    Int sepSize = 0;
+    for( const Int& p : part )
+        if( p == 2 )
+            ++sepSize;
+    return sepSize;
+}
+
+inline Int PartImbalance( const vector<Int>& part )
+{
+    Int imbalance = 0;
+    for( const Int& p : part )
+    {
+        if( p == 0 )
+            ++imbalance;
+        else if( p == 1 )
+            --imbalance;
+    }
+    return Abs(imbalance);
+}
+
+// Distributed utilities
+// =====================
+
+inline int Owner( const vector<Int>& vtxDist, Int i )
+{
+    return int(std::upper_bound(vtxDist.begin(),vtxDist.end(),i) -
+               vtxDist.begin()) - 1;
+}
+
+// The persistent pattern for exchanging values of the non-local targets
+struct Ghosts
+{
+    // The sorted (and therefore owner-grouped) non-local targets
+    vector<Int> inds;
+    // The index of the target of each edge within the concatenation of the
+    // local vertices and the ghosts
+    vector<Int> edgeSlots;
+    vector<int> sendSizes, sendOffs, recvSizes, recvOffs;
+    // The local indices of the vertices requested by other processes
+    vector<Int> sendInds;
+};
+
+void FormGhosts
+( const WeightedGraph& graph,
+  const vector<Int>& vtxDist,
+        mpi::Comm comm,
+        Ghosts& ghosts )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const Int numVertices = graph.numVertices;
+    const Int firstVertex = graph.firstVertex;
+    const Int numEdges = graph.targets.size();
+
+    ghosts.inds.clear();
+    for( const Int& target : graph.targets )
+        if( target < firstVertex || target >= firstVertex+numVertices )
+            ghosts.inds.push_back( target );
+    std::sort( ghosts.inds.begin(), ghosts.inds.end() );
+    ghosts.inds.erase
+    ( std::unique(ghosts.inds.begin(),ghosts.inds.end()), ghosts.inds.end() );
+
+    ghosts.edgeSlots.resize( numEdges );
+    EL_PARALLEL_FOR
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const Int target = graph.targets[e];
+        if( target >= firstVertex && target < firstVertex+numVertices )
+            ghosts.edgeSlots[e] = target - firstVertex;
+        else
+            ghosts.edgeSlots[e] = numVertices +
+              (std::lower_bound(ghosts.inds.begin(),ghosts.inds.end(),target)
+               - ghosts.inds.begin());
+    }
+
+    ghosts.recvSizes.assign( commSize, 0 );
+    for( const Int& i : ghosts.inds )
+        ++ghosts.recvSizes[Owner(vtxDist,i)];
+    Scan( ghosts.recvSizes, ghosts.recvOffs );
+    ghosts.sendSizes.resize( commSize );
+    mpi::AllToAll
+    ( ghosts.recvSizes.data(), 1, ghosts.sendSizes.data(), 1, comm );
+    const int totalSend = Scan( ghosts.sendSizes, ghosts.sendOffs );
+    ghosts.sendInds.resize( totalSend );
+    mpi::AllToAll
+    ( ghosts.inds.data(), ghosts.recvSizes.data(), ghosts.recvOffs.data(),
+      ghosts.sendInds.data(), ghosts.sendSizes.data(), ghosts.sendOffs.data(),
+      comm );
+    for( Int& i : ghosts.sendInds )
+        i -= firstVertex;
+}
+
+// Append the values of the ghosts to the local values
+void UpdateGhosts
+( const Ghosts& ghosts, Int numVertices, vector<Int>& values, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    values.resize( numVertices+ghosts.inds.size() );
+    const Int totalSend = ghosts.sendInds.size();
+    vector<Int> sendValues( totalSend );
+    for( Int i=0; i<totalSend; ++i )
+        sendValues[i] = values[ghosts.sendInds[i]];
+    mpi::AllToAll
+    ( sendValues.data(), ghosts.sendSizes.data(), ghosts.sendOffs.data(),
+      values.data()+numVertices, ghosts.recvSizes.data(),
+      ghosts.recvOffs.data(), comm );
+}
+
+struct DistLevel
+{
+    WeightedGraph graph;
+    vector<Int> vtxDist;
+    Ghosts ghosts;
+    // The local coarse index of each local vertex
+    vector<Int> cmap;
+};
+
+vector<Int> VertexDistribution( Int numLocalVertices, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    vector<Int> counts( commSize ), vtxDist;
+    mpi::AllGather( &numLocalVertices, 1, counts.data(), 1, comm );
+    const Int numVertices = Scan( counts, vtxDist );
+    vtxDist.push_back( numVertices );
+    return vtxDist;
+}
+
+// Gather a distributed graph onto every process
+WeightedGraph GatherGraph
+( const WeightedGraph& graph, const vector<Int>& vtxDist, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const Int numVertices = vtxDist[commSize];
+    vector<int> vertexSizes( commSize ), vertexOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        vertexSizes[q] = vtxDist[q+1] - vtxDist[q];
+        vertexOffs[q] = vtxDist[q];
+    }
+    const int numLocalEdges = graph.targets.size();
+    vector<int> edgeSizes( commSize ), edgeOffs;
+    mpi::AllGather( &numLocalEdges, 1, edgeSizes.data(), 1, comm );
+    const int numEdges = Scan( edgeSizes, edgeOffs );
+
+    WeightedGraph global;
+    global.numVertices = numVertices;
+    global.vertexWeights.resize( numVertices );
+    mpi::AllGather
+    ( graph.vertexWeights.data(), graph.numVertices,
+      global.vertexWeights.data(), vertexSizes.data(), vertexOffs.data(),
+      comm );
+
+    vector<Int> degrees( graph.numVertices );
+    for( Int v=0; v<graph.numVertices; ++v )
+        degrees[v] = graph.offsets[v+1] - graph.offsets[v];
+    global.offsets.resize( numVertices+1 );
+    mpi::AllGather
+    ( degrees.data(), graph.numVertices,
+      global.offsets.data(), vertexSizes.data(), vertexOffs.data(), comm );
+    Int offset = 0;
+    for( Int v=0; v<numVertices; ++v )
+    {
+        const Int degree = global.offsets[v];
+        global.offsets[v] = offset;
+        offset += degree;
+    }
+    global.offsets[numVertices] = offset;
+
+    global.targets.resize( numEdges );
+    global.edgeWeights.resize( numEdges );
+    mpi::AllGather
+    ( graph.targets.data(), numLocalEdges,
+      global.targets.data(), edgeSizes.data(), edgeOffs.data(), comm );
+    mpi::AllGather
+    ( graph.edgeWeights.data(), numLocalEdges,
+      global.edgeWeights.data(), edgeSizes.data(), edgeOffs.data(), comm );
+    return global;
+}
+
+// Return the rank whose (feasibility,quality,imbalance) triplet is best
+int BestRank( bool feasible, Int quality, Int imbalance, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    Int local[3] = { feasible ? 0 : 1, quality, imbalance };
+    vector<Int> all( 3*commSize );
+    mpi::AllGather( local, 3, all.data(), 3, comm );
+    int bestRank = 0;
+    for( int q=1; q<commSize; ++q )
+    {
+        const Int* cand = &all[3*q];
+        const Int* best = &all[3*bestRank];
+        if( std::lexicographical_compare( cand, cand+3, best, best+3 ) )
+            bestRank = q;
+    }
+    return bestRank;
+}
+
+// Refine a distributed bisection using passes which only move vertices in
+// a single direction: since moving a set of vertices from one side to the
+// other decreases the cut by at least the sum of their individual gains,
+// the simultaneous moves of different processes cannot conflict
+void DistRefine
+( const DistLevel& level, vector<Int>& part, Int maxSide, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const auto& graph = level.graph;
+    const Int numVertices = graph.numVertices;
+
+    Int sideWeights[2] = { 0, 0 };
+    for( Int v=0; v<numVertices; ++v )
+        sideWeights[part[v]] += graph.vertexWeights[v];
+    mpi::AllReduce( sideWeights, 2, comm );
+
+    vector<Int> values, gains( numVertices ), candidates;
+    vector<Int> candidateWeights( commSize );
+    const Int from0 = ( sideWeights[0] >= sideWeights[1] ? 0 : 1 );
+    Int numIdlePasses = 0;
+    for( Int pass=0; pass<2*numRefinePasses; ++pass )
+    {
+        const Int from = ( pass % 2 == 0 ? from0 : 1-from0 );
+        const Int to = 1-from;
+        const bool rebalance = ( sideWeights[from] > maxSide );
+
+        values.assign( part.begin(), part.end() );
+        UpdateGhosts( level.ghosts, numVertices, values, comm );
+
+        // Find the candidate moves
+        const Int minGain = ( rebalance ? std::numeric_limits<Int>::min()
+                                        : Int(1) );
+        EL_PARALLEL_FOR
+        for( Int v=0; v<numVertices; ++v )
+        {
+            gains[v] = std::numeric_limits<Int>::min();
+            if( part[v] != from )
+                continue;
+            Int ext=0, in=0;
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                if( values[level.ghosts.edgeSlots[e]] == from )
+                    in += graph.edgeWeights[e];
+                else
+                    ext += graph.edgeWeights[e];
+            }
+            if( ext > 0 && ext-in >= minGain )
+                gains[v] = ext - in;
+        }
+        candidates.clear();
+        Int localCandidateWeight = 0;
+        for( Int v=0; v<numVertices; ++v )
+        {
+            if( gains[v] != std::numeric_limits<Int>::min() )
+            {
+                candidates.push_back( v );
+                localCandidateWeight += graph.vertexWeights[v];
+            }
+        }
+        std::sort
+        ( candidates.begin(), candidates.end(),
+          [&]( Int v0, Int v1 ) { return gains[v0] > gains[v1]; } );
+
+        // Split the admissible weight of the moves among the processes in
+        // proportion to their candidates
+        const Int budget =
+          ( rebalance ? (sideWeights[from]-sideWeights[to])/2
+                      : maxSide-sideWeights[to] );
+        mpi::AllGather
+        ( &localCandidateWeight, 1, candidateWeights.data(), 1, comm );
+        const Int totalCandidateWeight = TotalWeight( candidateWeights );
+        Int localBudget = 0;
+        if( budget > 0 && totalCandidateWeight > 0 )
+            localBudget = Int( double(budget)*localCandidateWeight /
+                               totalCandidateWeight );
+
+        Int movedWeight = 0;
+        for( const Int v : candidates )
+        {
+            const Int weight = graph.vertexWeights[v];
+            if( movedWeight+weight > localBudget )
+                break;
+            part[v] = to;
+            movedWeight += weight;
+        }
+        movedWeight = mpi::AllReduce( movedWeight, comm );
+        sideWeights[from] -= movedWeight;
+        sideWeights[to] += movedWeight;
+
+        if( movedWeight == 0 )
+        {
+            if( ++numIdlePasses == 2 )
+                break;
+        }
+        else
+            numIdlePasses = 0;
+    }
+}
+
+// Extract a vertex separator (marked with part 2) from a distributed edge
+// bisection by taking the boundary of the side with the smaller boundary
+// and then greedily moving separator vertices into either side when doing
+// so pulls fewer (local) vertices from the opposite side into the separator.
+// Since these moves only ever turn separator vertices into members of the
+// destination side and members of the opposite side into separator
+// vertices, the moves of different processes cannot invalidate each other.
+void DistVertexSeparator
+( const DistLevel& level, vector<Int>& part, Int maxSide, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const auto& graph = level.graph;
+    const Int numVertices = graph.numVertices;
+    const int commSize = mpi::Size( comm );
+
+    vector<Int> values( part.begin(), part.end() );
+    UpdateGhosts( level.ghosts, numVertices, values, comm );
+    Int boundaryWeights[2] = { 0, 0 };
+    vector<char> boundary( numVertices, 0 );
+    for( Int v=0; v<numVertices; ++v )
+    {
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            if( values[level.ghosts.edgeSlots[e]] != part[v] )
+            {
+                boundary[v] = true;
+                boundaryWeights[part[v]] += graph.vertexWeights[v];
+                break;
+            }
+        }
+    }
+    mpi::AllReduce( boundaryWeights, 2, comm );
+    const Int sepSide = ( boundaryWeights[0] <= boundaryWeights[1] ? 0 : 1 );
+    Int sideWeights[2] = { 0, 0 };
+    for( Int v=0; v<numVertices; ++v )
+    {
+        if( boundary[v] && part[v] == sepSide )
+            part[v] = 2;
+        else
+            sideWeights[part[v]] += graph.vertexWeights[v];
+    }
+    mpi::AllReduce( sideWeights, 2, comm );
+
+    vector<Int> gains( numVertices ), candidates;
+    Int numIdlePasses = 0;
+    for( Int pass=0; pass<2*numRefinePasses; ++pass )
+    {
+        // Alternate starting with moves into the side which was not trimmed
+        const Int to = ( pass % 2 == 0 ? 1-sepSide : sepSide );
+        const Int other = 1-to;
+        // Moves which do not shrink the separator are only accepted when
+        // they improve the balance
+        const bool balancing = ( sideWeights[to] < sideWeights[other] );
+        values.assign( part.begin(), part.end() );
+        UpdateGhosts( level.ghosts, numVertices, values, comm );
+
+        // The cost of moving a separator vertex into 'to' is the weight of
+        // its neighbors in 'other', which must all be local
+        auto moveCost = [&]( Int v )
+        {
+            Int cost = 0;
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                const Int slot = level.ghosts.edgeSlots[e];
+                if( slot < numVertices )
+                {
+                    if( part[slot] == other )
+                        cost += graph.vertexWeights[slot];
+                }
+                else if( values[slot] == other )
+                    return std::numeric_limits<Int>::max();
+            }
+            return cost;
+        };
+        auto acceptable = [&]( Int weight, Int cost )
+        { return cost < weight || (balancing && cost == weight); };
+
+        EL_PARALLEL_FOR
+        for( Int v=0; v<numVertices; ++v )
+        {
+            gains[v] = std::numeric_limits<Int>::min();
+            if( part[v] != 2 )
+                continue;
+            const Int cost = moveCost( v );
+            if( acceptable(graph.vertexWeights[v],cost) )
+                gains[v] = graph.vertexWeights[v] - cost;
+        }
+        candidates.clear();
+        for( Int v=0; v<numVertices; ++v )
+            if( gains[v] != std::numeric_limits<Int>::min() )
+                candidates.push_back( v );
+        std::sort
+        ( candidates.begin(), candidates.end(),
+          [&]( Int v0, Int v1 ) { return gains[v0] > gains[v1]; } );
+
+        const Int localBudget =
+          Max( maxSide-sideWeights[to], Int(0) ) / commSize;
+        const Int localBalanceBudget =
+          Max( sideWeights[other]-sideWeights[to], Int(0) ) / (2*commSize);
+        Int movedWeight=0, pulledWeight=0, neutralWeight=0;
+        for( const Int v : candidates )
+        {
+            // The cost may have changed due to the previous moves
+            const Int weight = graph.vertexWeights[v];
+            const Int cost = moveCost( v );
+            if( !acceptable(weight,cost) ||
+                movedWeight+weight > localBudget )
+                continue;
+            if( cost == weight )
+            {
+                if( neutralWeight+weight > localBalanceBudget )
+                    continue;
+                neutralWeight += weight;
+            }
+            part[v] = to;
+            movedWeight += weight;
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                const Int slot = level.ghosts.edgeSlots[e];
+                if( slot < numVertices && part[slot] == other )
+                {
+                    part[slot] = 2;
+                    pulledWeight += graph.vertexWeights[slot];
+                }
+            }
+        }
+        Int changes[2] = { movedWeight, pulledWeight };
+        mpi::AllReduce( changes, 2, comm );
+        sideWeights[to] += changes[0];
+        sideWeights[other] -= changes[1];
+
+        if( changes[0] == 0 )
+        {
+            if( ++numIdlePasses == 2 )
+                break;
+        }
+        else
+            numIdlePasses = 0;
+    }
+    EL_DEBUG_ONLY(
+      values.assign( part.begin(), part.end() );
+      UpdateGhosts( level.ghosts, numVertices, values, comm );
+      for( Int v=0; v<numVertices; ++v )
+          if( part[v] != 2 )
+              for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+              {
+                  const Int u = values[level.ghosts.edgeSlots[e]];
+                  if( u != 2 && u != part[v] )
+                      LogicError
+                      ("Vertex ",graph.firstVertex+v,
+                       " touches the opposite side");
+              }
+    )
+}
+
+} // namespace multilevel
+
+Int MultilevelBisect
+( const Graph& graph,
+        Graph& leftChild,
+        Graph& rightChild,
+        vector<Int>& perm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const auto wGraph = multilevel::FromGraph( graph );
+
+    vector<Int> part, bestPart;
+    Int bestSepSize=0, bestImbalance=0;
+    const Int numTrials = Max( ctrl.numSeqSeps, Int(1) );
+    for( Int trial=0; trial<numTrials; ++trial )
+    {
+        const Int sepSize =
+          multilevel::VertexBisection
+          ( wGraph, part, trial, ctrl.maxImbalance );
+        const Int imbalance = multilevel::PartImbalance( part );
+        if( trial == 0 ||
+            multilevel::BetterBisection
+            ( true, sepSize, imbalance, true, bestSepSize, bestImbalance ) )
+        {
+            bestSepSize = sepSize;
+            bestImbalance = imbalance;
+            bestPart.swap( part );
+        }
+    }
+
+    Int sizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numSources; ++s )
+        ++sizes[bestPart[s]];
+    Int offsets[3] = { 0, sizes[0], sizes[0]+sizes[1] };
+    perm.resize( numSources );
+    for( Int s=0; s<numSources; ++s )
+        perm[s] = offsets[bestPart[s]]++;
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildrenFromPerm
+    ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
+    return sizes[2];
+}
+
+Int MultilevelBisect
+( const DistGraph& graph,
+        unique_ptr<Grid>& childGrid,
+        DistGraph& child,
+        DistMap& perm,
+        bool& onLeft,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+    if( commSize == 1 )
+        LogicError
+        ("This routine assumes at least two processes are used, "
+         "otherwise one child will be lost");
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+
+    vector<multilevel::DistLevel> levels(1);
+    levels[0].graph = multilevel::FromGraph( graph );
+    levels[0].vtxDist =
+      multilevel::VertexDistribution( numLocalSources, comm );
+
+    vector<Int> part;
+    if( ctrl.sequential )
+    {
+        // Compute independent separators of the full graph on each process
+        const auto global =
+          multilevel::GatherGraph( levels[0].graph, levels[0].vtxDist, comm );
+        vector<Int> trialPart;
+        Int sepSize=0, imbalance=0;
+        const Int numTrials = Max( ctrl.numSeqSeps, Int(1) );
+        for( Int trial=0; trial<numTrials; ++trial )
+        {
+            const Int trialSepSize =
+              multilevel::VertexBisection
+              ( global, trialPart, commRank*numTrials+trial,
+                ctrl.maxImbalance );
+            const Int trialImbalance = multilevel::PartImbalance( trialPart );
+            if( trial == 0 ||
+                multilevel::BetterBisection
+                ( true, trialSepSize, trialImbalance,
+                  true, sepSize, imbalance ) )
+            {
+                sepSize = trialSepSize;
+                imbalance = trialImbalance;
+                part.swap( trialPart );
+            }
+        }
+        const int bestRank =
+          multilevel::BestRank( true, sepSize, imbalance, comm );
+        mpi::Broadcast( part.data(), numSources, bestRank, comm );
+        part.erase( part.begin(), part.begin()+firstLocalSource );
+        part.resize( numLocalSources );
+    }
+    else
+    {
+        // Coarsen by contracting local matchings
+        // ======================================
+        const Int gatherSize = Max( Int(4096), 64*Int(commSize) );
+        const Int totalWeight = numSources;
+        const Int maxVertexWeight = Max( Int(1), 3*totalWeight/(2*gatherSize) );
+        multilevel::FormGhosts
+        ( levels[0].graph, levels[0].vtxDist, comm, levels[0].ghosts );
+        Int numGlobal = numSources;
+        vector<Int> match, values, edgeMap;
+        while( numGlobal > gatherSize )
+        {
+            const Int numLevels = levels.size();
+            auto& fine = levels[numLevels-1];
+            multilevel::HandshakeMatching
+            ( fine.graph, maxVertexWeight,
+              multilevel::Mix(commRank*64+numLevels), match );
+            vector<Int> cmap;
+            const Int numCoarse = multilevel::CoarseMap( match, cmap );
+            const Int numGlobalCoarse = mpi::AllReduce( numCoarse, comm );
+            if( numGlobalCoarse > multilevel::minCoarseningRatio*numGlobal )
+                break;
+
+            multilevel::DistLevel coarse;
+            coarse.vtxDist = multilevel::VertexDistribution( numCoarse, comm );
+            const Int firstCoarse = coarse.vtxDist[commRank];
+            values.resize( fine.graph.numVertices );
+            for( Int v=0; v<fine.graph.numVertices; ++v )
+                values[v] = firstCoarse + cmap[v];
+            multilevel::UpdateGhosts
+            ( fine.ghosts, fine.graph.numVertices, values, comm );
+            const Int numEdges = fine.graph.targets.size();
+            edgeMap.resize( numEdges );
+            for( Int e=0; e<numEdges; ++e )
+                edgeMap[e] = values[fine.ghosts.edgeSlots[e]];
+            multilevel::Contract
+            ( fine.graph, match, cmap, numCoarse, firstCoarse, edgeMap,
+              coarse.graph );
+            multilevel::FormGhosts
+            ( coarse.graph, coarse.vtxDist, comm, coarse.ghosts );
+            fine.cmap.swap( cmap );
+            levels.emplace_back( std::move(coarse) );
+            numGlobal = numGlobalCoarse;
+        }
+
+        // Bisect the gathered coarsest graph on every process
+        // ===================================================
+        const auto& coarsest = levels.back();
+        const auto global =
+          multilevel::GatherGraph( coarsest.graph, coarsest.vtxDist, comm );
+        vector<Int> globalPart, trialPart;
+        bool feasible=false;
+        Int cut=0, imbalance=0;
+        const Int globalMaxVertexWeight =
+          ( global.numVertices == 0 ? Int(1) :
+            *std::max_element
+            ( global.vertexWeights.begin(), global.vertexWeights.end() ) );
+        const Int globalMaxSide =
+          multilevel::MaxSideWeight
+          ( totalWeight, globalMaxVertexWeight, ctrl.maxImbalance );
+        const Int numTrials = Max( ctrl.numDistSeps, Int(1) );
+        for( Int trial=0; trial<numTrials; ++trial )
+        {
+            const Int trialCut =
+              multilevel::EdgeBisection
+              ( global, trialPart, commRank*numTrials+trial,
+                ctrl.maxImbalance );
+            Int weight0 = 0;
+            for( Int v=0; v<global.numVertices; ++v )
+                if( trialPart[v] == 0 )
+                    weight0 += global.vertexWeights[v];
+            const Int trialImbalance = Abs(totalWeight-2*weight0);
+            const bool trialFeasible =
+              ( Max(weight0,totalWeight-weight0) <= globalMaxSide );
+            if( trial == 0 ||
+                multilevel::BetterBisection
+                ( trialFeasible, trialCut, trialImbalance,
+                  feasible, cut, imbalance ) )
+            {
+                feasible = trialFeasible;
+                cut = trialCut;
+                imbalance = trialImbalance;
+                globalPart.swap( trialPart );
+            }
+        }
+        const int bestRank =
+          multilevel::BestRank( feasible, cut, imbalance, comm );
+        globalPart.resize( global.numVertices );
+        mpi::Broadcast
+        ( globalPart.data(), global.numVertices, bestRank, comm );
+        const Int firstCoarsest = coarsest.vtxDist[commRank];
+        part.assign
+        ( globalPart.begin()+firstCoarsest,
+          globalPart.begin()+firstCoarsest+coarsest.graph.numVertices );
+
+        // Project and refine
+        // ==================
+        vector<Int> finePart;
+        for( Int l=Int(levels.size())-2; l>=0; --l )
+        {
+            const auto& fine = levels[l];
+            finePart.resize( fine.graph.numVertices );
+            for( Int v=0; v<fine.graph.numVertices; ++v )
+                finePart[v] = part[fine.cmap[v]];
+            part.swap( finePart );
+            Int localMaxVertexWeight = 0;
+            for( const Int& weight : fine.graph.vertexWeights )
+                localMaxVertexWeight = Max( localMaxVertexWeight, weight );
+            const Int fineMaxVertexWeight =
+              mpi::AllReduce( localMaxVertexWeight, mpi::MAX, comm );
+            multilevel::DistRefine
+            ( fine, part,
+              multilevel::MaxSideWeight
+              (totalWeight,fineMaxVertexWeight,ctrl.maxImbalance),
+              comm );
+        }
+        const Int maxSide =
+          multilevel::MaxSideWeight( totalWeight, 1, ctrl.maxImbalance );
+        if( levels.size() == 1 )
+            multilevel::DistRefine( levels[0], part, maxSide, comm );
+
+        multilevel::DistVertexSeparator( levels[0], part, maxSide, comm );
+    }
+
+    // Form the permutation which orders the left side, then the right side,
+    // and finally the separator
+    Int localSizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numLocalSources; ++s )
+        ++localSizes[part[s]];
+    vector<Int> allSizes( 3*commSize );
+    mpi::AllGather( localSizes, 3, allSizes.data(), 3, comm );
+    Int sizes[3] = { 0, 0, 0 };
+    Int offsets[3];
+    for( Int j=0; j<3; ++j )
+    {
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == commRank )
+                offsets[j] = sizes[j];
+            sizes[j] += allSizes[3*q+j];
+        }
+    }
+    offsets[2] += sizes[0] + sizes[1];
+    offsets[1] += sizes[0];
+    perm.SetGrid( grid );
+    perm.Resize( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, offsets[part[s]]++ );
+
+    EL_DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildFromPerm
+    ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child );
+    return sizes[2];
+}
+
+} // namespace El
@@ -1444,6 +1444,7 @@ void EquilibratedMehrotra
     Real muOld = 0.1;
     Real relError = 1;
     SparseMatrix<Real> J, JOrig;
+    NormalMatrixPlan<Real> normalPlan;
     Matrix<Real> d, w;
     Matrix<Real> dInner;
 
@@ -1631,11 +1632,11 @@ void EquilibratedMehrotra
         {
             // Construct the KKT system
             // ------------------------
-            // TODO(poulson): Apply updates to a matrix of explicit zeros
-            // (with the correct sparsity pattern)
+            // The sparsity pattern of J only depends upon that of A
+            if( !normalPlan.Initialized() )
+                normalPlan.Initialize( problem.A );
             NormalKKT
-            ( problem.A, gammaPerm, deltaPerm,
-              solution.x, solution.z, J, false );
+            ( normalPlan, gammaPerm, deltaPerm, solution.x, solution.z, J );
             NormalKKTRHS
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
@@ -2043,6 +2044,7 @@ void EquilibratedMehrotra
 
     DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
+    DistNormalMatrixPlan<Real> normalPlan;
     DistMultiVec<Real> d(grid), w(grid);
     DistMultiVec<Real> dInner(grid);
 
@@ -2263,10 +2265,12 @@ void EquilibratedMehrotra
         {
             // Assemble the KKT system
             // -----------------------
-            // TODO(poulson): Apply updates on top of explicit zeros
+            // The sparsity (and communication) pattern of J only depends
+            // upon that of A
+            if( !normalPlan.Initialized() )
+                normalPlan.Initialize( problem.A );
             NormalKKT
-            ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
-              J, false );
+            ( normalPlan, gammaPerm, deltaPerm, solution.x, solution.z, J );
             NormalKKTRHS
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
@@ -156,6 +156,24 @@ void NormalKKT
   const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
+// Reuse the sparsity pattern (and communication pattern) of A D^2 A^T between
+// interior point iterations, as only D changes
+template<typename Real>
+void NormalKKT
+( const NormalMatrixPlan<Real>& plan,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J );
+template<typename Real>
+void NormalKKT
+( const DistNormalMatrixPlan<Real>& plan,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J );
 
 template<typename Real>
 void NormalKKTRHS
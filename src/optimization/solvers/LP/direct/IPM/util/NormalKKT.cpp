@@ -137,70 +137,72 @@ void NormalKKT
 
 template<typename Real>
 void NormalKKT
-( const SparseMatrix<Real>& A,
+( const NormalMatrixPlan<Real>& plan,
         Real gamma,
         Real delta,
   const Matrix<Real>& x,
   const Matrix<Real>& z,
-        SparseMatrix<Real>& J,
-  bool onlyLower )
+        SparseMatrix<Real>& J )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
+    const Int m = plan.Height();
+    const Int n = plan.Width();
     // TODO(poulson): Expose this value as a parameter
     const Real inflateRatio = Pow(limits::Epsilon<Real>(),Real(0.83));
 
-    // dInv := sqrt( (z ./ x) .+ gamma^2 )
-    // ===================================
-    Matrix<Real> dInv;
-    dInv.Resize( n, 1 );
+    // d := 1 ./ ( (z ./ x) .+ gamma^2 ) = 1 ./ dInv.^2
+    // ================================================
+    Matrix<Real> d;
+    d.Resize( n, 1 );
     for( Int i=0; i<n; ++i )
-        dInv(i) = Sqrt(z(i)/x(i) + gamma*gamma);
+        d(i) = 1 / (z(i)/x(i) + gamma*gamma);
 
     // Form A D^2 A^T + delta^2 I
     // ==========================
-    SparseMatrix<Real> G;
-    // TODO(poulson): Avoid forming this within an inner loop...
-    Transpose( A, G );
-    DiagonalSolve( LEFT, NORMAL, dInv, G );
-    Zeros( J, m, m );
-    ShiftDiagonal( J, delta*delta );
-    Syrk( LOWER, TRANSPOSE, Real(1), G, Real(1), J );
+    // The plan reuses the sparsity pattern of J (which includes the diagonal)
+    plan.Form( d, J );
 
-    // Inflate the diagonal in a small relative sense
-    // ==============================================
-    // TODO(poulson): Create EntrywiseMapDiagonal and replace this with it
+    // Shift and inflate the diagonal in a small relative sense
+    // ========================================================
     Real* valBuf = J.ValueBuffer();
     for( Int i=0; i<m; ++i )
     {
         const Int e = J.Offset( i, i );
-        const Real diagAbs = Abs(valBuf[e]);
+        const Real diagAbs = Abs(valBuf[e]+delta*delta);
         valBuf[e] = (1+inflateRatio)*diagAbs;
     }
+}
 
-    if( !onlyLower )
-        MakeSymmetric( LOWER, J );
+template<typename Real>
+void NormalKKT
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        SparseMatrix<Real>& J,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    NormalMatrixPlan<Real> plan;
+    plan.Initialize( A, onlyLower );
+    NormalKKT( plan, gamma, delta, x, z, J );
 }
 
 template<typename Real>
 void NormalKKT
-( const DistSparseMatrix<Real>& A,
+( const DistNormalMatrixPlan<Real>& plan,
         Real gamma,
         Real delta,
   const DistMultiVec<Real>& x,
   const DistMultiVec<Real>& z,
-        DistSparseMatrix<Real>& J,
-  bool onlyLower )
+        DistSparseMatrix<Real>& J )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-    const Grid& grid = A.Grid();
-    if( !mpi::Congruent( grid.Comm(), x.Grid().Comm() ) )
-        LogicError("Communicators of A and x must match");
+    const Int n = plan.Width();
+    const Grid& grid = x.Grid();
     if( !mpi::Congruent( grid.Comm(), z.Grid().Comm() ) )
-        LogicError("Communicators of A and z must match");
+        LogicError("Communicators of x and z must match");
 
     // TODO: Expose this value as a parameter
     const Real inflateRatio = Pow(limits::Epsilon<Real>(),Real(0.83));
@@ -208,40 +210,50 @@ void NormalKKT
     auto& xLoc = x.LockedMatrix();
     auto& zLoc = z.LockedMatrix();
 
-    // dInv := sqrt( (z ./ x) .+ gamma^2 )
-    // ===================================
-    DistMultiVec<Real> dInv(grid);
-    dInv.Resize( n, 1 );
-    auto& dInvLoc = dInv.Matrix();
-    const Int dInvLocalHeight = dInv.LocalHeight();
-    for( Int iLoc=0; iLoc<dInvLocalHeight; ++iLoc )
-        dInvLoc(iLoc) = Sqrt(zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
+    // d := 1 ./ ( (z ./ x) .+ gamma^2 ) = 1 ./ dInv.^2
+    // ================================================
+    DistMultiVec<Real> d(grid);
+    d.Resize( n, 1 );
+    auto& dLoc = d.Matrix();
+    const Int dLocalHeight = d.LocalHeight();
+    for( Int iLoc=0; iLoc<dLocalHeight; ++iLoc )
+        dLoc(iLoc) = 1 / (zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
 
     // Form A D^2 A^T + delta^2 I
     // ==========================
-    DistSparseMatrix<Real> G(grid);
-    // TODO: Avoid forming this within an inner loop...
-    Transpose( A, G );
-    DiagonalSolve( LEFT, NORMAL, dInv, G );
-    Zeros( J, m, m );
-    ShiftDiagonal( J, delta*delta );
-    Syrk( LOWER, TRANSPOSE, Real(1), G, Real(1), J );
+    // The plan reuses the sparsity pattern of J (which includes the diagonal)
+    plan.Form( d, J );
 
-    // Inflate the diagonal in a small relative sense
-    // ==============================================
-    // TODO: Create EntrywiseMapDiagonal and replace this with it
+    // Shift and inflate the diagonal in a small relative sense
+    // ========================================================
     Real* valBuf = J.ValueBuffer();
     const Int JLocalHeight = J.LocalHeight();
     for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
     {
         const Int i = J.GlobalRow(iLoc);
         const Int e = J.Offset( iLoc, i );
-        const Real diagAbs = Abs(valBuf[e]);
+        const Real diagAbs = Abs(valBuf[e]+delta*delta);
         valBuf[e] = (1+inflateRatio)*diagAbs;
     }
+}
 
-    if( !onlyLower )
-        MakeSymmetric( LOWER, J );
+template<typename Real>
+void NormalKKT
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    if( !mpi::Congruent( grid.Comm(), x.Grid().Comm() ) )
+        LogicError("Communicators of A and x must match");
+    DistNormalMatrixPlan<Real> plan;
+    plan.Initialize( A, onlyLower );
+    NormalKKT( plan, gamma, delta, x, z, J );
 }
 
 template<typename Real>
@@ -629,6 +641,20 @@ void ExpandNormalSolution
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void NormalKKT \
+  ( const NormalMatrixPlan<Real>& plan, \
+          Real gamma, \
+          Real delta, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          SparseMatrix<Real>& J ); \
+  template void NormalKKT \
+  ( const DistNormalMatrixPlan<Real>& plan, \
+          Real gamma, \
+          Real delta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J ); \
   template void NormalKKTRHS \
   ( const Matrix<Real>& A, \
           Real gamma, \
@@ -0,0 +1,201 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form a banded m x n matrix whose i'th row has nonzeros in the columns
+// (i*n)/m + {0,stride,...,(bandwidth-1)*stride} (modulo n)
+template<typename T>
+void Banded
+( DistSparseMatrix<T>& A, Int m, Int n, Int bandwidth, Int stride )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( bandwidth*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int k=0; k<bandwidth; ++k )
+            A.QueueLocalUpdate
+            ( iLoc, ((i*n)/m+k*stride) % n, SampleUniform<T>() );
+    }
+    A.ProcessLocalQueues();
+}
+
+template<typename T>
+void Banded
+( SparseMatrix<T>& A, Int m, Int n, Int bandwidth, Int stride )
+{
+    Zeros( A, m, n );
+    A.Reserve( bandwidth*m );
+    for( Int i=0; i<m; ++i )
+        for( Int k=0; k<bandwidth; ++k )
+            A.QueueUpdate( i, ((i*n)/m+k*stride) % n, SampleUniform<T>() );
+    A.ProcessQueues();
+}
+
+template<typename T>
+void TestSequential( Int m, Int k, Int n, Int bandwidth )
+{
+    Output("Testing sequential with ",TypeName<T>());
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    SparseMatrix<T> A, B, C;
+    Banded( A, m, k, bandwidth, 3 );
+    Banded( B, k, n, bandwidth, 7 );
+
+    // Test C := A B by comparing C X against A (B X)
+    Multiply( A, B, C );
+    Matrix<T> X, Y, Z, W;
+    Uniform( X, n, 4 );
+    Zeros( Y, m, 4 );
+    Multiply( NORMAL, T(1), C, X, T(0), Y );
+    Zeros( W, k, 4 );
+    Multiply( NORMAL, T(1), B, X, T(0), W );
+    Zeros( Z, m, 4 );
+    Multiply( NORMAL, T(1), A, W, T(0), Z );
+    Real ZNorm = FrobeniusNorm( Z );
+    Z -= Y;
+    Real relError = FrobeniusNorm( Z ) / ZNorm;
+    Output("|| A (B X) - (A B) X ||_F / || A (B X) ||_F = ",relError);
+    if( relError > 100*eps )
+        LogicError("Sparse product was incorrect");
+
+    // Test the lower triangle of C := A diag(d) A^T
+    NormalMatrixPlan<T> plan;
+    const bool onlyLower = true;
+    plan.Initialize( A, onlyLower );
+    Matrix<T> d;
+    Uniform( d, k, 1 );
+    plan.Form( d, C );
+    MakeSymmetric( LOWER, C );
+    Uniform( X, m, 4 );
+    Zeros( Y, m, 4 );
+    Multiply( NORMAL, T(1), C, X, T(0), Y );
+    Zeros( W, k, 4 );
+    Multiply( TRANSPOSE, T(1), A, X, T(0), W );
+    DiagonalScale( LEFT, NORMAL, d, W );
+    Zeros( Z, m, 4 );
+    Multiply( NORMAL, T(1), A, W, T(0), Z );
+    ZNorm = FrobeniusNorm( Z );
+    Z -= Y;
+    relError = FrobeniusNorm( Z ) / ZNorm;
+    Output
+    ("|| A D (A^T X) - (A D A^T) X ||_F / || A D (A^T X) ||_F = ",relError);
+    if( relError > 100*eps )
+        LogicError("Normal matrix was incorrect");
+    Output("");
+}
+
+template<typename T>
+void TestDistributed
+( Int m, Int k, Int n, Int bandwidth, const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing distributed with ",TypeName<T>());
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+
+    DistSparseMatrix<T> A(grid), B(grid), C(grid);
+    Banded( A, m, k, bandwidth, 3 );
+    Banded( B, k, n, bandwidth, 7 );
+
+    // Test C := A B by comparing C X against A (B X)
+    Timer timer;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    Multiply( A, B, C );
+    mpi::Barrier( grid.Comm() );
+    const Int numEntries = mpi::AllReduce( C.NumLocalEntries(), grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),"A B: ",timer.Stop()," seconds, ",numEntries," entries");
+
+    DistMultiVec<T> X(grid), Y(grid), Z(grid), W(grid);
+    Uniform( X, n, 4 );
+    Zeros( Y, m, 4 );
+    Multiply( NORMAL, T(1), C, X, T(0), Y );
+    Zeros( W, k, 4 );
+    Multiply( NORMAL, T(1), B, X, T(0), W );
+    Zeros( Z, m, 4 );
+    Multiply( NORMAL, T(1), A, W, T(0), Z );
+    Real ZNorm = FrobeniusNorm( Z );
+    Z -= Y;
+    Real relError = FrobeniusNorm( Z ) / ZNorm;
+    OutputFromRoot
+    (grid.Comm(),"|| A (B X) - (A B) X ||_F / || A (B X) ||_F = ",relError);
+    if( relError > 100*eps )
+        LogicError("Sparse product was incorrect");
+
+    // Test C := A diag(d) A^H for several d with a single plan
+    DistNormalMatrixPlan<T> plan;
+    const bool onlyLower = false;
+    const bool conjugate = true;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    plan.Initialize( A, onlyLower, conjugate );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot(grid.Comm(),"A D A^H symbolic: ",timer.Stop()," seconds");
+    DistMultiVec<T> d(grid);
+    Uniform( X, m, 4 );
+    for( Int trial=0; trial<3; ++trial )
+    {
+        Uniform( d, k, 1 );
+        mpi::Barrier( grid.Comm() );
+        timer.Start();
+        plan.Form( d, C );
+        mpi::Barrier( grid.Comm() );
+        OutputFromRoot
+        (grid.Comm(),"A D A^H numeric: ",timer.Stop()," seconds");
+
+        Zeros( Y, m, 4 );
+        Multiply( NORMAL, T(1), C, X, T(0), Y );
+        Zeros( W, k, 4 );
+        Multiply( ADJOINT, T(1), A, X, T(0), W );
+        DiagonalScale( LEFT, NORMAL, d, W );
+        Zeros( Z, m, 4 );
+        Multiply( NORMAL, T(1), A, W, T(0), Z );
+        ZNorm = FrobeniusNorm( Z );
+        Z -= Y;
+        relError = FrobeniusNorm( Z ) / ZNorm;
+        OutputFromRoot
+        (grid.Comm(),"|| A D (A^H X) - (A D A^H) X ||_F / ",
+         "|| A D (A^H X) ||_F = ",relError);
+        if( relError > 100*eps )
+            LogicError("Normal matrix was incorrect");
+    }
+    OutputFromRoot(grid.Comm(),"");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",2000);
+        const Int k = Input("--k","width of A and height of B",3000);
+        const Int n = Input("--n","width of B",1000);
+        const Int bandwidth = Input("--bandwidth","nonzeros per row",5);
+        ProcessInput();
+
+        if( mpi::Size( comm ) == 1 )
+        {
+            TestSequential<double>( m, k, n, bandwidth );
+            TestSequential<Complex<double>>( m, k, n, bandwidth );
+        }
+
+        const Grid grid( comm );
+        TestDistributed<double>( m, k, n, bandwidth, grid );
+        TestDistributed<Complex<double>>( m, k, n, bandwidth, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
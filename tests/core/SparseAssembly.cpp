@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Assemble the stiffness matrix of piecewise-linear finite elements over a
+// uniform grid of the unit interval, with the element matrices scaled by
+// 'alpha'. Element e couples the nodes e and e+1, and the elements are
+// dealt out to the processes in a round-robin fashion so that most of the
+// updates of a process are for rows owned by other processes.
+template<typename Field>
+void ElementData
+( Int numElements, Field alpha, int rank, int commSize,
+  vector<Int>& elementOffsets,
+  vector<Int>& elementIndices,
+  vector<Field>& values )
+{
+    elementOffsets.resize( 1, 0 );
+    elementIndices.resize( 0 );
+    values.resize( 0 );
+    for( Int e=rank; e<numElements; e+=commSize )
+    {
+        elementIndices.push_back( e );
+        elementIndices.push_back( e+1 );
+        elementOffsets.push_back( elementIndices.size() );
+        values.push_back( alpha );
+        values.push_back( -alpha );
+        values.push_back( -alpha );
+        values.push_back( alpha );
+    }
+}
+
+template<typename Field>
+void TestSequential( Int numElements )
+{
+    typedef Base<Field> Real;
+    const Int n = numElements + 1;
+    vector<Int> elementOffsets, elementIndices;
+    vector<Field> values;
+    ElementData
+    ( numElements, Field(1), 0, 1, elementOffsets, elementIndices, values );
+
+    // Assemble with the queues
+    SparseMatrix<Field> A, B;
+    Zeros( A, n, n );
+    vector<Int> rows, cols;
+    ElementUpdates( elementOffsets, elementIndices, rows, cols );
+    for( size_t k=0; k<rows.size(); ++k )
+        A.QueueUpdate( rows[k], cols[k], values[k] );
+    A.ProcessQueues();
+
+    // Reassemble twice with a plan
+    B = A;
+    B.FreezeSparsity();
+    auto plan = B.FormElementAssemblyPlan( elementOffsets, elementIndices );
+    for( auto& value : values )
+        value *= Field(2);
+    B.Assemble( plan, values, false );
+    B.Assemble( plan, values );
+
+    // B should now be 4 A
+    B -= A;
+    B -= A;
+    B -= A;
+    B -= A;
+    const Real errorNorm = FrobeniusNorm( B );
+    Output("Sequential: || B - 4 A ||_F = ",errorNorm);
+    if( errorNorm != Real(0) )
+        LogicError("Sequential planned assembly was incorrect");
+}
+
+template<typename Field>
+void TestDistributed( const Grid& grid, Int numElements )
+{
+    typedef Base<Field> Real;
+    const Int n = numElements + 1;
+    const int rank = grid.Rank();
+    const int commSize = grid.Size();
+    vector<Int> elementOffsets, elementIndices;
+    vector<Field> values;
+    ElementData
+    ( numElements, Field(1), rank, commSize,
+      elementOffsets, elementIndices, values );
+
+    // Assemble with the queues
+    DistSparseMatrix<Field> A(grid), B(grid);
+    Zeros( A, n, n );
+    vector<Int> rows, cols;
+    ElementUpdates( elementOffsets, elementIndices, rows, cols );
+    for( size_t k=0; k<rows.size(); ++k )
+        A.QueueUpdate( rows[k], cols[k], values[k] );
+    A.ProcessQueues();
+
+    // Reassemble twice with a plan
+    B = A;
+    B.FreezeSparsity();
+    auto plan = B.FormElementAssemblyPlan( elementOffsets, elementIndices );
+    for( auto& value : values )
+        value *= Field(2);
+    B.Assemble( plan, values, false );
+    B.Assemble( plan, values );
+
+    // B should now be 4 A
+    B -= A;
+    B -= A;
+    B -= A;
+    B -= A;
+    const Real errorNorm = FrobeniusNorm( B );
+    OutputFromRoot(grid.Comm(),"Distributed: || B - 4 A ||_F = ",errorNorm);
+    if( errorNorm != Real(0) )
+        LogicError("Distributed planned assembly was incorrect");
+}
+
+// In a diagonal matrix, the search for the absent entry (i,i+1) ends at the
+// beginning of row i+1, whose first entry is (i+1,i+1). Plans for such
+// entries must be rejected rather than aliased to the next row.
+template<typename Field>
+void TestAbsentEntry( const Grid& grid, Int n )
+{
+    SparseMatrix<Field> A;
+    Identity( A, n, n );
+    bool rejected = false;
+    try { A.FormAssemblyPlan( vector<Int>(1,0), vector<Int>(1,1) ); }
+    catch( std::logic_error& ) { rejected = true; }
+    if( !rejected )
+        LogicError("Sequential plan accepted an absent entry");
+
+    // Passive plans do not communicate, so each process may test the first
+    // of its rows on its own
+    DistSparseMatrix<Field> ADist(grid);
+    Identity( ADist, n, n );
+    if( ADist.LocalHeight() > 0 )
+    {
+        const Int row = ADist.FirstLocalRow();
+        const Int col = (row+1) % n;
+        const bool passive = true;
+        rejected = false;
+        try
+        {
+            ADist.FormAssemblyPlan
+            ( vector<Int>(1,row), vector<Int>(1,col), passive );
+        }
+        catch( std::logic_error& ) { rejected = true; }
+        if( !rejected )
+            LogicError("Distributed plan accepted an absent entry");
+    }
+    OutputFromRoot(grid.Comm(),"Plans for absent entries were rejected");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int numElements = Input("--numElements","number of elements",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestSequential<double>( numElements );
+        TestSequential<Complex<double>>( numElements );
+        TestDistributed<double>( grid, numElements );
+        TestDistributed<Complex<double>>( grid, numElements );
+        TestAbsentEntry<double>( grid, numElements+1 );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
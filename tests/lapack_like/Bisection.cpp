@@ -11,6 +11,38 @@
 #include <El.hpp>
 using namespace El;
 
+// Return 0, 1, or 2 depending upon whether the reordered index lies in the
+// left child, the right child, or the separator
+inline Int Side( Int index, Int leftChildSize, Int rightChildSize )
+{
+    if( index < leftChildSize )
+        return 0;
+    else if( index < leftChildSize+rightChildSize )
+        return 1;
+    else
+        return 2;
+}
+
+void CheckBisection
+( Int leftChildSize, Int rightChildSize, Int numVertices,
+  bool native, double maxImbalance, Int numCutEdges )
+{
+    if( numCutEdges != 0 )
+        LogicError
+        (numCutEdges," edges connected the two sides of the separator");
+    if( native )
+    {
+        // The native bisection bounds the weight of each side (with unit
+        // vertex weights) by that of its edge bisection
+        const Int half = (numVertices+1) / 2;
+        const Int maxSide = Max( Int(maxImbalance*half), half+1 );
+        if( Max(leftChildSize,rightChildSize) > maxSide )
+            LogicError
+            ("Partition sizes ",leftChildSize," and ",rightChildSize,
+             " exceeded the maximum side size of ",maxSide);
+    }
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -28,6 +60,10 @@ main( int argc, char* argv[] )
         const Int numSeqSeps = Input
             ("--numSeqSeps",
              "number of separators to try per sequential partition",1);
+        const bool native = Input
+            ("--native","use the native multilevel bisection?",true);
+        const double maxImbalance = Input
+            ("--maxImbalance","maximum native side imbalance",1.1);
         const bool print = Input("--print","print graph?",false);
         const bool display = Input("--display","display graph?",false);
         ProcessInput();
@@ -36,6 +72,8 @@ main( int argc, char* argv[] )
         ctrl.sequential = sequential;
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
+        ctrl.native = native;
+        ctrl.maxImbalance = maxImbalance;
 
         const Int numVertices = n*n*n;
         const Grid grid( comm );
@@ -101,6 +139,32 @@ main( int argc, char* argv[] )
                 OutputFromRoot
                 (comm,"Root is on right with sizes: ",leftChildSize,",",
                  rightChildSize,",",sepSize);
+
+            // Ensure that no edge connects the two children
+            const Int numLocalEdges = graph.NumLocalEdges();
+            vector<Int> sources( numLocalEdges ), targets( numLocalEdges );
+            for( Int e=0; e<numLocalEdges; ++e )
+            {
+                sources[e] = graph.Source( e );
+                targets[e] = graph.Target( e );
+            }
+            map.Translate( sources );
+            map.Translate( targets );
+            Int numLocalCutEdges = 0;
+            for( Int e=0; e<numLocalEdges; ++e )
+            {
+                const Int sourceSide =
+                  Side( sources[e], leftChildSize, rightChildSize );
+                const Int targetSide =
+                  Side( targets[e], leftChildSize, rightChildSize );
+                if( sourceSide != 2 && targetSide != 2 &&
+                    sourceSide != targetSide )
+                    ++numLocalCutEdges;
+            }
+            const Int numCutEdges = mpi::AllReduce( numLocalCutEdges, comm );
+            CheckBisection
+            ( leftChildSize, rightChildSize, numVertices, native,
+              maxImbalance, numCutEdges );
         }
         else
         {
@@ -117,6 +181,24 @@ main( int argc, char* argv[] )
             Output
             ("Partition sizes were: ",leftChildSize,",",rightChildSize,",",
              sepSize);
+
+            // Ensure that no edge connects the two children
+            Int numCutEdges = 0;
+            for( Int e=0; e<seqGraph.NumEdges(); ++e )
+            {
+                const Int source = map[seqGraph.Source(e)];
+                const Int target = map[seqGraph.Target(e)];
+                const Int sourceSide =
+                  Side( source, leftChildSize, rightChildSize );
+                const Int targetSide =
+                  Side( target, leftChildSize, rightChildSize );
+                if( sourceSide != 2 && targetSide != 2 &&
+                    sourceSide != targetSide )
+                    ++numCutEdges;
+            }
+            CheckBisection
+            ( leftChildSize, rightChildSize, numVertices, native,
+              maxImbalance, numCutEdges );
         }
     }
     catch( std::exception& e ) { ReportException(e); }
@@ -40,9 +40,20 @@ void TestCorrectness
 
     Output("|| X - B \\ Y ||_oo / (n eps || Y ||_1) = ",relError);
 
+    // Test the residual of the modified factorization, B - T T^H (or
+    // B - T^H T)
+    const Real frobB = HermitianFrobeniusNorm( uplo, B );
+    Herk
+    ( uplo, (uplo==LOWER ? NORMAL : ADJOINT), Real(-1), T, Real(1), B );
+    const Real relResidual =
+      HermitianFrobeniusNorm( uplo, B ) / (eps*n*frobB);
+    Output("|| B - T T^H ||_F / (n eps || B ||_F) = ",relResidual);
+
     // TODO(poulson): Use a more refined failure condition
     if( relError > Real(10) )
         LogicError("Relative error was unacceptably large");
+    if( relResidual > Real(10) )
+        LogicError("Relative residual was unacceptably large");
 }
 
 template<typename Field>
@@ -78,9 +89,21 @@ void TestCorrectness
     OutputFromRoot
     (grid.Comm(),"|| X - B \\ Y ||_oo / (n eps || Y ||_1) = ",relError);
 
+    // Test the residual of the modified factorization, B - T T^H (or
+    // B - T^H T)
+    const Real frobB = HermitianFrobeniusNorm( uplo, B );
+    Herk
+    ( uplo, (uplo==LOWER ? NORMAL : ADJOINT), Real(-1), T, Real(1), B );
+    const Real relResidual =
+      HermitianFrobeniusNorm( uplo, B ) / (eps*n*frobB);
+    OutputFromRoot
+    (grid.Comm(),"|| B - T T^H ||_F / (n eps || B ||_F) = ",relResidual);
+
     // TODO(poulson): Use a more refined failure condition
     if( relError > Real(10) )
         LogicError("Relative error was unacceptably large");
+    if( relResidual > Real(10) )
+        LogicError("Relative residual was unacceptably large");
 }
 
 template<typename Field>
@@ -90,7 +113,8 @@ void TestCholeskyMod
   Int n,
   Base<Field> alpha,
   bool correctness,
-  bool print )
+  bool print,
+  bool downdate=false )
 {
     Output("Testing with ",TypeName<Field>());
     PushIndent();
@@ -131,6 +155,25 @@ void TestCholeskyMod
 
     if( correctness )
         TestCorrectness( uplo, T, alpha, V, A );
+
+    if( !downdate )
+    {
+        PopIndent();
+        return;
+    }
+
+    // Downdating by the same vectors should recover the factor of A
+    VMod = V;
+    Output("Starting Cholesky mod with ",-alpha,"...");
+    timer.Start();
+    CholeskyMod( uplo, T, -alpha, VMod );
+    runTime = timer.Stop();
+    Output(runTime," seconds");
+    if( print )
+        Print( T, "Downdated Cholesky factor" );
+
+    if( correctness )
+        TestCorrectness( uplo, T, Base<Field>(0), V, A );
     PopIndent();
 }
 
@@ -142,7 +185,8 @@ void TestCholeskyMod
   Int n,
   Base<Field> alpha,
   bool correctness,
-  bool print )
+  bool print,
+  bool downdate=false )
 {
     OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
     PushIndent();
@@ -183,6 +227,25 @@ void TestCholeskyMod
 
     if( correctness )
         TestCorrectness( uplo, T, alpha, V, A );
+
+    if( !downdate )
+    {
+        PopIndent();
+        return;
+    }
+
+    // Downdating by the same vectors should recover the factor of A
+    VMod = V;
+    OutputFromRoot(grid.Comm(),"Starting Cholesky mod with ",-alpha,"...");
+    timer.Start();
+    CholeskyMod( uplo, T, -alpha, VMod );
+    runTime = timer.Stop();
+    OutputFromRoot(grid.Comm(),runTime," seconds");
+    if( print )
+        Print( T, "Downdated Cholesky factor" );
+
+    if( correctness )
+        TestCorrectness( uplo, T, Base<Field>(0), V, A );
     PopIndent();
 }
 
@@ -200,6 +263,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--m","height of matrix",100);
         const Int n = Input("--n","rank of update",5);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int smallNB =
+          Input("--smallNB","blocksize for a multi-panel pass",8);
         const double alpha = Input("--alpha","update scaling",3.);
         const bool sequential =
           Input("--sequential","test sequential?",true);
@@ -298,6 +363,26 @@ main( int argc, char* argv[] )
         TestCholeskyMod<Complex<BigFloat>>
         ( g, uplo, m, n, alpha, correctness, print );
 #endif
+
+        // Ensure that several panels, each with trailing rows, are updated
+        // and then downdated (which requires double precision, as A has a
+        // condition number of 1e10)
+        if( smallNB < m )
+        {
+            SetBlocksize( smallNB );
+            OutputFromRoot(comm,"Testing with a blocksize of ",smallNB);
+            if( sequential && mpi::Rank() == 0 )
+            {
+                TestCholeskyMod<double>
+                ( uplo, m, n, alpha, correctness, print, true );
+                TestCholeskyMod<Complex<double>>
+                ( uplo, m, n, alpha, correctness, print, true );
+            }
+            TestCholeskyMod<double>
+            ( g, uplo, m, n, alpha, correctness, print, true );
+            TestCholeskyMod<Complex<double>>
+            ( g, uplo, m, n, alpha, correctness, print, true );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -58,6 +58,7 @@ void TestQR
 ( const Grid& g,
   Int m, 
   Int n,
+  CholeskyQRVariant variant,
   bool testCorrectness,
   bool print )
 {
@@ -75,12 +76,17 @@ void TestQR
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    qr::Cholesky( Q, R );
+    const CholeskyQRVariant usedVariant = qr::Cholesky( Q, R, variant );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
+    const Int numPasses =
+      ( usedVariant == CHOLESKY_QR ? 1 :
+        ( usedVariant == CHOLESKY_QR2 ? 2 : 3 ) );
+    OutputFromRoot(g.Comm(),"Ran ",numPasses," CholeskyQR pass(es)");
     const double mD = double(m);
     const double nD = double(n);
-    const double gFlops = (2.*mD*nD*nD + 1./3.*nD*nD*nD)/(1.e9*runTime);
+    const double gFlops =
+      numPasses*(2.*mD*nD*nD + 1./3.*nD*nD*nD)/(1.e9*runTime);
     OutputFromRoot(g.Comm(),"Time: ",runTime," seconds (",gFlops," GFlop/s)");
     if( print )
     {
@@ -92,6 +98,48 @@ void TestQR
     PopIndent();
 }
 
+// Ensure that the adaptive variant falls back to shifted CholeskyQR3 for a
+// matrix whose singular values decay geometrically from one to 1/cond
+template<typename F>
+void TestIllConditioned
+( const Grid& g,
+  Int m,
+  Int n,
+  Base<F> cond,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing ill-conditioned with ",TypeName<F>());
+    PushIndent();
+    DistMatrix<F> X(g), V(g), ADense(g);
+    Uniform( X, m, n );
+    qr::ExplicitUnitary( X );
+    Haar( V, n );
+    for( Int j=0; j<n; ++j )
+    {
+        auto x = X( ALL, IR(j) );
+        x *= Pow( cond, -Real(j)/Real(Max(n-1,Int(1))) );
+    }
+    Gemm( NORMAL, ADJOINT, F(1), X, V, ADense );
+    DistMatrix<F,VC,STAR> A( ADense ), Q( ADense );
+    DistMatrix<F,STAR,STAR> R(g);
+    if( print )
+        Print( A, "A" );
+
+    const CholeskyQRVariant usedVariant =
+      qr::Cholesky( Q, R, CHOLESKY_QR_ADAPTIVE );
+    if( usedVariant != SHIFTED_CHOLESKY_QR3 )
+        LogicError("Expected a fallback to shifted CholeskyQR3");
+    OutputFromRoot(g.Comm(),"Fell back to shifted CholeskyQR3");
+    if( print )
+    {
+        Print( Q, "Q" );
+        Print( R, "R" );
+    }
+    TestCorrectness( Q, R, A );
+    PopIndent();
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -104,8 +152,12 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int variantInt = Input
+            ("--variant","0: QR, 1: QR2, 2: shifted QR3, 3: adaptive",3);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
+        const double cond =
+          Input("--cond","condition number of ill-conditioned matrix",1e12);
         const bool print = Input("--print","print matrices?",false);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
@@ -121,26 +173,31 @@ main( int argc, char* argv[] )
         const Grid g( comm, order );
         SetBlocksize( nb );
         ComplainIfDebug();
+        const auto variant = static_cast<CholeskyQRVariant>(variantInt);
+
+        TestQR<float>( g, m, n, variant, testCorrectness, print );
+        TestQR<Complex<float>>( g, m, n, variant, testCorrectness, print );
 
-        TestQR<float>( g, m, n, testCorrectness, print );
-        TestQR<Complex<float>>( g, m, n, testCorrectness, print );
+        TestQR<double>( g, m, n, variant, testCorrectness, print );
+        TestQR<Complex<double>>( g, m, n, variant, testCorrectness, print );
 
-        TestQR<double>( g, m, n, testCorrectness, print );
-        TestQR<Complex<double>>( g, m, n, testCorrectness, print );
+        // Single precision cannot represent a condition number of 1e12
+        TestIllConditioned<double>( g, m, n, cond, print );
+        TestIllConditioned<Complex<double>>( g, m, n, cond, print );
 
 #ifdef EL_HAVE_QD
-        TestQR<DoubleDouble>( g, m, n, testCorrectness, print );
-        TestQR<QuadDouble>( g, m, n, testCorrectness, print );
+        TestQR<DoubleDouble>( g, m, n, variant, testCorrectness, print );
+        TestQR<QuadDouble>( g, m, n, variant, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestQR<Quad>( g, m, n, testCorrectness, print );
-        TestQR<Complex<Quad>>( g, m, n, testCorrectness, print );
+        TestQR<Quad>( g, m, n, variant, testCorrectness, print );
+        TestQR<Complex<Quad>>( g, m, n, variant, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestQR<BigFloat>( g, m, n, testCorrectness, print );
-        TestQR<Complex<BigFloat>>( g, m, n, testCorrectness, print );
+        TestQR<BigFloat>( g, m, n, variant, testCorrectness, print );
+        TestQR<Complex<BigFloat>>( g, m, n, variant, testCorrectness, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -224,6 +224,10 @@ void TestSuite
     ctrl.tridiagEigCtrl.alg = ctrlDbl.tridiagEigCtrl.alg;
     ctrl.tridiagEigCtrl.subset = subset;
     ctrl.tridiagEigCtrl.progress = ctrlDbl.tridiagEigCtrl.progress;
+    ctrl.useSDC = ctrlDbl.useSDC;
+    ctrl.sdcCtrl.cutoff = ctrlDbl.sdcCtrl.cutoff;
+    ctrl.sdcCtrl.qdwhEig = ctrlDbl.sdcCtrl.qdwhEig;
+    ctrl.sdcCtrl.progress = ctrlDbl.sdcCtrl.progress;
 
     if( sequential && g.Rank() == 0 )
     {
@@ -301,6 +305,11 @@ main( int argc, char* argv[] )
         const bool testReal = Input("--testReal","test real matrices?",true);
         const bool testCpx = Input("--testCpx","test complex matrices?",true);
         const bool timeStages = Input("--timeStages","time stages?",true);
+        const bool useSDC =
+          Input("--useSDC","use spectral divide and conquer?",false);
+        const bool qdwhEig =
+          Input("--qdwhEig","use QDWH-eig splitting in SDC?",true);
+        const Int sdcCutoff = Input("--sdcCutoff","SDC cutoff",32);
         ProcessInput();
         PrintInputReport();
 
@@ -343,6 +352,10 @@ main( int argc, char* argv[] )
         ctrl.tridiagEigCtrl.sort = sort;
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
+        ctrl.useSDC = useSDC;
+        ctrl.sdcCtrl.cutoff = sdcCutoff;
+        ctrl.sdcCtrl.qdwhEig = qdwhEig;
+        ctrl.sdcCtrl.progress = progress;
         ctrl.tridiagEigCtrl.progress = progress;
 
         if( testReal )
@@ -408,6 +421,27 @@ main( int argc, char* argv[] )
               sequential, distributed, correctness, print, g, ctrl );
 #endif
          }
+
+        // Also run the QDWH-eig spectral divide and conquer on a matrix
+        // larger than its cutoff so that the spectrum is split at least once
+        if( !useSDC && !onlyEigvals )
+        {
+            const Int sdcHeight = Max( m, 2*sdcCutoff );
+            auto sdcCtrl( ctrl );
+            sdcCtrl.useSDC = true;
+            sdcCtrl.sdcCtrl.qdwhEig = true;
+            OutputFromRoot
+            (g.Comm(),"QDWH-eig spectral divide and conquer with height ",
+             sdcHeight,":");
+            if( testReal )
+                TestSuite<double>
+                ( sdcHeight, uplo, onlyEigvals, clustered,
+                  sequential, distributed, true, print, g, sdcCtrl );
+            if( testCpx )
+                TestSuite<Complex<double>>
+                ( sdcHeight, uplo, onlyEigvals, clustered,
+                  sequential, distributed, true, print, g, sdcCtrl );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -9,11 +9,49 @@
 #include <El.hpp>
 using namespace El;
 
+template<typename F>
+void CheckOrthogonality( const Matrix<F>& Q )
+{
+    typedef Base<F> Real;
+    const Int n = Q.Height();
+    const Int k = Q.Width();
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<F> X;
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), X );
+    const Real relOrthogError =
+      HermitianInfinityNorm( LOWER, X ) / (eps*Max(n,Int(1)));
+    Output("||Q^H Q - I||_oo / (eps n) = ",relOrthogError);
+    if( relOrthogError > Real(200) )
+        LogicError("Relative orthogonality error was unacceptably large");
+}
+
+template<typename F>
+void CheckOrthogonality( const DistMatrix<F>& Q )
+{
+    typedef Base<F> Real;
+    const Grid& g = Q.Grid();
+    const Int n = Q.Height();
+    const Int k = Q.Width();
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<F> X(g);
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), X );
+    const Real relOrthogError =
+      HermitianInfinityNorm( LOWER, X ) / (eps*Max(n,Int(1)));
+    OutputFromRoot(g.Comm(),"||Q^H Q - I||_oo / (eps n) = ",relOrthogError);
+    if( relOrthogError > Real(200) )
+        LogicError("Relative orthogonality error was unacceptably large");
+}
+
 template<typename Real,typename=EnableIf<IsReal<Real>>>
 void TestGraded
 ( bool progress,
   HermitianTridiagEigAlg alg,
   const herm_tridiag_eig::QRCtrl& qrCtrl,
+  bool nativeMRRR,
   bool print )
 {
     EL_DEBUG_CSE
@@ -24,6 +62,7 @@ void TestGraded
     ctrl.progress = progress;
     ctrl.alg = alg;
     ctrl.qrCtrl = qrCtrl;
+    ctrl.mrrrCtrl.native = nativeMRRR;
 
     Matrix<Real> d(n,1), e(n-1,1);
     d(0) = Real(1);
@@ -54,6 +93,11 @@ void TestGraded
     if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
         Output
         ("Convergence achieved after ",info.qrInfo.numIterations," iterations");
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_MRRR )
+        Output
+        (info.mrrrInfo.numRepresentations," representations, ",
+         info.mrrrInfo.numRQIIterations," RQI iterations, and ",
+         info.mrrrInfo.numOrthogonalizedClusters," orthogonalized clusters");
     if( print )
     {
         Print( w, "w" );
@@ -81,6 +125,7 @@ void TestGraded
     Output("|| T Q - Q diag(w) ||_F / || T ||_1 = ",errFrob/TOne);
     if( print )
         Print( R );
+    CheckOrthogonality( Q );
 }
 
 template<typename Real,typename=EnableIf<IsReal<Real>>>
@@ -89,6 +134,7 @@ void TestRandom
   bool progress,
   HermitianTridiagEigAlg alg,
   const herm_tridiag_eig::QRCtrl& qrCtrl,
+  bool nativeMRRR,
   bool print )
 {
     EL_DEBUG_CSE
@@ -98,6 +144,7 @@ void TestRandom
     ctrl.progress = progress;
     ctrl.alg = alg;
     ctrl.qrCtrl = qrCtrl;
+    ctrl.mrrrCtrl.native = nativeMRRR;
 
     Matrix<Real> d, e;
     Uniform( d, n, 1 );
@@ -121,6 +168,11 @@ void TestRandom
     if( ctrl.alg == HERM_TRIDIAG_EIG_QR )
         Output
         ("Convergence achieved after ",info.qrInfo.numIterations," iterations");
+    else if( ctrl.alg == HERM_TRIDIAG_EIG_MRRR )
+        Output
+        (info.mrrrInfo.numRepresentations," representations, ",
+         info.mrrrInfo.numRQIIterations," RQI iterations, and ",
+         info.mrrrInfo.numOrthogonalizedClusters," orthogonalized clusters");
     if( print )
     {
         Print( w, "w" );
@@ -148,6 +200,92 @@ void TestRandom
     Output("|| T Q - Q diag(w) ||_F / || T ||_1 = ",errFrob/TOne);
     if( print )
         Print( R );
+    CheckOrthogonality( Q );
+}
+
+// Exercise the distributed native MRRR (through the [STAR,VR] eigenvector
+// distribution of HermitianTridiagEig) via HermitianEig with the full
+// spectrum as well as with index and value subsets
+template<typename F>
+void TestDistributedNativeMRRR( Int n, bool print, const Grid& g )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing distributed native MRRR with ",TypeName<F>());
+    const Real eps = limits::Epsilon<Real>();
+
+    DistMatrix<F> AOrig(g);
+    HermitianUniformSpectrum( AOrig, n, -10, 10 );
+    const Real oneNormA = HermitianOneNorm( LOWER, AOrig );
+
+    for( Int test=0; test<3; ++test )
+    {
+        HermitianEigCtrl<F> ctrl;
+        ctrl.tridiagEigCtrl.alg = HERM_TRIDIAG_EIG_MRRR;
+        ctrl.tridiagEigCtrl.mrrrCtrl.native = true;
+        auto& subset = ctrl.tridiagEigCtrl.subset;
+        Int expectedWidth = n;
+        if( test == 1 )
+        {
+            subset.indexSubset = true;
+            subset.lowerIndex = n/4;
+            subset.upperIndex = n/2;
+            expectedWidth = n/2 - n/4 + 1;
+            OutputFromRoot
+            (g.Comm(),"Index subset [",subset.lowerIndex,",",
+             subset.upperIndex,"]");
+        }
+        else if( test == 2 )
+        {
+            subset.rangeSubset = true;
+            subset.lowerBound = Real(-5);
+            subset.upperBound = Real(5);
+            expectedWidth = -1;
+            OutputFromRoot
+            (g.Comm(),"Value subset (",subset.lowerBound,",",
+             subset.upperBound,"]");
+        }
+        else
+            OutputFromRoot(g.Comm(),"Full spectrum");
+
+        DistMatrix<F> A( AOrig ), Q(g);
+        DistMatrix<Real,VR,STAR> w(g);
+        HermitianEig( LOWER, A, w, Q, ctrl );
+        const Int k = w.Height();
+        if( print )
+        {
+            Print( w, "w" );
+            Print( Q, "Q" );
+        }
+        if( expectedWidth >= 0 && k != expectedWidth )
+            LogicError("Expected ",expectedWidth," eigenpairs but found ",k);
+        if( test == 2 )
+        {
+            auto w_STAR_STAR = DistMatrix<Real,STAR,STAR>( w );
+            for( Int j=0; j<k; ++j )
+            {
+                const Real omega = w_STAR_STAR.GetLocal(j,0);
+                if( omega <= subset.lowerBound || omega > subset.upperBound )
+                    LogicError("Eigenvalue ",omega," was outside of range");
+            }
+        }
+        CheckOrthogonality( Q );
+
+        // Find the residual || A Q - Q diag(w) ||_oo
+        DistMatrix<F> X(g);
+        X.AlignWith( Q );
+        Zeros( X, n, k );
+        Hemm( LEFT, LOWER, F(1), AOrig, Q, F(0), X );
+        DistMatrix<F> QW( Q );
+        DiagonalScale( RIGHT, NORMAL, w, QW );
+        X -= QW;
+        const Real relError = InfinityNorm( X ) / (n*eps*oneNormA);
+        OutputFromRoot
+        (g.Comm(),"||A Q - Q W||_oo / (eps n ||A||_1) = ",relError);
+        if( relError > Real(10) )
+            LogicError("Relative error was unacceptably large");
+    }
 }
 
 int main( int argc, char* argv[] )
@@ -157,12 +295,16 @@ int main( int argc, char* argv[] )
     try
     {
         const Int n = Input("--n","random matrix size",60);
+        const Int nDist =
+          Input("--nDist","distributed native MRRR matrix size",100);
         const bool fullAccuracyTwoByTwo =
           Input
           ("--fullAccuracyTwoByTwo?","full accuracy 2x2 eigenvalues?",true);
         const bool progress = Input("--progress","print progress?",true);
         const bool print = Input("--print","print matrices?",false);
         const Int algInt = Input("--algInt","0: QR, 1: D&C, 2: MRRR",1);
+        const bool nativeMRRR =
+          Input("--nativeMRRR","use native MRRR for BLAS types?",false);
         ProcessInput();
         PrintInputReport();
 
@@ -170,31 +312,35 @@ int main( int argc, char* argv[] )
         herm_tridiag_eig::QRCtrl qrCtrl;
         qrCtrl.fullAccuracyTwoByTwo = fullAccuracyTwoByTwo;
 
-        TestGraded<float>( progress, alg, qrCtrl, print );
-        TestGraded<double>( progress, alg, qrCtrl, print );
+        TestGraded<float>( progress, alg, qrCtrl, nativeMRRR, print );
+        TestGraded<double>( progress, alg, qrCtrl, nativeMRRR, print );
 #ifdef EL_HAVE_QUAD
-        TestGraded<Quad>( progress, alg, qrCtrl, print );
+        TestGraded<Quad>( progress, alg, qrCtrl, nativeMRRR, print );
 #endif
 #ifdef EL_HAVE_QD
-        TestGraded<DoubleDouble>( progress, alg, qrCtrl, print );
-        TestGraded<QuadDouble>( progress, alg, qrCtrl, print );
+        TestGraded<DoubleDouble>( progress, alg, qrCtrl, nativeMRRR, print );
+        TestGraded<QuadDouble>( progress, alg, qrCtrl, nativeMRRR, print );
 #endif
 #ifdef EL_HAVE_MPC
-        TestGraded<BigFloat>( progress, alg, qrCtrl, print );
+        TestGraded<BigFloat>( progress, alg, qrCtrl, nativeMRRR, print );
 #endif
 
-        TestRandom<float>( n, progress, alg, qrCtrl, print );
-        TestRandom<double>( n, progress, alg, qrCtrl, print );
+        TestRandom<float>( n, progress, alg, qrCtrl, nativeMRRR, print );
+        TestRandom<double>( n, progress, alg, qrCtrl, nativeMRRR, print );
 #ifdef EL_HAVE_QUAD
-        TestRandom<Quad>( n, progress, alg, qrCtrl, print );
+        TestRandom<Quad>( n, progress, alg, qrCtrl, nativeMRRR, print );
 #endif
 #ifdef EL_HAVE_QD
-        TestRandom<DoubleDouble>( n, progress, alg, qrCtrl, print );
-        TestRandom<QuadDouble>( n, progress, alg, qrCtrl, print );
+        TestRandom<DoubleDouble>( n, progress, alg, qrCtrl, nativeMRRR, print );
+        TestRandom<QuadDouble>( n, progress, alg, qrCtrl, nativeMRRR, print );
 #endif
 #ifdef EL_HAVE_MPC
-        TestRandom<BigFloat>( n, progress, alg, qrCtrl, print );
+        TestRandom<BigFloat>( n, progress, alg, qrCtrl, nativeMRRR, print );
 #endif
+
+        const Grid grid( mpi::COMM_WORLD );
+        TestDistributedNativeMRRR<double>( nDist, print, grid );
+        TestDistributedNativeMRRR<Complex<double>>( nDist, print, grid );
     }
     catch( std::exception& e ) { ReportException(e); }
 
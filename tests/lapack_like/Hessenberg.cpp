@@ -47,6 +47,17 @@ void TestCorrectness
             Display( Q, "Q" );
     }
 
+    // Compare the explicitly formed Q against Q applied to the identity
+    Matrix<Field> Q, QApplied;
+    hessenberg::FormQ( uplo, A, householderScalars, Q );
+    Identity( QApplied, n, n );
+    hessenberg::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, QApplied );
+    QApplied -= Q;
+    const Real formQError = FrobeniusNorm( QApplied ) / (n*eps);
+    Output("||FormQ - ApplyQ(I)||_F / (eps n) = ",formQError);
+    if( formQError > Real(1) )
+        LogicError("Unacceptably large difference in FormQ");
+
     // Reverse the accumulated Householder transforms
     hessenberg::ApplyQ( LEFT, uplo, ADJOINT, A, householderScalars, AOrig );
     hessenberg::ApplyQ( RIGHT, uplo, NORMAL, A, householderScalars, AOrig );
@@ -116,6 +127,18 @@ void TestCorrectness
             Display( Q, "Q" );
     }
 
+    // Compare the explicitly formed Q against Q applied to the identity
+    DistMatrix<Field> Q(grid), QApplied(grid);
+    hessenberg::FormQ( uplo, A, householderScalars, Q );
+    Identity( QApplied, n, n );
+    hessenberg::ApplyQ( LEFT, uplo, NORMAL, A, householderScalars, QApplied );
+    QApplied -= Q;
+    const Real formQError = FrobeniusNorm( QApplied ) / (n*eps);
+    OutputFromRoot
+    (grid.Comm(),"||FormQ - ApplyQ(I)||_F / (eps n) = ",formQError);
+    if( formQError > Real(1) )
+        LogicError("Unacceptably large difference in FormQ");
+
     // Reverse the accumulated Householder transforms
     hessenberg::ApplyQ( LEFT, uplo, ADJOINT, A, householderScalars, AOrig );
     hessenberg::ApplyQ( RIGHT, uplo, NORMAL, A, householderScalars, AOrig );
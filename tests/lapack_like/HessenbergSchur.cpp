@@ -305,6 +305,10 @@ int main( int argc, char* argv[] )
           Input
           ("--minMultiBulgeSize",
            "minimum size for using a multi-bulge algorithm",75);
+        const Int minDistAEDSize =
+          Input
+          ("--minDistAEDSize",
+           "minimum deflation window size for a subgrid AED",500);
         const bool accumulate =
           Input("--accumulate","accumulate reflections?",true);
         const bool sortShifts =
@@ -322,6 +326,7 @@ int main( int argc, char* argv[] )
         HessenbergSchurCtrl ctrl;
         ctrl.alg = static_cast<HessenbergSchurAlg>(algInt);
         ctrl.minMultiBulgeSize = minMultiBulgeSize;
+        ctrl.minDistAEDSize = minDistAEDSize;
         ctrl.accumulateReflections = accumulate;
         ctrl.sortShifts = sortShifts;
         ctrl.progress = progress;
@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestSequential
+( Int n1,
+  Int n2,
+  Int n3,
+  const IncompleteLDLCtrl<Base<Field>>& incompleteCtrl,
+  const RegSolveCtrl<Base<Field>>& solveCtrl,
+  bool print )
+{
+    Output("Testing sequential with ",TypeName<Field>());
+    typedef Base<Field> Real;
+    const Int N = n1*n2*n3;
+
+    SparseMatrix<Field> A;
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+    if( print )
+        Print( A, "A" );
+
+    Matrix<Field> x, b;
+    Uniform( x, N, 1 );
+    Zeros( b, N, 1 );
+    Multiply( NORMAL, Field(1), A, x, Field(0), b );
+
+    Timer timer;
+    IncompleteLDLFactorization<Field> incompleteFact;
+    const bool hermitian = true;
+    timer.Start();
+    incompleteFact.Initialize( A, hermitian );
+    incompleteFact.Factor( incompleteCtrl );
+    Output("Incomplete factorization: ",timer.Stop()," seconds");
+    Output
+    ("Factor entries: ",incompleteFact.NumEntries(),
+     ", matrix entries: ",A.NumEntries());
+
+    auto y = b;
+    timer.Start();
+    const Int numIts = ldl::SolveAfter( A, incompleteFact, y, solveCtrl );
+    Output("Preconditioned solve: ",timer.Stop()," seconds");
+    y -= x;
+    const Real relError = FrobeniusNorm( y ) / FrobeniusNorm( x );
+    Output("Iterations: ",numIts,", || x - y ||_2 / || x ||_2 = ",relError);
+    if( relError > Sqrt(solveCtrl.relTol) )
+        LogicError("The preconditioned solve did not converge");
+    Output("");
+}
+
+template<typename Field>
+void TestDistributed
+( Int n1,
+  Int n2,
+  Int n3,
+  const IncompleteLDLCtrl<Base<Field>>& incompleteCtrl,
+  const RegSolveCtrl<Base<Field>>& solveCtrl,
+  const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing distributed with ",TypeName<Field>());
+    typedef Base<Field> Real;
+    const Int N = n1*n2*n3;
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    DistMultiVec<Field> x(grid), b(grid);
+    Uniform( x, N, 1 );
+    Zeros( b, N, 1 );
+    Multiply( NORMAL, Field(1), A, x, Field(0), b );
+
+    Timer timer;
+    DistIncompleteLDLFactorization<Field> incompleteFact;
+    const bool hermitian = true;
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    incompleteFact.Initialize( A, hermitian );
+    incompleteFact.Factor( incompleteCtrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),"Incomplete factorization: ",timer.Stop()," seconds");
+
+    DistMultiVec<Field> y( b );
+    timer.Start();
+    const Int numIts = ldl::SolveAfter( A, incompleteFact, y, solveCtrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),"Preconditioned solve: ",timer.Stop()," seconds");
+    y -= x;
+    const Real relError = FrobeniusNorm( y ) / FrobeniusNorm( x );
+    OutputFromRoot
+    (grid.Comm(),"Iterations: ",numIts,
+     ", || x - y ||_2 / || x ||_2 = ",relError);
+    if( relError > Sqrt(solveCtrl.relTol) )
+        LogicError("The preconditioned solve did not converge");
+    OutputFromRoot(grid.Comm(),"");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const double dropTol = Input("--dropTol","drop tolerance",1e-3);
+        const Int fill = Input("--fill","extra entries per row",10);
+        const bool lgmres = Input("--lgmres","use LGMRES?",false);
+        const Int maxIts = Input("--maxIts","max Krylov iterations",500);
+        const Int restart = Input("--restart","Krylov restart",50);
+        const bool print = Input("--print","print matrix?",false);
+        ProcessInput();
+
+        IncompleteLDLCtrl<double> incompleteCtrl;
+        incompleteCtrl.dropTol = dropTol;
+        incompleteCtrl.fill = fill;
+
+        RegSolveCtrl<double> solveCtrl;
+        solveCtrl.alg = ( lgmres ? REG_SOLVE_LGMRES : REG_SOLVE_FGMRES );
+        solveCtrl.maxIts = maxIts;
+        solveCtrl.restart = restart;
+        solveCtrl.relTol = 1e-8;
+
+        if( commSize == 1 )
+        {
+            TestSequential<double>
+            ( n1, n2, n3, incompleteCtrl, solveCtrl, print );
+            TestSequential<Complex<double>>
+            ( n1, n2, n3, incompleteCtrl, solveCtrl, print );
+        }
+
+        const Grid grid( comm );
+        TestDistributed<double>
+        ( n1, n2, n3, incompleteCtrl, solveCtrl, grid );
+        TestDistributed<Complex<double>>
+        ( n1, n2, n3, incompleteCtrl, solveCtrl, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
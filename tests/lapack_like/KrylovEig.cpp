@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestCorrectness
+( const DistSparseMatrix<Field>& A,
+  const AbstractDistMatrix<Base<Field>>& w,
+  const DistMultiVec<Field>& X,
+        Base<Field> tol,
+        bool print )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = X.Grid();
+    const Int n = X.Height();
+    const Int numEigs = X.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( A );
+    if( print )
+        Print( w, "w" );
+
+    // Form I - X^H X
+    DistMatrix<Field> XMat(grid), Z(grid);
+    Copy( X, XMat );
+    Identity( Z, numEigs, numEigs );
+    Herk( UPPER, ADJOINT, Real(-1), XMat, Real(1), Z );
+    const Real orthogError = HermitianOneNorm( UPPER, Z );
+    const Real relOrthogError = orthogError / (eps*n);
+    OutputFromRoot
+    (grid.Comm(),"||X^H X - I||_1 / (eps n) = ",relOrthogError);
+
+    // Form A X - X diag(w)
+    DistMultiVec<Field> AX(grid);
+    Zeros( AX, n, numEigs );
+    Multiply( NORMAL, Field(1), A, X, Field(0), AX );
+    DistMatrix<Field> E(grid);
+    Copy( AX, E );
+    DiagonalScale( RIGHT, NORMAL, w, XMat );
+    E -= XMat;
+    const Real error = FrobeniusNorm( E );
+    const Real relError = error / (tol*oneNormA);
+    OutputFromRoot
+    (grid.Comm(),"||A X - X diag(w)||_F / (tol ||A||_1) = ",relError);
+
+    if( relOrthogError > Real(1)/(tol*n) )
+        LogicError("Unacceptably large relative orthogonality error");
+    if( relError > Real(10)*Sqrt(Real(numEigs)) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename Field>
+void TestKrylovEig
+( const Grid& grid,
+  Int n0,
+  Int n1,
+  Int numEigs,
+  Int basisSize,
+  Int blockSize,
+  bool shiftInvert,
+  bool correctness,
+  bool print,
+  bool progress )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n0, n1 );
+
+    KrylovEigCtrl<Real> ctrl;
+    ctrl.numEigs = numEigs;
+    ctrl.basisSize = basisSize;
+    ctrl.blockSize = blockSize;
+    ctrl.tol = Pow(limits::Epsilon<Real>(),Real(2)/Real(3));
+    ctrl.progress = progress;
+
+    DistMultiVec<Field> X(grid);
+    DistMatrix<Real,STAR,STAR> w(grid);
+    Timer timer;
+    for( const auto target : { EIG_SMALLEST, EIG_LARGEST } )
+    {
+        ctrl.target = target;
+        const string targetStr =
+          target == EIG_SMALLEST ? "smallest" : "largest";
+
+        OutputFromRoot
+        (grid.Comm(),"Thick-restart Lanczos for the ",numEigs," ",targetStr,
+         " eigenpairs...");
+        mpi::Barrier( grid.Comm() );
+        timer.Start();
+        auto info = ThickRestartLanczos( A, w, X, ctrl );
+        mpi::Barrier( grid.Comm() );
+        OutputFromRoot
+        (grid.Comm(),timer.Stop()," seconds, ",info.numIts," restarts, ",
+         info.numApplications," applications");
+        if( !info.converged )
+            LogicError("Thick-restart Lanczos did not converge");
+        if( correctness )
+            TestCorrectness( A, w, X, ctrl.tol, print );
+
+        OutputFromRoot
+        (grid.Comm(),"LOBPCG for the ",numEigs," ",targetStr,
+         " eigenpairs...");
+        mpi::Barrier( grid.Comm() );
+        timer.Start();
+        info = LOBPCG( A, w, X, ctrl );
+        mpi::Barrier( grid.Comm() );
+        OutputFromRoot
+        (grid.Comm(),timer.Stop()," seconds, ",info.numIts," iterations, ",
+         info.numApplications," applications");
+        if( !info.converged )
+            LogicError("LOBPCG did not converge");
+        if( correctness )
+            TestCorrectness( A, w, X, ctrl.tol, print );
+    }
+
+    if( shiftInvert )
+    {
+        // The eigenvalues nearest the middle of the spectrum
+        ctrl.shiftInvert = true;
+        ctrl.shift = Real(0.37)*MaxNorm(A);
+        OutputFromRoot
+        (grid.Comm(),"Shift-inverted thick-restart Lanczos for the ",numEigs,
+         " eigenpairs nearest ",ctrl.shift,"...");
+        mpi::Barrier( grid.Comm() );
+        timer.Start();
+        auto info = ThickRestartLanczos( A, w, X, ctrl );
+        mpi::Barrier( grid.Comm() );
+        OutputFromRoot
+        (grid.Comm(),timer.Stop()," seconds, ",info.numIts," restarts, ",
+         info.numApplications," applications");
+        if( !info.converged )
+            LogicError("Shift-inverted Lanczos did not converge");
+        if( correctness )
+            TestCorrectness( A, w, X, ctrl.tol, print );
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n0 = Input("--n0","first grid dimension",30);
+        const Int n1 = Input("--n1","second grid dimension",29);
+        const Int numEigs = Input("--numEigs","number of eigenpairs",5);
+        const Int basisSize = Input("--basisSize","Lanczos basis size",0);
+        const Int blockSize = Input("--blockSize","LOBPCG block size",8);
+        const bool shiftInvert =
+          Input("--shiftInvert","test shift-and-invert?",true);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
+        const Grid grid( comm, gridHeight, order );
+        ComplainIfDebug();
+
+        TestKrylovEig<double>
+        ( grid, n0, n1, numEigs, basisSize, blockSize, shiftInvert,
+          correctness, print, progress );
+        TestKrylovEig<Complex<double>>
+        ( grid, n0, n1, numEigs, basisSize, blockSize, shiftInvert,
+          correctness, print, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare X against f(A) B computed from a dense eigendecomposition of A
+template<typename Field>
+void TestCorrectness
+( const string& funcName,
+  const DistSparseMatrix<Field>& A,
+  function<Base<Field>(const Base<Field>&)> func,
+  const DistMultiVec<Field>& B,
+  const DistMultiVec<Field>& X,
+  const KrylovFunctionInfo<Base<Field>>& info,
+        Base<Field> tol,
+        bool print )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = B.Grid();
+
+    DistMatrix<Field> FA(grid), BDense(grid), XDense(grid), E(grid);
+    Copy( A, FA );
+    HermitianFunction( LOWER, FA, func );
+    Copy( B, BDense );
+    Copy( X, XDense );
+    Gemm( NORMAL, NORMAL, Field(1), FA, BDense, E );
+    const Real FNorm = FrobeniusNorm( E );
+    E -= XDense;
+    if( print )
+        Print( E, "E" );
+    const Real relError = FrobeniusNorm( E ) / FNorm;
+    OutputFromRoot
+    (grid.Comm(),funcName,": ",info.numIts," iterations, ",
+     info.numRestarts," restarts, ",info.numApplications," applications, ",
+     "estimated error ",info.errorEst,", ||f(A) B - X||_F / ||f(A) B||_F = ",
+     relError);
+
+    if( !info.converged )
+        LogicError(funcName," did not converge");
+    if( relError > Real(100)*tol )
+        LogicError("Unacceptably large relative error for ",funcName);
+}
+
+template<typename Field>
+void TestKrylovFunction
+( const Grid& grid,
+  Int n0,
+  Int n1,
+  Int numRHS,
+  Int basisSize,
+  Base<Field> t,
+  bool print,
+  bool progress )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n0, n1 );
+    const Int n = A.Height();
+
+    DistMultiVec<Field> B(grid), X(grid);
+    Gaussian( B, n, numRHS );
+
+    KrylovFunctionCtrl<Real> ctrl;
+    ctrl.basisSize = basisSize;
+    ctrl.tol = Pow(limits::Epsilon<Real>(),Real(2)/Real(3));
+    ctrl.progress = progress;
+
+    auto info = KrylovExp( A, -t, B, X, ctrl );
+    auto expFunc = [&]( const Real& alpha ) { return Exp(-t*alpha); };
+    TestCorrectness( "exp(-t A) B", A, expFunc, B, X, info, ctrl.tol, print );
+
+    info = KrylovSquareRoot( A, B, X, ctrl );
+    auto sqrtFunc = []( const Real& alpha ) { return Sqrt(alpha); };
+    TestCorrectness( "sqrt(A) B", A, sqrtFunc, B, X, info, ctrl.tol, print );
+
+    info = KrylovInverseSquareRoot( A, B, X, ctrl );
+    auto invSqrtFunc = []( const Real& alpha ) { return 1/Sqrt(alpha); };
+    TestCorrectness
+    ( "inv(sqrt(A)) B", A, invSqrtFunc, B, X, info, ctrl.tol, print );
+
+    // The user-defined function log(1+x)
+    auto logFunc = []( const Real& alpha ) { return Log(1+alpha); };
+    info = KrylovHermitianFunction( A, logFunc, B, X, ctrl );
+    TestCorrectness( "log(I+A) B", A, logFunc, B, X, info, ctrl.tol, print );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n0 = Input("--n0","first grid dimension",20);
+        const Int n1 = Input("--n1","second grid dimension",19);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const Int basisSize = Input("--basisSize","Lanczos basis size",30);
+        const double t = Input("--t","time",0.001);
+        const bool print = Input("--print","print matrices?",false);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
+        const Grid grid( comm, gridHeight, order );
+        ComplainIfDebug();
+
+        TestKrylovFunction<double>
+        ( grid, n0, n1, numRHS, basisSize, t, print, progress );
+        TestKrylovFunction<Complex<double>>
+        ( grid, n0, n1, numRHS, basisSize, t, print, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -97,6 +97,7 @@ template<typename Field>
 void TestLDL
 ( Int m,
   bool conjugated,
+  LDLPivotType pivotType,
   Int nbLocal,
   bool correctness,
   bool print )
@@ -121,7 +122,8 @@ void TestLDL
     timer.Start();
     Matrix<Field> dSub;
     Permutation p;
-    LDL( A, dSub, p, conjugated );
+    LDLPivotCtrl<Base<Field>> ctrl( pivotType );
+    LDL( A, dSub, p, conjugated, ctrl );
     const double runTime = timer.Stop();
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
@@ -143,6 +145,7 @@ void TestLDL
 ( const Grid& grid,
   Int m,
   bool conjugated,
+  LDLPivotType pivotType,
   Int nbLocal,
   bool correctness,
   bool print )
@@ -168,7 +171,8 @@ void TestLDL
     timer.Start();
     DistMatrix<Field,MD,STAR> dSub(grid);
     DistPermutation p(grid);
-    LDL( A, dSub, p, conjugated );
+    LDLPivotCtrl<Base<Field>> ctrl( pivotType );
+    LDL( A, dSub, p, conjugated, ctrl );
     mpi::Barrier( grid.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -200,6 +204,8 @@ main( int argc, char* argv[] )
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool conjugated = Input("--conjugate","conjugate LDL?",false);
+        const bool aasen =
+          Input("--aasen","also test blocked Aasen pivoting?",true);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -220,81 +226,93 @@ main( int argc, char* argv[] )
         const Grid grid( comm, gridHeight, order );
         SetBlocksize( nb );
         ComplainIfDebug();
-
-        if( sequential && mpi::Rank() == 0 )
+        // Every pivot type runs its own factorizations and residual checks
+        vector<LDLPivotType> pivotTypes(1,BUNCH_KAUFMAN_A);
+        if( aasen )
+            pivotTypes.push_back( AASEN );
+        for( const LDLPivotType pivotType : pivotTypes )
         {
+            OutputFromRoot
+            (comm,"Testing ",
+             (pivotType==AASEN ? "Aasen" : "Bunch-Kaufman")," pivoting");
+            PushIndent();
+
+            if( sequential && mpi::Rank() == 0 )
+            {
+                TestLDL<float>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+                TestLDL<Complex<float>>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+
+                TestLDL<double>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+                TestLDL<Complex<double>>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+
+#ifdef EL_HAVE_QD
+                TestLDL<DoubleDouble>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+                TestLDL<QuadDouble>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+
+                TestLDL<Complex<DoubleDouble>>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+                TestLDL<Complex<QuadDouble>>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+                TestLDL<Quad>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+                TestLDL<Complex<Quad>>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+#endif
+
+#ifdef EL_HAVE_MPC
+                TestLDL<BigFloat>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+                TestLDL<Complex<BigFloat>>
+                ( m, conjugated, pivotType, nbLocal, correctness, print );
+#endif
+            }
+
             TestLDL<float>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<float>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 
             TestLDL<double>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<double>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 
 #ifdef EL_HAVE_QD
             TestLDL<DoubleDouble>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<QuadDouble>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 
             TestLDL<Complex<DoubleDouble>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<QuadDouble>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestLDL<Quad>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<Quad>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestLDL<BigFloat>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<BigFloat>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 #endif
+            PopIndent();
         }
-
-        TestLDL<float>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-        TestLDL<Complex<float>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-
-        TestLDL<double>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-        TestLDL<Complex<double>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-
-#ifdef EL_HAVE_QD
-        TestLDL<DoubleDouble>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-        TestLDL<QuadDouble>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-
-        TestLDL<Complex<DoubleDouble>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-        TestLDL<Complex<QuadDouble>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-#endif
-
-#ifdef EL_HAVE_QUAD
-        TestLDL<Quad>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-        TestLDL<Complex<Quad>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-#endif
-
-#ifdef EL_HAVE_MPC
-        TestLDL<BigFloat>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-        TestLDL<Complex<BigFloat>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
-#endif
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,241 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Overwrite A with U diag(sigma) V^H, where U and V are Haar-distributed
+// (with V = U if 'hermitian' is true) and the singular values decay
+// geometrically from one to 1/cond
+template<typename Field,class MatType>
+void IllConditioned( MatType& A, Int n, Base<Field> cond, bool hermitian )
+{
+    typedef Base<Field> Real;
+    MatType U( A ), V( A );
+    Haar( U, n );
+    if( hermitian )
+        V = U;
+    else
+        Haar( V, n );
+    for( Int j=0; j<n; ++j )
+    {
+        auto u = U( ALL, IR(j) );
+        u *= Pow( cond, -Real(j)/Real(Max(n-1,Int(1))) );
+    }
+    Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
+}
+
+// Return the normwise backward error of X as a solution of A X = B
+template<typename Field,class MatType>
+Base<Field>
+BackwardError( const MatType& A, const MatType& X, const MatType& B )
+{
+    typedef Base<Field> Real;
+    MatType R( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    const Real denom = InfinityNorm(A)*MaxNorm(X) + MaxNorm(B);
+    return denom == Real(0) ? Real(0) : MaxNorm(R) / denom;
+}
+
+template<typename Field>
+void CheckEpsilons
+( const MixedPrecisionInfo<Base<Field>>& info )
+{
+    typedef Base<Field> Real;
+    if( info.workingEpsilon != limits::Epsilon<Real>() )
+        LogicError("Incorrect working epsilon of ",info.workingEpsilon);
+    if( info.factorEpsilon != limits::Epsilon<Base<Demote<Field>>>() )
+        LogicError("Incorrect factorization epsilon of ",info.factorEpsilon);
+}
+
+template<typename Field>
+void PrintInfo
+( const MixedPrecisionInfo<Base<Field>>& info,
+  Base<Field> backwardError,
+  mpi::Comm comm )
+{
+    OutputFromRoot
+    (comm,"factored=",info.factored,", converged=",info.converged,
+     ", fellBack=",info.fellBack,", ",info.numRefineIts," refinement and ",
+     info.numGMRESIts," GMRES iterations, backward error ",
+     info.backwardError," (",backwardError," recomputed)");
+}
+
+// Solve a well-conditioned system with classical and GMRES-based
+// refinement, and an ill-conditioned one both with and without falling back
+// to the working precision
+template<typename Field,class MatType>
+void TestSolves
+( bool hpd,
+  const MatType& A,
+  const MatType& AIll,
+  const MatType& B,
+  mpi::Comm comm )
+{
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol = Sqrt(Real(n))*eps;
+
+    auto solve =
+      [&]( const MatType& AMat, MatType& X,
+           const MixedPrecisionCtrl<Real>& ctrl )
+      {
+          if( hpd )
+              return HPDSolve( LOWER, NORMAL, AMat, X, ctrl );
+          else
+              return LinearSolve( AMat, X, ctrl );
+      };
+
+    for( Int refineInt=0; refineInt<2; ++refineInt )
+    {
+        MixedPrecisionCtrl<Real> ctrl;
+        ctrl.refine = static_cast<MixedPrecisionRefine>(refineInt);
+        OutputFromRoot
+        (comm,(refineInt==0?"Classical":"GMRES")," refinement:");
+
+        MatType X( B );
+        const auto info = solve( A, X, ctrl );
+        const Real backwardError = BackwardError<Field>( A, X, B );
+        PrintInfo<Field>( info, backwardError, comm );
+        CheckEpsilons<Field>( info );
+        if( !info.factored || !info.converged || info.fellBack )
+            LogicError("Refinement of a well-conditioned system failed");
+        if( info.numRefineIts < 1 )
+            LogicError("Expected at least one refinement iteration");
+        if( ctrl.refine == MIXED_REFINE_GMRES &&
+            info.numGMRESIts < info.numRefineIts )
+            LogicError("Expected at least one GMRES iteration per step");
+        if( ctrl.refine == MIXED_REFINE_CLASSICAL && info.numGMRESIts != 0 )
+            LogicError("Classical refinement reported GMRES iterations");
+        if( info.backwardError > relTol )
+            LogicError("Reported backward error exceeded the tolerance");
+        if( backwardError > 10*relTol )
+            LogicError("Backward error of the solution was too large");
+    }
+
+    // The demoted factorization of the ill-conditioned matrix either breaks
+    // down or is too inaccurate for classical refinement to converge
+    OutputFromRoot(comm,"Ill-conditioned without fallback:");
+    MixedPrecisionCtrl<Real> ctrl;
+    ctrl.fallback = false;
+    bool brokeDown = false;
+    try
+    {
+        MatType X( B );
+        const auto info = solve( AIll, X, ctrl );
+        PrintInfo<Field>( info, BackwardError<Field>(AIll,X,B), comm );
+        CheckEpsilons<Field>( info );
+        if( info.converged || info.fellBack )
+            LogicError("Refinement of an ill-conditioned system converged");
+        if( info.backwardError <= relTol )
+            LogicError("Unconverged refinement reported a small error");
+    }
+    catch( std::runtime_error& )
+    {
+        OutputFromRoot(comm,"Low-precision factorization broke down");
+        brokeDown = true;
+    }
+    if( brokeDown && !hpd )
+        LogicError("The low-precision LU factorization broke down");
+
+    OutputFromRoot(comm,"Ill-conditioned with fallback:");
+    ctrl.fallback = true;
+    MatType X( B );
+    const auto info = solve( AIll, X, ctrl );
+    const Real backwardError = BackwardError<Field>( AIll, X, B );
+    PrintInfo<Field>( info, backwardError, comm );
+    CheckEpsilons<Field>( info );
+    if( !info.fellBack )
+        LogicError("Expected a fallback to the working precision");
+    if( backwardError > 10*n*eps )
+        LogicError("Backward error of the fallback solution was too large");
+}
+
+template<typename Field>
+void TestSequential( Int n, Int numRHS, Base<Field> cond )
+{
+    Output("Testing sequential with ",TypeName<Field>());
+    PushIndent();
+    Matrix<Field> A, AIll, B;
+    Uniform( B, n, numRHS );
+
+    Output("LinearSolve");
+    PushIndent();
+    Uniform( A, n, n );
+    ShiftDiagonal( A, Field(n) );
+    IllConditioned<Field>( AIll, n, cond, false );
+    TestSolves<Field>( false, A, AIll, B, mpi::COMM_SELF );
+    PopIndent();
+
+    Output("HPDSolve");
+    PushIndent();
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    IllConditioned<Field>( AIll, n, cond, true );
+    TestSolves<Field>( true, A, AIll, B, mpi::COMM_SELF );
+    PopIndent();
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestDistributed( Int n, Int numRHS, Base<Field> cond, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing distributed with ",TypeName<Field>());
+    PushIndent();
+    DistMatrix<Field> A(g), AIll(g), B(g);
+    Uniform( B, n, numRHS );
+
+    OutputFromRoot(g.Comm(),"LinearSolve");
+    PushIndent();
+    Uniform( A, n, n );
+    ShiftDiagonal( A, Field(n) );
+    IllConditioned<Field>( AIll, n, cond, false );
+    TestSolves<Field>( false, A, AIll, B, g.Comm() );
+    PopIndent();
+
+    OutputFromRoot(g.Comm(),"HPDSolve");
+    PushIndent();
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    IllConditioned<Field>( AIll, n, cond, true );
+    TestSolves<Field>( true, A, AIll, B, g.Comm() );
+    PopIndent();
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",200);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const double cond =
+          Input("--cond","condition number of ill-conditioned matrices",1e12);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSequential<double>( n, numRHS, cond );
+            TestSequential<Complex<double>>( n, numRHS, cond );
+        }
+
+        const Grid g( comm );
+        TestDistributed<double>( n, numRHS, cond, g );
+        TestDistributed<Complex<double>>( n, numRHS, cond, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestCorrectness
+( const DistMatrix<Field>& A,
+  const DistMatrix<Field>& Q,
+  const DistMatrix<Field>& R,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( A );
+
+    // Form I - Q^H Q
+    DistMatrix<Field> Z(grid);
+    Identity( Z, n, n );
+    Herk( UPPER, ADJOINT, Real(-1), Q, Real(1), Z );
+    const Real orthogError = HermitianOneNorm( UPPER, Z );
+    const Real relOrthogError = orthogError / (eps*m);
+    OutputFromRoot
+    (grid.Comm(),"||Q^H Q - I||_1 / (eps m) = ",relOrthogError);
+
+    // Form A - Q R
+    auto E( A );
+    Gemm( NORMAL, NORMAL, Field(-1), Q, R, Field(1), E );
+    if( print )
+        Print( E, "A - Q R" );
+    const Real error = OneNorm( E );
+    const Real relError = error / (eps*m*oneNormA);
+    OutputFromRoot
+    (grid.Comm(),"||A - Q R||_1 / (eps m ||A||_1) = ",relError);
+
+    if( relOrthogError > Real(100) )
+        LogicError("Unacceptably large relative orthogonality error");
+    if( relError > Real(100) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename Field>
+void TestQRMod
+( const Grid& grid,
+  Int m,
+  Int n,
+  Int numAppend,
+  Int numDelete,
+  bool correctness,
+  bool print )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid), Q(grid), R(grid);
+    Uniform( A, m, n );
+    Q = A;
+    qr::Explicit( Q, R );
+
+    // Append columns
+    DistMatrix<Field> C(grid);
+    Uniform( C, m, numAppend );
+    {
+        OutputFromRoot(grid.Comm(),"Appending ",numAppend," columns...");
+        mpi::Barrier( grid.Comm() );
+        Timer timer;
+        timer.Start();
+        QRAppendColumns( Q, R, C );
+        mpi::Barrier( grid.Comm() );
+        OutputFromRoot(grid.Comm(),timer.Stop()," seconds");
+    }
+    DistMatrix<Field> AApp(grid);
+    Zeros( AApp, m, n+numAppend );
+    auto AAppL = AApp( ALL, IR(0,n) );
+    auto AAppR = AApp( ALL, IR(n,n+numAppend) );
+    AAppL = A;
+    AAppR = C;
+    if( correctness )
+        TestCorrectness( AApp, Q, R, print );
+
+    // Delete every other column in the middle of the matrix
+    vector<Int> deletions, kept;
+    const Int nApp = n + numAppend;
+    const Int firstDel = Max( nApp/2 - numDelete, Int(0) );
+    for( Int l=0; l<numDelete && firstDel+2*l<nApp; ++l )
+        deletions.push_back( firstDel+2*l );
+    for( Int j=0, l=0; j<nApp; ++j )
+    {
+        if( l < Int(deletions.size()) && deletions[l] == j )
+            ++l;
+        else
+            kept.push_back( j );
+    }
+    {
+        OutputFromRoot
+        (grid.Comm(),"Deleting ",deletions.size()," columns...");
+        mpi::Barrier( grid.Comm() );
+        Timer timer;
+        timer.Start();
+        QRDeleteColumns( Q, R, deletions );
+        mpi::Barrier( grid.Comm() );
+        OutputFromRoot(grid.Comm(),timer.Stop()," seconds");
+    }
+    DistMatrix<Field> ADel(grid);
+    GetSubmatrix( AApp, IR(0,m), kept, ADel );
+    if( correctness )
+        TestCorrectness( ADel, Q, R, print );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",300);
+        const Int n = Input("--width","width of matrix",100);
+        const Int numAppend = Input("--numAppend","columns to append",20);
+        const Int numDelete = Input("--numDelete","columns to delete",15);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
+        const Grid grid( comm, gridHeight, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        TestQRMod<float>
+        ( grid, m, n, numAppend, numDelete, correctness, print );
+        TestQRMod<Complex<float>>
+        ( grid, m, n, numAppend, numDelete, correctness, print );
+
+        TestQRMod<double>
+        ( grid, m, n, numAppend, numDelete, correctness, print );
+        TestQRMod<Complex<double>>
+        ( grid, m, n, numAppend, numDelete, correctness, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,299 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+(       DistMatrix<F>& A,
+  const DistMatrix<F>& U,
+  const DistMatrix<Base<F>,VR,STAR>& s,
+  const DistMatrix<F>& V,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int rank = s.Height();
+    const Int maxDim = Max(m,n);
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobA = FrobeniusNorm( A );
+
+    // Form I - U^H U
+    OutputFromRoot(g.Comm(),"Testing orthogonality of U...");
+    PushIndent();
+    DistMatrix<F> Z(g);
+    Identity( Z, rank, rank );
+    Herk( UPPER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real infOrthogUError = HermitianInfinityNorm( UPPER, Z );
+    const Real relOrthogUError = infOrthogUError / (eps*maxDim);
+    OutputFromRoot
+    (g.Comm(),"||U' U - I||_oo / (eps Max(m,n)) = ",relOrthogUError);
+    PopIndent();
+
+    // Form I - V^H V
+    OutputFromRoot(g.Comm(),"Testing orthogonality of V...");
+    PushIndent();
+    Identity( Z, rank, rank );
+    Herk( UPPER, ADJOINT, Real(-1), V, Real(1), Z );
+    const Real infOrthogVError = HermitianInfinityNorm( UPPER, Z );
+    const Real relOrthogVError = infOrthogVError / (eps*maxDim);
+    OutputFromRoot
+    (g.Comm(),"||V' V - I||_oo / (eps Max(m,n)) = ",relOrthogVError);
+    PopIndent();
+
+    // Form A - U S V^H
+    OutputFromRoot(g.Comm(),"Testing if A = U S V'...");
+    PushIndent();
+    auto VCopy( V );
+    DiagonalScale( RIGHT, NORMAL, s, VCopy );
+    Gemm( NORMAL, ADJOINT, F(-1), U, VCopy, F(1), A );
+    if( print )
+        Print( A, "A - U S V'" );
+    const Real frobError = FrobeniusNorm( A );
+    const Real relError = frobError / (eps*maxDim*frobA);
+    OutputFromRoot
+    (g.Comm(),"||A - U S V'||_F / (eps Max(m,n) ||A||_F) = ",relError);
+    PopIndent();
+
+    if( relOrthogUError > Real(10) )
+        LogicError("Unacceptably large relative orthog error for U");
+    if( relOrthogVError > Real(10) )
+        LogicError("Unacceptably large relative orthog error for V");
+    if( relError > Real(10) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename F>
+void TestCorrectness
+(       Matrix<F>& A,
+  const Matrix<F>& U,
+  const Matrix<Base<F>>& s,
+  const Matrix<F>& V )
+{
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int rank = s.Height();
+    const Int maxDim = Max(m,n);
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobA = FrobeniusNorm( A );
+
+    Matrix<F> Z;
+    Identity( Z, rank, rank );
+    Herk( UPPER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real relOrthogUError =
+      HermitianInfinityNorm( UPPER, Z ) / (eps*maxDim);
+    Output("||U' U - I||_oo / (eps Max(m,n)) = ",relOrthogUError);
+
+    Identity( Z, rank, rank );
+    Herk( UPPER, ADJOINT, Real(-1), V, Real(1), Z );
+    const Real relOrthogVError =
+      HermitianInfinityNorm( UPPER, Z ) / (eps*maxDim);
+    Output("||V' V - I||_oo / (eps Max(m,n)) = ",relOrthogVError);
+
+    auto VCopy( V );
+    DiagonalScale( RIGHT, NORMAL, s, VCopy );
+    Gemm( NORMAL, ADJOINT, F(-1), U, VCopy, F(1), A );
+    const Real relError = FrobeniusNorm( A ) / (eps*maxDim*frobA);
+    Output("||A - U S V'||_F / (eps Max(m,n) ||A||_F) = ",relError);
+
+    if( relOrthogUError > Real(10) )
+        LogicError("Unacceptably large relative orthog error for U");
+    if( relOrthogVError > Real(10) )
+        LogicError("Unacceptably large relative orthog error for V");
+    if( relError > Real(10) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename F>
+void TestRSVD
+( const Grid& g,
+  Int m,
+  Int n,
+  Int r,
+  SketchType sketch,
+  bool correctness,
+  bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    // Form a matrix of rank r
+    DistMatrix<F> X(g), Y(g), A(g), U(g), V(g);
+    DistMatrix<Base<F>,VR,STAR> s(g);
+    Uniform( X, m, r );
+    Uniform( Y, n, r );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, A );
+    if( print )
+        Print( A, "A" );
+
+    RandomizedCtrl<Base<F>> ctrl;
+    ctrl.rank = r;
+    ctrl.sketch = sketch;
+
+    OutputFromRoot(g.Comm(),"Starting randomized SVD...");
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    RSVD( A, U, s, V, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = timer.Stop();
+    OutputFromRoot(g.Comm(),"Time = ",runTime," seconds");
+    if( print )
+    {
+        Print( U, "U" );
+        Print( s, "s" );
+        Print( V, "V" );
+    }
+    if( correctness )
+        TestCorrectness( A, U, s, V, print );
+    PopIndent();
+}
+
+// Form a sparse m x n matrix of rank (at most) r whose i'th row has nonzeros
+// in two of the r columns {0,n/r,...,(r-1)(n/r)}
+template<typename F>
+void LowRankSparse( SparseMatrix<F>& A, Int m, Int n, Int r )
+{
+    Zeros( A, m, n );
+    A.Reserve( 2*m );
+    for( Int i=0; i<m; ++i )
+        for( Int k=0; k<2; ++k )
+            A.QueueUpdate( i, ((i+k)%r)*(n/r), SampleUniform<F>() );
+    A.ProcessQueues();
+}
+
+template<typename F>
+void LowRankSparse( DistSparseMatrix<F>& A, Int m, Int n, Int r )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 2*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int k=0; k<2; ++k )
+            A.QueueLocalUpdate( iLoc, ((i+k)%r)*(n/r), SampleUniform<F>() );
+    }
+    A.ProcessLocalQueues();
+}
+
+template<typename F>
+void TestSparseRSVD
+( Int m,
+  Int n,
+  Int r,
+  SketchType sketch )
+{
+    Output("Testing sequential sparse with ",TypeName<F>());
+    PushIndent();
+    SparseMatrix<F> A;
+    LowRankSparse( A, m, n, r );
+
+    RandomizedCtrl<Base<F>> ctrl;
+    ctrl.rank = r;
+    ctrl.sketch = sketch;
+    Matrix<F> U, V;
+    Matrix<Base<F>> s;
+    RSVD( A, U, s, V, ctrl );
+    if( s.Height() != r )
+        LogicError("Expected ",r," singular triplets but found ",s.Height());
+
+    Matrix<F> ADense;
+    Copy( A, ADense );
+    TestCorrectness( ADense, U, s, V );
+    PopIndent();
+}
+
+template<typename F>
+void TestSparseRSVD
+( const Grid& g,
+  Int m,
+  Int n,
+  Int r,
+  SketchType sketch,
+  bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing distributed sparse with ",TypeName<F>());
+    PushIndent();
+    DistSparseMatrix<F> A(g);
+    LowRankSparse( A, m, n, r );
+
+    RandomizedCtrl<Base<F>> ctrl;
+    ctrl.rank = r;
+    ctrl.sketch = sketch;
+    DistMultiVec<F> U(g), V(g);
+    Matrix<Base<F>> s;
+    RSVD( A, U, s, V, ctrl );
+    if( s.Height() != r )
+        LogicError("Expected ",r," singular triplets but found ",s.Height());
+
+    // The singular values are redundant, so each process fills its own rows
+    DistMatrix<F> ADense(g), UDense(g), VDense(g);
+    DistMatrix<Base<F>,VR,STAR> sDist(g);
+    Copy( A, ADense );
+    Copy( U, UDense );
+    Copy( V, VDense );
+    sDist.Resize( r, 1 );
+    for( Int iLoc=0; iLoc<sDist.LocalHeight(); ++iLoc )
+        sDist.SetLocal( iLoc, 0, s(sDist.GlobalRow(iLoc)) );
+    TestCorrectness( ADense, UDense, sDist, VDense, print );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",300);
+        const Int n = Input("--width","width of matrix",200);
+        const Int r = Input("--rank","rank of matrix",10);
+        const bool srht = Input("--srht","use an SRHT sketch?",false);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        const SketchType sketch = ( srht ? SRHT_SKETCH : GAUSSIAN_SKETCH );
+
+        TestRSVD<float>
+        ( g, m, n, r, sketch, correctness, print );
+        TestRSVD<Complex<float>>
+        ( g, m, n, r, sketch, correctness, print );
+
+        TestRSVD<double>
+        ( g, m, n, r, sketch, correctness, print );
+        TestRSVD<Complex<double>>
+        ( g, m, n, r, sketch, correctness, print );
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSparseRSVD<double>( m, n, r, sketch );
+            TestSparseRSVD<Complex<double>>( m, n, r, sketch );
+        }
+        TestSparseRSVD<double>( g, m, n, r, sketch, print );
+        TestSparseRSVD<Complex<double>>( g, m, n, r, sketch, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that || A - (A P^T)(:,0:k) [I, Z] ||_F / || A ||_F is small
+template<typename F>
+void TestID
+( const DistMatrix<F>& A,
+  const RandomizedCtrl<Base<F>>& ctrl,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(g.Comm(),"Testing RandomizedID...");
+    PushIndent();
+
+    DistPermutation P(g);
+    DistMatrix<F> Z(g);
+    RandomizedID( A, P, Z, ctrl );
+    const Int k = Z.Height();
+    if( print )
+        Print( Z, "Z" );
+    if( k != ctrl.rank )
+        LogicError("Expected an ID of rank ",ctrl.rank," but found ",k);
+
+    DistMatrix<F> AP( A );
+    P.PermuteCols( AP );
+    auto AC = AP( ALL, IR(0,k) );
+    DistMatrix<F> IZ(g);
+    Zeros( IZ, k, n );
+    auto IZL = IZ( ALL, IR(0,k) );
+    auto IZR = IZ( ALL, IR(k,n) );
+    FillDiagonal( IZL, F(1) );
+    IZR = Z;
+    DistMatrix<F> E( AP );
+    Gemm( NORMAL, NORMAL, F(-1), AC, IZ, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( A );
+    OutputFromRoot
+    (g.Comm(),"|| A P^T - A_C [I, Z] ||_F / || A ||_F = ",relError);
+    if( relError > 100*Max(m,n)*eps )
+        LogicError("Relative error was unacceptably large");
+    PopIndent();
+}
+
+// Ensure that || A - A_C Z A_R ||_F / || A ||_F is small
+template<typename F>
+void TestSkeleton
+( const DistMatrix<F>& A,
+  const RandomizedCtrl<Base<F>>& ctrl,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(g.Comm(),"Testing RandomizedSkeleton...");
+    PushIndent();
+
+    DistPermutation PR(g), PC(g);
+    DistMatrix<F> Z(g);
+    RandomizedSkeleton( A, PR, PC, Z, ctrl );
+    const Int k = Z.Height();
+    if( print )
+        Print( Z, "Z" );
+    if( k != ctrl.rank || Z.Width() != k )
+        LogicError
+        ("Expected a ",ctrl.rank," x ",ctrl.rank," core but found ",
+         k," x ",Z.Width());
+
+    DistMatrix<F> AR( A ), AC( A );
+    PR.PermuteRows( AR );
+    AR.Resize( k, n );
+    PC.PermuteCols( AC );
+    AC.Resize( m, k );
+    DistMatrix<F> ZAR(g), E( A );
+    Gemm( NORMAL, NORMAL, F(1), Z, AR, ZAR );
+    Gemm( NORMAL, NORMAL, F(-1), AC, ZAR, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( A );
+    OutputFromRoot
+    (g.Comm(),"|| A - A_C Z A_R ||_F / || A ||_F = ",relError);
+    if( relError > 100*Max(m,n)*eps )
+        LogicError("Relative error was unacceptably large");
+    PopIndent();
+}
+
+// Ensure that || op(A) - Q Q^H op(A) ||_F is within a small factor of the
+// optimal error for a matrix with singular values 2^{-j/4}. The power
+// iterations only reach this accuracy if they apply op(A)^H, which is
+// conj(A) rather than A when op(A) = A^T.
+template<typename F>
+void TestRangeFinder
+( const Grid& g,
+  Int m,
+  Int n,
+  const RandomizedCtrl<Base<F>>& ctrl,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing RangeFinder...");
+    PushIndent();
+
+    const Int minDim = Min(m,n);
+    DistMatrix<F> X(g), V(g), A(g);
+    Uniform( X, m, minDim );
+    qr::ExplicitUnitary( X );
+    Uniform( V, n, minDim );
+    qr::ExplicitUnitary( V );
+    Real optimalSquared = 0;
+    const Int numSamples = Min( ctrl.rank+ctrl.oversample, minDim );
+    for( Int j=0; j<minDim; ++j )
+    {
+        const Real sigma = Pow( Real(2), -Real(j)/Real(4) );
+        auto x = X( ALL, IR(j) );
+        x *= sigma;
+        if( j >= numSamples )
+            optimalSquared += sigma*sigma;
+    }
+    Gemm( NORMAL, ADJOINT, F(1), X, V, A );
+    const Real optimal = Sqrt( optimalSquared );
+
+    const Orientation orientations[3] = { NORMAL, TRANSPOSE, ADJOINT };
+    const char* names[3] = { "A", "A^T", "A^H" };
+    for( Int k=0; k<3; ++k )
+    {
+        DistMatrix<F> Q(g), opA(g), QHopA(g);
+        RangeFinder( orientations[k], A, Q, ctrl );
+        if( orientations[k] == NORMAL )
+            opA = A;
+        else
+            Transpose( A, opA, orientations[k] == ADJOINT );
+        if( print )
+            Print( Q, "Q" );
+        Gemm( ADJOINT, NORMAL, F(1), Q, opA, QHopA );
+        Gemm( NORMAL, NORMAL, F(-1), Q, QHopA, F(1), opA );
+        const Real relError = FrobeniusNorm( opA ) / optimal;
+        OutputFromRoot
+        (g.Comm(),"|| op(A) - Q Q^H op(A) ||_F / optimal for op(A) = ",
+         names[k],": ",relError);
+        if( relError > Real(3)/Real(2) )
+            LogicError("Range of ",names[k]," was poorly approximated");
+    }
+    PopIndent();
+}
+
+template<typename F>
+void TestRandomized
+( const Grid& g,
+  Int m,
+  Int n,
+  Int r,
+  SketchType sketch,
+  bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    // Form a matrix of rank r
+    DistMatrix<F> X(g), Y(g), A(g);
+    Uniform( X, m, r );
+    Uniform( Y, n, r );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, A );
+    if( print )
+        Print( A, "A" );
+
+    RandomizedCtrl<Base<F>> ctrl;
+    ctrl.rank = r;
+    ctrl.sketch = sketch;
+    TestID( A, ctrl, print );
+    TestSkeleton( A, ctrl, print );
+
+    ctrl.numPowerIts = 2;
+    TestRangeFinder<F>( g, m, n, ctrl, print );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",300);
+        const Int n = Input("--width","width of matrix",200);
+        const Int r = Input("--rank","rank of matrix",10);
+        const bool srht = Input("--srht","use an SRHT sketch?",false);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        const SketchType sketch = ( srht ? SRHT_SKETCH : GAUSSIAN_SKETCH );
+
+        TestRandomized<float>( g, m, n, r, sketch, print );
+        TestRandomized<Complex<float>>( g, m, n, r, sketch, print );
+        TestRandomized<double>( g, m, n, r, sketch, print );
+        TestRandomized<Complex<double>>( g, m, n, r, sketch, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
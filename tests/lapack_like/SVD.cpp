@@ -20,8 +20,10 @@ void TestSequentialSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool useQDWH,
   bool penalizeDerivative,
   Int divideCutoff,
+  Int sdcCutoff,
   bool print )
 {
     Output("Sequential test with ",TypeName<F>());
@@ -40,6 +42,8 @@ void TestSequentialSVD
 
     SVDCtrl<Real> ctrl;
     ctrl.bidiagSVDCtrl.useQR = useQR;
+    ctrl.useQDWH = useQDWH;
+    ctrl.sdcCtrl.cutoff = sdcCutoff;
     ctrl.bidiagSVDCtrl.wantU = wantU; 
     ctrl.bidiagSVDCtrl.wantV = wantV;
     ctrl.bidiagSVDCtrl.approach = approach;
@@ -108,6 +112,9 @@ void TestSequentialSVD
             LogicError("s(",i,")=",s(i)," > s(",i-1,")=",s(i-1));
 
     // Check that U and V are unitary
+    const Real eps = limits::Epsilon<Real>();
+    // TODO(poulson): Provide a rigorous motivation for this bound
+    const Real orthTol = Real(50)*Max(m,n)*eps;
     Matrix<F> E;
     if( wantU )
     {
@@ -115,6 +122,8 @@ void TestSequentialSVD
         Herk( LOWER, ADJOINT, Real(-1), U, Real(1), E );
         const Real UOrthErr = HermitianMaxNorm( LOWER, E );
         Output("|| I - U^H U ||_max = ",UOrthErr);
+        if( UOrthErr > orthTol )
+            LogicError("U was not unitary to within ",orthTol);
     }
     if( wantV )
     {
@@ -122,6 +131,8 @@ void TestSequentialSVD
         Herk( LOWER, ADJOINT, Real(-1), V, Real(1), E );
         const Real VOrthErr = HermitianMaxNorm( LOWER, E );
         Output("|| I - V^H V ||_max = ",VOrthErr);
+        if( VOrthErr > orthTol )
+            LogicError("V was not unitary to within ",orthTol);
     }
 
     // Compute the residual error
@@ -141,7 +152,6 @@ void TestSequentialSVD
             Print( E, "A - U S V'" );
         const Real maxNormE = MaxNorm( E );
         const Real frobNormE = FrobeniusNorm( E );
-        const Real eps = limits::Epsilon<Real>();
         const Real scaledResidual = frobNormE / (Max(m,n)*eps*twoNormA);
         Output("||A - U Sigma V^H||_max = ",maxNormE);
         Output("||A - U Sigma V^H||_F   = ",frobNormE);
@@ -166,8 +176,10 @@ void TestDistributedSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool useQDWH,
   bool penalizeDerivative,
   Int divideCutoff,
+  Int sdcCutoff,
   bool print )
 {
     typedef Base<F> Real;
@@ -189,6 +201,8 @@ void TestDistributedSVD
     // Compute the SVD of A 
     SVDCtrl<Real> ctrl;
     ctrl.bidiagSVDCtrl.useQR = useQR;
+    ctrl.useQDWH = useQDWH;
+    ctrl.sdcCtrl.cutoff = sdcCutoff;
     ctrl.bidiagSVDCtrl.wantU = wantU; 
     ctrl.bidiagSVDCtrl.wantV = wantV;
     ctrl.bidiagSVDCtrl.approach = approach;
@@ -274,6 +288,9 @@ void TestDistributedSVD
     }
 
     // Check that U and V are unitary
+    const Real eps = limits::Epsilon<Real>();
+    // TODO(poulson): Provide a rigorous motivation for this bound
+    const Real orthTol = Real(50)*Max(m,n)*eps;
     DistMatrix<F> E(grid);
     if( wantU )
     {
@@ -282,6 +299,8 @@ void TestDistributedSVD
         const Real UOrthErr = HermitianMaxNorm( LOWER, E );
         if( commRank == 0 )
             Output("|| I - U^H U ||_max = ",UOrthErr);
+        if( UOrthErr > orthTol )
+            LogicError("U was not unitary to within ",orthTol);
     }
     if( wantV )
     {
@@ -290,6 +309,8 @@ void TestDistributedSVD
         const Real VOrthErr = HermitianMaxNorm( LOWER, E );
         if( commRank == 0 )
             Output("|| I - V^H V ||_max = ",VOrthErr);
+        if( VOrthErr > orthTol )
+            LogicError("V was not unitary to within ",orthTol);
     }
 
     // Compute the residual error
@@ -312,7 +333,6 @@ void TestDistributedSVD
             Print( E, "A - U S V'" );
         const Real maxNormE = MaxNorm( E );
         const Real frobNormE = FrobeniusNorm( E );
-        const Real eps = limits::Epsilon<Real>();
         const Real scaledResidual = frobNormE / (Max(m,n)*eps*twoNormA);
         if( commRank == 0 )
         {
@@ -344,8 +364,10 @@ void TestSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool useQDWH,
   bool penalizeDerivative,
   Int divideCutoff,
+  Int sdcCutoff,
   bool print )
 {
     const int commRank = mpi::Rank();
@@ -353,13 +375,15 @@ void TestSVD
     {
         TestSequentialSVD<F>
         ( m, n, rank, approach, tolType, tol, time, progress, wantU, wantV,
-          useQR, penalizeDerivative, divideCutoff, print );
+          useQR, useQDWH, penalizeDerivative, divideCutoff, sdcCutoff,
+          print );
     }
     if( testDist )
     {
         TestDistributedSVD<F> 
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+          wantU, wantV, useQR, useQDWH, penalizeDerivative, divideCutoff,
+          sdcCutoff, print );
     }
 }
 
@@ -394,10 +418,13 @@ main( int argc, char* argv[] )
         const bool wantU = Input("--wantU","compute U?",true);
         const bool wantV = Input("--wantV","compute V?",true);
         const bool useQR = Input("--useQR","force use of QR algorithm?",false);
+        const bool useQDWH = Input("--useQDWH","use QDWH-SVD?",false);
         const bool penalizeDerivative =
           Input
           ("--penalizeDerivative","penalize secular derivative in D&C?",false);
         const Int divideCutoff = Input("--divideCutoff","D&C cutoff?",60);
+        const Int sdcCutoff =
+          Input("--sdcCutoff","QDWH-eig spectral D&C cutoff",32);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -421,63 +448,80 @@ main( int argc, char* argv[] )
 
         TestSVD<float>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
         TestSVD<Complex<float>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
 
         TestSVD<double>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
         TestSVD<Complex<double>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
 
 #ifdef EL_HAVE_QD
         TestSVD<DoubleDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
         TestSVD<Complex<DoubleDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
 
         TestSVD<QuadDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
         TestSVD<Complex<QuadDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestSVD<Quad>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
         TestSVD<Complex<Quad>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestSVD<BigFloat>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
         TestSVD<Complex<BigFloat>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, useQDWH,
+          penalizeDerivative, divideCutoff, sdcCutoff, print );
 #endif
+
+        // Also run QDWH-SVD on a full-rank matrix whose width exceeds the
+        // cutoff so that its QDWH-eig stage splits the spectrum at least once
+        if( !useQDWH )
+        {
+            const Int fullRank = Min( m, n );
+            if( mpi::Rank() == 0 )
+                Output("Testing QDWH-SVD with rank ",fullRank);
+            TestSVD<double>
+            ( m, n, fullRank, THIN_SVD, tolType, tol, time, progress,
+              scalapack, testSeq, testDist, wantU, wantV, useQR, true,
+              penalizeDerivative, divideCutoff, sdcCutoff, print );
+            TestSVD<Complex<double>>
+            ( m, n, fullRank, THIN_SVD, tolType, tol, time, progress,
+              scalapack, testSeq, testDist, wantU, wantV, useQR, true,
+              penalizeDerivative, divideCutoff, sdcCutoff, print );
+        }
     }
     catch( exception& e ) { ReportException(e); }
 
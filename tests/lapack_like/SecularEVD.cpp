@@ -166,6 +166,20 @@ void TestSecularHelper
      measMinCubicFails,"/",measMaxCubicFails,"/",measTotalCubicFails);
     Output("");
 
+    // The batched solver should reproduce the individual solutions
+    Matrix<Real> wBatch, dMinusShifts;
+    timer.Start();
+    auto batchInfo =
+      SecularEigenvalues( d, rho, z, wBatch, dMinusShifts, ctrl );
+    Output("Batched secular: ",timer.Stop()," seconds");
+    Output("Iterations [total]: ",batchInfo.numIterations);
+    wBatch -= w;
+    const Real batchDiff = MaxNorm( wBatch );
+    Output("|| wBatch - w ||_max = ",batchDiff);
+    if( batchDiff != Real(0) || batchInfo.numIterations != measTotalIter )
+        LogicError("Batched secular solutions did not match");
+    Output("");
+
     // Now compute the eigenvalues and vectors. We recompute the eigenvalues
     // to avoid interfering with the timing experiment above.
     Matrix<Real> Q;
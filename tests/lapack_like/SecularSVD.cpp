@@ -178,6 +178,21 @@ void TestSecularHelper
      measMinCubicFails,"/",measMaxCubicFails,"/",measTotalCubicFails);
     Output("");
 
+    // The batched solver should reproduce the individual solutions
+    Matrix<Real> sBatch, dMinusShifts, dPlusShifts;
+    timer.Start();
+    auto batchInfo =
+      SecularSingularValues
+      ( d, rho, z, sBatch, dMinusShifts, dPlusShifts, ctrl );
+    Output("Batched secular: ",timer.Stop()," seconds");
+    Output("Iterations [total]: ",batchInfo.numIterations);
+    sBatch -= s;
+    const Real batchDiff = MaxNorm( sBatch );
+    Output("|| sBatch - s ||_max = ",batchDiff);
+    if( batchDiff != Real(0) || batchInfo.numIterations != measTotalIter )
+        LogicError("Batched secular solutions did not match");
+    Output("");
+
     // Now compute the singular values and vectors. We recompute the singular
     // values to avoid interfering with the timing experiment above.
     Matrix<Real> U, V;
@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestBLR
+( Int n1,
+  Int n2,
+  Int n3,
+  Int minSize,
+  Int tileSize,
+  Int maxRefineIts,
+  const BisectCtrl& ctrl,
+  const El::Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    typedef Base<Field> Real;
+
+    const int N = n1*n2*n3;
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    DistMultiVec<Field> x( N, 1, grid ), b( N, 1, grid );
+    MakeUniform( x );
+    Zero( b );
+    Multiply( NORMAL, Field(1), A, x, Field(0), b );
+    const Real xNorm = FrobeniusNorm( x );
+
+    const bool hermitian = false;
+    Timer timer;
+
+    // Form a dense factorization as a reference
+    DistSparseLDLFactorization<Field> denseFact;
+    denseFact.Initialize( A, hermitian, ctrl );
+    denseFact.Factor( LDL_2D );
+    const Int numDenseEntries =
+      mpi::AllReduce( denseFact.Front().NumLocalEntries(), grid.Comm() );
+
+    BLRCtrl<Real> blrCtrl;
+    blrCtrl.minSize = minSize;
+    blrCtrl.tileSize = tileSize;
+    DistSparseLDLFactorization<Field> blrFact;
+    blrFact.SetBLRCtrl( blrCtrl );
+    blrFact.Initialize( A, hermitian, ctrl );
+    OutputFromRoot(grid.Comm(),"Running BLR LDL^T...");
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    blrFact.Factor( LDL_BLR_2D );
+    mpi::Barrier( grid.Comm() );
+    timer.Stop();
+    OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
+    const Int numBLREntries =
+      mpi::AllReduce( blrFact.Front().NumLocalEntries(), grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),"Dense factor entries: ",numDenseEntries,
+     ", BLR factor entries: ",numBLREntries);
+
+    // Since the BLR factorization is approximate, use it to precondition
+    // iterative refinement
+    DistMultiVec<Field> y( b ), r( b ), dy( grid );
+    blrFact.Solve( y );
+    Real relError = 0;
+    for( Int refineIt=0; refineIt<=maxRefineIts; ++refineIt )
+    {
+        DistMultiVec<Field> e( y );
+        e -= x;
+        relError = FrobeniusNorm( e ) / xNorm;
+        OutputFromRoot
+        (grid.Comm(),"After ",refineIt," refinements, ",
+         "|| x - y ||_2 / || x ||_2 = ",relError);
+        if( refineIt == maxRefineIts )
+            break;
+
+        r = b;
+        Multiply( NORMAL, Field(-1), A, y, Field(1), r );
+        dy = r;
+        blrFact.Solve( dy );
+        y += dy;
+    }
+    if( relError > Pow(limits::Epsilon<Real>(),Real(0.5)) )
+        LogicError("BLR-preconditioned refinement did not converge");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",20);
+        const Int n3 = Input("--n3","third grid dimension",20);
+        const Int minSize = Input("--minSize","minimum BLR front size",64);
+        const Int tileSize = Input("--tileSize","BLR tile size",32);
+        const Int maxRefineIts =
+          Input("--maxRefineIts","max refinement iterations",10);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        ProcessInput();
+
+        BisectCtrl ctrl;
+        ctrl.cutoff = cutoff;
+
+        const El::Grid grid( comm );
+        TestBLR<double>
+        ( n1, n2, n3, minSize, tileSize, maxRefineIts, ctrl, grid );
+        TestBLR<Complex<double>>
+        ( n1, n2, n3, minSize, tileSize, maxRefineIts, ctrl, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
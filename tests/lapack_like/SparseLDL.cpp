@@ -31,6 +31,7 @@ void TestSparseDirect
   Int n2,
   Int n3,
   Int numRHS,
+  Int solveBlockWidth,
   bool solve2d,
   bool selInv,
   bool intraPiv,
@@ -47,6 +48,9 @@ void TestSparseDirect
     OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
 
     const int N = n1*n2*n3;
+    // The negative Laplacian is well-conditioned for the default grid sizes
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 100*Sqrt(Real(N))*eps;
     DistSparseMatrix<Field> A(grid);
     Laplacian( A, n1, n2, n3 );
     A *= -Field(1);
@@ -184,6 +188,7 @@ void TestSparseDirect
 
     OutputFromRoot(grid.Comm(),"Solving against Y...");
     SetBlocksize( nbSolve );
+    sparseLDLFact.SetSolveBlockWidth( solveBlockWidth );
     mpi::Barrier( grid.Comm() );
     timer.Start();
     sparseLDLFact.Solve( Y );
@@ -208,6 +213,111 @@ void TestSparseDirect
          "|| x     ||_2 = ",XNorms.Get(j,0),"\n",Indent(),
          "|| error ||_2 = ",errorNorms.Get(j,0),"\n",Indent(),
          "|| A x   ||_2 = ",YOrigNorms.Get(j,0),"\n");
+    const Real solveError = FrobeniusNorm( Y ) / FrobeniusNorm( X );
+    if( solveError > tol )
+        LogicError("Solve was inaccurate");
+
+    // Repeat the solve with an explicit block width smaller than the number
+    // of right-hand sides so that the blocked path is always exercised
+    if( numRHS > 1 )
+    {
+        const Int blockWidth = numRHS / 2;
+        OutputFromRoot
+        (grid.Comm(),"Solving against Y in blocks of ",blockWidth,
+         " right-hand sides...");
+        Zero( Y );
+        Multiply( NORMAL, Field(1), A, X, Field(0), Y );
+        sparseLDLFact.SetSolveBlockWidth( blockWidth );
+        sparseLDLFact.Solve( Y );
+        sparseLDLFact.SetSolveBlockWidth( solveBlockWidth );
+        Y -= X;
+        const Real blockedError = FrobeniusNorm( Y ) / FrobeniusNorm( X );
+        OutputFromRoot
+        (grid.Comm(),"|| X_blocked - X ||_F / || X ||_F = ",blockedError);
+        if( blockedError > tol )
+            LogicError("Blocked solve was inaccurate");
+    }
+
+    if( intraPiv )
+        return;
+    OutputFromRoot(grid.Comm(),"Forming the selected inverse...");
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    DistSparseMatrix<Field> selInvA(grid);
+    SelectedInverse( sparseLDLFact, selInvA );
+    mpi::Barrier( grid.Comm() );
+    timer.Stop();
+    OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
+
+    // Compare the first few columns of the selected inverse against the
+    // corresponding columns of the inverse computed via solves
+    DistMultiVec<Field> Z( N, numRHS, grid );
+    Zero( Z );
+    for( Int j=0; j<numRHS; ++j )
+        Z.Set( j, j, Field(1) );
+    sparseLDLFact.Solve( Z );
+    Real localSelInvError = 0;
+    const Int firstLocalRow = selInvA.FirstLocalRow();
+    const Int numLocalEntries = selInvA.NumLocalEntries();
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int i = selInvA.Row(e);
+        const Int j = selInvA.Col(e);
+        if( j < numRHS )
+            localSelInvError =
+              Max( localSelInvError,
+                   Abs(selInvA.Value(e)-Z.GetLocal(i-firstLocalRow,j)) );
+    }
+    const Real selInvError =
+      mpi::AllReduce( localSelInvError, mpi::MAX, grid.Comm() );
+    const Real maxInvEntry = MaxNorm( Z );
+    OutputFromRoot
+    (grid.Comm(),"max | (selInv(A) - inv(A))(i,j) | = ",selInvError,
+     " (max | inv(A)(i,j) | = ",maxInvEntry,")");
+    if( selInvError > tol*maxInvEntry )
+        LogicError("Selected inverse was inaccurate");
+
+    // Repeat the solves with a sparse right-hand side, and then again while
+    // only requesting the last few rows of the solution
+    DistSparseMatrix<Field> E(grid);
+    Zeros( E, N, numRHS );
+    if( grid.Rank() == 0 )
+    {
+        E.Reserve( numRHS, numRHS );
+        for( Int j=0; j<numRHS; ++j )
+            E.QueueUpdate( j, j, Field(1) );
+    }
+    E.ProcessQueues();
+    vector<Int> outputRows;
+    for( Int i=N-numRHS; i<N; ++i )
+        outputRows.push_back( i );
+    DistMultiVec<Field> XSparse(grid), XPruned(grid);
+    sparseLDLFact.Solve( E, XSparse );
+    sparseLDLFact.Solve( E, outputRows, XPruned );
+    XSparse -= Z;
+    const Real sparseError = FrobeniusNorm( XSparse ) / FrobeniusNorm( Z );
+    Real localPrunedError = 0;
+    const Int localHeight = XPruned.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = XPruned.GlobalRow(iLoc);
+        for( Int j=0; j<numRHS; ++j )
+        {
+            const Field expected = ( i >= N-numRHS ? Z.GetLocal(iLoc,j) : 0 );
+            localPrunedError =
+              Max( localPrunedError, Abs(XPruned.GetLocal(iLoc,j)-expected) );
+        }
+    }
+    const Real prunedError =
+      mpi::AllReduce( localPrunedError, mpi::MAX, grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),
+     "|| X_sparse - X ||_F / || X ||_F = ",sparseError,"\n",Indent(),
+     "max | (X_pruned - X)(i,j) | = ",prunedError);
+    if( sparseError > tol )
+        LogicError("Solve with a sparse right-hand side was inaccurate");
+    if( prunedError > tol*maxInvEntry )
+        LogicError("Pruned solve was inaccurate");
 }
 
 int main( int argc, char* argv[] )
@@ -221,6 +331,8 @@ int main( int argc, char* argv[] )
         const Int n2 = Input("--n2","second grid dimension",15);
         const Int n3 = Input("--n3","third grid dimension",10);
         const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int solveBlockWidth = Input
+            ("--solveBlockWidth","max right-hand sides per solve (0=auto)",0);
         const bool solve2d = Input("--solve2d","use 2d solve?",false);
         const bool selInv = Input("--selInv","selectively invert?",false);
         const bool intraPiv = Input("--intraPiv","pivot within fronts?",false);
@@ -254,29 +366,29 @@ int main( int argc, char* argv[] )
         // TODO(poulson): Call complex variants as well
 
         TestSparseDirect<float>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solveBlockWidth, solve2d, selInv, intraPiv,
+          nbFact, nbSolve, natural, unpack, print, display, ctrl, grid );
         TestSparseDirect<double>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solveBlockWidth, solve2d, selInv, intraPiv,
+          nbFact, nbSolve, natural, unpack, print, display, ctrl, grid );
 #ifdef EL_HAVE_QD
         TestSparseDirect<DoubleDouble>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solveBlockWidth, solve2d, selInv, intraPiv,
+          nbFact, nbSolve, natural, unpack, print, display, ctrl, grid );
         TestSparseDirect<QuadDouble>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solveBlockWidth, solve2d, selInv, intraPiv,
+          nbFact, nbSolve, natural, unpack, print, display, ctrl, grid );
 #endif
 #ifdef EL_HAVE_QUAD
         TestSparseDirect<Quad>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solveBlockWidth, solve2d, selInv, intraPiv,
+          nbFact, nbSolve, natural, unpack, print, display, ctrl, grid );
 #endif
 #ifdef EL_HAVE_MPC
         mpfr::SetPrecision( prec );
         TestSparseDirect<BigFloat>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solveBlockWidth, solve2d, selInv, intraPiv,
+          nbFact, nbSolve, natural, unpack, print, display, ctrl, grid );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
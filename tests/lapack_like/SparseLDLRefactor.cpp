@@ -105,6 +105,40 @@ void TestSparseDirect
 
         // TODO(poulson): Check residual error
     }
+
+    // Re-initializing with a matrix with the same sparsity pattern should
+    // reuse the reordering and symbolic analysis
+    A *= 2;
+    OutputFromRoot(grid.Comm(),"Re-initializing with the same pattern...");
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
+    sparseLDLFact.Initialize( A, hermitian, ctrl );
+    mpi::Barrier( grid.Comm() );
+    timer.Stop();
+    OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
+    if( sparseLDLFact.NodeInfo().size != rootSepSize )
+        LogicError("The root separator changed upon re-initialization");
+
+    if( intraPiv )
+        sparseLDLFact.Factor( LDL_INTRAPIV_1D );
+    else
+        sparseLDLFact.Factor( LDL_1D );
+    DistMultiVec<Field> x( N, 1, grid ), y( N, 1, grid );
+    MakeUniform( x );
+    Zero( y );
+    Multiply( NORMAL, Field(1), A, x, Field(0), y );
+    sparseLDLFact.Solve( y );
+    y -= x;
+    typedef Base<Field> Real;
+    const Real relError = FrobeniusNorm( y ) / FrobeniusNorm( x );
+    OutputFromRoot
+    (grid.Comm(),"|| x - inv(A) A x ||_2 / || x ||_2 = ",relError);
+    // The condition number of the Laplacian grows quadratically with the
+    // largest grid dimension
+    const Real eps = limits::Epsilon<Real>();
+    const Real maxDim = Max( Max(n1,n2), n3 ) + 1;
+    if( relError > 10*maxDim*maxDim*eps )
+        LogicError("Relative error was unacceptably large");
 }
 
 int main( int argc, char* argv[] )
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestCorrectness
+( const DistSparseMatrix<Field>& A,
+  const AbstractDistMatrix<Base<Field>>& w,
+  const DistMultiVec<Field>& X,
+  const HermitianEigSubset<Base<Field>>& subset,
+        Base<Field> tol,
+        bool print )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = X.Grid();
+    const Int n = X.Height();
+    const Int numEigs = X.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( A );
+    if( print )
+        Print( w, "w" );
+
+    // Ensure that the eigenvalues lie in the window (up to the tolerance)
+    DistMatrix<Real,STAR,STAR> wStar( w );
+    for( Int j=0; j<numEigs; ++j )
+    {
+        const Real lambda = wStar.GetLocal(j,0);
+        if( lambda <= subset.lowerBound - tol*oneNormA ||
+            lambda > subset.upperBound + tol*oneNormA )
+            LogicError("Eigenvalue ",lambda," was outside of the window");
+    }
+
+    // Form I - X^H X
+    DistMatrix<Field> XMat(grid), Z(grid);
+    Copy( X, XMat );
+    Identity( Z, numEigs, numEigs );
+    Herk( UPPER, ADJOINT, Real(-1), XMat, Real(1), Z );
+    const Real orthogError = HermitianOneNorm( UPPER, Z );
+    const Real relOrthogError = orthogError / (eps*n);
+    OutputFromRoot
+    (grid.Comm(),"||X^H X - I||_1 / (eps n) = ",relOrthogError);
+
+    // Form A X - X diag(w)
+    DistMultiVec<Field> AX(grid);
+    Zeros( AX, n, numEigs );
+    Multiply( NORMAL, Field(1), A, X, Field(0), AX );
+    DistMatrix<Field> E(grid);
+    Copy( AX, E );
+    DiagonalScale( RIGHT, NORMAL, w, XMat );
+    E -= XMat;
+    const Real error = FrobeniusNorm( E );
+    const Real relError = error / (tol*oneNormA);
+    OutputFromRoot
+    (grid.Comm(),"||A X - X diag(w)||_F / (tol ||A||_1) = ",relError);
+
+    if( relOrthogError > Real(1)/(tol*n) )
+        LogicError("Unacceptably large relative orthogonality error");
+    if( relError > Real(10)*Sqrt(Real(numEigs)) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename Field>
+void TestSpectrumSlice
+( const Grid& grid,
+  Int n0,
+  Int n1,
+  double lowerRatio,
+  double upperRatio,
+  Int numTeams,
+  Int maxEigsPerSlice,
+  bool correctness,
+  bool print,
+  bool progress )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n0, n1 );
+    const Real maxNormA = MaxNorm( A );
+
+    SpectrumSliceCtrl<Real> ctrl;
+    ctrl.subset.rangeSubset = true;
+    ctrl.subset.lowerBound = Real(lowerRatio)*maxNormA;
+    ctrl.subset.upperBound = Real(upperRatio)*maxNormA;
+    ctrl.numTeams = numTeams;
+    ctrl.maxEigsPerSlice = maxEigsPerSlice;
+    ctrl.krylovCtrl.tol = Pow(limits::Epsilon<Real>(),Real(2)/Real(3));
+    ctrl.krylovCtrl.progress = progress;
+    ctrl.progress = progress;
+
+    DistMultiVec<Field> X(grid);
+    DistMatrix<Real,STAR,STAR> w(grid);
+    OutputFromRoot
+    (grid.Comm(),"Spectrum slicing over (",ctrl.subset.lowerBound,",",
+     ctrl.subset.upperBound,"]...");
+    mpi::Barrier( grid.Comm() );
+    Timer timer;
+    timer.Start();
+    auto info = HermitianEig( A, w, X, ctrl );
+    mpi::Barrier( grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),timer.Stop()," seconds, ",info.numSlices," slices, ",
+     info.numFactorizations," factorizations, found ",info.numFound," of ",
+     info.numEigs," eigenpairs");
+    if( !info.converged )
+        LogicError("Spectrum slicing did not find every eigenpair");
+    if( correctness )
+        TestCorrectness( A, w, X, ctrl.subset, ctrl.krylovCtrl.tol, print );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n0 = Input("--n0","first grid dimension",30);
+        const Int n1 = Input("--n1","second grid dimension",29);
+        const double lowerRatio =
+          Input("--lowerRatio","lower bound relative to max norm",0.3);
+        const double upperRatio =
+          Input("--upperRatio","upper bound relative to max norm",0.36);
+        const Int numTeams = Input("--numTeams","number of teams",0);
+        const Int maxEigsPerSlice =
+          Input("--maxEigsPerSlice","max eigenvalues per slice",10);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
+        const Grid grid( comm, gridHeight, order );
+        ComplainIfDebug();
+
+        TestSpectrumSlice<double>
+        ( grid, n0, n1, lowerRatio, upperRatio, numTeams, maxEigsPerSlice,
+          correctness, print, progress );
+        TestSpectrumSlice<Complex<double>>
+        ( grid, n0, n1, lowerRatio, upperRatio, numTeams, maxEigsPerSlice,
+          correctness, print, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}